@@ -74,6 +74,11 @@ static const char* const ACCOUNT_NONCE = "nonce";
 static const char* const ACCOUNT_ALIVE = "alive";
 static const char* const ACCOUNT_FROZEN = "frozen";
 
+/// total bytes of contract code kept in the executor code cache unless configured
+static const size_t DEFAULT_CODE_CACHE_CAPACITY = 64 * 1024 * 1024;
+/// idle temp storages kept for the static calls
+static const size_t CALL_STORAGE_POOL_SIZE = 64;
+
 /// auth
 static const char* const CONTRACT_SUFFIX = "_accessAuth";
 static const char* const ADMIN_FIELD = "admin";
@@ -25,6 +25,7 @@
 #include "../vm/Precompiled.h"
 #include "TransactionExecutive.h"
 #include "bcos-codec/abi/ContractABICodec.h"
+#include "bcos-framework/interfaces/ledger/LedgerTypeDef.h"
 #include "bcos-framework/interfaces/protocol/Exceptions.h"
 #include "bcos-framework/interfaces/storage/StorageInterface.h"
 #include "bcos-framework/interfaces/storage/Table.h"
@@ -64,6 +65,30 @@ BlockContext::BlockContext(std::shared_ptr<storage::StateStorage> storage,
     m_lastStorage = std::move(_lastStorage);
 }
 
+uint32_t BlockContext::compatibilityVersion()
+{
+    std::call_once(m_compatibilityVersionFlag, [this]() {
+        if (!m_storage)
+        {
+            return;
+        }
+        auto table = m_storage->openTable(ledger::SYS_CONFIG);
+        auto entry =
+            table ? table->getRow(ledger::SYSTEM_KEY_COMPATIBILITY_VERSION) : std::nullopt;
+        if (!entry)
+        {
+            return;
+        }
+        auto [value, enableNumber] = entry->getObject<ledger::SystemConfigEntry>();
+        if (enableNumber > m_blockNumber)
+        {
+            return;
+        }
+        m_compatibilityVersion = boost::lexical_cast<uint32_t>(value);
+    });
+    return m_compatibilityVersion;
+}
+
 void BlockContext::insertExecutive(int64_t contextID, int64_t seq, ExecutiveState state)
 {
     auto it = m_executives.find(std::tuple{contextID, seq});
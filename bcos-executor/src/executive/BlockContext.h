@@ -22,6 +22,7 @@
 #pragma once
 
 #include "../Common.h"
+#include "../precompiled/extension/AuthPolicyCache.h"
 #include "bcos-framework/interfaces/executor/ExecutionMessage.h"
 #include "bcos-framework/interfaces/protocol/Block.h"
 #include "bcos-framework/interfaces/protocol/ProtocolTypeDef.h"
@@ -32,6 +33,7 @@
 #include <atomic>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <stack>
 #include <string_view>
 
@@ -81,6 +83,12 @@ public:
 
     VMSchedule const& vmSchedule() const { return m_schedule; }
 
+    precompiled::AuthPolicyCache& authPolicyCache() { return m_authPolicyCache; }
+
+    // the compatibility version enabled for this block, read from SYS_CONFIG once by the first
+    // call, a new version set in this block only takes effect from the next block
+    uint32_t compatibilityVersion();
+
     struct ExecutiveState
     {
         std::shared_ptr<TransactionExecutive> executive;
@@ -123,6 +131,9 @@ private:
     std::shared_ptr<storage::StateStorage> m_storage;
     bcos::storage::StorageInterface::Ptr m_lastStorage = nullptr;
     crypto::Hash::Ptr m_hashImpl;
+    precompiled::AuthPolicyCache m_authPolicyCache;
+    std::once_flag m_compatibilityVersionFlag;
+    uint32_t m_compatibilityVersion = 0;
 };
 
 }  // namespace executor
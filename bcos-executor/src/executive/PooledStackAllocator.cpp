@@ -0,0 +1,107 @@
+/*
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief fixed size coroutine stacks with guard page, recycled per thread
+ * @file PooledStackAllocator.cpp
+ */
+
+#include "PooledStackAllocator.h"
+#include <sys/mman.h>
+#include <algorithm>
+#include <new>
+#include <vector>
+
+using namespace bcos::executor;
+
+namespace
+{
+using boost::context::stack_context;
+using boost::context::stack_traits;
+
+// free stacks released by the thread, unmapped when the thread exits
+struct StackPool
+{
+    ~StackPool()
+    {
+        for (auto& sctx : stacks)
+        {
+            ::munmap(static_cast<char*>(sctx.sp) - sctx.size, sctx.size);
+        }
+    }
+
+    std::vector<stack_context> stacks;
+};
+
+thread_local StackPool t_stackPool;
+}  // namespace
+
+PooledStackAllocator::PooledStackAllocator(size_t _stackSize)
+{
+    auto pageSize = stack_traits::page_size();
+    auto stackSize = std::max(_stackSize, stack_traits::minimum_size());
+    m_stackSize = (stackSize + pageSize - 1) / pageSize * pageSize;
+}
+
+stack_context PooledStackAllocator::allocate()
+{
+    // the guard page is part of the mapping
+    auto mappedSize = m_stackSize + stack_traits::page_size();
+
+    auto& stacks = t_stackPool.stacks;
+    auto it = std::find_if(stacks.rbegin(), stacks.rend(),
+        [mappedSize](const stack_context& sctx) { return sctx.size == mappedSize; });
+    if (it != stacks.rend())
+    {
+        auto sctx = *it;
+        stacks.erase(std::next(it).base());
+        return sctx;
+    }
+
+    auto vp = ::mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS,
+        -1, 0);
+    if (vp == MAP_FAILED)
+    {
+        throw std::bad_alloc();
+    }
+    // an unguarded stack would overflow into the memory below silently, fail the allocation like
+    // mmap does, mprotect fails with ENOMEM when the mapping count limit is reached
+    if (::mprotect(vp, stack_traits::page_size(), PROT_NONE) != 0)
+    {
+        ::munmap(vp, mappedSize);
+        throw std::bad_alloc();
+    }
+
+    stack_context sctx;
+    sctx.size = mappedSize;
+    sctx.sp = static_cast<char*>(vp) + sctx.size;
+    return sctx;
+}
+
+void PooledStackAllocator::deallocate(stack_context& _sctx) noexcept
+{
+    auto& stacks = t_stackPool.stacks;
+    if (stacks.size() < MAX_POOLED_STACKS)
+    {
+        stacks.push_back(_sctx);
+        return;
+    }
+
+    ::munmap(static_cast<char*>(_sctx.sp) - _sctx.size, _sctx.size);
+}
+
+size_t PooledStackAllocator::pooledStacks()
+{
+    return t_stackPool.stacks.size();
+}
@@ -0,0 +1,53 @@
+/*
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief fixed size coroutine stacks with guard page, recycled per thread
+ * @file PooledStackAllocator.h
+ */
+
+#pragma once
+
+#include <boost/context/stack_context.hpp>
+#include <boost/context/stack_traits.hpp>
+#include <cstddef>
+
+namespace bcos::executor
+{
+/// StackAllocator of boost.context, every stack is mmapped with a PROT_NONE guard page below it
+/// like protected_fixedsize_stack, but released stacks are kept in a free list of the releasing
+/// thread and handed out again instead of being unmapped
+class PooledStackAllocator
+{
+public:
+    // the max number of free stacks kept by one thread
+    constexpr static size_t MAX_POOLED_STACKS = 64;
+
+    explicit PooledStackAllocator(
+        size_t _stackSize = boost::context::stack_traits::default_size());
+
+    // throw std::bad_alloc if the stack or its guard page can not be mapped
+    boost::context::stack_context allocate();
+    void deallocate(boost::context::stack_context& _sctx) noexcept;
+
+    // usable size of the stacks, rounded up to whole pages
+    size_t stackSize() const { return m_stackSize; }
+
+    // number of free stacks pooled by the calling thread
+    static size_t pooledStacks();
+
+private:
+    size_t m_stackSize;
+};
+}  // namespace bcos::executor
@@ -78,6 +78,16 @@ public:
         return std::move(entry);
     }
 
+    // Read the value of a row without constructing an Entry, visitor receives a view of the
+    // value which is only valid during the call. Return false if the row does not exist
+    template <class Visitor>
+    bool getRowValue(const std::string_view& table, const std::string_view& key, Visitor&& visitor)
+    {
+        acquireKeyLock(key);
+
+        return m_storage->getRowValue(table, key, std::forward<Visitor>(visitor));
+    }
+
     std::vector<std::optional<storage::Entry>> getRows(
         const std::string_view& table, const std::variant<const gsl::span<std::string_view const>,
                                            const gsl::span<std::string const>>& _keys)
@@ -124,6 +134,14 @@ public:
         }
     }
 
+    void setRowValue(
+        const std::string_view& table, const std::string_view& key, const std::string_view& value)
+    {
+        acquireKeyLock(key);
+
+        m_storage->setRowValue(table, key, value);
+    }
+
     std::optional<storage::Table> createTable(std::string _tableName, std::string _valueFields)
     {
         auto ret = createTableWithoutException(_tableName, _valueFields);
@@ -56,49 +56,54 @@ using errinfo_evmcStatusCode = boost::error_info<struct tag_evmcStatusCode, evmc
 
 CallParameters::UniquePtr TransactionExecutive::start(CallParameters::UniquePtr input)
 {
-    m_pullMessage.emplace([this, inputPtr = input.release()](Coroutine::push_type& push) {
-        COROUTINE_TRACE_LOG(TRACE, m_contextID, m_seq) << "Create new coroutine";
+    m_pullMessage.emplace(PooledStackAllocator(m_coroutineStackSize),
+        [this, inputPtr = input.release()](Coroutine::push_type& push) {
+            COROUTINE_TRACE_LOG(TRACE, m_contextID, m_seq) << "Create new coroutine";
 
-        // Take ownership from input
-        m_pushMessage.emplace(std::move(push));
+            // Take ownership from input
+            m_pushMessage.emplace(std::move(push));
 
-        auto callParameters = std::unique_ptr<CallParameters>(inputPtr);
-        auto blockContext = m_blockContext.lock();
-        if (!blockContext)
-        {
-            BOOST_THROW_EXCEPTION(BCOS_ERROR(-1, "blockContext is null"));
-        }
+            auto callParameters = std::unique_ptr<CallParameters>(inputPtr);
+            auto blockContext = m_blockContext.lock();
+            if (!blockContext)
+            {
+                BOOST_THROW_EXCEPTION(BCOS_ERROR(-1, "blockContext is null"));
+            }
 
-        m_storageWrapper = std::make_unique<SyncStorageWrapper>(blockContext->storage(),
-            std::bind(&TransactionExecutive::externalAcquireKeyLocks, this, std::placeholders::_1),
-            m_recoder);
-        if (blockContext->lastStorage())
-        {
-            m_lastStorageWrapper = std::make_shared<SyncStorageWrapper>(
-                std::dynamic_pointer_cast<bcos::storage::StateStorage>(blockContext->lastStorage()),
-                std::bind(
-                    &TransactionExecutive::externalAcquireKeyLocks, this, std::placeholders::_1),
-                m_recoder);
-        }
+            initStorageWrapper(*blockContext);
 
-        if (!callParameters->keyLocks.empty())
-        {
-            m_storageWrapper->importExistsKeyLocks(callParameters->keyLocks);
-        }
+            if (!callParameters->keyLocks.empty())
+            {
+                m_storageWrapper->importExistsKeyLocks(callParameters->keyLocks);
+            }
 
-        m_exchangeMessage = execute(std::move(callParameters));
-        // Execute is finished, erase the key locks
-        m_exchangeMessage->keyLocks.clear();
+            m_exchangeMessage = execute(std::move(callParameters));
+            // Execute is finished, erase the key locks
+            m_exchangeMessage->keyLocks.clear();
 
-        // Return the ownership to input
-        push = std::move(*m_pushMessage);
+            // Return the ownership to input
+            push = std::move(*m_pushMessage);
 
-        COROUTINE_TRACE_LOG(TRACE, m_contextID, m_seq) << "Finish coroutine executing";
-    });
+            COROUTINE_TRACE_LOG(TRACE, m_contextID, m_seq) << "Finish coroutine executing";
+        });
 
     return dispatcher();
 }
 
+void TransactionExecutive::initStorageWrapper(BlockContext& blockContext)
+{
+    m_storageWrapper = std::make_unique<SyncStorageWrapper>(blockContext.storage(),
+        std::bind(&TransactionExecutive::externalAcquireKeyLocks, this, std::placeholders::_1),
+        m_recoder);
+    if (blockContext.lastStorage())
+    {
+        m_lastStorageWrapper = std::make_shared<SyncStorageWrapper>(
+            std::dynamic_pointer_cast<bcos::storage::StateStorage>(blockContext.lastStorage()),
+            std::bind(&TransactionExecutive::externalAcquireKeyLocks, this, std::placeholders::_1),
+            m_recoder);
+    }
+}
+
 CallParameters::UniquePtr TransactionExecutive::dispatcher()
 {
     try
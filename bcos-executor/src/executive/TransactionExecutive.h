@@ -24,7 +24,9 @@
 #include "../Common.h"
 #include "../executor/TransactionExecutor.h"
 #include "../precompiled/PrecompiledResult.h"
+#include "../vm/CodeCache.h"
 #include "BlockContext.h"
+#include "PooledStackAllocator.h"
 #include "SyncStorageWrapper.h"
 #include "bcos-framework/interfaces/executor/ExecutionMessage.h"
 #include "bcos-framework/interfaces/protocol/BlockHeader.h"
@@ -108,6 +110,9 @@ public:
     // External request key locks, throw exception if dead lock detected
     void externalAcquireKeyLocks(std::string acquireKeyLock);
 
+    // wrap the block state for the synchronous access, done by start() in the coroutine
+    void initStorageWrapper(BlockContext& blockContext);
+
     auto& storage()
     {
         assert(m_storageWrapper);
@@ -141,6 +146,11 @@ public:
 
     bool isBuiltInPrecompiled(const std::string& _a) const;
 
+    void setCodeCache(CodeCache::Ptr _codeCache) { m_codeCache = std::move(_codeCache); }
+    CodeCache::Ptr const& codeCache() const { return m_codeCache; }
+
+    void setCoroutineStackSize(size_t _stackSize) { m_coroutineStackSize = _stackSize; }
+
     bool isEthereumPrecompiled(const std::string& _a) const;
 
     std::pair<bool, bytes> executeOriginPrecompiled(const std::string& _a, bytesConstRef _in) const;
@@ -236,6 +246,8 @@ private:
     std::shared_ptr<const std::map<std::string, std::shared_ptr<PrecompiledContract>>>
         m_evmPrecompiled;
     std::shared_ptr<const std::set<std::string>> m_builtInPrecompiled;
+    CodeCache::Ptr m_codeCache;
+    size_t m_coroutineStackSize = boost::context::stack_traits::default_size();
 
     std::string m_contractAddress;
     int64_t m_contextID;
@@ -0,0 +1,99 @@
+/*
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief pool of the temp storages of the static calls
+ * @file CallStoragePool.h
+ */
+
+#pragma once
+#include "bcos-table/src/StateStorage.h"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace bcos
+{
+namespace executor
+{
+/// The writes of a static call are dropped, so every call executes on a temp StateStorage above
+/// the committed state. A call runs on one thread at a time, so the storages have one bucket, and
+/// they are reset and kept for the next calls when the call context is released
+class CallStoragePool : public std::enable_shared_from_this<CallStoragePool>
+{
+public:
+    using Ptr = std::shared_ptr<CallStoragePool>;
+
+    explicit CallStoragePool(size_t _maxIdle) : m_maxIdle(_maxIdle) {}
+
+    // the storage returns to the pool when the last reference is released
+    storage::StateStorage::Ptr acquire(storage::StorageInterface::Ptr _prev)
+    {
+        storage::StateStorage* storage = nullptr;
+        {
+            std::lock_guard<std::mutex> l(m_mutex);
+            if (!m_idle.empty())
+            {
+                storage = m_idle.back().release();
+                m_idle.pop_back();
+            }
+        }
+        if (storage)
+        {
+            storage->setPrev(std::move(_prev));
+            m_reused++;
+        }
+        else
+        {
+            storage = new storage::StateStorage(std::move(_prev), 1);
+        }
+        std::weak_ptr<CallStoragePool> pool = shared_from_this();
+        return storage::StateStorage::Ptr(storage, [pool](storage::StateStorage* _storage) {
+            auto self = pool.lock();
+            if (!self)
+            {
+                delete _storage;
+                return;
+            }
+            self->release(std::unique_ptr<storage::StateStorage>(_storage));
+        });
+    }
+
+    size_t idle() const
+    {
+        std::lock_guard<std::mutex> l(m_mutex);
+        return m_idle.size();
+    }
+    size_t reused() const { return m_reused; }
+
+private:
+    void release(std::unique_ptr<storage::StateStorage> _storage)
+    {
+        // drop the entries and the reference to the committed state out of the lock
+        _storage->reset(nullptr);
+        std::lock_guard<std::mutex> l(m_mutex);
+        if (m_idle.size() < m_maxIdle)
+        {
+            m_idle.emplace_back(std::move(_storage));
+        }
+    }
+
+    size_t m_maxIdle;
+    std::vector<std::unique_ptr<storage::StateStorage>> m_idle;
+    mutable std::mutex m_mutex;
+    std::atomic<size_t> m_reused = {0};
+};
+}  // namespace executor
+}  // namespace bcos
@@ -20,6 +20,7 @@
  */
 
 #include "TransactionExecutor.h"
+#include "CallStoragePool.h"
 #include "../Common.h"
 #include "../dag/Abi.h"
 #include "../dag/ClockCache.h"
@@ -40,6 +41,7 @@
 #include "../precompiled/Utilities.h"
 #include "../precompiled/extension/ContractAuthPrecompiled.h"
 #include "../precompiled/extension/DagTransferPrecompiled.h"
+#include "../vm/CodeCache.h"
 #include "../vm/Precompiled.h"
 #include "../vm/gas_meter/GasInjector.h"
 #include "bcos-codec/abi/ContractABIType.h"
@@ -47,6 +49,7 @@
 #include "bcos-framework/interfaces/executor/ExecutionMessage.h"
 #include "bcos-framework/interfaces/executor/PrecompiledTypeDef.h"
 #include "bcos-framework/interfaces/ledger/LedgerTypeDef.h"
+#include "bcos-framework/interfaces/metrics/Metrics.h"
 #include "bcos-framework/interfaces/protocol/ProtocolTypeDef.h"
 #include "bcos-framework/interfaces/protocol/TransactionReceipt.h"
 #include "bcos-framework/interfaces/storage/StorageInterface.h"
@@ -108,7 +111,11 @@ TransactionExecutor::TransactionExecutor(txpool::TxPoolInterface::Ptr txpool,
 
     GlobalHashImpl::g_hashImpl = m_hashImpl;
     m_abiCache = make_shared<ClockCache<bcos::bytes, FunctionAbi>>(32);
+    m_codeCache = std::make_shared<CodeCache>(DEFAULT_CODE_CACHE_CAPACITY,
+        m_cachedStorage ? storage::StorageInterface::Ptr(m_cachedStorage) : m_backendStorage);
+    m_callStoragePool = std::make_shared<CallStoragePool>(CALL_STORAGE_POOL_SIZE);
     m_gasInjector = std::make_shared<wasm::GasInjector>(wasm::GetInstructionTable());
+    m_txFetchWorker = std::make_shared<ThreadPool>("txFetch", 1);
 }
 
 void TransactionExecutor::nextBlockHeader(const bcos::protocol::BlockHeader::ConstPtr& blockHeader,
@@ -162,6 +169,9 @@ void TransactionExecutor::nextBlockHeader(const bcos::protocol::BlockHeader::Con
             m_blockContext = createBlockContext(blockHeader, stateStorage, lastStateStorage);
             m_stateStorages.emplace_back(blockHeader->number(), stateStorage);
         }
+        m_txFetchElapsed = 0;
+        m_txFetchBatches = 0;
+        m_txFetchCount = 0;
 
         EXECUTOR_LOG(INFO) << "NextBlockHeader success";
         callback(nullptr);
@@ -199,8 +209,8 @@ void TransactionExecutor::call(bcos::protocol::ExecutionMessage::UniquePtr input
             prev = m_backendStorage;
         }
 
-        // Create a temp storage
-        auto storage = std::make_shared<storage::StateStorage>(std::move(prev));
+        // Take a temp storage from the pool, it returns when the call context is released
+        auto storage = m_callStoragePool->acquire(std::move(prev));
 
         // Create a temp block context
         blockContext = createBlockContext(
@@ -318,6 +328,131 @@ void TransactionExecutor::executeTransaction(bcos::protocol::ExecutionMessage::U
         });
 }
 
+void TransactionExecutor::executeTransactions(std::string contractAddress,
+    gsl::span<bcos::protocol::ExecutionMessage::UniquePtr> inputs,
+    std::function<void(
+        bcos::Error::UniquePtr, std::vector<bcos::protocol::ExecutionMessage::UniquePtr>)>
+        callback)
+{
+    EXECUTOR_LOG(TRACE) << "ExecuteTransactions request" << LOG_KV("to", contractAddress)
+                        << LOG_KV("size", inputs.size());
+
+    if (!m_blockContext)
+    {
+        callback(BCOS_ERROR_UNIQUE_PTR(
+                     ExecuteError::EXECUTE_ERROR, "Execute failed with empty blockContext!"),
+            {});
+        return;
+    }
+
+    auto batch = std::make_shared<InOrderBatch>();
+    batch->inputs.reserve(inputs.size());
+    auto txHashes = std::make_shared<bcos::crypto::HashList>();
+    for (auto& input : inputs)
+    {
+        if (input->type() == bcos::protocol::ExecutionMessage::TXHASH)
+        {
+            txHashes->emplace_back(input->transactionHash());
+        }
+        batch->inputs.emplace_back(std::move(input));
+    }
+    batch->outputs.reserve(batch->inputs.size());
+    batch->callback = std::move(callback);
+
+    if (txHashes->empty())
+    {
+        executeBatchInOrder(m_blockContext, std::move(batch));
+        return;
+    }
+
+    // Fetch the transactions of the whole batch at once before executing in order
+    auto startT = utcTime();
+    auto txCount = txHashes->size();
+    m_txpool->asyncFillBlock(std::move(txHashes),
+        [this, blockContext = m_blockContext, batch, startT, txCount](
+            Error::Ptr error, bcos::protocol::TransactionsPtr transactions) {
+            m_txFetchElapsed += (utcTime() - startT);
+            ++m_txFetchBatches;
+            m_txFetchCount += txCount;
+
+            if (error || !transactions || transactions->size() != txCount)
+            {
+                // the messages fetch their transactions one by one, only the messages whose
+                // transactions are missing fail
+                EXECUTOR_LOG(WARNING) << "ExecuteTransactions fetch transactions failed"
+                                      << LOG_KV("size", txCount)
+                                      << LOG_KV("message", error ? error->errorMessage() : "");
+                transactions = nullptr;
+            }
+            batch->transactions = std::move(transactions);
+            executeBatchInOrder(blockContext, batch);
+        });
+}
+
+void TransactionExecutor::executeBatchInOrder(
+    std::shared_ptr<BlockContext> blockContext, std::shared_ptr<InOrderBatch> batch)
+{
+    // results called back inside asyncExecute continue this loop instead of recursing, so a long
+    // batch doesn't overflow the stack
+    while (true)
+    {
+        auto index = batch->outputs.size();
+        if (index == batch->inputs.size())
+        {
+            batch->callback(nullptr, std::move(batch->outputs));
+            return;
+        }
+
+        auto& input = batch->inputs[index];
+        appendKeyLocks(*input, batch->lockedKeys);
+        batch->stage = 0;
+        auto onResult = [this, blockContext, batch](Error::UniquePtr&& error,
+                            bcos::protocol::ExecutionMessage::UniquePtr&& output) {
+            if (error || !output)
+            {
+                std::string errorMessage = "ExecuteTransactions failed";
+                EXECUTOR_LOG(ERROR) << errorMessage << LOG_KV("index", batch->outputs.size())
+                                    << LOG_KV("message", error ? error->errorMessage() : "");
+                batch->failed = true;
+                batch->callback(error ? BCOS_ERROR_WITH_PREV_UNIQUE_PTR(-1, errorMessage, *error) :
+                                        BCOS_ERROR_UNIQUE_PTR(-1, errorMessage),
+                    {});
+            }
+            else
+            {
+                collectKeyLocks(*output, batch->lockedKeys);
+                batch->outputs.emplace_back(std::move(output));
+            }
+
+            if (batch->stage.exchange(1) == 2 && !batch->failed)
+            {
+                executeBatchInOrder(blockContext, batch);
+            }
+        };
+
+        // the TXHASH messages without fetched transactions fetch them in asyncExecute
+        bcos::protocol::Transaction::ConstPtr tx;
+        if (input->type() == bcos::protocol::ExecutionMessage::TXHASH && batch->transactions)
+        {
+            tx = (*batch->transactions)[batch->txIndex++];
+        }
+        if (tx)
+        {
+            executeFetchedTransaction(blockContext, std::move(input), tx, std::move(onResult));
+        }
+        else
+        {
+            asyncExecute(blockContext, std::move(input), false, std::move(onResult));
+        }
+
+        if (batch->stage.exchange(2) == 0 || batch->failed)
+        {
+            // the callback continues the batch
+            return;
+        }
+    }
+}
+
 void TransactionExecutor::getHash(bcos::protocol::BlockNumber number,
     std::function<void(bcos::Error::UniquePtr, crypto::HashType)> callback)
 {
@@ -347,7 +482,19 @@ void TransactionExecutor::getHash(bcos::protocol::BlockNumber number,
     }
 
     auto hash = last.storage->hash(m_hashImpl);
-    EXECUTOR_LOG(INFO) << "GetTableHashes success" << LOG_KV("hash", hash.hex());
+    static auto& txFetchCount = metrics::histogram(metrics::c_executorTxFetchCount);
+    static auto& txFetchBatches = metrics::histogram(metrics::c_executorTxFetchBatches);
+    static auto& txFetchElapsed = metrics::histogram(metrics::c_executorTxFetchElapsed);
+    txFetchCount.record(m_txFetchCount);
+    txFetchBatches.record(m_txFetchBatches);
+    txFetchElapsed.record(m_txFetchElapsed);
+    EXECUTOR_LOG(INFO) << "GetTableHashes success" << LOG_KV("hash", hash.hex())
+                       << LOG_KV("txFetchCount", m_txFetchCount)
+                       << LOG_KV("txFetchBatches", m_txFetchBatches)
+                       << LOG_KV("txFetchElapsed(ms)", m_txFetchElapsed)
+                       << LOG_KV("codeCacheHits", m_codeCache->hits())
+                       << LOG_KV("codeCacheMisses", m_codeCache->misses())
+                       << LOG_KV("codeCacheBytes", m_codeCache->sizeBytes());
 
     callback(nullptr, std::move(hash));
 }
@@ -1082,6 +1229,11 @@ void TransactionExecutor::getABI(
         });
 }
 
+void TransactionExecutor::setCodeCacheCapacity(size_t _capacityBytes)
+{
+    m_codeCache->setCapacity(_capacityBytes);
+}
+
 void TransactionExecutor::asyncExecute(std::shared_ptr<BlockContext> blockContext,
     bcos::protocol::ExecutionMessage::UniquePtr input, bool staticCall,
     std::function<void(bcos::Error::UniquePtr&&, bcos::protocol::ExecutionMessage::UniquePtr&&)>
@@ -1095,63 +1247,8 @@ void TransactionExecutor::asyncExecute(std::shared_ptr<BlockContext> blockContex
     {
     case bcos::protocol::ExecutionMessage::TXHASH:
     {
-        // Get transaction first
-        auto txHashes = std::make_shared<bcos::crypto::HashList>(1);
-        (*txHashes)[0] = (input->transactionHash());
-
-        m_txpool->asyncFillBlock(std::move(txHashes),
-            [this, inputPtr = input.release(), blockContext = std::move(blockContext), callback](
-                Error::Ptr error, bcos::protocol::TransactionsPtr transactions) mutable {
-                auto input = std::unique_ptr<bcos::protocol::ExecutionMessage>(inputPtr);
-
-                if (error)
-                {
-                    callback(BCOS_ERROR_WITH_PREV_UNIQUE_PTR(ExecuteError::EXECUTE_ERROR,
-                                 "Transaction does not exists: " + input->transactionHash().hex(),
-                                 *error),
-                        nullptr);
-                    return;
-                }
-
-                if (!transactions || transactions->empty())
-                {
-                    callback(BCOS_ERROR_UNIQUE_PTR(ExecuteError::EXECUTE_ERROR,
-                                 "Transaction does not exists: " + input->transactionHash().hex()),
-                        nullptr);
-                    return;
-                }
-
-                auto tx = (*transactions)[0];
-                if (!tx)
-                {
-                    callback(BCOS_ERROR_UNIQUE_PTR(ExecuteError::EXECUTE_ERROR,
-                                 "Transaction is null: " + input->transactionHash().hex()),
-                        nullptr);
-                    return;
-                }
-
-                auto contextID = input->contextID();
-                auto seq = input->seq();
-                auto callParameters = createCallParameters(*input, *tx);
-
-                auto executive =
-                    createExecutive(blockContext, callParameters->codeAddress, contextID, seq);
-                blockContext->insertExecutive(contextID, seq, {executive});
-
-                try
-                {
-                    auto output = executive->start(std::move(callParameters));
-
-                    auto message = toExecutionResult(*executive, std::move(output));
-                    callback(nullptr, std::move(message));
-                    return;
-                }
-                catch (std::exception& e)
-                {
-                    EXECUTOR_LOG(ERROR) << "Execute error: " << boost::diagnostic_information(e);
-                    callback(BCOS_ERROR_WITH_PREV_UNIQUE_PTR(-1, "Execute error", e), nullptr);
-                }
-            });
+        // Get transaction first, TXHASH messages of the block are fetched in batch
+        asyncFetchTransaction(std::move(blockContext), std::move(input), std::move(callback));
         break;
     }
     case bcos::protocol::ExecutionMessage::MESSAGE:
@@ -1268,6 +1365,173 @@ std::unique_ptr<ExecutionMessage> TransactionExecutor::toExecutionResult(
     return message;
 }
 
+void TransactionExecutor::asyncFetchTransaction(std::shared_ptr<BlockContext> blockContext,
+    bcos::protocol::ExecutionMessage::UniquePtr input,
+    std::function<void(bcos::Error::UniquePtr&&, bcos::protocol::ExecutionMessage::UniquePtr&&)>
+        callback)
+{
+    {
+        std::unique_lock<std::mutex> lock(m_txFetchMutex);
+        m_pendingTxFetches.emplace_back(
+            TransactionFetch{std::move(blockContext), std::move(input), std::move(callback)});
+        if (m_txFetching)
+        {
+            // Joined the next batch, sent when the in flight fetch returns
+            return;
+        }
+        m_txFetching = true;
+    }
+
+    flushTransactionFetches();
+}
+
+void TransactionExecutor::flushTransactionFetches()
+{
+    auto fetches = std::make_shared<std::vector<TransactionFetch>>();
+    {
+        std::unique_lock<std::mutex> lock(m_txFetchMutex);
+        if (m_pendingTxFetches.empty())
+        {
+            m_txFetching = false;
+            return;
+        }
+        fetches->swap(m_pendingTxFetches);
+    }
+
+    auto txHashes = std::make_shared<bcos::crypto::HashList>();
+    txHashes->reserve(fetches->size());
+    for (auto& fetch : *fetches)
+    {
+        txHashes->emplace_back(fetch.input->transactionHash());
+    }
+
+    auto startT = utcTime();
+    m_txpool->asyncFillBlock(std::move(txHashes),
+        [this, fetches, startT](Error::Ptr error, bcos::protocol::TransactionsPtr transactions) {
+            m_txFetchElapsed += (utcTime() - startT);
+            ++m_txFetchBatches;
+            m_txFetchCount += fetches->size();
+            EXECUTOR_LOG(TRACE) << LOG_DESC("asyncFillBlock finished")
+                                << LOG_KV("size", fetches->size())
+                                << LOG_KV("timecost", (utcTime() - startT));
+
+            // Messages queued during this fetch go out now, overlapping with the execution below.
+            // Sent from the worker, so a txpool calling back synchronously doesn't recurse here
+            m_txFetchWorker->enqueue([this]() { flushTransactionFetches(); });
+
+            if (fetches->size() > 1 &&
+                (error || !transactions || transactions->size() != fetches->size()))
+            {
+                // The txpool fails the whole batch for any missing transaction, fetch them one by
+                // one so that only the messages whose transactions are missing fail
+                EXECUTOR_LOG(WARNING) << LOG_DESC("asyncFillBlock failed, fetch one by one")
+                                      << LOG_KV("size", fetches->size())
+                                      << LOG_KV("message", error ? error->errorMessage() : "");
+                for (auto& fetch : *fetches)
+                {
+                    fetchTransaction(std::move(fetch));
+                }
+                return;
+            }
+
+            auto executeFetched = [&](size_t i) {
+                auto& [blockContext, input, callback] = (*fetches)[i];
+                if (error)
+                {
+                    callback(BCOS_ERROR_WITH_PREV_UNIQUE_PTR(ExecuteError::EXECUTE_ERROR,
+                                 "Transaction does not exists: " + input->transactionHash().hex(),
+                                 *error),
+                        nullptr);
+                    return;
+                }
+
+                if (!transactions || transactions->size() <= i)
+                {
+                    callback(BCOS_ERROR_UNIQUE_PTR(ExecuteError::EXECUTE_ERROR,
+                                 "Transaction does not exists: " + input->transactionHash().hex()),
+                        nullptr);
+                    return;
+                }
+
+                executeFetchedTransaction(
+                    blockContext, std::move(input), (*transactions)[i], callback);
+            };
+
+            // Messages in a fetch batch come from separate asyncExecute calls that were all in
+            // flight at once, they may be sent to the same contract but never depend on each
+            // other: the messages of an in order batch are only sent after the previous one
+            // returns, and the conflicting keys are guarded by the key locks. So they run
+            // concurrently as their separate txpool callbacks did before the fetches were batched
+            if (fetches->size() == 1)
+            {
+                executeFetched(0);
+                return;
+            }
+            tbb::parallel_for(tbb::blocked_range<size_t>(0U, fetches->size()),
+                [&](const tbb::blocked_range<size_t>& range) {
+                    for (auto i = range.begin(); i < range.end(); ++i)
+                    {
+                        executeFetched(i);
+                    }
+                });
+        });
+}
+
+void TransactionExecutor::fetchTransaction(TransactionFetch fetch)
+{
+    auto txHashes = std::make_shared<bcos::crypto::HashList>(1, fetch.input->transactionHash());
+    auto pending = std::make_shared<TransactionFetch>(std::move(fetch));
+    m_txpool->asyncFillBlock(std::move(txHashes),
+        [this, pending](Error::Ptr error, bcos::protocol::TransactionsPtr transactions) {
+            auto& [blockContext, input, callback] = *pending;
+            if (error || !transactions || transactions->empty())
+            {
+                auto errorMessage =
+                    "Transaction does not exists: " + input->transactionHash().hex();
+                callback(error ? BCOS_ERROR_WITH_PREV_UNIQUE_PTR(
+                                     ExecuteError::EXECUTE_ERROR, errorMessage, *error) :
+                                 BCOS_ERROR_UNIQUE_PTR(ExecuteError::EXECUTE_ERROR, errorMessage),
+                    nullptr);
+                return;
+            }
+            executeFetchedTransaction(blockContext, std::move(input), (*transactions)[0], callback);
+        });
+}
+
+void TransactionExecutor::executeFetchedTransaction(std::shared_ptr<BlockContext> blockContext,
+    bcos::protocol::ExecutionMessage::UniquePtr input, bcos::protocol::Transaction::ConstPtr tx,
+    std::function<void(bcos::Error::UniquePtr&&, bcos::protocol::ExecutionMessage::UniquePtr&&)>
+        callback)
+{
+    if (!tx)
+    {
+        callback(BCOS_ERROR_UNIQUE_PTR(ExecuteError::EXECUTE_ERROR,
+                     "Transaction is null: " + input->transactionHash().hex()),
+            nullptr);
+        return;
+    }
+
+    auto contextID = input->contextID();
+    auto seq = input->seq();
+    auto callParameters = createCallParameters(*input, *tx);
+
+    auto executive = createExecutive(blockContext, callParameters->codeAddress, contextID, seq);
+    blockContext->insertExecutive(contextID, seq, {executive});
+
+    try
+    {
+        auto output = executive->start(std::move(callParameters));
+
+        auto message = toExecutionResult(*executive, std::move(output));
+        callback(nullptr, std::move(message));
+    }
+    catch (std::exception& e)
+    {
+        EXECUTOR_LOG(ERROR) << "Execute error: " << boost::diagnostic_information(e);
+        callback(BCOS_ERROR_WITH_PREV_UNIQUE_PTR(-1, "Execute error", e), nullptr);
+    }
+}
+
 std::unique_ptr<protocol::ExecutionMessage> TransactionExecutor::toExecutionResult(
     std::unique_ptr<CallParameters> params)
 {
@@ -1332,6 +1596,8 @@ TransactionExecutive::Ptr TransactionExecutor::createExecutive(
     executive->setConstantPrecompiled(m_constantPrecompiled);
     executive->setEVMPrecompiled(m_precompiledContract);
     executive->setBuiltInPrecompiled(m_builtInPrecompiled);
+    executive->setCodeCache(m_codeCache);
+    executive->setCoroutineStackSize(m_coroutineStackSize);
 
     // TODO: register User developed Precompiled contract
     // registerUserPrecompiled(context);
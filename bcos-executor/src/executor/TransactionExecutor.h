@@ -37,10 +37,13 @@
 #include "bcos-table/src/StateStorage.h"
 #include "tbb/concurrent_unordered_map.h"
 #include <bcos-crypto/interfaces/crypto/Hash.h>
+#include <bcos-utilities/ThreadPool.h>
 #include <tbb/concurrent_hash_map.h>
 #include <tbb/spin_mutex.h>
+#include <boost/context/stack_traits.hpp>
 #include <boost/function.hpp>
 #include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <functional>
 #include <future>
@@ -74,6 +77,8 @@ class BlockContext;
 class PrecompiledContract;
 template <typename T, typename V>
 class ClockCache;
+class CodeCache;
+class CallStoragePool;
 struct FunctionAbi;
 struct CallParameters;
 
@@ -102,6 +107,12 @@ public:
         std::function<void(bcos::Error::UniquePtr, bcos::protocol::ExecutionMessage::UniquePtr)>
             callback) override;
 
+    void executeTransactions(std::string contractAddress,
+        gsl::span<bcos::protocol::ExecutionMessage::UniquePtr> inputs,
+        std::function<void(
+            bcos::Error::UniquePtr, std::vector<bcos::protocol::ExecutionMessage::UniquePtr>)>
+            callback) override;
+
     void call(bcos::protocol::ExecutionMessage::UniquePtr input,
         std::function<void(bcos::Error::UniquePtr, bcos::protocol::ExecutionMessage::UniquePtr)>
             callback) override;
@@ -137,6 +148,12 @@ public:
     void getABI(
         std::string_view contract, std::function<void(bcos::Error::Ptr, std::string)> callback) override;
 
+    // stack size of the coroutines the transactions are executed in
+    void setCoroutineStackSize(size_t _stackSize) { m_coroutineStackSize = _stackSize; }
+
+    // total bytes of the committed contract code cached
+    void setCodeCacheCapacity(size_t _capacityBytes);
+
 protected:
     virtual void dagExecuteTransactionsInternal(gsl::span<std::unique_ptr<CallParameters>> inputs,
         std::function<void(
@@ -163,6 +180,38 @@ protected:
         std::function<void(bcos::Error::UniquePtr&&, bcos::protocol::ExecutionMessage::UniquePtr&&)>
             callback);
 
+    // queue a TXHASH message, the queued messages are fetched from txpool in one batch
+    void asyncFetchTransaction(std::shared_ptr<BlockContext> blockContext,
+        bcos::protocol::ExecutionMessage::UniquePtr input,
+        std::function<void(bcos::Error::UniquePtr&&, bcos::protocol::ExecutionMessage::UniquePtr&&)>
+            callback);
+    void flushTransactionFetches();
+    void executeFetchedTransaction(std::shared_ptr<BlockContext> blockContext,
+        bcos::protocol::ExecutionMessage::UniquePtr input, bcos::protocol::Transaction::ConstPtr tx,
+        std::function<void(bcos::Error::UniquePtr&&, bcos::protocol::ExecutionMessage::UniquePtr&&)>
+            callback);
+
+    // the messages of an executeTransactions call, transactions are the fetched transactions of
+    // the TXHASH messages in order
+    struct InOrderBatch
+    {
+        std::vector<bcos::protocol::ExecutionMessage::UniquePtr> inputs;
+        std::vector<bcos::protocol::ExecutionMessage::UniquePtr> outputs;
+        bcos::protocol::TransactionsPtr transactions;
+        size_t txIndex = 0;
+        // keys held by the previous messages which are waiting for external calls or key locks
+        std::vector<std::string> lockedKeys;
+        std::function<void(
+            bcos::Error::UniquePtr, std::vector<bcos::protocol::ExecutionMessage::UniquePtr>)>
+            callback;
+        bool failed = false;
+        // 0: waiting for the result, 1: called back inside asyncExecute, 2: called back later
+        std::atomic<int> stage = {0};
+    };
+    // execute the messages one by one, the next message is sent after the result of the previous
+    void executeBatchInOrder(
+        std::shared_ptr<BlockContext> blockContext, std::shared_ptr<InOrderBatch> batch);
+
     std::unique_ptr<protocol::ExecutionMessage> toExecutionResult(
         const TransactionExecutive& executive, std::unique_ptr<CallParameters> params);
 
@@ -195,6 +244,32 @@ protected:
     crypto::Hash::Ptr m_hashImpl;
     bool m_isAuthCheck = false;
     std::shared_ptr<ClockCache<bcos::bytes, FunctionAbi>> m_abiCache;
+    // code of the hot contracts, saves reading the code row from storage on every call
+    std::shared_ptr<CodeCache> m_codeCache;
+    // temp storages of the static calls
+    std::shared_ptr<CallStoragePool> m_callStoragePool;
+    size_t m_coroutineStackSize = boost::context::stack_traits::default_size();
+
+    struct TransactionFetch
+    {
+        std::shared_ptr<BlockContext> blockContext;
+        bcos::protocol::ExecutionMessage::UniquePtr input;
+        std::function<void(
+            bcos::Error::UniquePtr&&, bcos::protocol::ExecutionMessage::UniquePtr&&)>
+            callback;
+    };
+    // fetch the transaction of a message alone, the fallback of a failed batch
+    void fetchTransaction(TransactionFetch fetch);
+    // TXHASH messages arrived while a txpool fetch is in flight
+    std::vector<TransactionFetch> m_pendingTxFetches;
+    bool m_txFetching = false;
+    std::mutex m_txFetchMutex;
+    // sends the next batch after a fetch returns
+    std::shared_ptr<bcos::ThreadPool> m_txFetchWorker;
+    // txpool fetch statistics of the current block, reset by nextBlockHeader
+    std::atomic<uint64_t> m_txFetchElapsed = {0};
+    std::atomic<uint64_t> m_txFetchBatches = {0};
+    std::atomic<uint64_t> m_txFetchCount = {0};
 
     struct State
     {
@@ -234,7 +234,7 @@ void KVTableFactoryPrecompiled::set(
             CODE_TABLE_KEY_VALUE_LENGTH_OVERFLOW);
     }
     // transferEntry(entryTuple, entry);
-    entry.setObject(entryTuple);
+    entry.setObject(entryTuple, getCompatibilityVersion(_executive));
     table->setRow(key, entry);
     callResult->setExecResult(codec->encode(s256(1)));
     gasPricer->setMemUsed(entry.size());
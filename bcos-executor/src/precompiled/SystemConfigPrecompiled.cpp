@@ -55,6 +55,16 @@ SystemConfigPrecompiled::SystemConfigPrecompiled(crypto::Hash::Ptr _hashImpl)
     m_sysValueCmp.insert(std::make_pair(SYSTEM_KEY_TX_COUNT_LIMIT, [defaultCmp](int64_t _v) {
         defaultCmp(SYSTEM_KEY_TX_COUNT_LIMIT, _v, TX_COUNT_LIMIT_MIN);
     }));
+    m_sysValueCmp.insert(std::make_pair(SYSTEM_KEY_COMPATIBILITY_VERSION, [](int64_t _v) {
+        if (_v >= 0 && _v <= storage::codec::COMPACT_COMPATIBILITY_VERSION)
+        {
+            return;
+        }
+        BOOST_THROW_EXCEPTION(PrecompiledError("Invalid value " + std::to_string(_v) +
+                                               " ,the value for " +
+                                               SYSTEM_KEY_COMPATIBILITY_VERSION +
+                                               " is not supported by this node"));
+    }));
 }
 
 std::shared_ptr<PrecompiledExecResult> SystemConfigPrecompiled::call(
@@ -83,11 +93,18 @@ std::shared_ptr<PrecompiledExecResult> SystemConfigPrecompiled::call(
                                << LOG_KV("configValue", configValue);
 
         checkValueValid(configKey, configValue);
+        if (configKey == SYSTEM_KEY_COMPATIBILITY_VERSION &&
+            boost::lexical_cast<uint32_t>(configValue) < getCompatibilityVersion(_executive))
+        {
+            // the rows written in the new formats can not be read by the old nodes
+            BOOST_THROW_EXCEPTION(
+                PrecompiledError("The compatibility version can not be downgraded"));
+        }
         auto table = _executive->storage().openTable(ledger::SYS_CONFIG);
 
         auto entry = table->newEntry();
         auto systemConfigEntry = SystemConfigEntry{configValue, blockContext->number() + 1};
-        entry.setObject(systemConfigEntry);
+        entry.setObject(systemConfigEntry, getCompatibilityVersion(_executive));
 
         table->setRow(configKey, std::move(entry));
 
@@ -55,7 +55,8 @@ private:
     void checkValueValid(std::string_view key, std::string_view value);
     std::map<std::string, std::function<void(int64_t)>> m_sysValueCmp;
     const std::set<std::string> c_supportedKey = {bcos::ledger::SYSTEM_KEY_TX_GAS_LIMIT,
-        bcos::ledger::SYSTEM_KEY_CONSENSUS_LEADER_PERIOD, bcos::ledger::SYSTEM_KEY_TX_COUNT_LIMIT};
+        bcos::ledger::SYSTEM_KEY_CONSENSUS_LEADER_PERIOD, bcos::ledger::SYSTEM_KEY_TX_COUNT_LIMIT,
+        bcos::ledger::SYSTEM_KEY_COMPATIBILITY_VERSION};
 };
 
 }  // namespace precompiled
@@ -323,7 +323,7 @@ void TableFactoryPrecompiled::insert(
     {
         // auto entry = table->newEntry();
         Entry entry;
-        entry.setObject(insertEntry);
+        entry.setObject(insertEntry, getCompatibilityVersion(_executive));
 
         gasPricer->appendOperation(InterfaceOpcode::Insert, 1);
         gasPricer->updateMemUsed(entry.size());
@@ -383,7 +383,7 @@ void TableFactoryPrecompiled::update(
     u256 updateCount = 0;
     auto updateEntry = table->newEntry();
     // updateEntry->getObject<>();
-    updateEntry.setObject(entry);
+    updateEntry.setObject(entry, getCompatibilityVersion(_executive));
     for (auto& tableKey : tableKeySet)
     {
         auto tableEntry = table->getRow(tableKey);
@@ -21,8 +21,10 @@
 #include "Utilities.h"
 #include "Common.h"
 #include <bcos-crypto/interfaces/crypto/Hash.h>
+#include <bcos-framework/interfaces/ledger/LedgerTypeDef.h>
 #include <tbb/concurrent_unordered_map.h>
 #include <boost/core/ignore_unused.hpp>
+#include <boost/lexical_cast.hpp>
 #include <regex>
 
 using namespace bcos;
@@ -493,4 +495,9 @@ bool precompiled::recursiveBuildDir(
         }
     }
     return true;
-}
\ No newline at end of file
+}
+uint32_t bcos::precompiled::getCompatibilityVersion(
+    const std::shared_ptr<executor::TransactionExecutive>& _executive)
+{
+    return _executive->blockContext().lock()->compatibilityVersion();
+}
@@ -98,5 +98,8 @@ std::pair<std::string, std::string> getLinkNameAndVersion(const std::string& _ab
 
 bool recursiveBuildDir(const std::shared_ptr<executor::TransactionExecutive>& _executive,
     const std::string& _absoluteDir);
+
+// the chain compatibility version enabled at the block being executed, 0 if it is not set
+uint32_t getCompatibilityVersion(const std::shared_ptr<executor::TransactionExecutive>& _executive);
 }  // namespace precompiled
 }  // namespace bcos
\ No newline at end of file
@@ -0,0 +1,92 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @file AuthPolicyCache.h
+ * @brief decoded auth policies of one block
+ */
+
+#pragma once
+#include <bcos-utilities/Common.h>
+#include <bcos-utilities/FixedBytes.h>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace bcos::precompiled
+{
+/// The acl of a contract method or of deploy, with the auth type already applied: accounts
+/// absent from the list get defaultAccess, the access of listed accounts is stored as is
+struct AuthPolicy
+{
+    using ConstPtr = std::shared_ptr<const AuthPolicy>;
+
+    bool check(const Address& _account) const
+    {
+        auto it = accounts.find(_account);
+        return it == accounts.end() ? defaultAccess : it->second;
+    }
+
+    bool defaultAccess = true;
+    std::map<Address, bool> accounts;
+};
+
+/// Policies are read from the state of the last block, which doesn't change during the block, so
+/// the cache lives in the BlockContext and needs no invalidation, auth writes of the block take
+/// effect with the cache of the next block
+class AuthPolicyCache
+{
+public:
+    // _loader is called without lock if the policy is not cached, two executives may both load the
+    // same policy, which is harmless
+    template <class Loader>
+    AuthPolicy::ConstPtr methodPolicy(
+        const std::string& _path, bytesConstRef _func, Loader&& _loader)
+    {
+        auto key = _path;
+        key.append((const char*)_func.data(), _func.size());
+        return getOrLoad(key, std::forward<Loader>(_loader));
+    }
+
+    template <class Loader>
+    AuthPolicy::ConstPtr deployPolicy(Loader&& _loader)
+    {
+        // contract paths are never empty
+        return getOrLoad(std::string(), std::forward<Loader>(_loader));
+    }
+
+private:
+    template <class Loader>
+    AuthPolicy::ConstPtr getOrLoad(const std::string& _key, Loader&& _loader)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            auto it = m_policies.find(_key);
+            if (it != m_policies.end())
+            {
+                return it->second;
+            }
+        }
+
+        auto policy = std::make_shared<const AuthPolicy>(_loader());
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_policies.emplace(_key, std::move(policy)).first->second;
+    }
+
+    std::unordered_map<std::string, AuthPolicy::ConstPtr> m_policies;
+    std::mutex m_mutex;
+};
+}  // namespace bcos::precompiled
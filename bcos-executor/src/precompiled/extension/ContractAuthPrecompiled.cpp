@@ -359,8 +359,23 @@ bool ContractAuthPrecompiled::checkMethodAuth(
     const std::shared_ptr<executor::TransactionExecutive>& _executive, const std::string& _path,
     bytesRef func, const Address& account)
 {
-    auto path = _path;
-    path = getAuthTableName(path);
+    auto path = getAuthTableName(_path);
+    if (!_executive->lastStorage())
+    {
+        return loadMethodAuthPolicy(_executive, path, func).check(account);
+    }
+    // the state of the last block is immutable during the block, cache the decoded policy
+    auto blockContext = _executive->blockContext().lock();
+    auto policy = blockContext->authPolicyCache().methodPolicy(
+        path, func, [&]() { return loadMethodAuthPolicy(_executive, path, func); });
+    return policy->check(account);
+}
+
+AuthPolicy ContractAuthPrecompiled::loadMethodAuthPolicy(
+    const std::shared_ptr<executor::TransactionExecutive>& _executive, const std::string& path,
+    bytesConstRef func)
+{
+    AuthPolicy policy;
     auto lastStorage = _executive->lastStorage();
     auto table =
         (lastStorage) ? lastStorage->openTable(path) : _executive->storage().openTable(path);
@@ -370,13 +385,13 @@ bool ContractAuthPrecompiled::checkMethodAuth(
         PRECOMPILED_LOG(DEBUG) << LOG_BADGE("ContractAuthPrecompiled")
                                << LOG_DESC("auth table not found, auth pass through by default.")
                                << LOG_KV("path", path);
-        return true;
+        return policy;
     }
     auto getMethodType = getMethodAuthType(_executive, path, func);
     if (getMethodType == (int)CODE_TABLE_AUTH_TYPE_NOT_EXIST)
     {
         // this method not set type
-        return true;
+        return policy;
     }
     std::string getTypeStr;
     if (getMethodType == (int)AuthType::WHITE_LIST_MODE)
@@ -388,40 +403,38 @@ bool ContractAuthPrecompiled::checkMethodAuth(
         PRECOMPILED_LOG(ERROR) << LOG_BADGE("ContractAuthPrecompiled")
                                << LOG_DESC("error auth type") << LOG_KV("path", path)
                                << LOG_KV("type", getMethodType);
-        return false;
+        policy.defaultAccess = false;
+        return policy;
     }
 
+    // if white list mode, accounts not in the list are denied
+    // if black list mode, accounts not in the list are allowed
+    bool isBlackList = getMethodType == (int)AuthType::BLACK_LIST_MODE;
     auto entry = table->getRow(getTypeStr);
     if (!entry || entry->getField(SYS_VALUE).empty())
     {
         PRECOMPILED_LOG(DEBUG) << LOG_BADGE("ContractAuthPrecompiled")
                                << LOG_DESC("auth row not found, no method set acl")
                                << LOG_KV("path", path) << LOG_KV("authType", getTypeStr);
-        // if entry still empty
-        //      if white list mode, return false
-        //      if black list mode， return true
-        return getMethodType == (int)AuthType::BLACK_LIST_MODE;
+        policy.defaultAccess = isBlackList;
+        return policy;
     }
     MethodAuthMap authMap;
     bytes&& out = asBytes(std::string(entry->getField(SYS_VALUE)));
     codec::scale::decode(authMap, gsl::make_span(out));
-    if (authMap.find(func.toBytes()) == authMap.end())
+    auto it = authMap.find(func.toBytes());
+    if (it == authMap.end())
     {
         // func not set acl, pass through
-        return true;
+        return policy;
     }
-    if (authMap.at(func.toBytes()).find(account) == authMap.at(func.toBytes()).end())
+    policy.defaultAccess = isBlackList;
+    for (auto& [account, access] : it->second)
     {
-        // can't find account in user map
-        // if white list mode, return false
-        // if black list mode, return true
-        return getMethodType == (int)AuthType::BLACK_LIST_MODE;
+        // the value of black list is whether the account is blocked
+        policy.accounts.emplace(account, isBlackList ? !access : access);
     }
-    if (getMethodType == (int)AuthType::BLACK_LIST_MODE)
-    {
-        return !authMap.at(func.toBytes()).at(account);
-    }
-    return authMap.at(func.toBytes()).at(account);
+    return policy;
 }
 
 void ContractAuthPrecompiled::setMethodAuth(
@@ -746,6 +759,20 @@ void ContractAuthPrecompiled::hasDeployAuth(
 bool ContractAuthPrecompiled::checkDeployAuth(
     const std::shared_ptr<executor::TransactionExecutive>& _executive, const Address& _account)
 {
+    if (!_executive->lastStorage())
+    {
+        return loadDeployAuthPolicy(_executive).check(_account);
+    }
+    auto blockContext = _executive->blockContext().lock();
+    auto policy = blockContext->authPolicyCache().deployPolicy(
+        [&]() { return loadDeployAuthPolicy(_executive); });
+    return policy->check(_account);
+}
+
+AuthPolicy ContractAuthPrecompiled::loadDeployAuthPolicy(
+    const std::shared_ptr<executor::TransactionExecutive>& _executive)
+{
+    AuthPolicy policy;
     auto lastStorage = _executive->lastStorage();
     auto table =
         (lastStorage) ? lastStorage->openTable("/apps") : _executive->storage().openTable("/apps");
@@ -753,33 +780,27 @@ bool ContractAuthPrecompiled::checkDeployAuth(
     auto type = getDeployAuthType(_executive);
     if (type == 0)
     {
-        return true;
+        return policy;
     }
+    bool isBlackList = type == (int)AuthType::BLACK_LIST_MODE;
     auto getAclType = (type == (int)AuthType::WHITE_LIST_MODE) ? FS_ACL_WHITE : FS_ACL_BLACK;
     auto entry = table->getRow(getAclType);
+    // if white list mode, accounts not in the list are denied
+    // if black list mode, accounts not in the list are allowed
+    policy.defaultAccess = isBlackList;
     if (entry->getField(0).empty())
     {
         PRECOMPILED_LOG(DEBUG) << LOG_BADGE("ContractAuthPrecompiled")
                                << LOG_DESC("not deploy acl exist, return by default")
                                << LOG_KV("aclType", type);
-        // if entry still empty
-        //      if white list mode, return false
-        //      if black list mode， return true
-        return type == (int)AuthType::BLACK_LIST_MODE;
+        return policy;
     }
     std::map<Address, bool> aclMap;
     auto&& out = asBytes(std::string(entry->getField(0)));
     codec::scale::decode(aclMap, gsl::make_span(out));
-    if (aclMap.find(_account) == aclMap.end())
-    {
-        // can't find account in map
-        // if white list mode, return false
-        // if black list mode, return true
-        return type == (int)AuthType::BLACK_LIST_MODE;
-    }
-    if (type == (int)AuthType::BLACK_LIST_MODE)
+    for (auto& [account, access] : aclMap)
     {
-        return !aclMap.at(_account);
+        policy.accounts.emplace(account, isBlackList ? !access : access);
     }
-    return aclMap.at(_account);
-}
\ No newline at end of file
+    return policy;
+}
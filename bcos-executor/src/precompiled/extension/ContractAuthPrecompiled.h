@@ -22,6 +22,7 @@
 #include "../../vm/Precompiled.h"
 #include "../Common.h"
 #include "../Utilities.h"
+#include "AuthPolicyCache.h"
 #include <bcos-framework/interfaces/executor/PrecompiledTypeDef.h>
 
 namespace bcos::precompiled
@@ -110,6 +111,13 @@ private:
 
     u256 getDeployAuthType(const std::shared_ptr<executor::TransactionExecutive>& _executive);
 
+    AuthPolicy loadMethodAuthPolicy(
+        const std::shared_ptr<executor::TransactionExecutive>& _executive,
+        const std::string& path, bytesConstRef func);
+
+    AuthPolicy loadDeployAuthPolicy(
+        const std::shared_ptr<executor::TransactionExecutive>& _executive);
+
     inline bool checkSender(std::string_view _sender)
     {
         return _sender == precompiled::AUTH_COMMITTEE_ADDRESS;
@@ -0,0 +1,109 @@
+/*
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief executor wide LRU cache of contract code
+ * @file CodeCache.cpp
+ */
+
+#include "CodeCache.h"
+#include "../Common.h"
+#include "bcos-framework/interfaces/metrics/Metrics.h"
+#include <boost/throw_exception.hpp>
+#include <future>
+
+using namespace bcos;
+using namespace bcos::executor;
+
+CodeCache::Code CodeCache::get(std::string_view _table)
+{
+    static auto& cacheHits = metrics::counter(metrics::c_executorCodeCacheHits);
+    static auto& cacheMisses = metrics::counter(metrics::c_executorCodeCacheMisses);
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    auto it = m_index.find(_table);
+    if (it == m_index.end())
+    {
+        ++m_misses;
+        cacheMisses.add();
+        return nullptr;
+    }
+
+    // move to the front as the most recently used
+    m_lru.splice(m_lru.begin(), m_lru, it->second);
+    ++m_hits;
+    cacheHits.add();
+    return it->second->second;
+}
+
+CodeCache::Code CodeCache::load(std::string_view _table)
+{
+    std::promise<std::tuple<Error::UniquePtr, std::optional<storage::Entry>>> getPromise;
+    m_committedStorage->asyncGetRow(_table, ACCOUNT_CODE,
+        [&getPromise](Error::UniquePtr error, std::optional<storage::Entry> entry) {
+            getPromise.set_value({std::move(error), std::move(entry)});
+        });
+    auto [error, entry] = getPromise.get_future().get();
+    if (error)
+    {
+        BOOST_THROW_EXCEPTION(*error);
+    }
+    if (!entry)
+    {
+        return nullptr;
+    }
+
+    auto code = entry->getField(0);
+    auto cachedCode = std::make_shared<const bytes>(code.begin(), code.end());
+    insert(_table, cachedCode);
+    return cachedCode;
+}
+
+void CodeCache::insert(std::string_view _table, Code _code)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (!_code || _code->size() > m_capacityBytes || m_index.count(_table))
+    {
+        return;
+    }
+
+    m_sizeBytes += _code->size();
+    m_lru.emplace_front(std::string(_table), std::move(_code));
+    m_index.emplace(m_lru.front().first, m_lru.begin());
+    evict();
+}
+
+void CodeCache::setCapacity(size_t _capacityBytes)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_capacityBytes = _capacityBytes;
+    evict();
+}
+
+size_t CodeCache::sizeBytes() const
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    return m_sizeBytes;
+}
+
+void CodeCache::evict()
+{
+    while (m_sizeBytes > m_capacityBytes)
+    {
+        auto& last = m_lru.back();
+        m_sizeBytes -= last.second->size();
+        m_index.erase(last.first);
+        m_lru.pop_back();
+    }
+}
@@ -0,0 +1,81 @@
+/*
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief executor wide LRU cache of contract code
+ * @file CodeCache.h
+ */
+
+#pragma once
+#include "bcos-framework/interfaces/storage/StorageInterface.h"
+#include <bcos-utilities/Common.h>
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace bcos
+{
+namespace executor
+{
+/// Code of the contracts committed to the storage, keyed by the contract table. The code row is
+/// only written when the contract is deployed, so the committed code never changes and a hit
+/// needs no storage read. The code deployed by the blocks not committed yet is never cached, it
+/// may still be reverted. Entries are only evicted by the LRU size limit
+class CodeCache
+{
+public:
+    using Ptr = std::shared_ptr<CodeCache>;
+    using Code = std::shared_ptr<const bcos::bytes>;
+
+    CodeCache(size_t _capacityBytes, storage::StorageInterface::Ptr _committedStorage)
+      : m_capacityBytes(_capacityBytes), m_committedStorage(std::move(_committedStorage))
+    {}
+
+    // return nullptr if the code of _table is not cached
+    Code get(std::string_view _table);
+
+    // read the code of _table from the committed storage and cache it, return nullptr if the
+    // contract is not committed
+    Code load(std::string_view _table);
+
+    void insert(std::string_view _table, Code _code);
+
+    // evict the least recently used code beyond the new capacity
+    void setCapacity(size_t _capacityBytes);
+
+    size_t hits() const { return m_hits; }
+    size_t misses() const { return m_misses; }
+    size_t sizeBytes() const;
+
+private:
+    void evict();
+
+    using LRUList = std::list<std::pair<std::string, Code>>;
+
+    LRUList m_lru;
+    std::unordered_map<std::string_view, LRUList::iterator> m_index;
+    size_t m_sizeBytes = 0;
+    size_t m_capacityBytes;
+    storage::StorageInterface::Ptr m_committedStorage;
+    mutable std::mutex m_mutex;
+
+    std::atomic<size_t> m_hits = {0};
+    std::atomic<size_t> m_misses = {0};
+};
+}  // namespace executor
+}  // namespace bcos
@@ -310,13 +310,11 @@ u256 HostContext::store(const u256& _n)
     auto key = toEvmC(_n);
     auto keyView = std::string_view((char*)key.bytes, sizeof(key.bytes));
 
-    auto entry = m_executive->storage().getRow(m_tableName, keyView);
-    if (entry)
-    {
-        return fromBigEndian<u256>(entry->getField(0));
-    }
+    u256 value;
+    m_executive->storage().getRowValue(m_tableName, keyView,
+        [&value](std::string_view valueView) { value = fromBigEndian<u256>(valueView); });
 
-    return u256();
+    return value;
 }
 
 void HostContext::setStore(u256 const& _n, u256 const& _v)
@@ -325,12 +323,9 @@ void HostContext::setStore(u256 const& _n, u256 const& _v)
     auto keyView = std::string_view((char*)key.bytes, sizeof(key.bytes));
 
     auto value = toEvmC(_v);
-    bytes valueBytes(value.bytes, value.bytes + sizeof(value.bytes));
+    auto valueView = std::string_view((char*)value.bytes, sizeof(value.bytes));
 
-    Entry entry;
-    entry.importFields({std::move(valueBytes)});
-
-    m_executive->storage().setRow(m_tableName, keyView, std::move(entry));
+    m_executive->storage().setRowValue(m_tableName, keyView, valueView);
 }
 
 void HostContext::log(h256s&& _topics, bytesConstRef _data)
@@ -376,6 +371,22 @@ std::string_view HostContext::myAddress() const
 
 bytesConstRef HostContext::code()
 {
+    // the committed code is served from the cache without reading the storage, the code deployed
+    // by the blocks not committed yet is read from the block state
+    auto const& codeCache = m_executive->codeCache();
+    if (codeCache)
+    {
+        m_code = codeCache->get(m_tableName);
+        if (!m_code)
+        {
+            m_code = codeCache->load(m_tableName);
+        }
+        if (m_code)
+        {
+            return bytesConstRef(m_code->data(), m_code->size());
+        }
+    }
+
     auto entry = m_executive->storage().getRow(m_tableName, ACCOUNT_CODE);
     if (entry)
     {
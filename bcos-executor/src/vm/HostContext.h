@@ -22,6 +22,7 @@
 #pragma once
 
 #include "../Common.h"
+#include "CodeCache.h"
 #include "bcos-framework/interfaces/protocol/BlockHeader.h"
 #include "bcos-framework/interfaces/storage/Table.h"
 #include <evmc/evmc.h>
@@ -144,6 +145,8 @@ private:
     SubState m_sub;  ///< Sub-band VM state (suicides, refund counter, logs).
 
     std::list<CallParameters::UniquePtr> m_responseStore;
+    // keep the code returned by code() alive while the vm executes it
+    CodeCache::Code m_code;
 };
 
 }  // namespace executor
@@ -0,0 +1,76 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the coroutines created on the pooled stacks against the fixedsize_stack of boost
+ * @file coroutine-stack-bench.cpp
+ */
+#include <bcos-executor/src/executive/PooledStackAllocator.h>
+#include <boost/context/fixedsize_stack.hpp>
+#include <boost/coroutine2/coroutine.hpp>
+#include <chrono>
+#include <iostream>
+
+using namespace bcos;
+using namespace bcos::executor;
+
+using Coroutine = boost::coroutines2::coroutine<int>;
+
+template <class StackAllocator>
+std::chrono::nanoseconds runCoroutines(
+    StackAllocator const& allocator, size_t count, size_t switches)
+{
+    auto start = std::chrono::steady_clock::now();
+    int64_t sum = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        Coroutine::pull_type pull(
+            StackAllocator(allocator), [switches](Coroutine::push_type& push) {
+                for (size_t j = 0; j < switches; ++j)
+                {
+                    push((int)j);
+                }
+            });
+        for (auto value : pull)
+        {
+            sum += value;
+        }
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start);
+    if (sum != (int64_t)(count * (switches * (switches - 1) / 2)))
+    {
+        std::cout << "Unexpected coroutine result: " << sum << std::endl;
+    }
+    return elapsed;
+}
+
+int main(int argc, const char* argv[])
+{
+    // coroutine-stack-bench [coroutineCount] [switches] [stackSize]
+    size_t count = argc > 1 ? std::stoul(argv[1]) : 100000;
+    size_t switches = argc > 2 ? std::stoul(argv[2]) : 4;
+    size_t stackSize =
+        argc > 3 ? std::stoul(argv[3]) : boost::context::stack_traits::default_size();
+
+    auto fixedElapsed = runCoroutines(boost::context::fixedsize_stack(stackSize), count, switches);
+    auto pooledElapsed = runCoroutines(PooledStackAllocator(stackSize), count, switches);
+
+    std::cout << "Create " << count << " coroutines with " << switches << " switches each"
+              << ", stackSize: " << stackSize
+              << ", fixedsize_stack: " << fixedElapsed.count() / count << "ns/coroutine"
+              << ", PooledStackAllocator: " << pooledElapsed.count() / count << "ns/coroutine"
+              << std::endl;
+    return 0;
+}
@@ -0,0 +1,68 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+/**
+ * @brief : unitest for the temp storages of the static calls
+ */
+
+#include "../src/executor/CallStoragePool.h"
+#include <boost/test/unit_test.hpp>
+#include <memory>
+
+using namespace std;
+using namespace bcos;
+using namespace bcos::executor;
+using namespace bcos::storage;
+
+namespace bcos
+{
+namespace test
+{
+BOOST_AUTO_TEST_SUITE(TestCallStoragePool)
+
+BOOST_AUTO_TEST_CASE(ReuseReleasedStorage)
+{
+    auto committed = std::make_shared<StateStorage>(nullptr);
+    auto pool = std::make_shared<CallStoragePool>(1);
+
+    auto storage = pool->acquire(committed);
+    auto* address = storage.get();
+    BOOST_CHECK(storage->createTable("t_test", "value"));
+    storage.reset();
+    BOOST_CHECK_EQUAL(pool->idle(), 1);
+
+    // the released storage is reused without the writes of the last call
+    storage = pool->acquire(committed);
+    BOOST_CHECK_EQUAL(storage.get(), address);
+    BOOST_CHECK_EQUAL(pool->reused(), 1);
+    BOOST_CHECK_EQUAL(pool->idle(), 0);
+    BOOST_CHECK(!storage->openTable("t_test"));
+
+    // the storages beyond the idle limit are deleted
+    auto another = pool->acquire(committed);
+    BOOST_CHECK_NE(another.get(), storage.get());
+    storage.reset();
+    another.reset();
+    BOOST_CHECK_EQUAL(pool->idle(), 1);
+
+    // the storages released after the pool are deleted
+    storage = pool->acquire(committed);
+    pool.reset();
+    storage.reset();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+}  // namespace test
+}  // namespace bcos
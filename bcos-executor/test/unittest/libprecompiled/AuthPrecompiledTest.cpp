@@ -1432,5 +1432,38 @@ BOOST_AUTO_TEST_CASE(testDeployAdmin)
     }
 }
 
+BOOST_AUTO_TEST_CASE(authPolicyCache)
+{
+    AuthPolicyCache cache;
+    Address allowed("1234654b49838bd3e9466c85a4cc3428c9601235");
+    Address denied("2234654b49838bd3e9466c85a4cc3428c9601235");
+    Address unknown("3234654b49838bd3e9466c85a4cc3428c9601235");
+    bytes func = fromHex("12345678");
+    size_t loads = 0;
+    auto loader = [&]() {
+        ++loads;
+        AuthPolicy policy;
+        policy.defaultAccess = false;
+        policy.accounts.emplace(allowed, true);
+        policy.accounts.emplace(denied, false);
+        return policy;
+    };
+
+    auto policy = cache.methodPolicy("/apps/hello", ref(func), loader);
+    BOOST_CHECK(policy->check(allowed));
+    BOOST_CHECK(!policy->check(denied));
+    BOOST_CHECK(!policy->check(unknown));
+    BOOST_CHECK_EQUAL(cache.methodPolicy("/apps/hello", ref(func), loader), policy);
+    BOOST_CHECK_EQUAL(loads, 1);
+
+    // other methods, contracts and deploy have their own policies
+    bytes otherFunc = fromHex("87654321");
+    cache.methodPolicy("/apps/hello", ref(otherFunc), loader);
+    cache.methodPolicy("/apps/hello2", ref(func), loader);
+    cache.deployPolicy(loader);
+    cache.deployPolicy(loader);
+    BOOST_CHECK_EQUAL(loads, 4);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 }  // namespace bcos::test
\ No newline at end of file
@@ -0,0 +1,177 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+/**
+ * @brief : unitest for the executor code cache
+ */
+
+#include "../src/executive/BlockContext.h"
+#include "../src/executive/TransactionExecutive.h"
+#include "../src/vm/CodeCache.h"
+#include "../src/vm/HostContext.h"
+#include "bcos-table/src/StateStorage.h"
+#include <boost/test/unit_test.hpp>
+#include <memory>
+
+using namespace std;
+using namespace bcos;
+using namespace bcos::executor;
+using namespace bcos::storage;
+
+namespace bcos
+{
+namespace test
+{
+// count the rows read from the storage
+class ReadCountingStorage : public StateStorage
+{
+public:
+    using StateStorage::BaseStorage;
+
+    void asyncGetRow(std::string_view table, std::string_view key,
+        std::function<void(Error::UniquePtr, std::optional<Entry>)> callback) override
+    {
+        ++reads;
+        StateStorage::asyncGetRow(table, key, std::move(callback));
+    }
+
+    size_t reads = 0;
+};
+
+class CodeCacheFixture
+{
+public:
+    CodeCacheFixture()
+    {
+        committedStorage = std::make_shared<ReadCountingStorage>(nullptr);
+        blockStorage = std::make_shared<ReadCountingStorage>(committedStorage);
+        codeCache = std::make_shared<CodeCache>(1024, committedStorage);
+        blockContext = std::make_shared<BlockContext>(
+            blockStorage, nullptr, 1, h256(), 0, 0, FiscoBcosScheduleV4, false, false);
+    }
+
+    void setCode(StateStorage& storage, std::string_view table, bytes code)
+    {
+        Entry entry;
+        entry.importFields({std::move(code)});
+        storage.asyncSetRow(table, ACCOUNT_CODE, std::move(entry), [](Error::UniquePtr error) {
+            BOOST_CHECK(!error);
+        });
+    }
+
+    // read the code of table as the HostContext of a call does
+    bytes code(std::string const& table)
+    {
+        auto executive =
+            std::make_shared<TransactionExecutive>(blockContext, table, 0, 0, gasInjector);
+        executive->setCodeCache(codeCache);
+        executive->initStorageWrapper(*blockContext);
+        HostContext hostContext(
+            std::make_unique<CallParameters>(CallParameters::MESSAGE), executive, table);
+        return hostContext.code().toBytes();
+    }
+
+    std::shared_ptr<ReadCountingStorage> committedStorage;
+    std::shared_ptr<ReadCountingStorage> blockStorage;
+    CodeCache::Ptr codeCache;
+    BlockContext::Ptr blockContext;
+    std::shared_ptr<wasm::GasInjector> gasInjector;
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestCodeCache, CodeCacheFixture)
+
+BOOST_AUTO_TEST_CASE(HitAndMiss)
+{
+    CodeCache cache(1024, committedStorage);
+    BOOST_CHECK(!cache.get("table1"));
+    BOOST_CHECK_EQUAL(cache.misses(), 1);
+
+    cache.insert("table1", std::make_shared<const bytes>(bytes{1, 2, 3}));
+    auto code = cache.get("table1");
+    BOOST_CHECK(code);
+    BOOST_CHECK(*code == bytes({1, 2, 3}));
+    BOOST_CHECK_EQUAL(cache.hits(), 1);
+    BOOST_CHECK_EQUAL(cache.sizeBytes(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(LoadCommitted)
+{
+    CodeCache cache(1024, committedStorage);
+    BOOST_CHECK(!cache.load("table1"));
+    BOOST_CHECK(!cache.get("table1"));
+
+    setCode(*committedStorage, "table1", bytes{1, 2, 3});
+    auto code = cache.load("table1");
+    BOOST_CHECK(code && *code == bytes({1, 2, 3}));
+    BOOST_CHECK(cache.get("table1") == code);
+}
+
+BOOST_AUTO_TEST_CASE(EvictLeastRecentlyUsed)
+{
+    CodeCache cache(10, committedStorage);
+    cache.insert("table1", std::make_shared<const bytes>(4, 1));
+    cache.insert("table2", std::make_shared<const bytes>(4, 2));
+    // table1 becomes the most recently used
+    BOOST_CHECK(cache.get("table1"));
+
+    cache.insert("table3", std::make_shared<const bytes>(4, 3));
+    BOOST_CHECK(cache.get("table1"));
+    BOOST_CHECK(!cache.get("table2"));
+    BOOST_CHECK(cache.get("table3"));
+    BOOST_CHECK_EQUAL(cache.sizeBytes(), 8);
+
+    // code larger than the capacity is never cached
+    cache.insert("table4", std::make_shared<const bytes>(11, 4));
+    BOOST_CHECK(!cache.get("table4"));
+    BOOST_CHECK(cache.get("table1"));
+
+    // shrinking the capacity evicts the least recently used
+    cache.setCapacity(4);
+    BOOST_CHECK(cache.get("table1"));
+    BOOST_CHECK(!cache.get("table3"));
+    BOOST_CHECK_EQUAL(cache.sizeBytes(), 4);
+}
+
+BOOST_AUTO_TEST_CASE(HostContextReads)
+{
+    setCode(*committedStorage, "/apps/committed", bytes{1, 2, 3});
+
+    // the first call reads the committed code once
+    BOOST_CHECK(code("/apps/committed") == bytes({1, 2, 3}));
+    BOOST_CHECK_EQUAL(committedStorage->reads, 1);
+    BOOST_CHECK_EQUAL(blockStorage->reads, 0);
+
+    // the following calls hit the cache and read nothing
+    BOOST_CHECK(code("/apps/committed") == bytes({1, 2, 3}));
+    BOOST_CHECK(code("/apps/committed") == bytes({1, 2, 3}));
+    BOOST_CHECK_EQUAL(committedStorage->reads, 1);
+    BOOST_CHECK_EQUAL(blockStorage->reads, 0);
+    BOOST_CHECK_EQUAL(codeCache->hits(), 2);
+
+    // the code deployed by the block is read from the block state every call and never cached
+    setCode(*blockStorage, "/apps/uncommitted", bytes{4, 5});
+    BOOST_CHECK(code("/apps/uncommitted") == bytes({4, 5}));
+    BOOST_CHECK(code("/apps/uncommitted") == bytes({4, 5}));
+    BOOST_CHECK_EQUAL(committedStorage->reads, 3);
+    BOOST_CHECK_EQUAL(blockStorage->reads, 2);
+    BOOST_CHECK(!codeCache->get("/apps/uncommitted"));
+
+    // a contract not deployed has no code
+    BOOST_CHECK(code("/apps/none").empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+}  // namespace test
+}  // namespace bcos
@@ -0,0 +1,62 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+/**
+ * @brief : unitest of the pooled coroutine stack allocator
+ */
+
+#include "../src/executive/PooledStackAllocator.h"
+#include <boost/test/unit_test.hpp>
+
+using namespace std;
+using namespace bcos;
+using namespace bcos::executor;
+
+namespace bcos
+{
+namespace test
+{
+BOOST_AUTO_TEST_SUITE(TestPooledStackAllocator)
+
+BOOST_AUTO_TEST_CASE(reuseStack)
+{
+    PooledStackAllocator allocator(100 * 1024);
+    BOOST_CHECK_EQUAL(allocator.stackSize() % boost::context::stack_traits::page_size(), 0);
+    BOOST_CHECK_GE(allocator.stackSize(), 100 * 1024);
+
+    auto pooled = PooledStackAllocator::pooledStacks();
+    auto sctx = allocator.allocate();
+    // touch the whole usable range, the guard page lies below it
+    auto bottom = static_cast<char*>(sctx.sp) - allocator.stackSize();
+    bottom[0] = 1;
+    static_cast<char*>(sctx.sp)[-1] = 1;
+    allocator.deallocate(sctx);
+    BOOST_CHECK_EQUAL(PooledStackAllocator::pooledStacks(), pooled + 1);
+
+    auto reused = allocator.allocate();
+    BOOST_CHECK_EQUAL(reused.sp, sctx.sp);
+    BOOST_CHECK_EQUAL(PooledStackAllocator::pooledStacks(), pooled);
+
+    // stacks of another size are not handed out from the pool
+    PooledStackAllocator bigger(allocator.stackSize() * 2);
+    allocator.deallocate(reused);
+    auto other = bigger.allocate();
+    BOOST_CHECK_NE(other.sp, reused.sp);
+    bigger.deallocate(other);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+}  // namespace test
+}  // namespace bcos
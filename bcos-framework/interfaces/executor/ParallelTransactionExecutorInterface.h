@@ -59,6 +59,15 @@ public:
         std::function<void(bcos::Error::UniquePtr, bcos::protocol::ExecutionMessage::UniquePtr)>
             callback) = 0;
 
+    // Execute messages to the same contract in the order of inputs, as if they were sent one by
+    // one: the keys held by a message which doesn't return are locked for the messages after it.
+    // The outputs are in the order of inputs
+    virtual void executeTransactions(std::string contractAddress,
+        gsl::span<bcos::protocol::ExecutionMessage::UniquePtr> inputs,
+        std::function<void(
+            bcos::Error::UniquePtr, std::vector<bcos::protocol::ExecutionMessage::UniquePtr>)>
+            callback) = 0;
+
     virtual void dagExecuteTransactions(
         gsl::span<bcos::protocol::ExecutionMessage::UniquePtr> inputs,
         std::function<void(
@@ -96,6 +105,31 @@ public:
 
     virtual void getABI(
         std::string_view contract, std::function<void(bcos::Error::Ptr, std::string)> callback) = 0;
+
+    // add the keys held by the previous messages of a batch to the key locks of a message
+    static void appendKeyLocks(
+        bcos::protocol::ExecutionMessage& message, const std::vector<std::string>& lockedKeys)
+    {
+        if (lockedKeys.empty())
+        {
+            return;
+        }
+        auto keyLocks = message.takeKeyLocks();
+        keyLocks.insert(keyLocks.end(), lockedKeys.begin(), lockedKeys.end());
+        message.setKeyLocks(std::move(keyLocks));
+    }
+
+    // the keys a response still holds, MESSAGE and KEY_LOCK suspend the executive with its locks
+    static void collectKeyLocks(
+        const bcos::protocol::ExecutionMessage& response, std::vector<std::string>& lockedKeys)
+    {
+        if (response.type() == bcos::protocol::ExecutionMessage::MESSAGE ||
+            response.type() == bcos::protocol::ExecutionMessage::KEY_LOCK)
+        {
+            lockedKeys.insert(
+                lockedKeys.end(), response.keyLocks().begin(), response.keyLocks().end());
+        }
+    }
 };
 }  // namespace executor
 }  // namespace bcos
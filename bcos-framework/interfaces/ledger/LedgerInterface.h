@@ -30,8 +30,12 @@
 #include "LedgerTypeDef.h"
 #include <bcos-crypto/interfaces/crypto/CommonType.h>
 #include <bcos-utilities/Error.h>
+#include <boost/core/ignore_unused.hpp>
 #include <gsl/span>
+#include <atomic>
 #include <map>
+#include <set>
+#include <vector>
 
 
 namespace bcos::ledger
@@ -119,6 +123,65 @@ public:
         std::function<void(Error::Ptr, protocol::TransactionReceipt::ConstPtr, MerkleProofPtr)>
             _onGetTx) = 0;
 
+    /**
+     * @brief async get the transaction receipts by the tx hash list without proof
+     * @param _txHashList the hash list of the transactions
+     * @param _onGetReceipts callback the receipts in the order of _txHashList, the receipts not
+     *                       found are nullptr
+     */
+    virtual void asyncGetBatchReceiptsByHashList(crypto::HashListPtr _txHashList,
+        std::function<void(Error::Ptr, std::vector<protocol::TransactionReceipt::ConstPtr>)>
+            _onGetReceipts)
+    {
+        if (_txHashList->empty())
+        {
+            _onGetReceipts(nullptr, {});
+            return;
+        }
+        // query one by one by default
+        struct BatchReceipts
+        {
+            std::vector<protocol::TransactionReceipt::ConstPtr> receipts;
+            std::atomic_size_t remaining;
+        };
+        auto batch = std::make_shared<BatchReceipts>();
+        batch->receipts.resize(_txHashList->size());
+        batch->remaining = _txHashList->size();
+        for (size_t i = 0; i < _txHashList->size(); ++i)
+        {
+            asyncGetTransactionReceiptByHash((*_txHashList)[i], false,
+                [batch, i, _onGetReceipts](Error::Ptr _error,
+                    protocol::TransactionReceipt::ConstPtr _receipt, MerkleProofPtr) {
+                    if (!_error || _error->errorCode() == 0)
+                    {
+                        batch->receipts[i] = std::move(_receipt);
+                    }
+                    if (batch->remaining.fetch_sub(1) == 1)
+                    {
+                        _onGetReceipts(nullptr, std::move(batch->receipts));
+                    }
+                });
+        }
+    }
+
+    /**
+     * @brief async get the locations of the logs matching the filter from the log index
+     * @param _fromBlock the first block of the range
+     * @param _toBlock the last block of the range
+     * @param _addresses the log address must be one of _addresses, empty matches all
+     * @param _topics the i-th topic of the log must be one of _topics[i], empty matches all
+     * @param _onGetLogs callback the locations in chain order, or an error if there is no filter
+     *                   or the range is not indexed
+     */
+    virtual void asyncGetLogLocations(protocol::BlockNumber _fromBlock,
+        protocol::BlockNumber _toBlock, std::set<std::string> const& _addresses,
+        std::vector<std::set<std::string>> const& _topics,
+        std::function<void(Error::Ptr, std::vector<LogLocation>)> _onGetLogs)
+    {
+        boost::ignore_unused(_fromBlock, _toBlock, _addresses, _topics);
+        _onGetLogs(std::make_shared<Error>(-1, "The log index is not supported"), {});
+    }
+
     /**
      * @brief async get total transaction count and latest block number
      * @param _callback callback totalTxCount, totalFailedTxCount, and latest block number
@@ -21,6 +21,7 @@
 #pragma once
 #include "../protocol/ProtocolTypeDef.h"
 #include <bcos-utilities/Common.h>
+#include <tuple>
 
 namespace bcos::ledger
 {
@@ -37,10 +38,31 @@ static const int32_t RECEIPTS = 0x0002;
 static const char* const SYSTEM_KEY_TX_GAS_LIMIT = "tx_gas_limit";
 static const char* const SYSTEM_KEY_TX_COUNT_LIMIT = "tx_count_limit";
 static const char* const SYSTEM_KEY_CONSENSUS_LEADER_PERIOD = "consensus_leader_period";
+// the storage formats enabled by the chain, raised once all the nodes support them
+static const char* const SYSTEM_KEY_COMPATIBILITY_VERSION = "compatibility_version";
 
 // system config struct
 using SystemConfigEntry = std::tuple<std::string, bcos::protocol::BlockNumber>;
 
+// the location of a log in the chain
+struct LogLocation
+{
+    bcos::protocol::BlockNumber blockNumber;
+    uint32_t txIndex;
+    uint32_t logIndex;
+
+    bool operator<(LogLocation const& _other) const
+    {
+        return std::tie(blockNumber, txIndex, logIndex) <
+               std::tie(_other.blockNumber, _other.txIndex, _other.logIndex);
+    }
+    bool operator==(LogLocation const& _other) const
+    {
+        return blockNumber == _other.blockNumber && txIndex == _other.txIndex &&
+               logIndex == _other.logIndex;
+    }
+};
+
 const unsigned TX_GAS_LIMIT_MIN = 100000;
 // get consensus node list type
 static const char* const CONSENSUS_SEALER = "consensus_sealer";
@@ -51,6 +73,8 @@ static const char* const CONSENSUS_WORKING_SEALER = "consensus_working_sealer";
 static const char* const SYS_KEY_CURRENT_NUMBER = "current_number";
 static const char* const SYS_KEY_TOTAL_TRANSACTION_COUNT = "total_transaction_count";
 static const char* const SYS_KEY_TOTAL_FAILED_TRANSACTION = "total_failed_transaction_count";
+// the first block number of the log index, chains created before the log index have no such key
+static const char* const SYS_KEY_LOG_INDEX_FROM = "log_index_from_number";
 
 // sys table name
 static const char* const SYS_CONSENSUS = "s_consensus";
@@ -63,5 +87,6 @@ static const char* const SYS_NUMBER_2_BLOCK_HEADER = "s_number_2_header";
 static const char* const SYS_NUMBER_2_TXS = "s_number_2_txs";
 static const char* const SYS_HASH_2_TX = "s_hash_2_tx";
 static const char* const SYS_HASH_2_RECEIPT = "s_hash_2_receipt";
+static const char* const SYS_LOG_INDEX = "s_log_index";
 static const char* const DAG_TRANSFER = "/tables/dag_transfer";
 }  // namespace bcos
@@ -0,0 +1,226 @@
+/*
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief in-process counters and latency histograms of the block lifecycle
+ * @file Metrics.h
+ */
+#pragma once
+#include <bcos-utilities/Common.h>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+
+namespace bcos
+{
+namespace metrics
+{
+// the stages of the block lifecycle, in microseconds
+constexpr static const char* c_sealStage = "sealer.seal";
+constexpr static const char* c_prePrepareStage = "pbft.prePrepare";
+constexpr static const char* c_prepareStage = "pbft.prepare";
+constexpr static const char* c_commitStage = "pbft.commit";
+constexpr static const char* c_executeStage = "scheduler.execute";
+constexpr static const char* c_hashStage = "scheduler.hash";
+constexpr static const char* c_twoPCStage = "scheduler.2pc";
+constexpr static const char* c_notifyStage = "scheduler.notify";
+constexpr static const char* c_storagePrepareStage = "storage.prepare";
+constexpr static const char* c_storageCommitStage = "storage.commit";
+// the committed blocks and transactions
+constexpr static const char* c_committedBlocks = "scheduler.committedBlocks";
+constexpr static const char* c_committedTxs = "scheduler.committedTxs";
+// the transactions fetched from the txpool by the executor per block, the number of the fetch
+// batches, and the time spent waiting for the fetches in milliseconds
+constexpr static const char* c_executorTxFetchCount = "executor.txFetchCount";
+constexpr static const char* c_executorTxFetchBatches = "executor.txFetchBatches";
+constexpr static const char* c_executorTxFetchElapsed = "executor.txFetchElapsed";
+// the contract code calls served by the executor code cache and the ones read from the storage
+constexpr static const char* c_executorCodeCacheHits = "executor.codeCacheHits";
+constexpr static const char* c_executorCodeCacheMisses = "executor.codeCacheMisses";
+// the AMOP messages pushed to the clients by the gateway, the latency is until the client responds
+constexpr static const char* c_amopClientNotify = "amop.clientNotify";
+constexpr static const char* c_amopClientSent = "amop.clientSent";
+constexpr static const char* c_amopClientDropped = "amop.clientDropped";
+// the AMOP broadcast messages dropped by the RPC for the sdk sessions holding too many messages
+constexpr static const char* c_amopSessionDropped = "amop.sessionDropped";
+
+class Counter
+{
+public:
+    void add(uint64_t _value = 1) { m_value.fetch_add(_value, std::memory_order_relaxed); }
+    uint64_t value() const { return m_value.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<uint64_t> m_value = {0};
+};
+
+/// HDR-style histogram: the values below c_linearLimit have their own buckets, and every power
+/// of two above is split into c_subBuckets linear buckets, so the percentiles are reported with
+/// at most 1/c_subBuckets relative error. Recording only takes relaxed atomic operations
+class Histogram
+{
+public:
+    constexpr static size_t c_subBucketBits = 3;
+    constexpr static size_t c_subBuckets = 1 << c_subBucketBits;
+    constexpr static uint64_t c_linearLimit = 2 * c_subBuckets;
+    constexpr static size_t c_bucketNum =
+        c_linearLimit + (64 - c_subBucketBits - 1) * c_subBuckets;
+
+    void record(uint64_t _value)
+    {
+        m_buckets[bucketIndex(_value)].fetch_add(1, std::memory_order_relaxed);
+        m_count.fetch_add(1, std::memory_order_relaxed);
+        m_sum.fetch_add(_value, std::memory_order_relaxed);
+        auto max = m_max.load(std::memory_order_relaxed);
+        while (_value > max && !m_max.compare_exchange_weak(max, _value, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    void recordElapsed(std::chrono::steady_clock::time_point _start)
+    {
+        record(std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - _start)
+                   .count());
+    }
+
+    uint64_t count() const { return m_count.load(std::memory_order_relaxed); }
+    uint64_t sum() const { return m_sum.load(std::memory_order_relaxed); }
+    uint64_t max() const { return m_max.load(std::memory_order_relaxed); }
+
+    // the upper bound of the bucket holding the _percentile (0~100) of the recorded values
+    uint64_t percentile(double _percentile) const
+    {
+        auto count = this->count();
+        if (count == 0)
+        {
+            return 0;
+        }
+        auto rank = (uint64_t)(_percentile / 100 * count + 0.5);
+        rank = std::max<uint64_t>(rank, 1);
+        uint64_t accumulated = 0;
+        for (size_t i = 0; i < c_bucketNum; i++)
+        {
+            accumulated += m_buckets[i].load(std::memory_order_relaxed);
+            if (accumulated >= rank)
+            {
+                return std::min(bucketUpperBound(i), max());
+            }
+        }
+        return max();
+    }
+
+    static size_t bucketIndex(uint64_t _value)
+    {
+        if (_value < c_linearLimit)
+        {
+            return _value;
+        }
+        // the index of the highest bit, at least c_subBucketBits + 1
+        size_t exponent = 63 - __builtin_clzll(_value);
+        auto subBucket = (_value >> (exponent - c_subBucketBits)) & (c_subBuckets - 1);
+        return c_linearLimit + (exponent - c_subBucketBits - 1) * c_subBuckets + subBucket;
+    }
+
+    static uint64_t bucketUpperBound(size_t _index)
+    {
+        if (_index < c_linearLimit)
+        {
+            return _index;
+        }
+        auto exponent = (_index - c_linearLimit) / c_subBuckets + c_subBucketBits + 1;
+        auto subBucket = (_index - c_linearLimit) % c_subBuckets;
+        auto width = (uint64_t)1 << (exponent - c_subBucketBits);
+        return ((uint64_t)1 << exponent) + (subBucket + 1) * width - 1;
+    }
+
+private:
+    std::array<std::atomic<uint64_t>, c_bucketNum> m_buckets = {};
+    std::atomic<uint64_t> m_count = {0};
+    std::atomic<uint64_t> m_sum = {0};
+    std::atomic<uint64_t> m_max = {0};
+};
+
+/// The metrics of the process by name, the metrics are never removed so the references handed out
+/// stay valid, the hot paths keep them in static references and never lock
+class MetricsRegistry
+{
+public:
+    static MetricsRegistry& instance()
+    {
+        static MetricsRegistry registry;
+        return registry;
+    }
+
+    Histogram& histogram(std::string const& _name) { return get(m_histograms, _name); }
+    Counter& counter(std::string const& _name) { return get(m_counters, _name); }
+
+    // copy the metrics out, ordered by name
+    std::map<std::string, Histogram const*> histograms() const
+    {
+        return snapshot(m_histograms);
+    }
+    std::map<std::string, Counter const*> counters() const { return snapshot(m_counters); }
+
+private:
+    template <class T>
+    T& get(std::map<std::string, std::unique_ptr<T>>& _metrics, std::string const& _name)
+    {
+        UpgradableGuard l(x_metrics);
+        auto it = _metrics.find(_name);
+        if (it != _metrics.end())
+        {
+            return *it->second;
+        }
+        UpgradeGuard ul(l);
+        auto& metric = _metrics[_name];
+        if (!metric)
+        {
+            metric = std::make_unique<T>();
+        }
+        return *metric;
+    }
+
+    template <class T>
+    std::map<std::string, T const*> snapshot(
+        std::map<std::string, std::unique_ptr<T>> const& _metrics) const
+    {
+        std::map<std::string, T const*> metrics;
+        ReadGuard l(x_metrics);
+        for (auto const& it : _metrics)
+        {
+            metrics[it.first] = it.second.get();
+        }
+        return metrics;
+    }
+
+    std::map<std::string, std::unique_ptr<Histogram>> m_histograms;
+    std::map<std::string, std::unique_ptr<Counter>> m_counters;
+    mutable SharedMutex x_metrics;
+};
+
+inline Histogram& histogram(std::string const& _name)
+{
+    return MetricsRegistry::instance().histogram(_name);
+}
+inline Counter& counter(std::string const& _name)
+{
+    return MetricsRegistry::instance().counter(_name);
+}
+}  // namespace metrics
+}  // namespace bcos
@@ -39,6 +39,7 @@ enum CommonError : int32_t
     NotFoundClientByTopicDispatchMsg = 3002,
     AMOPSendMsgFailed = 3003,
     UnSupportedPacketType = 3004,
+    AMOPClientBusy = 3005,
 };
 
 }  // namespace protocol
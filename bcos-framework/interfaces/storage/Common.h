@@ -32,6 +32,7 @@
 #include <gsl/span>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -66,9 +67,47 @@ struct Condition
     // string compare, "12" < "2"
     void LT(const std::string& value) { m_conditions.emplace_back(Comparator::LT, value); }
     void LE(const std::string& value) { m_conditions.emplace_back(Comparator::LE, value); }
-    void limit(size_t start, size_t end) { m_limit = std::pair<size_t, size_t>(start, end); }
+    // skip the first start matched keys in key order and return at most count keys, count 0
+    // means no limit
+    void limit(size_t start, size_t count) { m_limit = std::pair<size_t, size_t>(start, count); }
 
     std::pair<size_t, size_t> getLimit() const { return m_limit; }
+    bool hasLimit() const { return m_limit.first > 0 || m_limit.second > 0; }
+
+    // the smallest key may satisfy GT and GE, a range scan seeks to it
+    std::string lowerBound() const
+    {
+        std::string bound;
+        for (auto& cond : m_conditions)
+        {
+            if (cond.cmp == Comparator::GT || cond.cmp == Comparator::GE)
+            {
+                // the successor of value is value + '\0'
+                auto key = cond.cmp == Comparator::GT ? cond.value + '\0' : cond.value;
+                bound = std::max(bound, key);
+            }
+        }
+        return bound;
+    }
+
+    // keys not less than the bound can't satisfy LT and LE, a range scan stops at it, nullopt
+    // if there is no LT or LE
+    std::optional<std::string> upperBound() const
+    {
+        std::optional<std::string> bound;
+        for (auto& cond : m_conditions)
+        {
+            if (cond.cmp == Comparator::LT || cond.cmp == Comparator::LE)
+            {
+                auto key = cond.cmp == Comparator::LE ? cond.value + '\0' : cond.value;
+                if (!bound || key < *bound)
+                {
+                    bound = std::move(key);
+                }
+            }
+        }
+        return bound;
+    }
 
     bool isValid(const std::string_view& key) const
     {  // all conditions must be satisfied
@@ -131,7 +170,7 @@ struct Condition
     };
 
     std::vector<cond> m_conditions;
-    std::pair<size_t, size_t> m_limit;
+    std::pair<size_t, size_t> m_limit = {0, 0};
 };
 
 class TableInfo
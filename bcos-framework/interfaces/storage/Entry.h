@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Common.h"
+#include "EntryCodec.h"
 #include <bcos-utilities/Common.h>
 #include <bcos-utilities/Error.h>
 #include <boost/archive/basic_archive.hpp>
@@ -50,11 +51,27 @@ public:
 
     ~Entry() noexcept {}
 
+    // Values in the compact format of EntryCodec.h, told by their header, are decoded by the
+    // codec, the others by boost archive
     template <typename Out, typename InputArchive = boost::archive::binary_iarchive,
         int flag = ARCHIVE_FLAG>
     void getObject(Out& out) const
     {
         auto view = get();
+        if (codec::isCompact(view))
+        {
+            if constexpr (codec::isCompactType<Out>)
+            {
+                if (codec::decodeCompact(view, out))
+                {
+                    return;
+                }
+            }
+            BOOST_THROW_EXCEPTION(BCOS_ERROR(StorageError::UnknownEntryType,
+                "Decode compact object failed, version: " +
+                    std::to_string((int)codec::compactVersion(view))));
+        }
+
         boost::iostreams::stream<boost::iostreams::array_source> inputStream(
             view.data(), view.size());
         InputArchive archive(inputStream, flag);
@@ -87,6 +104,23 @@ public:
         setField(0, std::move(value));
     }
 
+    // Objects made of integers, strings, vectors and tuples are written in the compact format
+    // once the chain compatibility version reaches codec::COMPACT_COMPATIBILITY_VERSION, and with
+    // boost archive before it, so all the nodes write the same rows for the same block
+    template <typename In>
+    void setObject(const In& in, uint32_t compatibilityVersion)
+    {
+        if constexpr (codec::isCompactType<In>)
+        {
+            if (compatibilityVersion >= codec::COMPACT_COMPATIBILITY_VERSION)
+            {
+                setField(0, codec::encodeCompact(in));
+                return;
+            }
+        }
+        setObject(in);
+    }
+
     std::string_view get() const { return outputValueView(m_value); }
 
     std::string_view getField(size_t index) const
@@ -114,9 +148,10 @@ public:
         set(std::forward<T>(input));
     }
 
-    void set(const char* p)
+    void set(const char* p) { set(std::string_view(p, strlen(p))); }
+
+    void set(std::string_view view)
     {
-        auto view = std::string_view(p, strlen(p));
         m_size = view.size();
         if (view.size() <= SMALL_SIZE)
         {
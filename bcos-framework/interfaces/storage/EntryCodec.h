@@ -0,0 +1,314 @@
+/*
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief compact binary codec of the objects stored in Entry
+ * @file EntryCodec.h
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/// Layout: <format byte 0xff> "BE" <version>, then the fields in declaration order
+///   unsigned integers and enums: LEB128 varint
+///   signed integers: zigzag LEB128 varint
+///   bool: one byte
+///   strings and byte vectors: varint length + raw bytes
+///   vectors: varint count + elements
+///   tuples and pairs: elements, no count
+/// The format of a value is told by its header alone: the header would be the low bytes of a
+/// length over 20M in the boost archive format, which no row of the chain holds. A value with the
+/// header is always decoded by this codec, and a malformed one is an error instead of being handed
+/// to boost archive. The compact values change the state root, so they are written only when the
+/// chain compatibility version reaches COMPACT_COMPATIBILITY_VERSION, see Entry::setObject
+namespace bcos::storage::codec
+{
+constexpr static std::string_view COMPACT_MAGIC = "\xff"
+                                                  "BE";
+constexpr static char COMPACT_VERSION = 1;
+constexpr static size_t COMPACT_HEADER_SIZE = COMPACT_MAGIC.size() + 1;
+
+// the first chain compatibility version whose rows are written in the compact format
+constexpr static uint32_t COMPACT_COMPATIBILITY_VERSION = 1;
+
+template <class T, class = void>
+struct IsCompactType : std::false_type
+{
+};
+template <class T>
+struct IsCompactType<T, std::enable_if_t<std::is_integral_v<T> || std::is_enum_v<T>>>
+  : std::true_type
+{
+};
+template <>
+struct IsCompactType<std::string> : std::true_type
+{
+};
+template <class T, class A>
+struct IsCompactType<std::vector<T, A>>
+  : std::bool_constant<IsCompactType<T>::value && !std::is_same_v<T, bool>>
+{
+};
+template <class... Types>
+struct IsCompactType<std::tuple<Types...>> : std::conjunction<IsCompactType<Types>...>
+{
+};
+template <class First, class Second>
+struct IsCompactType<std::pair<First, Second>>
+  : std::conjunction<IsCompactType<First>, IsCompactType<Second>>
+{
+};
+template <class T>
+constexpr bool isCompactType = IsCompactType<std::remove_cv_t<T>>::value;
+
+template <class T>
+struct IsVector : std::false_type
+{
+};
+template <class T, class A>
+struct IsVector<std::vector<T, A>> : std::true_type
+{
+};
+template <class T>
+struct IsTuple : std::false_type
+{
+};
+template <class... Types>
+struct IsTuple<std::tuple<Types...>> : std::true_type
+{
+};
+template <class First, class Second>
+struct IsTuple<std::pair<First, Second>> : std::true_type
+{
+};
+
+inline void appendVarint(std::string& out, uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        out.push_back((char)((value & 0x7f) | 0x80));
+        value >>= 7;
+    }
+    out.push_back((char)value);
+}
+
+inline bool readVarint(std::string_view& in, uint64_t& value)
+{
+    value = 0;
+    for (size_t i = 0; i < in.size() && i < 10; ++i)
+    {
+        auto byte = (uint8_t)in[i];
+        value |= (uint64_t)(byte & 0x7f) << (7 * i);
+        if (!(byte & 0x80))
+        {
+            in.remove_prefix(i + 1);
+            return true;
+        }
+    }
+    return false;
+}
+
+template <class T>
+void encode(std::string& out, const T& value)
+{
+    if constexpr (std::is_same_v<T, bool>)
+    {
+        out.push_back(value ? 1 : 0);
+    }
+    else if constexpr (std::is_enum_v<T>)
+    {
+        encode(out, static_cast<std::underlying_type_t<T>>(value));
+    }
+    else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>)
+    {
+        auto number = (int64_t)value;
+        appendVarint(out, ((uint64_t)number << 1) ^ (uint64_t)(number >> 63));
+    }
+    else if constexpr (std::is_integral_v<T>)
+    {
+        appendVarint(out, (uint64_t)value);
+    }
+    else if constexpr (std::is_same_v<T, std::string>)
+    {
+        appendVarint(out, value.size());
+        out.append(value.data(), value.size());
+    }
+    else if constexpr (IsVector<T>::value)
+    {
+        appendVarint(out, value.size());
+        if constexpr (sizeof(typename T::value_type) == 1 &&
+                      std::is_integral_v<typename T::value_type>)
+        {
+            out.append((const char*)value.data(), value.size());
+        }
+        else
+        {
+            for (auto& element : value)
+            {
+                encode(out, element);
+            }
+        }
+    }
+    else if constexpr (IsTuple<T>::value)
+    {
+        std::apply([&out](auto const&... element) { (encode(out, element), ...); }, value);
+    }
+    else
+    {
+        static_assert(isCompactType<T>, "Unsupported type of the compact codec");
+    }
+}
+
+template <class T>
+bool decode(std::string_view& in, T& value)
+{
+    if constexpr (std::is_same_v<T, bool>)
+    {
+        if (in.empty())
+        {
+            return false;
+        }
+        value = in[0] != 0;
+        in.remove_prefix(1);
+        return true;
+    }
+    else if constexpr (std::is_enum_v<T>)
+    {
+        std::underlying_type_t<T> number;
+        if (!decode(in, number))
+        {
+            return false;
+        }
+        value = static_cast<T>(number);
+        return true;
+    }
+    else if constexpr (std::is_integral_v<T>)
+    {
+        uint64_t number;
+        if (!readVarint(in, number))
+        {
+            return false;
+        }
+        if constexpr (std::is_signed_v<T>)
+        {
+            value = (T)((int64_t)(number >> 1) ^ -(int64_t)(number & 1));
+        }
+        else
+        {
+            value = (T)number;
+        }
+        return true;
+    }
+    else if constexpr (std::is_same_v<T, std::string>)
+    {
+        uint64_t size;
+        if (!readVarint(in, size) || size > in.size())
+        {
+            return false;
+        }
+        value = T(in.data(), size);
+        in.remove_prefix(size);
+        return true;
+    }
+    else if constexpr (IsVector<T>::value)
+    {
+        uint64_t count;
+        if (!readVarint(in, count))
+        {
+            return false;
+        }
+        if constexpr (sizeof(typename T::value_type) == 1 &&
+                      std::is_integral_v<typename T::value_type>)
+        {
+            if (count > in.size())
+            {
+                return false;
+            }
+            value.assign((const typename T::value_type*)in.data(),
+                (const typename T::value_type*)in.data() + count);
+            in.remove_prefix(count);
+            return true;
+        }
+        else
+        {
+            // every element takes at least one byte, reject bogus counts before resizing
+            if (count > in.size())
+            {
+                return false;
+            }
+            value.resize(count);
+            for (auto& element : value)
+            {
+                if (!decode(in, element))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+    }
+    else if constexpr (IsTuple<T>::value)
+    {
+        return std::apply(
+            [&in](auto&... element) { return (decode(in, element) && ...); }, value);
+    }
+    else
+    {
+        static_assert(isCompactType<T>, "Unsupported type of the compact codec");
+        return false;
+    }
+}
+
+// whether data is in the compact format, of any version
+inline bool isCompact(std::string_view data)
+{
+    return data.size() >= COMPACT_HEADER_SIZE &&
+           data.substr(0, COMPACT_MAGIC.size()) == COMPACT_MAGIC;
+}
+
+inline char compactVersion(std::string_view data)
+{
+    return data[COMPACT_MAGIC.size()];
+}
+
+template <class T>
+std::string encodeCompact(const T& value)
+{
+    std::string out;
+    out.reserve(COMPACT_HEADER_SIZE + 32);
+    out.append(COMPACT_MAGIC);
+    out.push_back(COMPACT_VERSION);
+    encode(out, value);
+    return out;
+}
+
+// return false if data is malformed or of an unknown version, data must be compact
+template <class T>
+bool decodeCompact(std::string_view data, T& value)
+{
+    if (compactVersion(data) != COMPACT_VERSION)
+    {
+        return false;
+    }
+    data.remove_prefix(COMPACT_HEADER_SIZE);
+    return decode(data, value) && data.empty();
+}
+}  // namespace bcos::storage::codec
@@ -49,6 +49,22 @@ public:
     virtual void asyncSubmit(
         bytesPointer _tx, bcos::protocol::TxSubmitCallback _txSubmitCallback) = 0;
 
+    /**
+     * @brief submit a batch of transactions
+     *
+     * @param _txs the transactions to be submitted
+     * @param _txSubmitCallbacks the callbacks of the transactions, _txSubmitCallbacks[i] is
+     * triggered with the result of _txs[i]
+     */
+    virtual void asyncSubmitBatch(std::vector<bytesPointer> _txs,
+        std::vector<bcos::protocol::TxSubmitCallback> _txSubmitCallbacks)
+    {
+        for (size_t i = 0; i < _txs.size(); ++i)
+        {
+            asyncSubmit(std::move(_txs[i]), std::move(_txSubmitCallbacks[i]));
+        }
+    }
+
     /**
      * @brief fetch transactions from the txpool
      *
@@ -74,6 +90,24 @@ public:
     virtual void asyncVerifyBlock(bcos::crypto::PublicPtr _generatedNodeID,
         bytesConstRef const& _block, std::function<void(Error::Ptr, bool)> _onVerifyFinished) = 0;
 
+    /**
+     * @brief resolve the transactions of a compact proposal against the txpool, the transactions
+     * missing from the txpool are fetched from the leader
+     *
+     * @param _generatedNodeID the NodeID of the leader
+     * @param _proposalHash the hash of the proposal
+     * @param _salt the salt of the short ids, see shortTxID
+     * @param _shortTxIDs the short ids of the transactions in the proposal
+     * @param _txsDigest the txsHashDigest of the transactions in the proposal, the resolved
+     * transactions must match it
+     * @param _onResolved called with the block of the transaction metaData in the order of the
+     * short ids
+     */
+    virtual void asyncResolveShortTxIDs(bcos::crypto::PublicPtr _generatedNodeID,
+        bcos::crypto::HashType const& _proposalHash, uint64_t _salt, ShortTxIDsPtr _shortTxIDs,
+        bcos::crypto::HashType const& _txsDigest,
+        std::function<void(Error::Ptr, bcos::protocol::Block::Ptr)> _onResolved) = 0;
+
     /**
      * @brief The dispatcher obtains the transaction list corresponding to the block from the
      * transaction pool
@@ -18,8 +18,11 @@
  * @date: 2021-05-07
  */
 #pragma once
+#include <bcos-crypto/interfaces/crypto/Hash.h>
 #include <bcos-crypto/interfaces/crypto/KeyInterface.h>
 #include <bcos-utilities/Log.h>
+#include <cstring>
+#include <vector>
 
 #define TXPOOL_LOG(LEVEL) BCOS_LOG(LEVEL) << LOG_BADGE("TXPOOL")
 
@@ -29,5 +32,56 @@ namespace txpool
 {
 using TxsHashSet = std::set<bcos::crypto::HashType>;
 using TxsHashSetPtr = std::shared_ptr<TxsHashSet>;
+
+// short ids of the compact relay, which identify the transactions of proposals and txs status
+// announcements instead of the full hashes
+using ShortTxIDs = std::vector<uint64_t>;
+using ShortTxIDsPtr = std::shared_ptr<ShortTxIDs>;
+
+// The txs status is salted by the receiver of the announcement, but the compact proposal is
+// salted by the leader, which can grind transactions colliding with the ones of the replicas.
+// The short ids only save bandwidth: the transactions resolved from them are checked against the
+// full hashes, see txsHashDigest, and are never trusted on their own
+inline uint64_t shortTxID(uint64_t _salt, bcos::crypto::HashType const& _txHash)
+{
+    // splitmix64 over the words of the hash, keyed by the salt
+    uint64_t id = _salt;
+    for (size_t i = 0; i + sizeof(uint64_t) <= bcos::crypto::HashType::size; i += sizeof(uint64_t))
+    {
+        uint64_t word;
+        memcpy(&word, _txHash.data() + i, sizeof(word));
+        id = (id ^ word) + 0x9e3779b97f4a7c15ULL;
+        id = (id ^ (id >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        id = (id ^ (id >> 27)) * 0x94d049bb133111ebULL;
+        id ^= id >> 31;
+    }
+    return id;
+}
+
+// The compact proposals of one epoch are salted alike by all the leaders, so the replicas keep one
+// short id index per epoch however many leaders rotate. The salt is predictable, which costs no
+// more than the grinding of a leader, see shortTxID
+constexpr int64_t c_shortTxIDSaltEpoch = 1000;
+inline uint64_t proposalShortTxIDSalt(int64_t _index)
+{
+    uint64_t salt = (uint64_t)(_index / c_shortTxIDSaltEpoch) + 0x9e3779b97f4a7c15ULL;
+    salt = (salt ^ (salt >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    salt = (salt ^ (salt >> 27)) * 0x94d049bb133111ebULL;
+    salt ^= salt >> 31;
+    // the salt 0 marks the proposals with full transactions
+    return salt == 0 ? 1 : salt;
+}
+
+// the digest of the hash list of the transactions identified by the short ids
+inline bcos::crypto::HashType txsHashDigest(
+    bcos::crypto::Hash::Ptr const& _hashImpl, bcos::crypto::HashList const& _txsHash)
+{
+    bytes txsHashData;
+    for (auto const& txHash : _txsHash)
+    {
+        txsHashData.insert(txsHashData.end(), txHash.begin(), txHash.end());
+    }
+    return _hashImpl->hash(txsHashData);
+}
 }  // namespace txpool
 }  // namespace bcos
\ No newline at end of file
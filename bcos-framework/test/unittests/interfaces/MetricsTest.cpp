@@ -0,0 +1,90 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief Unit tests for the metrics
+ * @file MetricsTest.cpp
+ */
+#include "bcos-framework/interfaces/metrics/Metrics.h"
+#include <bcos-utilities/testutils/TestPromptFixture.h>
+#include <boost/test/unit_test.hpp>
+#include <limits>
+#include <vector>
+using namespace bcos;
+using namespace bcos::metrics;
+namespace bcos
+{
+namespace test
+{
+BOOST_FIXTURE_TEST_SUITE(MetricsTest, TestPromptFixture)
+BOOST_AUTO_TEST_CASE(testHistogramBuckets)
+{
+    // every value falls into the bucket whose upper bound is the nearest above it
+    std::vector<uint64_t> values = {0, 1, 15, 16, 17, 100, 1000, 123456789, (uint64_t)1 << 40,
+        std::numeric_limits<uint64_t>::max()};
+    for (auto value : values)
+    {
+        auto index = Histogram::bucketIndex(value);
+        BOOST_CHECK(index < Histogram::c_bucketNum);
+        BOOST_CHECK(Histogram::bucketUpperBound(index) >= value);
+        if (index > 0)
+        {
+            BOOST_CHECK(Histogram::bucketUpperBound(index - 1) < value);
+        }
+        // the relative error is bounded by the sub buckets
+        BOOST_CHECK(Histogram::bucketUpperBound(index) - value <= value / Histogram::c_subBuckets);
+    }
+    BOOST_CHECK(
+        Histogram::bucketIndex(std::numeric_limits<uint64_t>::max()) == Histogram::c_bucketNum - 1);
+}
+
+BOOST_AUTO_TEST_CASE(testHistogramPercentile)
+{
+    Histogram histogram;
+    BOOST_CHECK(histogram.percentile(50) == 0);
+    for (uint64_t i = 1; i <= 1000; i++)
+    {
+        histogram.record(i);
+    }
+    BOOST_CHECK(histogram.count() == 1000);
+    BOOST_CHECK(histogram.sum() == 500500);
+    BOOST_CHECK(histogram.max() == 1000);
+    auto p50 = histogram.percentile(50);
+    BOOST_CHECK(p50 >= 500 && p50 <= 500 + 500 / Histogram::c_subBuckets);
+    auto p99 = histogram.percentile(99);
+    BOOST_CHECK(p99 >= 990 && p99 <= 1000);
+    BOOST_CHECK(histogram.percentile(100) == 1000);
+}
+
+BOOST_AUTO_TEST_CASE(testMetricsRegistry)
+{
+    auto& registry = MetricsRegistry::instance();
+    auto& latency = histogram("test.latency");
+    BOOST_CHECK(&latency == &registry.histogram("test.latency"));
+    latency.record(10);
+    auto& txs = counter("test.txs");
+    txs.add();
+    txs.add(9);
+    BOOST_CHECK(registry.counter("test.txs").value() == 10);
+
+    auto histograms = registry.histograms();
+    BOOST_CHECK(histograms.count("test.latency"));
+    BOOST_CHECK(histograms.at("test.latency")->count() == 1);
+    auto counters = registry.counters();
+    BOOST_CHECK(counters.count("test.txs"));
+    BOOST_CHECK(!counters.count("test.latency"));
+}
+BOOST_AUTO_TEST_SUITE_END()
+}  // namespace test
+}  // namespace bcos
@@ -20,7 +20,9 @@
  */
 #pragma once
 #include "../../interfaces/protocol/CommonError.h"
+#include "../../interfaces/protocol/BlockFactory.h"
 #include "../../interfaces/txpool/TxPoolInterface.h"
+#include <map>
 #include <bcos-utilities/ThreadPool.h>
 
 using namespace bcos;
@@ -95,6 +97,59 @@ public:
         });
     }
 
+    // resolve the short ids from the known txs, the missed ones are not fetched from the leader
+    void asyncResolveShortTxIDs(PublicPtr, HashType const&, uint64_t _salt,
+        ShortTxIDsPtr _shortTxIDs, HashType const& _txsDigest,
+        std::function<void(Error::Ptr, Block::Ptr)> _onResolved) override
+    {
+        m_worker->enqueue([this, _salt, _shortTxIDs, _txsDigest, _onResolved]() {
+            if (!m_knownTxs)
+            {
+                _onResolved(std::make_shared<Error>(
+                                CommonError::TransactionsMissing, "TransactionsMissing"),
+                    nullptr);
+                return;
+            }
+            std::map<uint64_t, TransactionMetaData::ConstPtr> knownTxs;
+            for (size_t i = 0; i < m_knownTxs->transactionsMetaDataSize(); i++)
+            {
+                auto txMetaData = m_knownTxs->transactionMetaData(i);
+                knownTxs[shortTxID(_salt, txMetaData->hash())] = txMetaData;
+            }
+            auto txsMetaData = m_blockFactory->createBlock();
+            HashList txsHash;
+            for (auto const& id : *_shortTxIDs)
+            {
+                auto it = knownTxs.find(id);
+                if (it == knownTxs.end())
+                {
+                    _onResolved(std::make_shared<Error>(
+                                    CommonError::TransactionsMissing, "TransactionsMissing"),
+                        nullptr);
+                    return;
+                }
+                txsMetaData->appendTransactionMetaData(
+                    std::const_pointer_cast<TransactionMetaData>(it->second));
+                txsHash.emplace_back(it->second->hash());
+            }
+            if (txsHashDigest(m_blockFactory->cryptoSuite()->hashImpl(), txsHash) != _txsDigest)
+            {
+                _onResolved(std::make_shared<Error>(CommonError::InconsistentTransactions,
+                                "InconsistentTransactions"),
+                    nullptr);
+                return;
+            }
+            _onResolved(nullptr, txsMetaData);
+        });
+    }
+
+    // the txs resolved by asyncResolveShortTxIDs, all the short ids are missed if not set
+    void setKnownTxs(BlockFactory::Ptr _blockFactory, Block::Ptr _knownTxs)
+    {
+        m_blockFactory = _blockFactory;
+        m_knownTxs = _knownTxs;
+    }
+
     void setVerifyResult(bool _verifyResult) { m_verifyResult = _verifyResult; }
     bool verifyResult() const { return m_verifyResult; }
 
@@ -103,6 +158,8 @@ public:
 private:
     bool m_verifyResult = true;
     std::shared_ptr<ThreadPool> m_worker = nullptr;
+    BlockFactory::Ptr m_blockFactory;
+    Block::Ptr m_knownTxs;
 };
 }  // namespace test
 }  // namespace bcos
\ No newline at end of file
@@ -123,9 +123,9 @@ void Gateway::asyncGetNodeIDs(const std::string& _groupID, GetNodeIDsFunc _getNo
 void Gateway::asyncSendMessageByNodeID(const std::string& _groupID, NodeIDPtr _srcNodeID,
     NodeIDPtr _dstNodeID, bytesConstRef _payload, ErrorRespFunc _errorRespFunc)
 {
-    auto p2pIDs =
-        m_gatewayNodeManager->peersRouterTable()->queryP2pIDs(_groupID, _dstNodeID->hex());
-    if (p2pIDs.empty())
+    // the shared p2pID list of the route, no copy or hex conversion of the nodeID
+    auto p2pIDs = m_gatewayNodeManager->peersRouterTable()->routeP2pIDs(_groupID, _dstNodeID);
+    if (!p2pIDs)
     {
         if (m_gatewayNodeManager->localRouterTable()->sendMessage(
                 _groupID, _srcNodeID, _dstNodeID, _payload, _errorRespFunc))
@@ -150,27 +150,22 @@ void Gateway::asyncSendMessageByNodeID(const std::string& _groupID, NodeIDPtr _s
     class Retry : public std::enable_shared_from_this<Retry>
     {
     public:
-        // random choose one p2pID to send message
-        P2pID randomChooseP2pID()
+        // the gateways are tried in turn from a random one
+        void chooseFirstP2pID()
         {
-            auto p2pId = P2pID();
-            if (!m_p2pIDs.empty())
-            {
-                // shuffle
-                std::random_device rd;
-                std::default_random_engine rng(rd());
-                std::shuffle(m_p2pIDs.begin(), m_p2pIDs.end(), rng);
-                p2pId = *m_p2pIDs.begin();
-                m_p2pIDs.erase(m_p2pIDs.begin());
-            }
+            thread_local std::mt19937 rng(std::random_device{}());
+            m_firstChoice = std::uniform_int_distribution<size_t>(0, m_p2pIDs->size() - 1)(rng);
+        }
 
-            return p2pId;
+        P2pID const& chooseP2pID()
+        {
+            return (*m_p2pIDs)[(m_firstChoice + m_triedTimes++) % m_p2pIDs->size()];
         }
 
         // send the message with retry
         void trySendMessage()
         {
-            if (m_p2pIDs.empty())
+            if (m_triedTimes >= m_p2pIDs->size())
             {
                 GATEWAY_LOG(ERROR)
                     << LOG_DESC("[Gateway::Retry]") << LOG_DESC("unable to send the message")
@@ -186,9 +181,10 @@ void Gateway::asyncSendMessageByNodeID(const std::string& _groupID, NodeIDPtr _s
                 }
                 return;
             }
-            auto p2pID = randomChooseP2pID();
+            // the p2pID is kept alive by the p2pID list of self
+            auto const& p2pID = chooseP2pID();
             auto self = shared_from_this();
-            auto callback = [self, p2pID](NetworkException e, std::shared_ptr<P2PSession> session,
+            auto callback = [self, &p2pID](NetworkException e, std::shared_ptr<P2PSession> session,
                                 std::shared_ptr<P2PMessage> message) {
                 boost::ignore_unused(session);
                 // network error
@@ -205,9 +201,9 @@ void Gateway::asyncSendMessageByNodeID(const std::string& _groupID, NodeIDPtr _s
 
                 try
                 {
-                    auto payload = message->payload();
+                    auto payload = message->payloadRef();
                     int respCode =
-                        boost::lexical_cast<int>(std::string(payload->begin(), payload->end()));
+                        boost::lexical_cast<int>(std::string(payload.begin(), payload.end()));
                     // the peer gateway not response not ok ,it means the gateway not dispatch the
                     // message successfully,find another gateway and try again
                     if (respCode != CommonError::SUCCESS)
@@ -233,8 +229,8 @@ void Gateway::asyncSendMessageByNodeID(const std::string& _groupID, NodeIDPtr _s
                 {
                     GATEWAY_LOG(ERROR)
                         << LOG_BADGE("trySendMessage and receive response exception")
-                        << LOG_KV("payload",
-                               std::string(message->payload()->begin(), message->payload()->end()))
+                        << LOG_KV("payload", std::string(message->payloadRef().begin(),
+                                                 message->payloadRef().end()))
                         << LOG_KV("packetType", message->packetType())
                         << LOG_KV("src", message->options() ?
                                              toHex(*(message->options()->srcNodeID())) :
@@ -249,7 +245,10 @@ void Gateway::asyncSendMessageByNodeID(const std::string& _groupID, NodeIDPtr _s
         }
 
     public:
-        std::vector<P2pID> m_p2pIDs;
+        // immutable, shared with the router table
+        PeersRouterTable::P2pIDListPtr m_p2pIDs;
+        size_t m_firstChoice = 0;
+        size_t m_triedTimes = 0;
         NodeIDPtr m_srcNodeID;
         NodeIDPtr m_dstNodeID;
         std::shared_ptr<P2PMessage> m_p2pMessage;
@@ -269,7 +268,8 @@ void Gateway::asyncSendMessageByNodeID(const std::string& _groupID, NodeIDPtr _s
     message->setPayload(std::make_shared<bytes>(_payload.begin(), _payload.end()));
 
     retry->m_p2pMessage = message;
-    retry->m_p2pIDs.insert(retry->m_p2pIDs.begin(), p2pIDs.begin(), p2pIDs.end());
+    retry->m_p2pIDs = std::move(p2pIDs);
+    retry->chooseFirstP2pID();
     retry->m_respFunc = _errorRespFunc;
     retry->m_srcNodeID = _srcNodeID;
     retry->m_dstNodeID = _dstNodeID;
@@ -402,8 +402,7 @@ void Gateway::onReceiveP2PMessage(
     auto groupID = options->groupID();
     auto srcNodeID = options->srcNodeID();
     const auto& dstNodeIDs = options->dstNodeIDs();
-    auto payload = _msg->payload();
-    auto bytesConstRefPayload = bytesConstRef(payload->data(), payload->size());
+    auto bytesConstRefPayload = _msg->payloadRef();
     auto srcNodeIDPtr = m_gatewayNodeManager->keyFactory()->createKey(*srcNodeID.get());
     auto dstNodeIDPtr = m_gatewayNodeManager->keyFactory()->createKey(*dstNodeIDs[0].get());
     auto gateway = std::weak_ptr<Gateway>(shared_from_this());
@@ -444,5 +443,5 @@ void Gateway::onReceiveBroadcastMessage(
     auto groupID = _msg->options()->groupID();
     auto type = _msg->ext();
     m_gatewayNodeManager->localRouterTable()->asyncBroadcastMsg(type, groupID, srcNodeIDPtr,
-        bytesConstRef(_msg->payload()->data(), _msg->payload()->size()));
+        _msg->payloadRef());
 }
\ No newline at end of file
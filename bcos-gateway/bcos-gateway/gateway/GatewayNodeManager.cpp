@@ -104,7 +104,7 @@ void GatewayNodeManager::onReceiveStatusSeq(
         return;
     }
     auto statusSeq = boost::asio::detail::socket_ops::network_to_host_long(
-        *((uint32_t*)_msg->payload()->data()));
+        *((uint32_t*)_msg->payloadRef().data()));
     auto statusSeqChanged = statusChanged(_session->p2pID(), statusSeq);
     NODE_MANAGER_LOG(TRACE) << LOG_DESC("onReceiveStatusSeq") << LOG_KV("p2pid", _session->p2pID())
                             << LOG_KV("statusSeq", statusSeq)
@@ -138,7 +138,7 @@ void GatewayNodeManager::onReceiveNodeStatus(
         return;
     }
     auto gatewayNodeStatus = m_gatewayNodeStatusFactory->createGatewayNodeStatus();
-    gatewayNodeStatus->decode(bytesConstRef(_msg->payload()->data(), _msg->payload()->size()));
+    gatewayNodeStatus->decode(_msg->payloadRef());
     auto p2pID = _session->p2pID();
     NODE_MANAGER_LOG(INFO) << LOG_DESC("onReceiveNodeStatus") << LOG_KV("p2pid", p2pID)
                            << LOG_KV("seq", gatewayNodeStatus->seq())
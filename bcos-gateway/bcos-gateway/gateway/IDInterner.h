@@ -0,0 +1,270 @@
+/*
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @file IDInterner.h
+ * @brief dense indexes of the group and node identifiers of the router tables
+ */
+#pragma once
+#include <bcos-crypto/interfaces/crypto/KeyInterface.h>
+#include <bcos-utilities/Common.h>
+#include <bcos-utilities/DataConvertUtility.h>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace bcos
+{
+namespace gateway
+{
+/// Maps identifiers to dense indexes, the router tables intern the groups and nodes when they
+/// are registered and keep the routes in arrays indexed by them, so routing a message only looks
+/// up the indexes without building any string.
+/// The released indexes are reused by the next interned identifiers, so the indexes stay below
+/// the number of the identifiers in use at once.
+/// Not thread-safe, guarded by the mutex of the owner
+class IDInterner
+{
+public:
+    using Index = uint32_t;
+    constexpr static Index c_invalidIndex = std::numeric_limits<Index>::max();
+
+    Index intern(std::string_view _id)
+    {
+        auto it = m_indexes.find(_id);
+        if (it != m_indexes.end())
+        {
+            return it->second;
+        }
+        Index index;
+        if (!m_freeIndexes.empty())
+        {
+            index = m_freeIndexes.back();
+            m_freeIndexes.pop_back();
+            m_ids[index] = std::string(_id);
+        }
+        else
+        {
+            // the deque never moves the interned strings, the keys view them
+            m_ids.emplace_back(_id);
+            index = (Index)(m_ids.size() - 1);
+        }
+        m_indexes.emplace(std::string_view(m_ids[index]), index);
+        return index;
+    }
+
+    // the index is reused by the next interned identifier
+    void release(Index _index)
+    {
+        m_indexes.erase(std::string_view(m_ids[_index]));
+        m_ids[_index] = std::string();
+        m_freeIndexes.emplace_back(_index);
+    }
+
+    // c_invalidIndex if _id is not interned
+    Index find(std::string_view _id) const
+    {
+        auto it = m_indexes.find(_id);
+        return it == m_indexes.end() ? c_invalidIndex : it->second;
+    }
+
+    std::string const& id(Index _index) const { return m_ids[_index]; }
+    // the number of the interned identifiers
+    size_t size() const { return m_indexes.size(); }
+
+private:
+    std::deque<std::string> m_ids;
+    std::unordered_map<std::string_view, Index> m_indexes;
+    std::vector<Index> m_freeIndexes;
+};
+
+/// groupID => nodeID => Value of the router tables, the nodes are interned per group so the array
+/// of a group only holds the nodes of the group. Setting a node to nullptr releases its index,
+/// and the index of the group when it has no nodes left.
+/// Not thread-safe, guarded by the mutex of the owner
+template <class Value>
+class GroupNodeTable
+{
+public:
+    // nullptr if the node is not in the group
+    Value const& get(std::string_view _groupID, std::string_view _nodeIDKey) const
+    {
+        static const Value c_empty = nullptr;
+        auto groupIndex = m_groupIDs.find(_groupID);
+        if (groupIndex == IDInterner::c_invalidIndex)
+        {
+            return c_empty;
+        }
+        auto const& group = m_groups[groupIndex];
+        auto nodeIndex = group.nodeIDs.find(_nodeIDKey);
+        if (nodeIndex == IDInterner::c_invalidIndex)
+        {
+            return c_empty;
+        }
+        return group.values[nodeIndex];
+    }
+
+    void set(std::string_view _groupID, std::string_view _nodeIDKey, Value _value)
+    {
+        if (!_value)
+        {
+            erase(_groupID, _nodeIDKey);
+            return;
+        }
+        auto groupIndex = m_groupIDs.intern(_groupID);
+        if (groupIndex >= m_groups.size())
+        {
+            m_groups.resize(groupIndex + 1);
+        }
+        auto& group = m_groups[groupIndex];
+        auto nodeIndex = group.nodeIDs.intern(_nodeIDKey);
+        if (nodeIndex >= group.values.size())
+        {
+            group.values.resize(nodeIndex + 1);
+        }
+        group.values[nodeIndex] = std::move(_value);
+    }
+
+    // _f(nodeIDKey, value) for every node of the group
+    template <class F>
+    void forEachNode(std::string_view _groupID, F _f) const
+    {
+        auto groupIndex = m_groupIDs.find(_groupID);
+        if (groupIndex == IDInterner::c_invalidIndex)
+        {
+            return;
+        }
+        forEachGroupNode(m_groups[groupIndex], _f);
+    }
+
+    // _f(groupID, nodeIDKey, value) for every node
+    template <class F>
+    void forEach(F _f) const
+    {
+        for (IDInterner::Index groupIndex = 0; groupIndex < m_groups.size(); groupIndex++)
+        {
+            auto const& group = m_groups[groupIndex];
+            if (group.nodeIDs.size() == 0)
+            {
+                continue;
+            }
+            auto const& groupID = m_groupIDs.id(groupIndex);
+            forEachGroupNode(group, [&](std::string const& _nodeIDKey, Value const& _value) {
+                _f(groupID, _nodeIDKey, _value);
+            });
+        }
+    }
+
+    // _f(value) returns the updated value of every node, nullptr erases the node
+    template <class F>
+    void update(F _f)
+    {
+        for (IDInterner::Index groupIndex = 0; groupIndex < m_groups.size(); groupIndex++)
+        {
+            auto& group = m_groups[groupIndex];
+            for (IDInterner::Index nodeIndex = 0; nodeIndex < group.values.size(); nodeIndex++)
+            {
+                auto& value = group.values[nodeIndex];
+                if (!value)
+                {
+                    continue;
+                }
+                value = _f(value);
+                if (!value)
+                {
+                    group.nodeIDs.release(nodeIndex);
+                }
+            }
+            if (group.nodeIDs.size() == 0 && !group.values.empty())
+            {
+                releaseGroup(groupIndex);
+            }
+        }
+    }
+
+private:
+    struct Group
+    {
+        IDInterner nodeIDs;
+        // nodeIndex => Value, nullptr for the released indexes
+        std::vector<Value> values;
+    };
+
+    template <class F>
+    void forEachGroupNode(Group const& _group, F _f) const
+    {
+        for (IDInterner::Index nodeIndex = 0; nodeIndex < _group.values.size(); nodeIndex++)
+        {
+            if (_group.values[nodeIndex])
+            {
+                _f(_group.nodeIDs.id(nodeIndex), _group.values[nodeIndex]);
+            }
+        }
+    }
+
+    void erase(std::string_view _groupID, std::string_view _nodeIDKey)
+    {
+        auto groupIndex = m_groupIDs.find(_groupID);
+        if (groupIndex == IDInterner::c_invalidIndex)
+        {
+            return;
+        }
+        auto& group = m_groups[groupIndex];
+        auto nodeIndex = group.nodeIDs.find(_nodeIDKey);
+        if (nodeIndex == IDInterner::c_invalidIndex)
+        {
+            return;
+        }
+        group.values[nodeIndex] = nullptr;
+        group.nodeIDs.release(nodeIndex);
+        if (group.nodeIDs.size() == 0)
+        {
+            releaseGroup(groupIndex);
+        }
+    }
+
+    void releaseGroup(IDInterner::Index _groupIndex)
+    {
+        m_groups[_groupIndex] = Group();
+        m_groupIDs.release(_groupIndex);
+    }
+
+    IDInterner m_groupIDs;
+    // groupIndex => Group, empty for the released indexes
+    std::vector<Group> m_groups;
+};
+
+// the nodes are interned by the raw bytes of the nodeID
+inline std::string_view nodeIDKey(bcos::crypto::NodeIDPtr const& _nodeID)
+{
+    auto const& data = _nodeID->data();
+    return std::string_view((char const*)data.data(), data.size());
+}
+
+// the raw bytes of the hex nodeID, empty if it's not a hex string
+inline std::string nodeIDKey(std::string const& _hexNodeID)
+{
+    auto nodeID = bcos::fromHexString(_hexNodeID);
+    if (!nodeID)
+    {
+        return std::string();
+    }
+    return std::string(nodeID->begin(), nodeID->end());
+}
+}  // namespace gateway
+}  // namespace bcos
@@ -26,15 +26,23 @@ using namespace bcos::gateway;
 using namespace bcos::front;
 using namespace bcos::crypto;
 
+FrontServiceInfo::Ptr LocalRouterTable::frontService(
+    std::string_view _groupID, std::string_view _nodeIDKey) const
+{
+    return m_nodeList.get(_groupID, _nodeIDKey);
+}
+
+void LocalRouterTable::setFrontService(std::string_view _groupID, std::string_view _nodeIDKey,
+    FrontServiceInfo::Ptr _frontServiceInfo)
+{
+    m_nodeList.set(_groupID, _nodeIDKey, std::move(_frontServiceInfo));
+}
+
 FrontServiceInfo::Ptr LocalRouterTable::getFrontService(
     const std::string& _groupID, NodeIDPtr _nodeID) const
 {
     ReadGuard l(x_nodeList);
-    if (!m_nodeList.count(_groupID) || !m_nodeList.at(_groupID).count(_nodeID->hex()))
-    {
-        return nullptr;
-    }
-    return m_nodeList.at(_groupID).at(_nodeID->hex());
+    return frontService(_groupID, nodeIDKey(_nodeID));
 }
 
 std::vector<FrontServiceInfo::Ptr> LocalRouterTable::getGroupFrontServiceList(
@@ -42,14 +50,10 @@ std::vector<FrontServiceInfo::Ptr> LocalRouterTable::getGroupFrontServiceList(
 {
     std::vector<FrontServiceInfo::Ptr> nodeServiceList;
     ReadGuard l(x_nodeList);
-    if (!m_nodeList.count(_groupID))
-    {
-        return nodeServiceList;
-    }
-    for (auto const& it : m_nodeList.at(_groupID))
-    {
-        nodeServiceList.emplace_back(it.second);
-    }
+    m_nodeList.forEachNode(
+        _groupID, [&](std::string const&, FrontServiceInfo::Ptr const& _frontServiceInfo) {
+            nodeServiceList.emplace_back(_frontServiceInfo);
+        });
     return nodeServiceList;
 }
 
@@ -57,15 +61,9 @@ NodeIDs LocalRouterTable::getGroupNodeIDList(const std::string& _groupID) const
 {
     NodeIDs nodeIDList;
     ReadGuard l(x_nodeList);
-    if (!m_nodeList.count(_groupID))
-    {
-        return nodeIDList;
-    }
-    for (auto const& item : m_nodeList.at(_groupID))
-    {
-        auto bytes = bcos::fromHexString(item.first);
-        nodeIDList.emplace_back(m_keyFactory->createKey(*bytes.get()));
-    }
+    m_nodeList.forEachNode(_groupID, [&](std::string const& _nodeID, FrontServiceInfo::Ptr const&) {
+        nodeIDList.emplace_back(m_keyFactory->createKey(bytes(_nodeID.begin(), _nodeID.end())));
+    });
     return nodeIDList;
 }
 
@@ -73,19 +71,21 @@ std::map<std::string, std::set<std::string>> LocalRouterTable::nodeListInfo() co
 {
     std::map<std::string, std::set<std::string>> nodeList;
     ReadGuard l(x_nodeList);
-    for (auto const& it : m_nodeList)
-    {
-        auto groupID = it.first;
-        if (!nodeList.count(groupID))
-        {
-            nodeList[groupID] = std::set<std::string>();
-        }
-        auto const& infos = it.second;
-        for (auto const& nodeIt : infos)
-        {
-            nodeList[groupID].insert(nodeIt.first);
-        }
-    }
+    m_nodeList.forEach([&](std::string const& _groupID, std::string const&,
+                           FrontServiceInfo::Ptr const& _frontServiceInfo) {
+        nodeList[_groupID].insert(_frontServiceInfo->nodeID());
+    });
+    return nodeList;
+}
+
+LocalRouterTable::GroupNodeListType LocalRouterTable::nodeList() const
+{
+    GroupNodeListType nodeList;
+    ReadGuard l(x_nodeList);
+    m_nodeList.forEach([&](std::string const& _groupID, std::string const&,
+                           FrontServiceInfo::Ptr const& _frontServiceInfo) {
+        nodeList[_groupID][_frontServiceInfo->nodeID()] = _frontServiceInfo;
+    });
     return nodeList;
 }
 
@@ -100,21 +100,18 @@ bool LocalRouterTable::insertNode(const std::string& _groupID, NodeIDPtr _nodeID
 {
     auto nodeIDStr = _nodeID->hex();
     UpgradableGuard l(x_nodeList);
-    if (m_nodeList.count(_groupID) && m_nodeList[_groupID].count(nodeIDStr))
+    auto registeredFrontService = frontService(_groupID, nodeIDKey(_nodeID));
+    if (registeredFrontService && registeredFrontService->nodeType() == _type)
     {
-        auto nodeType = (m_nodeList.at(_groupID).at(nodeIDStr))->nodeType();
-        if (_type == nodeType)
-        {
-            ROUTER_LOG(INFO) << LOG_DESC("insertNode: the node has already existed")
-                             << LOG_KV("groupID", _groupID) << LOG_KV("nodeID", nodeIDStr)
-                             << LOG_KV("nodeType", _type);
-            return false;
-        }
+        ROUTER_LOG(INFO) << LOG_DESC("insertNode: the node has already existed")
+                         << LOG_KV("groupID", _groupID) << LOG_KV("nodeID", nodeIDStr)
+                         << LOG_KV("nodeType", _type);
+        return false;
     }
     auto frontServiceInfo =
         std::make_shared<FrontServiceInfo>(nodeIDStr, _frontService, _type, nullptr);
     UpgradeGuard ul(l);
-    m_nodeList[_groupID][nodeIDStr] = frontServiceInfo;
+    setFrontService(_groupID, nodeIDKey(_nodeID), frontServiceInfo);
     ROUTER_LOG(INFO) << LOG_DESC("insertNode") << LOG_KV("groupID", _groupID)
                      << LOG_KV("nodeID", nodeIDStr) << LOG_KV("nodeType", _type);
     return true;
@@ -129,7 +126,7 @@ bool LocalRouterTable::removeNode(const std::string& _groupID, NodeIDPtr _nodeID
 {
     auto nodeIDStr = _nodeID->hex();
     UpgradableGuard l(x_nodeList);
-    if (!m_nodeList.count(_groupID) || !m_nodeList[_groupID].count(nodeIDStr))
+    if (!frontService(_groupID, nodeIDKey(_nodeID)))
     {
         ROUTER_LOG(INFO) << LOG_DESC("removeNode: the node is not registered")
                          << LOG_KV("groupID", _groupID) << LOG_KV("nodeID", nodeIDStr);
@@ -137,11 +134,7 @@ bool LocalRouterTable::removeNode(const std::string& _groupID, NodeIDPtr _nodeID
     }
     // erase the node from m_nodeList
     UpgradeGuard ul(l);
-    (m_nodeList[_groupID]).erase(nodeIDStr);
-    if (m_nodeList.at(_groupID).empty())
-    {
-        m_nodeList.erase(_groupID);
-    }
+    setFrontService(_groupID, nodeIDKey(_nodeID), nullptr);
     ROUTER_LOG(INFO) << LOG_DESC("removeNode") << LOG_KV("groupID", _groupID)
                      << LOG_KV("nodeID", nodeIDStr);
     return true;
@@ -157,14 +150,18 @@ bool LocalRouterTable::updateGroupNodeInfos(bcos::group::GroupInfo::Ptr _groupIn
     {
         auto const& nodeInfo = it.second;
         auto const& nodeID = nodeInfo->nodeID();
+        auto key = nodeIDKey(nodeID);
+        if (key.empty())
+        {
+            ROUTER_LOG(WARNING) << LOG_DESC("updateGroupNodeInfos: ignore invalid nodeID")
+                                << LOG_KV("nodeID", nodeID);
+            continue;
+        }
         // the node is registered
-        if (m_nodeList.count(groupID) && m_nodeList[groupID].count(nodeID))
+        auto registeredFrontService = frontService(groupID, key);
+        if (registeredFrontService && registeredFrontService->nodeType() == nodeInfo->nodeType())
         {
-            auto nodeType = (m_nodeList.at(groupID).at(nodeID))->nodeType();
-            if (nodeType == nodeInfo->nodeType())
-            {
-                continue;
-            }
+            continue;
         }
         // insert the new node
         auto serviceName = nodeInfo->serviceName(bcos::protocol::FRONT);
@@ -178,7 +175,7 @@ bool LocalRouterTable::updateGroupNodeInfos(bcos::group::GroupInfo::Ptr _groupIn
         UpgradeGuard ul(l);
         auto frontServiceInfo = std::make_shared<FrontServiceInfo>(
             nodeInfo->nodeID(), frontService.first, nodeInfo->nodeType(), frontService.second);
-        m_nodeList[groupID][nodeID] = frontServiceInfo;
+        setFrontService(groupID, key, frontServiceInfo);
         ROUTER_LOG(INFO) << LOG_DESC("updateGroupNodeInfos: insert frontService for the node")
                          << LOG_KV("nodeID", nodeInfo->nodeID())
                          << LOG_KV("serviceName", serviceName) << printNodeInfo(nodeInfo);
@@ -190,33 +187,17 @@ bool LocalRouterTable::updateGroupNodeInfos(bcos::group::GroupInfo::Ptr _groupIn
 bool LocalRouterTable::eraseUnreachableNodes()
 {
     bool updated = false;
-    UpgradableGuard l(x_nodeList);
-    for (auto it = m_nodeList.begin(); it != m_nodeList.end();)
-    {
-        auto& nodesInfo = it->second;
-        for (auto pFrontService = nodesInfo.begin(); pFrontService != nodesInfo.end();)
+    WriteGuard l(x_nodeList);
+    m_nodeList.update([&updated](FrontServiceInfo::Ptr const& _frontService) {
+        if (!_frontService->unreachable())
         {
-            auto frontService = pFrontService->second;
-            if (frontService->unreachable())
-            {
-                ROUTER_LOG(INFO) << LOG_DESC("remove FrontService for unreachable")
-                                 << LOG_KV("node", pFrontService->first);
-                UpgradeGuard ul(l);
-                pFrontService = nodesInfo.erase(pFrontService);
-                updated = true;
-                continue;
-            }
-            pFrontService++;
+            return _frontService;
         }
-        if (nodesInfo.size() == 0)
-        {
-            UpgradeGuard ul(l);
-            it = m_nodeList.erase(it);
-            updated = true;
-            continue;
-        }
-        it++;
-    }
+        ROUTER_LOG(INFO) << LOG_DESC("remove FrontService for unreachable")
+                         << LOG_KV("node", _frontService->nodeID());
+        updated = true;
+        return FrontServiceInfo::Ptr();
+    });
     return updated;
 }
 
@@ -228,9 +209,10 @@ bool LocalRouterTable::asyncBroadcastMsg(
     {
         return false;
     }
+    auto srcNodeID = _srcNodeID->hex();
     for (auto const& it : frontServiceList)
     {
-        if (it->nodeID() == _srcNodeID->hex())
+        if (it->nodeID() == srcNodeID)
         {
             continue;
         }
@@ -19,6 +19,7 @@
  */
 #pragma once
 #include "FrontServiceInfo.h"
+#include "IDInterner.h"
 #include "bcos-gateway/libp2p/P2PSession.h"
 #include <bcos-crypto/interfaces/crypto/KeyFactory.h>
 #include <bcos-crypto/interfaces/crypto/KeyInterface.h>
@@ -53,11 +54,7 @@ public:
 
     // Note: copy to ensure thread-safe
     // groupID => nodeID => FrontServiceInfo
-    GroupNodeListType nodeList() const
-    {
-        ReadGuard l(x_nodeList);
-        return m_nodeList;
-    }
+    GroupNodeListType nodeList() const;
 
     bool asyncBroadcastMsg(uint16_t _nodeType, const std::string& _groupID,
         bcos::crypto::NodeIDPtr _srcNodeID, bytesConstRef _payload);
@@ -66,9 +63,15 @@ public:
         bcos::crypto::NodeIDPtr _dstNodeID, bytesConstRef _payload, ErrorRespFunc _errorRespFunc);
 
 private:
+    // the caller holds x_nodeList
+    FrontServiceInfo::Ptr frontService(
+        std::string_view _groupID, std::string_view _nodeIDKey) const;
+    void setFrontService(std::string_view _groupID, std::string_view _nodeIDKey,
+        FrontServiceInfo::Ptr _frontServiceInfo);
+
     bcos::crypto::KeyFactory::Ptr m_keyFactory;
     // groupID => nodeID => FrontServiceInfo
-    GroupNodeListType m_nodeList;
+    GroupNodeTable<FrontServiceInfo::Ptr> m_nodeList;
     mutable SharedMutex x_nodeList;
 };
 }  // namespace gateway
@@ -18,6 +18,7 @@
  * @date 2021-12-29
  */
 #include "PeersRouterTable.h"
+#include <algorithm>
 
 using namespace bcos;
 using namespace bcos::protocol;
@@ -28,46 +29,45 @@ bcos::crypto::NodeIDs PeersRouterTable::getGroupNodeIDList(const std::string& _g
 {
     NodeIDs nodeIDList;
     ReadGuard l(x_groupNodeList);
-    if (!m_groupNodeList.count(_groupID))
-    {
-        return nodeIDList;
-    }
-    for (auto const& it : m_groupNodeList.at(_groupID))
-    {
-        auto nodeID = bcos::fromHexString(it.first);
-        if (!nodeID)
-        {
-            continue;
-        }
-        auto nodeIDPtr = m_keyFactory->createKey(*nodeID.get());
-        nodeIDList.emplace_back(nodeIDPtr);
-    }
+    m_groupNodeList.forEachNode(_groupID, [&](std::string const& _nodeID, P2pIDListPtr const&) {
+        nodeIDList.emplace_back(m_keyFactory->createKey(bytes(_nodeID.begin(), _nodeID.end())));
+    });
     return nodeIDList;
 }
 
+PeersRouterTable::P2pIDListPtr PeersRouterTable::route(
+    std::string_view _groupID, std::string_view _nodeIDKey) const
+{
+    return m_groupNodeList.get(_groupID, _nodeIDKey);
+}
+
+PeersRouterTable::P2pIDListPtr PeersRouterTable::routeP2pIDs(
+    const std::string& _groupID, NodeIDPtr const& _nodeID) const
+{
+    ReadGuard l(x_groupNodeList);
+    return route(_groupID, nodeIDKey(_nodeID));
+}
+
 std::set<P2pID> PeersRouterTable::queryP2pIDs(
     const std::string& _groupID, const std::string& _nodeID) const
 {
+    auto key = nodeIDKey(_nodeID);
     ReadGuard l(x_groupNodeList);
-    if (!m_groupNodeList.count(_groupID) || !m_groupNodeList.at(_groupID).count(_nodeID))
+    auto p2pIDs = route(_groupID, key);
+    if (!p2pIDs)
     {
         return std::set<P2pID>();
     }
-    return m_groupNodeList.at(_groupID).at(_nodeID);
+    return std::set<P2pID>(p2pIDs->begin(), p2pIDs->end());
 }
 
 std::set<P2pID> PeersRouterTable::queryP2pIDsByGroupID(const std::string& _groupID) const
 {
     std::set<P2pID> p2pNodeIDList;
     ReadGuard l(x_groupNodeList);
-    if (!m_groupNodeList.count(_groupID))
-    {
-        return p2pNodeIDList;
-    }
-    for (const auto& it : m_groupNodeList.at(_groupID))
-    {
-        p2pNodeIDList.insert(it.second.begin(), it.second.end());
-    }
+    m_groupNodeList.forEachNode(_groupID, [&](std::string const&, P2pIDListPtr const& _p2pIDs) {
+        p2pNodeIDList.insert(_p2pIDs->begin(), _p2pIDs->end());
+    });
     return p2pNodeIDList;
 }
 
@@ -90,15 +90,25 @@ void PeersRouterTable::batchInsertNodeList(
     WriteGuard l(x_groupNodeList);
     for (auto const& it : _nodeList)
     {
-        auto groupID = it->groupID();
         auto const& nodeIDList = it->nodeIDList();
         for (auto const& nodeID : nodeIDList)
         {
-            if (!m_groupNodeList.count(groupID) || !m_groupNodeList.at(groupID).count(nodeID))
+            auto key = nodeIDKey(nodeID);
+            if (key.empty())
             {
-                m_groupNodeList[groupID][nodeID] = std::set<P2pID>();
+                ROUTER_LOG(WARNING) << LOG_DESC("PeersRouterTable: ignore invalid nodeID")
+                                    << LOG_KV("p2pID", _p2pNodeID) << LOG_KV("nodeID", nodeID);
+                continue;
+            }
+            auto const& p2pIDs = m_groupNodeList.get(it->groupID(), key);
+            if (p2pIDs && std::find(p2pIDs->begin(), p2pIDs->end(), _p2pNodeID) != p2pIDs->end())
+            {
+                continue;
             }
-            m_groupNodeList[groupID][nodeID].insert(_p2pNodeID);
+            auto updatedP2pIDs =
+                p2pIDs ? std::make_shared<P2pIDList>(*p2pIDs) : std::make_shared<P2pIDList>();
+            updatedP2pIDs->emplace_back(_p2pNodeID);
+            m_groupNodeList.set(it->groupID(), key, std::move(updatedP2pIDs));
         }
     }
 }
@@ -117,42 +127,26 @@ void PeersRouterTable::removeP2PID(const P2pID& _p2pID)
 void PeersRouterTable::removeP2PIDFromGroupNodeList(const P2pID& _p2pID)
 {
     WriteGuard l(x_groupNodeList);
-    // remove all nodeIDs info belong to p2pID
-    for (auto it = m_groupNodeList.begin(); it != m_groupNodeList.end();)
-    {
-        for (auto innerIt = it->second.begin(); innerIt != it->second.end();)
+    // remove all nodeIDs info belong to p2pID, the nodes without p2pIDs are erased
+    m_groupNodeList.update([&_p2pID](P2pIDListPtr const& _p2pIDs) -> P2pIDListPtr {
+        if (std::find(_p2pIDs->begin(), _p2pIDs->end(), _p2pID) == _p2pIDs->end())
         {
-            for (auto innerIt2 = innerIt->second.begin(); innerIt2 != innerIt->second.end();)
-            {
-                if (*innerIt2 == _p2pID)
-                {
-                    innerIt2 = innerIt->second.erase(innerIt2);
-                }
-                else
-                {
-                    ++innerIt2;
-                }
-            }
-
-            if (innerIt->second.empty())
-            {
-                innerIt = it->second.erase(innerIt);
-            }
-            else
-            {
-                ++innerIt;
-            }
+            return _p2pIDs;
         }
-
-        if (it->second.empty())
+        auto updatedP2pIDs = std::make_shared<P2pIDList>();
+        for (auto const& p2pID : *_p2pIDs)
         {
-            it = m_groupNodeList.erase(it);
+            if (p2pID != _p2pID)
+            {
+                updatedP2pIDs->emplace_back(p2pID);
+            }
         }
-        else
+        if (updatedP2pIDs->empty())
         {
-            ++it;
+            return nullptr;
         }
-    }
+        return updatedP2pIDs;
+    });
 }
 
 void PeersRouterTable::updatePeerNodeList(P2pID const& _p2pNodeID, GatewayNodeStatus::Ptr _status)
@@ -20,6 +20,7 @@
 #pragma once
 #include "FrontServiceInfo.h"
 #include "GatewayStatus.h"
+#include "IDInterner.h"
 #include <bcos-crypto/interfaces/crypto/KeyFactory.h>
 #include <bcos-crypto/interfaces/crypto/KeyInterface.h>
 #include <bcos-framework/interfaces/gateway/GroupNodeInfo.h>
@@ -36,6 +37,9 @@ class PeersRouterTable
 {
 public:
     using Ptr = std::shared_ptr<PeersRouterTable>;
+    using P2pIDList = std::vector<P2pID>;
+    // the published lists are never modified, the updates replace them
+    using P2pIDListPtr = std::shared_ptr<const P2pIDList>;
     PeersRouterTable(std::string _uuid, bcos::crypto::KeyFactory::Ptr _keyFactory,
         P2PInterface::Ptr _p2pInterface)
       : m_uuid(_uuid),
@@ -47,6 +51,9 @@ public:
 
     bcos::crypto::NodeIDs getGroupNodeIDList(const std::string& _groupID) const;
     std::set<P2pID> queryP2pIDs(const std::string& _groupID, const std::string& _nodeID) const;
+    // the p2p peers routing to the node, nullptr if no route, called for every message
+    P2pIDListPtr routeP2pIDs(
+        const std::string& _groupID, bcos::crypto::NodeIDPtr const& _nodeID) const;
     std::set<P2pID> queryP2pIDsByGroupID(const std::string& _groupID) const;
     void removeP2PID(const P2pID& _p2pID);
 
@@ -69,13 +76,16 @@ protected:
     void removeNodeFromGatewayInfo(P2pID const& _p2pID);
     GatewayStatus::Ptr gatewayInfo(std::string const& _uuid);
 
+    // the caller holds x_groupNodeList
+    P2pIDListPtr route(std::string_view _groupID, std::string_view _nodeIDKey) const;
+
 private:
     std::string m_uuid;
     bcos::crypto::KeyFactory::Ptr m_keyFactory;
     P2PInterface::Ptr m_p2pInterface;
     // used for peer-to-peer router
-    // groupID => NodeID => set<P2pID>
-    std::map<std::string, std::map<std::string, std::set<P2pID>>> m_groupNodeList;
+    // groupID => nodeID => P2pIDs
+    GroupNodeTable<P2pIDListPtr> m_groupNodeList;
     mutable SharedMutex x_groupNodeList;
 
     // the nodeIDList infos of the peers
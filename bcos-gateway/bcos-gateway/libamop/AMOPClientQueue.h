@@ -0,0 +1,195 @@
+/*
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @file AMOPClientQueue.h
+ * @brief bounded queue of the AMOP messages pushed to a client
+ */
+#pragma once
+#include <bcos-framework/interfaces/metrics/Metrics.h>
+#include <bcos-utilities/Common.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <memory>
+
+namespace bcos
+{
+namespace amop
+{
+/// At most m_maxInflight messages are notified to the client at the same time, and at most
+/// m_maxPending messages wait behind them, the messages beyond are dropped, so a slow client
+/// only holds a bounded amount of the gateway memory
+class AMOPClientQueue : public std::enable_shared_from_this<AMOPClientQueue>
+{
+public:
+    using Ptr = std::shared_ptr<AMOPClientQueue>;
+    // send _data to the client, _onSent must be called once the client responds or fails, the
+    // slot is released if _send throws
+    using SendFunc = std::function<void(bytesConstRef _data, std::function<void()> _onSent)>;
+
+    AMOPClientQueue(size_t _maxInflight, size_t _maxPending)
+      : m_maxInflight(std::max<size_t>(_maxInflight, 1)), m_maxPending(_maxPending)
+    {}
+
+    // return false if the queue is full and the message is dropped
+    bool push(bytesConstRef _data, SendFunc _send)
+    {
+        bool sendNow = false;
+        bool startDrain = false;
+        {
+            Guard l(x_queue);
+            // the waiting messages go first
+            if (m_inflight >= m_maxInflight || !m_pending.empty())
+            {
+                if (m_pending.size() >= m_maxPending)
+                {
+                    m_dropped++;
+                    static auto& droppedCounter = metrics::counter(metrics::c_amopClientDropped);
+                    droppedCounter.add();
+                    return false;
+                }
+                // the data is only copied when the message waits
+                m_pending.emplace_back(_data.toBytes(), std::move(_send));
+                startDrain = !m_draining && m_inflight < m_maxInflight;
+                m_draining = m_draining || startDrain;
+            }
+            else
+            {
+                m_inflight++;
+                sendNow = true;
+            }
+        }
+        if (sendNow)
+        {
+            send(_data, _send);
+        }
+        else if (startDrain)
+        {
+            drain();
+        }
+        return true;
+    }
+
+    // the messages being notified and waiting, the unicast messages prefer the least loaded client
+    size_t load() const
+    {
+        Guard l(x_queue);
+        return m_inflight + m_pending.size();
+    }
+    size_t inflight() const
+    {
+        Guard l(x_queue);
+        return m_inflight;
+    }
+    size_t pending() const
+    {
+        Guard l(x_queue);
+        return m_pending.size();
+    }
+    uint64_t sent() const
+    {
+        Guard l(x_queue);
+        return m_sent;
+    }
+    uint64_t dropped() const
+    {
+        Guard l(x_queue);
+        return m_dropped;
+    }
+
+private:
+    void send(bytesConstRef _data, SendFunc const& _send)
+    {
+        std::weak_ptr<AMOPClientQueue> queue = shared_from_this();
+        auto released = std::make_shared<std::atomic_bool>(false);
+        auto startT = std::chrono::steady_clock::now();
+        auto onSent = [queue, released, startT]() {
+            // the slot is released only once even if the callback is called again
+            if (released->exchange(true))
+            {
+                return;
+            }
+            static auto& notifyLatency = metrics::histogram(metrics::c_amopClientNotify);
+            notifyLatency.recordElapsed(startT);
+            auto self = queue.lock();
+            if (self)
+            {
+                self->onSent();
+            }
+        };
+        try
+        {
+            _send(_data, onSent);
+        }
+        catch (std::exception const&)
+        {
+            onSent();
+        }
+    }
+
+    void onSent()
+    {
+        {
+            Guard l(x_queue);
+            m_sent++;
+            static auto& sentCounter = metrics::counter(metrics::c_amopClientSent);
+            sentCounter.add();
+            m_inflight--;
+            // the draining thread picks up the released slot, the send function may call back
+            // synchronously, so the stack never grows with the pending messages
+            if (m_draining || m_pending.empty())
+            {
+                return;
+            }
+            m_draining = true;
+        }
+        drain();
+    }
+
+    // send the pending messages while there are free slots, only one thread drains at a time
+    void drain()
+    {
+        while (true)
+        {
+            std::pair<bytes, SendFunc> next;
+            {
+                Guard l(x_queue);
+                if (m_pending.empty() || m_inflight >= m_maxInflight)
+                {
+                    m_draining = false;
+                    return;
+                }
+                next = std::move(m_pending.front());
+                m_pending.pop_front();
+                m_inflight++;
+            }
+            send(ref(next.first), next.second);
+        }
+    }
+
+    size_t const m_maxInflight;
+    size_t const m_maxPending;
+
+    size_t m_inflight = 0;
+    bool m_draining = false;
+    std::deque<std::pair<bytes, SendFunc>> m_pending;
+    uint64_t m_sent = 0;
+    uint64_t m_dropped = 0;
+    mutable Mutex x_queue;
+};
+}  // namespace amop
+}  // namespace bcos
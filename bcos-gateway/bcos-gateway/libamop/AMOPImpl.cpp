@@ -22,6 +22,7 @@
 #include <bcos-gateway/libamop/AMOPMessage.h>
 #include <bcos-gateway/libnetwork/Common.h>
 #include <boost/bind/bind.hpp>
+#include <limits>
 using namespace bcos;
 using namespace bcos::gateway;
 using namespace bcos::amop;
@@ -86,7 +87,7 @@ void AMOPImpl::onReceiveTopicSeqMessage(P2pID const& _nodeID, AMOPMessage::Ptr _
         Options option(0);
         m_network->asyncSendMessageByP2PNodeID(MessageType::AMOPMessageType, _nodeID,
             bytesConstRef(buffer->data(), buffer->size()), option,
-            [_nodeID](Error::Ptr&& _error, int16_t, bytesPointer) {
+            [_nodeID](Error::Ptr&& _error, int16_t, bytesConstRef) {
                 if (_error && (_error->errorCode() != CommonError::SUCCESS))
                 {
                     AMOP_LOG(WARNING)
@@ -158,7 +159,7 @@ void AMOPImpl::onReceiveRequestTopicMessage(P2pID const& _nodeID, AMOPMessage::P
         Options option(0);
         m_network->asyncSendMessageByP2PNodeID(MessageType::AMOPMessageType, _nodeID,
             bytesConstRef(buffer->data(), buffer->size()), option,
-            [_nodeID](Error::Ptr&& _error, int16_t, bytesPointer) {
+            [_nodeID](Error::Ptr&& _error, int16_t, bytesConstRef) {
                 if (_error && (_error->errorCode() != CommonError::SUCCESS))
                 {
                     AMOP_LOG(WARNING)
@@ -196,21 +197,13 @@ void AMOPImpl::onReceiveAMOPMessage(P2pID const& _nodeID, std::string const& _to
     std::string choosedClient;
     if (!clients.empty())
     {
-        choosedClient = randomChoose(clients);
+        choosedClient = chooseLeastLoadedClient(clients);
         clientService = m_topicManager->createAndGetServiceByClient(choosedClient);
     }
     if (!clientService)
     {
-        auto amopMsg = m_messageFactory->buildMessage();
-        auto buffer = std::make_shared<bcos::bytes>();
-        amopMsg->setStatus(CommonError::NotFoundClientByTopicDispatchMsg);
-        amopMsg->setType(AMOPMessage::Type::AMOPResponse);
-        std::string errorMessage = "NotFoundClientByTopicDispatchMsg";
-        amopMsg->setData(bytesConstRef((bcos::byte*)errorMessage.c_str(), errorMessage.size()));
-        amopMsg->encode(*buffer);
-        m_threadPool->enqueue([buffer, _responseCallback]() {
-            _responseCallback(buffer, MessageType::AMOPMessageType);
-        });
+        responseAMOPError(CommonError::NotFoundClientByTopicDispatchMsg,
+            "NotFoundClientByTopicDispatchMsg", _responseCallback);
         AMOP_LOG(WARNING) << LOG_BADGE("onRecvAMOPMessage")
                           << LOG_DESC("no client subscribe the topic") << LOG_KV("topic", _topic)
                           << LOG_KV("nodeID", _nodeID);
@@ -219,25 +212,76 @@ void AMOPImpl::onReceiveAMOPMessage(P2pID const& _nodeID, std::string const& _to
 
     AMOP_LOG(INFO) << LOG_DESC("onRecvAMOPMessage") << LOG_KV("topic", _topic)
                    << LOG_KV("from", _nodeID) << LOG_KV("choosedClient", choosedClient);
-    clientService->asyncNotifyAMOPMessage(bcos::rpc::AMOPNotifyMessageType::Unicast, _topic, _data,
-        [this, _responseCallback](Error::Ptr&& _error, bytesPointer _responseData) {
-            if (!_error || _error->errorCode() == CommonError::SUCCESS)
-            {
-                _responseCallback(_responseData, MessageType::WSMessageType);
-                return;
-            }
-            auto amopMsg = m_messageFactory->buildMessage();
-            amopMsg->setStatus(_error->errorCode());
-            amopMsg->setType(AMOPMessage::Type::AMOPResponse);
-            auto const& errorMessage = _error->errorMessage();
-            amopMsg->setData(bytesConstRef((bcos::byte*)errorMessage.c_str(), errorMessage.size()));
-            auto buffer = std::make_shared<bcos::bytes>();
-            amopMsg->encode(*buffer);
-            _responseCallback(buffer, MessageType::AMOPMessageType);
-            AMOP_LOG(WARNING) << LOG_DESC("asyncNotifyAMOPMessage error")
-                              << LOG_KV("code", _error->errorCode())
-                              << LOG_KV("msg", _error->errorMessage());
-        });
+    auto clientQueue = m_topicManager->clientQueue(choosedClient);
+    auto sendFunc = [this, clientService, _topic, _responseCallback](
+                        bytesConstRef _payload, std::function<void()> _onSent) {
+        clientService->asyncNotifyAMOPMessage(bcos::rpc::AMOPNotifyMessageType::Unicast, _topic,
+            _payload,
+            [this, _onSent, _responseCallback](Error::Ptr&& _error, bytesPointer _responseData) {
+                _onSent();
+                if (!_error || _error->errorCode() == CommonError::SUCCESS)
+                {
+                    _responseCallback(_responseData, MessageType::WSMessageType);
+                    return;
+                }
+                auto amopMsg = m_messageFactory->buildMessage();
+                amopMsg->setStatus(_error->errorCode());
+                amopMsg->setType(AMOPMessage::Type::AMOPResponse);
+                auto const& errorMessage = _error->errorMessage();
+                amopMsg->setData(
+                    bytesConstRef((bcos::byte*)errorMessage.c_str(), errorMessage.size()));
+                auto buffer = std::make_shared<bcos::bytes>();
+                amopMsg->encode(*buffer);
+                _responseCallback(buffer, MessageType::AMOPMessageType);
+                AMOP_LOG(WARNING) << LOG_DESC("asyncNotifyAMOPMessage error")
+                                  << LOG_KV("code", _error->errorCode())
+                                  << LOG_KV("msg", _error->errorMessage());
+            });
+    };
+    if (!clientQueue->push(_data, std::move(sendFunc)))
+    {
+        // all the clients subscribe the topic are busy, the sender may retry later
+        responseAMOPError(CommonError::AMOPClientBusy, "AMOPClientBusy", _responseCallback);
+        AMOP_LOG(WARNING) << LOG_BADGE("onRecvAMOPMessage")
+                          << LOG_DESC("drop the message for the client is busy")
+                          << LOG_KV("topic", _topic) << LOG_KV("client", choosedClient)
+                          << LOG_KV("dropped", clientQueue->dropped());
+    }
+}
+
+void AMOPImpl::responseAMOPError(int32_t _errorCode, std::string const& _errorMessage,
+    std::function<void(bytesPointer, int16_t)> const& _responseCallback)
+{
+    auto amopMsg = m_messageFactory->buildMessage();
+    auto buffer = std::make_shared<bcos::bytes>();
+    amopMsg->setStatus(_errorCode);
+    amopMsg->setType(AMOPMessage::Type::AMOPResponse);
+    amopMsg->setData(bytesConstRef((bcos::byte*)_errorMessage.c_str(), _errorMessage.size()));
+    amopMsg->encode(*buffer);
+    m_threadPool->enqueue([buffer, _responseCallback]() {
+        _responseCallback(buffer, MessageType::AMOPMessageType);
+    });
+}
+
+// the client with the least messages being notified and waiting, random among the same load
+std::string AMOPImpl::chooseLeastLoadedClient(std::vector<std::string> const& _clients)
+{
+    std::vector<std::string> choices;
+    size_t minLoad = std::numeric_limits<size_t>::max();
+    for (auto const& client : _clients)
+    {
+        auto load = m_topicManager->clientQueue(client)->load();
+        if (load < minLoad)
+        {
+            minLoad = load;
+            choices.clear();
+        }
+        if (load == minLoad)
+        {
+            choices.emplace_back(client);
+        }
+    }
+    return randomChoose(std::move(choices));
 }
 
 // receive the AMOP broadcast message from given node
@@ -266,17 +310,30 @@ void AMOPImpl::onReceiveAMOPBroadcastMessage(P2pID const& _nodeID, AMOPMessage::
         AMOP_LOG(DEBUG) << LOG_BADGE("onRecvAMOPBroadcastMessage")
                         << LOG_DESC("push message to client") << LOG_KV("topic", topic)
                         << LOG_KV("client", client);
-        clientService->asyncNotifyAMOPMessage(bcos::rpc::AMOPNotifyMessageType::Broadcast, topic,
-            _msg->data(), [client](Error::Ptr&& _error, bytesPointer) {
-                if (_error)
-                {
-                    AMOP_LOG(WARNING)
-                        << LOG_BADGE("onRecvAMOPBroadcastMessage")
-                        << LOG_DESC("asyncNotifyAMOPMessage error") << LOG_KV("client", client)
-                        << LOG_KV("code", _error->errorCode())
-                        << LOG_KV("msg", _error->errorMessage());
-                }
-            });
+        auto clientQueue = m_topicManager->clientQueue(client);
+        auto sendFunc = [clientService, client, topic](
+                            bytesConstRef _payload, std::function<void()> _onSent) {
+            clientService->asyncNotifyAMOPMessage(bcos::rpc::AMOPNotifyMessageType::Broadcast,
+                topic, _payload, [client, _onSent](Error::Ptr&& _error, bytesPointer) {
+                    _onSent();
+                    if (_error)
+                    {
+                        AMOP_LOG(WARNING)
+                            << LOG_BADGE("onRecvAMOPBroadcastMessage")
+                            << LOG_DESC("asyncNotifyAMOPMessage error") << LOG_KV("client", client)
+                            << LOG_KV("code", _error->errorCode())
+                            << LOG_KV("msg", _error->errorMessage());
+                    }
+                });
+        };
+        // the broadcast message is dropped for the slow client, the other clients still receive it
+        if (!clientQueue->push(_msg->data(), std::move(sendFunc)))
+        {
+            AMOP_LOG(WARNING) << LOG_BADGE("onRecvAMOPBroadcastMessage")
+                              << LOG_DESC("drop the message for the client is busy")
+                              << LOG_KV("topic", topic) << LOG_KV("client", client)
+                              << LOG_KV("dropped", clientQueue->dropped());
+        }
     }
     AMOP_LOG(DEBUG) << LOG_DESC("onReceiveAMOPBroadcastMessage") << LOG_KV("nodeID", _nodeID);
 }
@@ -368,7 +425,7 @@ void AMOPImpl::asyncSendMessageByTopic(const std::string& _topic, bcos::bytesCon
             m_network->asyncSendMessageByP2PNodeID(MessageType::AMOPMessageType, choosedNodeID,
                 bytesConstRef(m_buffer->data(), m_buffer->size()), option,
                 [self, choosedNodeID, callback = m_callback](
-                    Error::Ptr&& _error, int16_t _type, bytesPointer _responseData) {
+                    Error::Ptr&& _error, int16_t _type, bytesConstRef _responseData) {
                     if (_error && (_error->errorCode() != CommonError::SUCCESS))
                     {
                         AMOP_LOG(DEBUG)
@@ -383,7 +440,7 @@ void AMOPImpl::asyncSendMessageByTopic(const std::string& _topic, bcos::bytesCon
                     bcos::Error::Ptr error = nullptr;
                     if (_type == bcos::gateway::MessageType::AMOPMessageType)
                     {
-                        auto amopMsg = self->m_messageFactory->buildMessage(ref(*_responseData));
+                        auto amopMsg = self->m_messageFactory->buildMessage(_responseData);
                         auto errorMessage =
                             std::string(amopMsg->data().begin(), amopMsg->data().end());
                         auto errorCode = amopMsg->status();
@@ -406,8 +463,11 @@ void AMOPImpl::asyncSendMessageByTopic(const std::string& _topic, bcos::bytesCon
                     {
                         AMOP_LOG(INFO)
                             << LOG_DESC("asyncSendMessageByTopic: receive responseData")
-                            << LOG_KV("size", _responseData->size()) << LOG_KV("type", _type);
-                        callback(std::move(error), _type, _responseData);
+                            << LOG_KV("size", _responseData.size()) << LOG_KV("type", _type);
+                        // the response leaves the gateway, copied out of the received frame
+                        auto responseData =
+                            std::make_shared<bytes>(_responseData.begin(), _responseData.end());
+                        callback(std::move(error), _type, responseData);
                     }
                 });
         }
@@ -501,7 +561,7 @@ void AMOPImpl::dispatcherAMOPMessage(
     {
         return;
     }
-    auto amopMessage = m_messageFactory->buildMessage(ref(*_message->payload()));
+    auto amopMessage = m_messageFactory->buildMessage(_message->payloadRef());
     auto amopMsgType = amopMessage->type();
     auto fromNodeID = _session->p2pID();
     switch (amopMsgType)
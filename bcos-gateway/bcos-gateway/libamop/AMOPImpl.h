@@ -140,6 +140,9 @@ private:
         std::function<void(bytesPointer, int16_t)> const& _responseCallback);
     void onRecvAMOPResponse(int16_t _type, bytesPointer _responseData,
         std::function<void(bcos::Error::Ptr&&, int16_t, bytesPointer)> _callback);
+    void responseAMOPError(int32_t _errorCode, std::string const& _errorMessage,
+        std::function<void(bytesPointer, int16_t)> const& _responseCallback);
+    std::string chooseLeastLoadedClient(std::vector<std::string> const& _clients);
     bool trySendTopicMessageToLocalClient(const std::string& _topic, bcos::bytesConstRef _data,
         std::function<void(bcos::Error::Ptr&&, int16_t, bytesPointer)> _respFunc);
 
@@ -98,7 +98,9 @@ void TopicManager::subTopic(const std::string& _client, const TopicItems& _topic
 {
     {
         std::unique_lock lock(x_clientTopics);
-        m_client2TopicItems[_client] = _topicItems;  // Override the previous value
+        auto& topicItems = m_client2TopicItems[_client];
+        updateTopicIndex(m_topic2Clients, _client, topicItems, _topicItems);
+        topicItems = _topicItems;  // Override the previous value
         incTopicSeq();
     }
     createAndGetServiceByClient(_client);
@@ -149,15 +151,16 @@ void TopicManager::removeTopics(
         {
             return;
         }
+        auto& topicItems = m_client2TopicItems[_client];
+        auto remainedTopicItems = topicItems;
         for (auto const& topic : _topicList)
         {
-            if (m_client2TopicItems[_client].count(topic))
-            {
-                m_client2TopicItems[_client].erase(topic);
-            }
+            remainedTopicItems.erase(topic);
             TOPIC_LOG(INFO) << LOG_BADGE("removeTopics") << LOG_KV("client", _client)
                             << LOG_KV("topicSeq", topicSeq()) << LOG_KV("topic", topic);
         }
+        updateTopicIndex(m_topic2Clients, _client, topicItems, remainedTopicItems);
+        topicItems = std::move(remainedTopicItems);
         incTopicSeq();
     }
 }
@@ -171,9 +174,11 @@ void TopicManager::removeTopicsByClients(const std::vector<std::string>& _client
     std::unique_lock lock(x_clientTopics);
     for (auto const& client : _clients)
     {
-        if (m_client2TopicItems.count(client))
+        auto it = m_client2TopicItems.find(client);
+        if (it != m_client2TopicItems.end())
         {
-            m_client2TopicItems.erase(client);
+            updateTopicIndex(m_topic2Clients, client, it->second, TopicItems());
+            m_client2TopicItems.erase(it);
         }
         TOPIC_LOG(INFO) << LOG_BADGE("removeTopicsByClients") << LOG_KV("client", client);
     }
@@ -307,7 +312,12 @@ void TopicManager::notifyNodeIDs(const std::vector<P2pID>& _nodeIDs)
                     return it->first == _nodeID;
                 }) == _nodeIDs.end())
             {  // nodeID is offline, remove the nodeID's state
-                m_nodeID2TopicItems.erase(it->first);
+                auto topicsIt = m_nodeID2TopicItems.find(it->first);
+                if (topicsIt != m_nodeID2TopicItems.end())
+                {
+                    updateTopicIndex(m_topic2NodeIDs, it->first, topicsIt->second, TopicItems());
+                    m_nodeID2TopicItems.erase(topicsIt);
+                }
                 it = m_nodeID2TopicSeq.erase(it);
                 removeCount++;
             }
@@ -334,7 +344,9 @@ void TopicManager::updateSeqAndTopicsByNodeID(
     {
         std::unique_lock lock(x_topics);
         m_nodeID2TopicSeq[_nodeID] = _topicSeq;
-        m_nodeID2TopicItems[_nodeID] = _topicItems;
+        auto& topicItems = m_nodeID2TopicItems[_nodeID];
+        updateTopicIndex(m_topic2NodeIDs, _nodeID, topicItems, _topicItems);
+        topicItems = _topicItems;
     }
 
     TOPIC_LOG(INFO) << LOG_BADGE("updateSeqAndTopicsByNodeID") << LOG_KV("nodeID", _nodeID)
@@ -352,17 +364,19 @@ void TopicManager::queryNodeIDsByTopic(
     const std::string& _topic, std::vector<std::string>& _nodeIDs)
 {
     std::shared_lock lock(x_topics);
-    for (auto it = m_nodeID2TopicItems.begin(); it != m_nodeID2TopicItems.end(); ++it)
+    auto it = m_topic2NodeIDs.find(_topic);
+    if (it == m_topic2NodeIDs.end())
+    {
+        return;
+    }
+    for (auto const& nodeID : it->second)
     {
-        auto findIt = std::find_if(it->second.begin(), it->second.end(),
-            [_topic](const TopicItem& _topicItem) { return _topic == _topicItem.topicName(); });
         // only return the connected nodes
-        if (findIt != it->second.end() && m_network->connected(it->first))
+        if (m_network->connected(nodeID))
         {
-            _nodeIDs.push_back(it->first);
+            _nodeIDs.push_back(nodeID);
         }
     }
-    return;
 }
 
 /**
@@ -376,14 +390,10 @@ void TopicManager::queryClientsByTopic(
 {
     {
         std::shared_lock lock(x_clientTopics);
-        for (const auto& items : m_client2TopicItems)
+        auto it = m_topic2Clients.find(_topic);
+        if (it != m_topic2Clients.end())
         {
-            auto it = std::find_if(items.second.begin(), items.second.end(),
-                [_topic](const TopicItem& _topicItem) { return _topic == _topicItem.topicName(); });
-            if (it != items.second.end())
-            {
-                _clients.push_back(items.first);
-            }
+            _clients.insert(_clients.end(), it->second.begin(), it->second.end());
         }
     }
 
@@ -469,4 +479,70 @@ void TopicManager::checkClientConnection()
             removeTopicsByClients(clientsToRemove);
         }
     }
+    reportClientQueues(clientsToRemove);
+}
+
+AMOPClientQueue::Ptr TopicManager::clientQueue(std::string const& _client)
+{
+    UpgradableGuard l(x_clientQueues);
+    auto it = m_clientQueues.find(_client);
+    if (it != m_clientQueues.end())
+    {
+        return it->second;
+    }
+    auto queue =
+        std::make_shared<AMOPClientQueue>(c_maxInflightClientMessages, c_maxPendingClientMessages);
+    UpgradeGuard ul(l);
+    m_clientQueues[_client] = queue;
+    return queue;
+}
+
+void TopicManager::reportClientQueues(std::vector<std::string> const& _removedClients)
+{
+    WriteGuard l(x_clientQueues);
+    for (auto const& client : _removedClients)
+    {
+        m_clientQueues.erase(client);
+    }
+    for (auto const& it : m_clientQueues)
+    {
+        auto const& queue = it.second;
+        if (queue->load() == 0 && queue->dropped() == 0)
+        {
+            continue;
+        }
+        TOPIC_LOG(INFO) << LOG_DESC("clientQueue") << LOG_KV("client", it.first)
+                        << LOG_KV("inflight", queue->inflight())
+                        << LOG_KV("pending", queue->pending()) << LOG_KV("sent", queue->sent())
+                        << LOG_KV("dropped", queue->dropped());
+    }
+}
+
+void TopicManager::updateTopicIndex(std::unordered_map<std::string, std::set<std::string>>& _index,
+    std::string const& _subscriber, TopicItems const& _oldItems, TopicItems const& _newItems)
+{
+    for (auto const& topicItem : _oldItems)
+    {
+        if (_newItems.count(topicItem))
+        {
+            continue;
+        }
+        auto it = _index.find(topicItem.topicName());
+        if (it == _index.end())
+        {
+            continue;
+        }
+        it->second.erase(_subscriber);
+        if (it->second.empty())
+        {
+            _index.erase(it);
+        }
+    }
+    for (auto const& topicItem : _newItems)
+    {
+        if (!_oldItems.count(topicItem))
+        {
+            _index[topicItem.topicName()].insert(_subscriber);
+        }
+    }
 }
\ No newline at end of file
@@ -19,6 +19,7 @@
  */
 #pragma once
 
+#include "AMOPClientQueue.h"
 #include <bcos-crypto/interfaces/crypto/KeyInterface.h>
 #include <bcos-framework/interfaces/rpc/RPCInterface.h>
 #include <bcos-gateway/libamop/Common.h>
@@ -147,6 +148,13 @@ public:
      */
     void queryClientsByTopic(const std::string& _topic, std::vector<std::string>& _clients);
 
+    /**
+     * @brief: the bounded send queue of the client, created if not exists
+     * @param _client: client
+     * @return AMOPClientQueue::Ptr
+     */
+    AMOPClientQueue::Ptr clientQueue(std::string const& _client);
+
     virtual bcos::rpc::RPCInterface::Ptr createAndGetServiceByClient(std::string const& _clientID)
     {
         try
@@ -177,12 +185,21 @@ public:
 protected:
     virtual void notifyRpcToSubscribeTopics();
     virtual void checkClientConnection();
+    // log the load of the client queues and remove the queues of the disconnected clients
+    void reportClientQueues(std::vector<std::string> const& _removedClients);
+
+    // update the topic => subscribers index for the topics of the subscriber changed from
+    // _oldItems to _newItems
+    static void updateTopicIndex(std::unordered_map<std::string, std::set<std::string>>& _index,
+        std::string const& _subscriber, TopicItems const& _oldItems, TopicItems const& _newItems);
 
     // m_client2TopicItems lock
     mutable std::shared_mutex x_clientTopics;
     // client => TopicItems
     // Note: the clientID is the rpc node endpoint
     std::unordered_map<std::string, TopicItems> m_client2TopicItems;
+    // topic => clients, the inverted index of m_client2TopicItems
+    std::unordered_map<std::string, std::set<std::string>> m_topic2Clients;
 
     // topicSeq
     std::atomic<uint32_t> m_topicSeq{1};
@@ -194,10 +211,20 @@ protected:
 
     // nodeID => topicItems
     std::unordered_map<std::string, TopicItems> m_nodeID2TopicItems;
+    // topic => nodeIDs, the inverted index of m_nodeID2TopicItems
+    std::unordered_map<std::string, std::set<std::string>> m_topic2NodeIDs;
 
     std::map<std::string, bcos::rpc::RPCInterface::Ptr> m_clientInfo;
     mutable SharedMutex x_clientInfo;
 
+    // client => the messages pushed to the client
+    std::unordered_map<std::string, AMOPClientQueue::Ptr> m_clientQueues;
+    mutable SharedMutex x_clientQueues;
+    // the messages notified to a client at the same time
+    size_t const c_maxInflightClientMessages = 64;
+    // the messages waiting for a busy client, the messages beyond are dropped
+    size_t const c_maxPendingClientMessages = 1024;
+
     std::shared_ptr<Timer> m_timer;
     unsigned const int CONNECTION_CHECK_PERIOD = 2000;
     std::string m_rpcServiceName;
@@ -21,6 +21,7 @@
 #pragma once
 
 #include <bcos-utilities/Common.h>
+#include <memory>
 #include <set>
 #include <string>
 #include <vector>
@@ -45,6 +46,15 @@ public:
     virtual bool isRespPacket() const = 0;
     virtual bool encode(bcos::bytes& _buffer) = 0;
     virtual ssize_t decode(bytesConstRef _buffer) = 0;
+
+    /// length of the frame starting at _buffer, MESSAGE_INCOMPLETE if the header is not fully
+    /// received, MESSAGE_ERROR if the header is illegal
+    virtual ssize_t frameLength(bytesConstRef _buffer) const = 0;
+    /// decode a whole received frame, the message may keep slices of _frame instead of copying
+    virtual ssize_t decodeFrame(std::shared_ptr<const bytes> _frame)
+    {
+        return decode(bytesConstRef(_frame->data(), _frame->size()));
+    }
 };
 
 class MessageFactory
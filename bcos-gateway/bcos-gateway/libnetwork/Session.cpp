@@ -410,43 +410,27 @@ void Session::doRead()
                     return;
                 }
                 s->updateIdleTimer(s->m_readIdleTimer);
-                s->m_data.insert(s->m_data.end(), s->m_recvBuffer.begin(),
-                    s->m_recvBuffer.begin() + bytesTransferred);
-
-                while (true)
+                if (s->onRead(bytesTransferred))
                 {
-                    Message::Ptr message = s->m_messageFactory->buildMessage();
-                    ssize_t result =
-                        message->decode(bytesConstRef(s->m_data.data(), s->m_data.size()));
-                    if (result > 0)
-                    {
-                        /// SESSION_LOG(TRACE) << "Decode success: " << result;
-                        NetworkException e(P2PExceptionType::Success, "Success");
-                        s->onMessage(e, message);
-                        s->m_data.erase(s->m_data.begin(), s->m_data.begin() + result);
-                    }
-                    else if (result == 0)
-                    {
-                        s->doRead();
-                        break;
-                    }
-                    else
-                    {
-                        SESSION_LOG(ERROR)
-                            << LOG_DESC("Decode message error") << LOG_KV("result", result);
-                        s->onMessage(
-                            NetworkException(P2PExceptionType::ProtocolError, "ProtocolError"),
-                            message);
-                        break;
-                    }
+                    s->doRead();
                 }
             }
         };
 
         if (m_socket->isConnected())
         {
-            server->asioInterface()->asyncReadSome(
-                m_socket, boost::asio::buffer(m_recvBuffer, m_recvBuffer.size()), asyncRead);
+            if (m_frame)
+            {
+                server->asioInterface()->asyncReadSome(m_socket,
+                    boost::asio::buffer(
+                        m_frame->data() + m_frameOffset, m_frame->size() - m_frameOffset),
+                    asyncRead);
+            }
+            else
+            {
+                server->asioInterface()->asyncReadSome(
+                    m_socket, boost::asio::buffer(m_recvBuffer, m_recvBuffer.size()), asyncRead);
+            }
         }
         else
         {
@@ -463,6 +447,86 @@ void Session::doRead()
     }
 }
 
+bool Session::onRead(std::size_t _bytesTransferred)
+{
+    if (m_frame)
+    {
+        m_frameOffset += _bytesTransferred;
+        if (m_frameOffset < m_frame->size())
+        {
+            return true;
+        }
+        return onFrame();
+    }
+
+    m_data.insert(m_data.end(), m_recvBuffer.begin(), m_recvBuffer.begin() + _bytesTransferred);
+    return decodeFrames();
+}
+
+bool Session::decodeFrames()
+{
+    size_t offset = 0;
+    bool success = true;
+    while (true)
+    {
+        auto buffer = bytesConstRef(m_data.data() + offset, m_data.size() - offset);
+        Message::Ptr message = m_messageFactory->buildMessage();
+        auto length = message->frameLength(buffer);
+        if (length == 0)
+        {
+            break;
+        }
+
+        if (length > 0 && (size_t)length > buffer.size())
+        {
+            // read the rest of the frame directly into a buffer of its size
+            m_frame = std::make_shared<bytes>(length);
+            std::copy(buffer.begin(), buffer.end(), m_frame->begin());
+            m_frameOffset = buffer.size();
+            offset = m_data.size();
+            break;
+        }
+
+        ssize_t result = length > 0 ? message->decode(buffer.getCroppedData(0, length)) : length;
+        if (result > 0)
+        {
+            /// SESSION_LOG(TRACE) << "Decode success: " << result;
+            NetworkException e(P2PExceptionType::Success, "Success");
+            onMessage(e, message);
+            offset += result;
+        }
+        else
+        {
+            SESSION_LOG(ERROR) << LOG_DESC("Decode message error") << LOG_KV("result", result);
+            onMessage(NetworkException(P2PExceptionType::ProtocolError, "ProtocolError"), message);
+            success = false;
+            break;
+        }
+    }
+
+    m_data.erase(m_data.begin(), m_data.begin() + offset);
+    return success;
+}
+
+bool Session::onFrame()
+{
+    auto frame = std::move(m_frame);
+    m_frameOffset = 0;
+
+    Message::Ptr message = m_messageFactory->buildMessage();
+    ssize_t result = message->decodeFrame(std::move(frame));
+    if (result <= 0)
+    {
+        SESSION_LOG(ERROR) << LOG_DESC("Decode message error") << LOG_KV("result", result);
+        onMessage(NetworkException(P2PExceptionType::ProtocolError, "ProtocolError"), message);
+        return false;
+    }
+
+    NetworkException e(P2PExceptionType::Success, "Success");
+    onMessage(e, message);
+    return true;
+}
+
 bool Session::checkRead(boost::system::error_code _ec)
 {
     if (_ec && _ec.category() != boost::asio::error::get_misc_category() &&
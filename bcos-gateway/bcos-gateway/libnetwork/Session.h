@@ -100,9 +100,19 @@ private:
     void send(std::shared_ptr<bytes> _msg);
 
     void doRead();
+    /// handle the bytes read, return false if the session stops reading
+    bool onRead(std::size_t _bytesTransferred);
+    /// decode the frames in m_data, the frame not fully received moves to m_frame
+    bool decodeFrames();
+    bool onFrame();
+
     std::vector<byte> m_data;  ///< Buffer for ingress packet data.
     std::vector<byte> m_recvBuffer;
     const size_t bufferSize;
+    /// the right-sized buffer of the frame being received, the rest of the frame is read directly
+    /// into it and handed to the message without copy
+    std::shared_ptr<bytes> m_frame;
+    size_t m_frameOffset = 0;
 
     /// Drop the connection for the reason @a _r.
     void drop(DisconnectReason _r);
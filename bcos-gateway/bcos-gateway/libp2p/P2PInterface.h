@@ -28,8 +28,9 @@ using CallbackFuncWithSession =
     std::function<void(NetworkException, std::shared_ptr<P2PSession>, std::shared_ptr<P2PMessage>)>;
 using DisconnectCallbackFuncWithSession =
     std::function<void(NetworkException, std::shared_ptr<P2PSession>)>;
+// _data is a view of the response payload, valid only during the callback
 using P2PResponseCallback =
-    std::function<void(Error::Ptr&& _error, int16_t, std::shared_ptr<bytes> _data)>;
+    std::function<void(Error::Ptr&& _error, int16_t, bytesConstRef _data)>;
 class P2PInterface
 {
 public:
@@ -185,7 +185,8 @@ bool P2PMessage::encode(bytes& _buffer)
         return false;
     }
 
-    _buffer.insert(_buffer.end(), m_payload->begin(), m_payload->end());
+    auto payload = payloadRef();
+    _buffer.insert(_buffer.end(), payload.begin(), payload.end());
 
     // calc total length and modify the length value in the buffer
     length = boost::asio::detail::socket_ops::host_to_network_long((uint32_t)_buffer.size());
@@ -226,31 +227,43 @@ ssize_t P2PMessage::decodeHeader(bytesConstRef _buffer)
     return offset;
 }
 
-ssize_t P2PMessage::decode(bytesConstRef _buffer)
+ssize_t P2PMessage::frameLength(bytesConstRef _buffer) const
 {
-    // check if packet header fully received
     if (_buffer.size() < P2PMessage::MESSAGE_HEADER_LENGTH)
     {
         return MessageDecodeStatus::MESSAGE_INCOMPLETE;
     }
 
-    int32_t offset = decodeHeader(_buffer);
+    uint32_t length =
+        boost::asio::detail::socket_ops::network_to_host_long(*((uint32_t*)_buffer.data()));
+    if (length > P2PMessage::MAX_MESSAGE_LENGTH || length < P2PMessage::MESSAGE_HEADER_LENGTH)
+    {
+        P2PMSG_LOG(WARNING) << LOG_DESC("Illegal p2p message packet") << LOG_KV("length", length)
+                            << LOG_KV("maxLen", P2PMessage::MAX_MESSAGE_LENGTH);
+        return MessageDecodeStatus::MESSAGE_ERROR;
+    }
+    return length;
+}
 
-    // check if packet header fully received
-    if (_buffer.size() < m_length)
+ssize_t P2PMessage::decodeFields(bytesConstRef _buffer, bytesConstRef& _payload)
+{
+    auto length = frameLength(_buffer);
+    if (length <= 0)
     {
-        return MessageDecodeStatus::MESSAGE_INCOMPLETE;
+        return length;
     }
-    if (m_length > P2PMessage::MAX_MESSAGE_LENGTH)
+
+    // check if packet fully received
+    if (_buffer.size() < (size_t)length)
     {
-        P2PMSG_LOG(WARNING) << LOG_DESC("Illegal p2p message packet") << LOG_KV("length", m_length)
-                            << LOG_KV("maxLen", P2PMessage::MAX_MESSAGE_LENGTH);
-        return MessageDecodeStatus::MESSAGE_ERROR;
+        return MessageDecodeStatus::MESSAGE_INCOMPLETE;
     }
+
+    int32_t offset = decodeHeader(_buffer);
     if (hasOptions())
     {
         // encode options
-        auto optionsOffset = m_options->decode(_buffer.getCroppedData(offset));
+        auto optionsOffset = m_options->decode(_buffer.getCroppedData(offset, m_length - offset));
         if (optionsOffset < 0)
         {
             return MessageDecodeStatus::MESSAGE_ERROR;
@@ -258,9 +271,49 @@ ssize_t P2PMessage::decode(bytesConstRef _buffer)
         offset += optionsOffset;
     }
 
-    auto data = _buffer.getCroppedData(offset, m_length - offset);
-    // payload
-    m_payload = std::make_shared<bytes>(data.begin(), data.end());
-
+    _payload = _buffer.getCroppedData(offset, m_length - offset);
     return m_length;
 }
+
+ssize_t P2PMessage::decode(bytesConstRef _buffer)
+{
+    bytesConstRef data;
+    auto result = decodeFields(_buffer, data);
+    if (result > 0)
+    {
+        // payload
+        m_payload = std::make_shared<bytes>(data.begin(), data.end());
+        m_frame.reset();
+    }
+    return result;
+}
+
+ssize_t P2PMessage::decodeFrame(std::shared_ptr<const bytes> _frame)
+{
+    bytesConstRef data;
+    auto result = decodeFields(bytesConstRef(_frame->data(), _frame->size()), data);
+    if (result > 0)
+    {
+        // the payload refers to the frame, copied only if payload() is called
+        m_framePayload = data;
+        m_frame = std::move(_frame);
+        m_payload.reset();
+    }
+    return result;
+}
+
+std::shared_ptr<bytes> P2PMessage::payload() const
+{
+    if (!m_frame)
+    {
+        return m_payload;
+    }
+
+    auto payload = std::atomic_load(&m_payload);
+    if (!payload)
+    {
+        payload = std::make_shared<bytes>(m_framePayload.begin(), m_framePayload.end());
+        std::atomic_store(&m_payload, payload);
+    }
+    return payload;
+}
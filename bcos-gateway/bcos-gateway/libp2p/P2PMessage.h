@@ -131,8 +131,22 @@ public:
     P2PMessageOptions::Ptr options() const { return m_options; }
     void setOptions(P2PMessageOptions::Ptr _options) { m_options = _options; }
 
-    std::shared_ptr<bytes> payload() const { return m_payload; }
-    void setPayload(std::shared_ptr<bytes> _payload) { m_payload = _payload; }
+    // the payload of a received frame is copied out on the first call, prefer payloadRef()
+    std::shared_ptr<bytes> payload() const;
+    void setPayload(std::shared_ptr<bytes> _payload)
+    {
+        m_payload = _payload;
+        m_frame.reset();
+    }
+    // view of the payload without copy, valid as long as the message, empty if no payload is set
+    bytesConstRef payloadRef() const
+    {
+        if (m_frame)
+        {
+            return m_framePayload;
+        }
+        return m_payload ? bytesConstRef(m_payload->data(), m_payload->size()) : bytesConstRef();
+    }
 
 public:
     ssize_t decodeHeader(bytesConstRef _buffer);
@@ -145,12 +159,17 @@ public:
 
     bool encode(bytes& _buffer) override;
     ssize_t decode(bytesConstRef _buffer) override;
+    ssize_t frameLength(bytesConstRef _buffer) const override;
+    ssize_t decodeFrame(std::shared_ptr<const bytes> _frame) override;
     bool isRespPacket() const override
     {
         return (m_ext & bcos::protocol::MessageExtFieldFlag::Response) != 0;
     }
 
 protected:
+    // decode the fields except the payload, return the length of the message or the decode status
+    ssize_t decodeFields(bytesConstRef _buffer, bytesConstRef& _payload);
+
     uint32_t m_length = 0;
     uint16_t m_version = 0;
     uint16_t m_packetType = 0;
@@ -159,7 +178,10 @@ protected:
 
     P2PMessageOptions::Ptr m_options;  ///< options fields
 
-    std::shared_ptr<bytes> m_payload;  ///< payload data
+    mutable std::shared_ptr<bytes> m_payload;  ///< payload data
+    // the received frame holding the payload, the payload is a slice of it if not null
+    std::shared_ptr<const bytes> m_frame;
+    bytesConstRef m_framePayload;
 };
 
 class P2PMessageFactory : public MessageFactory
@@ -538,7 +538,7 @@ void Service::asyncSendMessageByP2PNodeID(int16_t _type, P2pID _dstNodeID, bytes
         {
             auto errorMsg =
                 "send message to " + _dstNodeID + " failed for no connection established";
-            _callback(std::make_shared<bcos::Error>(-1, errorMsg), 0, nullptr);
+            _callback(std::make_shared<bcos::Error>(-1, errorMsg), 0, bytesConstRef());
         }
         return;
     }
@@ -555,14 +555,14 @@ void Service::asyncSendMessageByP2PNodeID(int16_t _type, P2pID _dstNodeID, bytes
                                      << LOG_KV("type", packetType) << LOG_KV("dst", _dstNodeID);
                 if (_callback)
                 {
-                    _callback(
-                        _e.toError(), packetType, _p2pMessage ? _p2pMessage->payload() : nullptr);
+                    _callback(_e.toError(), packetType,
+                        _p2pMessage ? _p2pMessage->payloadRef() : bytesConstRef());
                 }
                 return;
             }
             if (_callback)
             {
-                _callback(nullptr, packetType, _p2pMessage->payload());
+                _callback(nullptr, packetType, _p2pMessage->payloadRef());
             }
         },
         _options);
@@ -0,0 +1,86 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the route of every message by the interned indexes against the query by hex nodeID
+ * @file gateway-route-bench.cpp
+ */
+#include <bcos-crypto/signature/key/KeyFactoryImpl.h>
+#include <bcos-gateway/gateway/PeersRouterTable.h>
+#include <bcos-gateway/protocol/GatewayNodeStatus.h>
+#include <chrono>
+#include <iostream>
+
+using namespace bcos;
+using namespace bcos::gateway;
+
+int main(int argc, const char* argv[])
+{
+    // gateway-route-bench [routeCount] [nodeCount]
+    size_t routeCount = argc > 1 ? std::stoul(argv[1]) : 100000;
+    size_t nodeCount = argc > 2 ? std::stoul(argv[2]) : 100;
+
+    auto keyFactory = std::make_shared<bcos::crypto::KeyFactoryImpl>();
+    auto peersRouterTable = std::make_shared<PeersRouterTable>("testUUID", keyFactory, nullptr);
+    std::string groupID = "group";
+    std::vector<bcos::crypto::NodeIDPtr> nodeIDs;
+    std::vector<std::string> nodeIDList;
+    for (size_t i = 0; i < nodeCount; i++)
+    {
+        std::string strNodeID = "nodeID" + std::to_string(i);
+        strNodeID.resize(64, '0');
+        nodeIDs.emplace_back(keyFactory->createKey(
+            bytesConstRef((bcos::byte*)strNodeID.data(), strNodeID.size())));
+        nodeIDList.emplace_back(nodeIDs.back()->hex());
+    }
+    auto groupNodeInfo = std::make_shared<bcostars::protocol::GroupNodeInfoImpl>();
+    groupNodeInfo->setGroupID(groupID);
+    groupNodeInfo->setNodeIDList(std::move(nodeIDList));
+    auto status = std::make_shared<GatewayNodeStatus>();
+    status->setSeq(1);
+    status->setUUID("testUUID");
+    status->setGroupNodeInfos({groupNodeInfo});
+    for (auto const& p2pID : {"xxxxx", "yyyyy", "zzzzz"})
+    {
+        peersRouterTable->updatePeerStatus(p2pID, status);
+    }
+
+    auto startT = std::chrono::steady_clock::now();
+    size_t queried = 0;
+    for (size_t i = 0; i < routeCount; i++)
+    {
+        auto const& nodeID = nodeIDs[i % nodeIDs.size()];
+        queried += peersRouterTable->queryP2pIDs(groupID, nodeID->hex()).size();
+    }
+    auto queryT = std::chrono::steady_clock::now();
+    size_t routed = 0;
+    for (size_t i = 0; i < routeCount; i++)
+    {
+        routed += peersRouterTable->routeP2pIDs(groupID, nodeIDs[i % nodeIDs.size()])->size();
+    }
+    auto routeT = std::chrono::steady_clock::now();
+    if (routed != queried)
+    {
+        std::cerr << "route mismatch, routed: " << routed << ", queried: " << queried
+                  << std::endl;
+        return 1;
+    }
+    std::cout << "route " << routeCount << " messages to " << nodeCount
+              << " nodes, query by hex nodeID: "
+              << std::chrono::duration_cast<std::chrono::microseconds>(queryT - startT).count()
+              << "us, interned route: "
+              << std::chrono::duration_cast<std::chrono::microseconds>(routeT - queryT).count()
+              << "us" << std::endl;
+    return 0;
+}
@@ -22,16 +22,33 @@
 #define BOOST_TEST_MAIN
 
 #include <bcos-gateway/Common.h>
+#include <bcos-gateway/libnetwork/ASIOInterface.h>
+#include <bcos-gateway/libnetwork/Host.h>
+#include <bcos-gateway/libnetwork/Session.h>
 #include <bcos-gateway/libp2p/P2PInterface.h>
 #include <bcos-gateway/libp2p/P2PMessage.h>
 #include <bcos-gateway/libp2p/Service.h>
 #include <bcos-utilities/testutils/TestPromptFixture.h>
+#include <boost/asio/detail/socket_ops.hpp>
 #include <boost/test/unit_test.hpp>
+#include <future>
+#include <thread>
 
 using namespace bcos;
 using namespace bcos::gateway;
 using namespace bcos::test;
 
+namespace
+{
+// the host only serves the sessions of the test, it neither listens nor connects
+class FakeHost : public Host
+{
+public:
+    using Host::Host;
+    bool haveNetwork() const override { return true; }
+};
+}  // namespace
+
 BOOST_FIXTURE_TEST_SUITE(GatewayMessageTest, TestPromptFixture)
 
 BOOST_AUTO_TEST_CASE(test_P2PMessage_hasOptions)
@@ -305,4 +322,134 @@ BOOST_AUTO_TEST_CASE(test_P2PMessage_codec)
     }
 }
 
+BOOST_AUTO_TEST_CASE(test_P2PMessage_frameThroughput)
+{
+    auto factory = std::make_shared<P2PMessageFactory>();
+    const size_t messageCount = 10;
+    const size_t payloadSize = 10 * 1024 * 1024;
+
+    // the stream of the encoded messages
+    bytes stream;
+    for (size_t i = 0; i < messageCount; ++i)
+    {
+        auto encodeMsg = std::static_pointer_cast<P2PMessage>(factory->buildMessage());
+        encodeMsg->setSeq(i);
+        encodeMsg->setPayload(std::make_shared<bytes>(payloadSize, (byte)i));
+        bytes buffer;
+        BOOST_CHECK(encodeMsg->encode(buffer));
+        stream.insert(stream.end(), buffer.begin(), buffer.end());
+    }
+
+    // read the stream like Session, a header of 4096 bytes then the rest into the frame
+    auto startT = utcTime();
+    size_t offset = 0;
+    size_t received = 0;
+    while (offset < stream.size())
+    {
+        auto header = bytesConstRef(stream.data() + offset, 4096);
+        auto length = factory->buildMessage()->frameLength(header);
+        BOOST_CHECK_EQUAL(length, payloadSize + P2PMessage::MESSAGE_HEADER_LENGTH);
+
+        auto frame = std::make_shared<bytes>(length);
+        std::copy(stream.begin() + offset, stream.begin() + offset + length, frame->begin());
+        offset += length;
+
+        auto decodeMsg = std::static_pointer_cast<P2PMessage>(factory->buildMessage());
+        auto frameData = frame->data();
+        BOOST_CHECK_EQUAL(decodeMsg->decodeFrame(std::move(frame)), length);
+        BOOST_CHECK_EQUAL(decodeMsg->seq(), received);
+
+        // the payload is a slice of the frame
+        auto payload = decodeMsg->payloadRef();
+        BOOST_CHECK_EQUAL(payload.size(), payloadSize);
+        BOOST_CHECK(payload.data() == frameData + P2PMessage::MESSAGE_HEADER_LENGTH);
+        BOOST_CHECK_EQUAL(payload[payloadSize - 1], (byte)received);
+        ++received;
+    }
+    BOOST_CHECK_EQUAL(received, messageCount);
+    BOOST_TEST_MESSAGE("frame " << messageCount << " messages of 10MB, timecost: "
+                                << (utcTime() - startT) << "ms");
+
+    // the header of an illegal length is rejected before receiving the frame
+    bytes header(stream.begin(), stream.begin() + P2PMessage::MESSAGE_HEADER_LENGTH);
+    *((uint32_t*)header.data()) = boost::asio::detail::socket_ops::host_to_network_long(
+        P2PMessage::MAX_MESSAGE_LENGTH + 1);
+    auto length = factory->buildMessage()->frameLength(bytesConstRef(header.data(), header.size()));
+    BOOST_CHECK_EQUAL(length, MessageDecodeStatus::MESSAGE_ERROR);
+}
+
+BOOST_AUTO_TEST_CASE(test_Session_readThroughput)
+{
+    auto factory = std::make_shared<P2PMessageFactory>();
+    const size_t messageCount = 10;
+    const size_t payloadSize = 10 * 1024 * 1024;
+    const size_t smallPayloadSize = 100;
+
+    // the large messages are followed by small ones, so frames of both kinds share the reads
+    bytes stream;
+    for (size_t i = 0; i < messageCount * 2; ++i)
+    {
+        auto encodeMsg = std::static_pointer_cast<P2PMessage>(factory->buildMessage());
+        encodeMsg->setSeq(i);
+        encodeMsg->setPayload(
+            std::make_shared<bytes>(i % 2 ? smallPayloadSize : payloadSize, (byte)i));
+        bytes buffer;
+        BOOST_CHECK(encodeMsg->encode(buffer));
+        stream.insert(stream.end(), buffer.begin(), buffer.end());
+    }
+
+    auto ioService = std::make_shared<boost::asio::io_service>();
+    auto sslContext =
+        std::make_shared<boost::asio::ssl::context>(boost::asio::ssl::context::tlsv12);
+    auto asioInterface = std::make_shared<ASIOInterface>();
+    asioInterface->setType(ASIOInterface::TCP_ONLY);
+    asioInterface->setIOService(ioService);
+    asioInterface->setSSLContext(sslContext);
+    asioInterface->init("127.0.0.1", 0);
+    auto host = std::make_shared<FakeHost>(asioInterface, nullptr, factory);
+    host->setThreadPool(std::make_shared<ThreadPool>("session", 1));
+
+    // the session reads the loopback connection
+    boost::asio::ip::tcp::socket client(*ioService);
+    client.connect(asioInterface->acceptor()->local_endpoint());
+    auto socket = asioInterface->newSocket();
+    asioInterface->acceptor()->accept(socket->ref());
+
+    std::atomic<size_t> received = {0};
+    std::promise<void> allReceived;
+    auto session = std::make_shared<Session>();
+    session->setHost(host);
+    session->setSocket(socket);
+    session->setMessageFactory(factory);
+    session->setMessageHandler(
+        [&](NetworkException _e, SessionFace::Ptr, Message::Ptr _message) {
+            BOOST_CHECK_EQUAL(_e.errorCode(), P2PExceptionType::Success);
+            auto message = std::static_pointer_cast<P2PMessage>(_message);
+            auto index = received.load();
+            BOOST_CHECK_EQUAL(message->seq(), index);
+            auto payload = message->payloadRef();
+            BOOST_CHECK_EQUAL(payload.size(), index % 2 ? smallPayloadSize : payloadSize);
+            BOOST_CHECK_EQUAL(payload[payload.size() - 1], (byte)index);
+            if (++received == messageCount * 2)
+            {
+                allReceived.set_value();
+            }
+        });
+    session->start();
+    std::thread ioThread([ioService]() { ioService->run(); });
+
+    auto startT = utcTime();
+    boost::asio::write(client, boost::asio::buffer(stream));
+    auto future = allReceived.get_future();
+    BOOST_CHECK(future.wait_for(std::chrono::seconds(60)) == std::future_status::ready);
+    BOOST_CHECK_EQUAL(received, messageCount * 2);
+    BOOST_TEST_MESSAGE("read " << messageCount << " messages of 10MB and " << messageCount
+                               << " messages of 100B through the session, timecost: "
+                               << (utcTime() - startT) << "ms");
+
+    ioService->stop();
+    ioThread.join();
+    host->threadPool()->stop();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
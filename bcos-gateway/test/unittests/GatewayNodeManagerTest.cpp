@@ -436,4 +436,128 @@ BOOST_AUTO_TEST_CASE(test_GatewayNodeManager_remove)
         BOOST_CHECK(p2pIDs2.empty());
     }
 }
+BOOST_AUTO_TEST_CASE(test_GatewayNodeManager_route)
+{
+    auto keyFactory = std::make_shared<bcos::crypto::KeyFactoryImpl>();
+    auto gatewayNodeManager = std::make_shared<FakeGatewayNodeManager>(keyFactory, nullptr);
+    std::string groupID = "group";
+    std::vector<bcos::crypto::NodeIDPtr> nodeIDs;
+    std::vector<std::string> nodeIDList;
+    for (size_t i = 0; i < 100; i++)
+    {
+        std::string strNodeID = "nodeID" + std::to_string(i);
+        strNodeID.resize(64, '0');
+        nodeIDs.emplace_back(keyFactory->createKey(
+            bytesConstRef((bcos::byte*)strNodeID.data(), strNodeID.size())));
+        nodeIDList.emplace_back(nodeIDs.back()->hex());
+    }
+    auto status =
+        createGatewayNodeStatus(110, "testUUID", {createGroupNodeInfo(groupID, nodeIDList)});
+    std::vector<std::string> p2pIDs = {"xxxxx", "yyyyy", "zzzzz"};
+    for (auto const& p2pID : p2pIDs)
+    {
+        gatewayNodeManager->updatePeerStatus(p2pID, status);
+    }
+    auto peersRouterTable = gatewayNodeManager->peersRouterTable();
+    for (auto const& nodeID : nodeIDs)
+    {
+        auto route = peersRouterTable->routeP2pIDs(groupID, nodeID);
+        BOOST_CHECK(route);
+        BOOST_CHECK(std::set<P2pID>(route->begin(), route->end()) ==
+                    peersRouterTable->queryP2pIDs(groupID, nodeID->hex()));
+        BOOST_CHECK_EQUAL(route->size(), p2pIDs.size());
+    }
+    BOOST_CHECK(!peersRouterTable->routeP2pIDs("group2", nodeIDs[0]));
+    std::string strNodeID = "unknownNodeID";
+    auto unknownNodeID =
+        keyFactory->createKey(bytesConstRef((bcos::byte*)strNodeID.data(), strNodeID.size()));
+    BOOST_CHECK(!peersRouterTable->routeP2pIDs(groupID, unknownNodeID));
+
+    // the route in use is not changed by the updates
+    auto route = peersRouterTable->routeP2pIDs(groupID, nodeIDs[0]);
+    gatewayNodeManager->onRemoveNodeIDs(p2pIDs[0]);
+    BOOST_CHECK_EQUAL(route->size(), p2pIDs.size());
+    BOOST_CHECK_EQUAL(peersRouterTable->routeP2pIDs(groupID, nodeIDs[0])->size(), 2);
+
+    // the local nodes
+    BOOST_CHECK(gatewayNodeManager->registerNode(
+        groupID, unknownNodeID, bcos::protocol::NodeType::CONSENSUS_NODE, nullptr));
+    auto localRouterTable = gatewayNodeManager->localRouterTable();
+    auto frontServiceInfo = localRouterTable->getFrontService(groupID, unknownNodeID);
+    BOOST_CHECK(frontServiceInfo);
+    BOOST_CHECK_EQUAL(frontServiceInfo->nodeID(), unknownNodeID->hex());
+    BOOST_CHECK(!localRouterTable->getFrontService(groupID, nodeIDs[0]));
+    BOOST_CHECK_EQUAL(localRouterTable->nodeList()[groupID].count(unknownNodeID->hex()), 1);
+    BOOST_CHECK(localRouterTable->getGroupNodeIDList(groupID)[0]->data() ==
+                unknownNodeID->data());
+
+}
+
+BOOST_AUTO_TEST_CASE(test_IDInterner_release)
+{
+    IDInterner interner;
+    BOOST_CHECK_EQUAL(interner.intern("a"), 0);
+    BOOST_CHECK_EQUAL(interner.intern("b"), 1);
+    BOOST_CHECK_EQUAL(interner.intern("a"), 0);
+    interner.release(0);
+    BOOST_CHECK_EQUAL(interner.size(), 1);
+    BOOST_CHECK_EQUAL(interner.find("a"), IDInterner::c_invalidIndex);
+    // the released index is reused
+    BOOST_CHECK_EQUAL(interner.intern("c"), 0);
+    BOOST_CHECK_EQUAL(interner.id(0), "c");
+    BOOST_CHECK_EQUAL(interner.find("b"), 1);
+    BOOST_CHECK_EQUAL(interner.intern("a"), 2);
+
+    GroupNodeTable<std::shared_ptr<int>> table;
+    table.set("group1", "a", std::make_shared<int>(1));
+    table.set("group2", "b", std::make_shared<int>(2));
+    BOOST_CHECK_EQUAL(*table.get("group1", "a"), 1);
+    // the nodes are interned per group
+    BOOST_CHECK(!table.get("group1", "b"));
+    table.set("group1", "a", nullptr);
+    BOOST_CHECK(!table.get("group1", "a"));
+    size_t nodes = 0;
+    table.forEach([&nodes](std::string const& _groupID, std::string const& _nodeID,
+                      std::shared_ptr<int> const&) {
+        BOOST_CHECK_EQUAL(_groupID, "group2");
+        BOOST_CHECK_EQUAL(_nodeID, "b");
+        ++nodes;
+    });
+    BOOST_CHECK_EQUAL(nodes, 1);
+    // the group without nodes is released, its index is reused
+    table.set("group3", "c", std::make_shared<int>(3));
+    table.update([](std::shared_ptr<int> const& _value) {
+        return *_value == 2 ? nullptr : _value;
+    });
+    BOOST_CHECK(!table.get("group2", "b"));
+    BOOST_CHECK_EQUAL(*table.get("group3", "c"), 3);
+}
+
+BOOST_AUTO_TEST_CASE(test_GatewayNodeManager_routeRelease)
+{
+    auto keyFactory = std::make_shared<bcos::crypto::KeyFactoryImpl>();
+    auto gatewayNodeManager = std::make_shared<FakeGatewayNodeManager>(keyFactory, nullptr);
+    auto peersRouterTable = gatewayNodeManager->peersRouterTable();
+    // the nodes come and go, the routes of the removed nodes are released
+    for (size_t i = 0; i < 100; i++)
+    {
+        std::string strNodeID = "nodeID" + std::to_string(i);
+        strNodeID.resize(64, '0');
+        auto nodeID = keyFactory->createKey(
+            bytesConstRef((bcos::byte*)strNodeID.data(), strNodeID.size()));
+        auto groupID = "group" + std::to_string(i);
+        auto status = createGatewayNodeStatus(
+            110 + i, "testUUID", {createGroupNodeInfo(groupID, {nodeID->hex()})});
+        gatewayNodeManager->updatePeerStatus("xxxxx", status);
+        BOOST_CHECK_EQUAL(peersRouterTable->routeP2pIDs(groupID, nodeID)->size(), 1);
+        BOOST_CHECK_EQUAL(peersRouterTable->getGroupNodeIDList(groupID).size(), 1);
+        if (i > 0)
+        {
+            // replaced by the new status
+            BOOST_CHECK(peersRouterTable->getGroupNodeIDList("group" + std::to_string(i - 1))
+                            .empty());
+        }
+    }
+    gatewayNodeManager->onRemoveNodeIDs("xxxxx");
+    BOOST_CHECK(peersRouterTable->getGroupNodeIDList("group99").empty());
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
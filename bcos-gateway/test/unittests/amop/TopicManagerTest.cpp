@@ -21,6 +21,8 @@
 #include <bcos-gateway/libamop/TopicManager.h>
 #include <bcos-utilities/testutils/TestPromptFixture.h>
 #include <boost/test/unit_test.hpp>
+#include <deque>
+#include <set>
 
 using namespace bcos;
 using namespace bcos::amop;
@@ -135,4 +137,113 @@ BOOST_AUTO_TEST_CASE(test_subTopics)
     }
 }
 
+BOOST_AUTO_TEST_CASE(test_queryClientsByTopic)
+{
+    auto topicManager = std::make_shared<TopicManager>("", nullptr);
+    topicManager->subTopic("client0", TopicItems{TopicItem("topic0"), TopicItem("topic1")});
+    topicManager->subTopic("client1", TopicItems{TopicItem("topic1"), TopicItem("topic2")});
+    auto queryClients = [&topicManager](std::string const& _topic) {
+        std::vector<std::string> clients;
+        topicManager->queryClientsByTopic(_topic, clients);
+        return std::set<std::string>(clients.begin(), clients.end());
+    };
+    BOOST_CHECK(queryClients("topic0") == std::set<std::string>{"client0"});
+    BOOST_CHECK(queryClients("topic1") == (std::set<std::string>{"client0", "client1"}));
+    BOOST_CHECK(queryClients("topic3").empty());
+
+    // override the topics of client0
+    topicManager->subTopic("client0", TopicItems{TopicItem("topic2"), TopicItem("topic3")});
+    BOOST_CHECK(queryClients("topic0").empty());
+    BOOST_CHECK(queryClients("topic1") == std::set<std::string>{"client1"});
+    BOOST_CHECK(queryClients("topic2") == (std::set<std::string>{"client0", "client1"}));
+
+    topicManager->removeTopics("client1", {"topic2", "topic4"});
+    BOOST_CHECK(queryClients("topic2") == std::set<std::string>{"client0"});
+    BOOST_CHECK(queryClients("topic1") == std::set<std::string>{"client1"});
+
+    topicManager->removeTopicsByClients({"client0"});
+    BOOST_CHECK(queryClients("topic2").empty());
+    BOOST_CHECK(queryClients("topic3").empty());
+    BOOST_CHECK(queryClients("topic1") == std::set<std::string>{"client1"});
+}
+
+BOOST_AUTO_TEST_CASE(test_clientQueue)
+{
+    auto topicManager = std::make_shared<TopicManager>("", nullptr);
+    auto queue = topicManager->clientQueue("client");
+    BOOST_CHECK(queue == topicManager->clientQueue("client"));
+
+    // the client responds when the test calls the callbacks
+    // the callbacks are appended when the callbacks are called
+    std::deque<std::function<void()>> onSentList;
+    std::vector<bytes> sentData;
+    auto sendFunc = [&onSentList, &sentData](bytesConstRef _data, std::function<void()> _onSent) {
+        sentData.emplace_back(_data.toBytes());
+        onSentList.emplace_back(std::move(_onSent));
+    };
+    auto smallQueue = std::make_shared<AMOPClientQueue>(2, 2);
+    for (uint8_t i = 0; i < 5; i++)
+    {
+        bytes data{i};
+        BOOST_CHECK_EQUAL(smallQueue->push(ref(data), sendFunc), i < 4);
+    }
+    BOOST_CHECK_EQUAL(sentData.size(), 2);
+    BOOST_CHECK_EQUAL(smallQueue->inflight(), 2);
+    BOOST_CHECK_EQUAL(smallQueue->pending(), 2);
+    BOOST_CHECK_EQUAL(smallQueue->load(), 4);
+    BOOST_CHECK_EQUAL(smallQueue->dropped(), 1);
+
+    // the pending messages are sent in order when the client responds
+    for (size_t i = 0; i < onSentList.size(); i++)
+    {
+        onSentList[i]();
+    }
+    BOOST_CHECK_EQUAL(sentData.size(), 4);
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        BOOST_CHECK(sentData[i] == bytes{i});
+    }
+    BOOST_CHECK_EQUAL(smallQueue->sent(), 4);
+    BOOST_CHECK_EQUAL(smallQueue->load(), 0);
+
+    // the slot is released once though the callback is called again
+    bytes data{5};
+    BOOST_CHECK(smallQueue->push(ref(data), sendFunc));
+    onSentList.back()();
+    onSentList.back()();
+    BOOST_CHECK_EQUAL(smallQueue->sent(), 5);
+    BOOST_CHECK_EQUAL(smallQueue->inflight(), 0);
+
+    // the slot is released if the send throws
+    auto throwFunc = [](bytesConstRef, std::function<void()>) {
+        BOOST_THROW_EXCEPTION(std::runtime_error("send failed"));
+    };
+    BOOST_CHECK(smallQueue->push(ref(data), throwFunc));
+    BOOST_CHECK_EQUAL(smallQueue->inflight(), 0);
+    BOOST_CHECK_EQUAL(smallQueue->sent(), 6);
+
+    // the pending messages sent synchronously are drained in a loop instead of a recursion
+    size_t pendingSize = 100000;
+    auto largeQueue = std::make_shared<AMOPClientQueue>(1, pendingSize);
+    std::function<void()> firstOnSent;
+    BOOST_CHECK(largeQueue->push(
+        ref(data), [&firstOnSent](bytesConstRef, std::function<void()> _onSent) {
+            firstOnSent = std::move(_onSent);
+        }));
+    size_t syncSent = 0;
+    auto syncFunc = [&syncSent](bytesConstRef, std::function<void()> _onSent) {
+        syncSent++;
+        _onSent();
+    };
+    for (size_t i = 0; i < pendingSize; i++)
+    {
+        BOOST_CHECK(largeQueue->push(ref(data), syncFunc));
+    }
+    BOOST_CHECK_EQUAL(largeQueue->pending(), pendingSize);
+    firstOnSent();
+    BOOST_CHECK_EQUAL(syncSent, pendingSize);
+    BOOST_CHECK_EQUAL(largeQueue->sent(), pendingSize + 1);
+    BOOST_CHECK_EQUAL(largeQueue->load(), 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
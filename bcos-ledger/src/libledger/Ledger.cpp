@@ -22,6 +22,7 @@
  */
 
 #include "Ledger.h"
+#include "utilities/LogIndex.h"
 #include <bcos-codec/scale/Scale.h>
 #include <bcos-crypto/interfaces/crypto/CommonType.h>
 #include <bcos-framework/interfaces/consensus/ConsensusNode.h>
@@ -40,7 +41,9 @@
 #include <boost/lexical_cast.hpp>
 #include <boost/lexical_cast/bad_lexical_cast.hpp>
 #include <boost/throw_exception.hpp>
+#include <algorithm>
 #include <future>
+#include <iterator>
 #include <memory>
 #include <utility>
 
@@ -50,6 +53,61 @@ using namespace bcos::protocol;
 using namespace bcos::storage;
 using namespace bcos::crypto;
 
+bool Ledger::logIndexFromRecorded(bcos::storage::StorageInterface::Ptr const& _storage)
+{
+    if (m_logIndexFromRecorded)
+    {
+        return true;
+    }
+    std::promise<std::tuple<Error::UniquePtr, bool>> getPromise;
+    _storage->asyncGetRow(SYS_CURRENT_STATE, SYS_KEY_LOG_INDEX_FROM,
+        [&getPromise](Error::UniquePtr&& error, std::optional<Entry>&& entry) {
+            getPromise.set_value({std::move(error), entry.has_value()});
+        });
+    auto [error, recorded] = getPromise.get_future().get();
+    if (error)
+    {
+        // never overwrite the recorded block with a later one, it's checked again with the next
+        // block
+        LEDGER_LOG(WARNING) << LOG_DESC("Get the first block of the log index failed")
+                            << LOG_KV("message", error->errorMessage());
+        return true;
+    }
+    // the blocks prewritten before the recorded one is committed record it again, which only
+    // narrows the range covered by the log index
+    m_logIndexFromRecorded = recorded;
+    return recorded;
+}
+
+void Ledger::createLogIndexTable()
+{
+    std::promise<std::tuple<Error::UniquePtr, std::optional<Table>>> openTablePromise;
+    m_storage->asyncOpenTable(
+        SYS_LOG_INDEX, [&openTablePromise](auto&& error, std::optional<Table>&& table) {
+            openTablePromise.set_value({std::move(error), std::move(table)});
+        });
+    auto [openError, table] = openTablePromise.get_future().get();
+    if (openError)
+    {
+        BOOST_THROW_EXCEPTION(*openError);
+    }
+    if (table)
+    {
+        return;
+    }
+    std::promise<Error::UniquePtr> createTablePromise;
+    m_storage->asyncCreateTable(SYS_LOG_INDEX, SYS_VALUE,
+        [&createTablePromise](auto&& error, std::optional<Table>&&) {
+            createTablePromise.set_value(std::move(error));
+        });
+    auto createError = createTablePromise.get_future().get();
+    if (createError)
+    {
+        BOOST_THROW_EXCEPTION(*createError);
+    }
+    LEDGER_LOG(INFO) << LOG_DESC("Create the log index table of the existing chain");
+}
+
 void Ledger::asyncPrewriteBlock(bcos::storage::StorageInterface::Ptr storage,
     bcos::protocol::Block::ConstPtr block, std::function<void(Error::Ptr&&)> callback)
 {
@@ -70,8 +128,15 @@ void Ledger::asyncPrewriteBlock(bcos::storage::StorageInterface::Ptr storage,
 
     auto blockNumberStr = boost::lexical_cast<std::string>(header->number());
 
-    // 8 storage callbacks and write hash=>receipt
-    size_t TOTAL_CALLBACK = 8 + block->receiptsSize();
+    // the log index rows of the block
+    auto logIndexRows = LogIndex::buildRows(*block, header->number());
+    // the log index covers the blocks from the first one prewritten with it, which is the genesis
+    // block of a new chain or the first block after the upgrade of an existing chain
+    bool initLogIndex = !logIndexFromRecorded(storage);
+
+    // 8 storage callbacks and write hash=>receipt and the log index
+    size_t TOTAL_CALLBACK =
+        8 + block->receiptsSize() + logIndexRows.size() + (initLogIndex ? 1 : 0);
     auto setRowCallback = [total = std::make_shared<std::atomic<size_t>>(TOTAL_CALLBACK),
                               failed = std::make_shared<bool>(false),
                               callback = std::move(callback)](
@@ -200,6 +265,23 @@ void Ledger::asyncPrewriteBlock(bcos::storage::StorageInterface::Ptr storage,
         });
 
 
+    // log index
+    for (auto& [key, postings] : logIndexRows)
+    {
+        Entry logIndexEntry;
+        logIndexEntry.importFields({std::move(postings)});
+        storage->asyncSetRow(SYS_LOG_INDEX, key, std::move(logIndexEntry),
+            [setRowCallback](auto&& error) { setRowCallback(std::move(error)); });
+    }
+    if (initLogIndex)
+    {
+        Entry logIndexFromEntry;
+        logIndexFromEntry.importFields({blockNumberStr});
+        storage->asyncSetRow(SYS_CURRENT_STATE, SYS_KEY_LOG_INDEX_FROM,
+            std::move(logIndexFromEntry),
+            [setRowCallback](auto&& error) { setRowCallback(std::move(error)); });
+    }
+
     LEDGER_LOG(DEBUG) << LOG_DESC("Calculate tx counts in block")
                       << LOG_KV("number", blockNumberStr) << LOG_KV("totalCount", totalCount)
                       << LOG_KV("failedCount", failedCount);
@@ -662,6 +744,235 @@ void Ledger::asyncGetTransactionReceiptByHash(bcos::crypto::HashType const& _txH
         });
 }
 
+void Ledger::asyncGetBatchReceiptsByHashList(crypto::HashListPtr _txHashList,
+    std::function<void(Error::Ptr, std::vector<protocol::TransactionReceipt::ConstPtr>)>
+        _onGetReceipts)
+{
+    auto keys = std::make_shared<std::vector<std::string>>();
+    keys->reserve(_txHashList->size());
+    for (auto const& hash : *_txHashList)
+    {
+        keys->push_back(hash.hex());
+    }
+
+    LEDGER_LOG(TRACE) << "GetBatchReceiptsByHashList" << LOG_KV("size", keys->size());
+
+    m_storage->asyncOpenTable(SYS_HASH_2_RECEIPT,
+        [this, keys, callback = std::move(_onGetReceipts)](
+            auto&& error, std::optional<Table>&& table) {
+            auto validError = checkTableValid(std::move(error), table, SYS_HASH_2_RECEIPT);
+            if (validError)
+            {
+                callback(std::move(validError), {});
+                return;
+            }
+
+            table->asyncGetRows(*keys, [this, keys, callback](auto&& error,
+                                           std::vector<std::optional<Entry>>&& entries) {
+                if (error)
+                {
+                    LEDGER_LOG(ERROR) << "GetBatchReceiptsByHashList error"
+                                      << boost::diagnostic_information(*error);
+                    callback(BCOS_ERROR_WITH_PREV_PTR(LedgerError::GetStorageError,
+                                 "GetBatchReceiptsByHashList", *error),
+                        {});
+                    return;
+                }
+
+                // the receipts not found are nullptr
+                std::vector<protocol::TransactionReceipt::ConstPtr> receipts(entries.size());
+                for (size_t i = 0; i < entries.size(); ++i)
+                {
+                    if (!entries[i].has_value())
+                    {
+                        continue;
+                    }
+                    auto field = entries[i]->getField(0);
+                    receipts[i] = m_blockFactory->receiptFactory()->createReceipt(
+                        bcos::bytesConstRef((bcos::byte*)field.data(), field.size()));
+                }
+                callback(nullptr, std::move(receipts));
+            });
+        });
+}
+
+void Ledger::asyncGetLogLocations(protocol::BlockNumber _fromBlock,
+    protocol::BlockNumber _toBlock, std::set<std::string> const& _addresses,
+    std::vector<std::set<std::string>> const& _topics,
+    std::function<void(Error::Ptr, std::vector<LogLocation>)> _onGetLogs)
+{
+    // a log matches if it matches one value of every group
+    std::vector<std::vector<std::string>> prefixGroups;
+    if (!_addresses.empty())
+    {
+        auto& prefixes = prefixGroups.emplace_back();
+        for (auto const& address : _addresses)
+        {
+            prefixes.push_back(LogIndex::addressPrefix(address));
+        }
+    }
+    for (size_t position = 0; position < _topics.size(); ++position)
+    {
+        if (_topics[position].empty())
+        {
+            continue;
+        }
+        auto& prefixes = prefixGroups.emplace_back();
+        for (auto const& topic : _topics[position])
+        {
+            prefixes.push_back(LogIndex::topicPrefix(position, topic));
+        }
+    }
+    if (_fromBlock < 0 || _toBlock < _fromBlock || prefixGroups.empty())
+    {
+        _onGetLogs(BCOS_ERROR_PTR(LedgerError::ErrorArgument,
+                       "GetLogLocations needs a valid block range and an address or topic"),
+            {});
+        return;
+    }
+
+    LEDGER_LOG(TRACE) << "GetLogLocations" << LOG_KV("fromBlock", _fromBlock)
+                      << LOG_KV("toBlock", _toBlock) << LOG_KV("groups", prefixGroups.size());
+
+    asyncGetSystemTableEntry(SYS_CURRENT_STATE, SYS_KEY_LOG_INDEX_FROM,
+        [this, _fromBlock, _toBlock, prefixGroups = std::move(prefixGroups),
+            callback = std::move(_onGetLogs)](
+            Error::Ptr&& error, std::optional<bcos::storage::Entry>&& entry) mutable {
+            // the chains created before the log index have no index of the history blocks
+            bool indexed = false;
+            try
+            {
+                indexed = !error && boost::lexical_cast<protocol::BlockNumber>(
+                                        entry->getField(0)) <= _fromBlock;
+            }
+            catch (boost::bad_lexical_cast const&)
+            {}
+            if (!indexed)
+            {
+                callback(BCOS_ERROR_PTR(LedgerError::LogIndexNotFound,
+                             "The block range is not covered by the log index"),
+                    {});
+                return;
+            }
+            asyncGetLogLocationsFromIndex(
+                _fromBlock, _toBlock, std::move(prefixGroups), std::move(callback));
+        });
+}
+
+void Ledger::asyncGetLogLocationsFromIndex(protocol::BlockNumber _fromBlock,
+    protocol::BlockNumber _toBlock, std::vector<std::vector<std::string>> _prefixGroups,
+    std::function<void(Error::Ptr, std::vector<LogLocation>)> _onGetLogs)
+{
+    struct LogQuery
+    {
+        std::vector<std::vector<std::vector<LogLocation>>> locations;
+        std::atomic_size_t remaining;
+        std::atomic_bool failed = {false};
+        std::function<void(Error::Ptr, std::vector<LogLocation>)> callback;
+
+        void onFinished(Error::Ptr _error)
+        {
+            if (_error)
+            {
+                failed = true;
+            }
+            if (remaining.fetch_sub(1) != 1)
+            {
+                return;
+            }
+            if (failed)
+            {
+                callback(BCOS_ERROR_PTR(LedgerError::GetStorageError, "GetLogLocations failed"),
+                    {});
+                return;
+            }
+            // merge the locations of every group, then intersect the groups
+            std::vector<LogLocation> result;
+            for (size_t i = 0; i < locations.size(); ++i)
+            {
+                std::vector<LogLocation> merged;
+                for (auto& prefixLocations : locations[i])
+                {
+                    merged.insert(merged.end(), prefixLocations.begin(), prefixLocations.end());
+                }
+                std::sort(merged.begin(), merged.end());
+                merged.erase(std::unique(merged.begin(), merged.end()), merged.end());
+                if (i == 0)
+                {
+                    result = std::move(merged);
+                    continue;
+                }
+                std::vector<LogLocation> intersection;
+                std::set_intersection(result.begin(), result.end(), merged.begin(), merged.end(),
+                    std::back_inserter(intersection));
+                result = std::move(intersection);
+            }
+            callback(nullptr, std::move(result));
+        }
+    };
+    auto query = std::make_shared<LogQuery>();
+    query->callback = std::move(_onGetLogs);
+    size_t total = 0;
+    query->locations.resize(_prefixGroups.size());
+    for (size_t i = 0; i < _prefixGroups.size(); ++i)
+    {
+        query->locations[i].resize(_prefixGroups[i].size());
+        total += _prefixGroups[i].size();
+    }
+    query->remaining = total;
+
+    for (size_t i = 0; i < _prefixGroups.size(); ++i)
+    {
+        for (size_t j = 0; j < _prefixGroups[i].size(); ++j)
+        {
+            // the rows of a prefix within the range are adjacent, scan them at once
+            storage::Condition condition;
+            condition.GE(LogIndex::key(_prefixGroups[i][j], _fromBlock));
+            condition.LE(LogIndex::key(_prefixGroups[i][j], _toBlock));
+            m_storage->asyncGetPrimaryKeys(SYS_LOG_INDEX, condition,
+                [this, query, i, j](Error::UniquePtr error, std::vector<std::string> keys) {
+                    if (error)
+                    {
+                        LEDGER_LOG(ERROR) << "GetLogLocations get keys error"
+                                          << boost::diagnostic_information(*error);
+                        query->onFinished(BCOS_ERROR_PTR(LedgerError::GetStorageError, ""));
+                        return;
+                    }
+                    if (keys.empty())
+                    {
+                        query->onFinished(nullptr);
+                        return;
+                    }
+                    auto keysPtr = std::make_shared<std::vector<std::string>>(std::move(keys));
+                    m_storage->asyncGetRows(SYS_LOG_INDEX, *keysPtr,
+                        [query, i, j, keysPtr](
+                            Error::UniquePtr error, std::vector<std::optional<Entry>> entries) {
+                            if (error)
+                            {
+                                LEDGER_LOG(ERROR) << "GetLogLocations get rows error"
+                                                  << boost::diagnostic_information(*error);
+                                query->onFinished(
+                                    BCOS_ERROR_PTR(LedgerError::GetStorageError, ""));
+                                return;
+                            }
+                            auto& locations = query->locations[i][j];
+                            for (size_t k = 0; k < entries.size(); ++k)
+                            {
+                                if (entries[k] && !LogIndex::decodePostings((*keysPtr)[k],
+                                                      entries[k]->getField(0), locations))
+                                {
+                                    query->onFinished(BCOS_ERROR_PTR(LedgerError::DecodeError,
+                                        "Decode log index error"));
+                                    return;
+                                }
+                            }
+                            query->onFinished(nullptr);
+                        });
+                });
+        }
+    }
+}
+
 void Ledger::asyncGetTotalTransactionCount(
     std::function<void(Error::Ptr, int64_t, int64_t, bcos::protocol::BlockNumber)> _callback)
 {
@@ -1309,6 +1620,7 @@ bool Ledger::buildGenesisBlock(
     if (std::get<1>(getBlockResult))
     {
         // genesis block exists, quit
+        createLogIndexTable();
         LEDGER_LOG(INFO) << LOG_DESC("[#buildGenesisBlock] success, block exists");
         return true;
     }
@@ -1325,6 +1637,7 @@ bool Ledger::buildGenesisBlock(
         SYS_NUMBER_2_TXS, SYS_VALUE,
         SYS_HASH_2_RECEIPT, SYS_VALUE,
         SYS_BLOCK_NUMBER_2_NONCES, SYS_VALUE,
+        SYS_LOG_INDEX, SYS_VALUE,
         DAG_TRANSFER, "balance"
     };
     // clang-format on
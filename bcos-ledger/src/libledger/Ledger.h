@@ -30,6 +30,7 @@
 #include <bcos-utilities/Common.h>
 #include <bcos-utilities/Exceptions.h>
 #include <bcos-utilities/ThreadPool.h>
+#include <atomic>
 #include <utility>
 
 #define LEDGER_LOG(LEVEL) BCOS_LOG(LEVEL) << LOG_BADGE("LEDGER")
@@ -77,6 +78,14 @@ public:
             Error::Ptr, bcos::protocol::TransactionReceipt::ConstPtr, MerkleProofPtr)>
             _onGetTx) override;
 
+    void asyncGetBatchReceiptsByHashList(crypto::HashListPtr _txHashList,
+        std::function<void(Error::Ptr, std::vector<protocol::TransactionReceipt::ConstPtr>)>
+            _onGetReceipts) override;
+
+    void asyncGetLogLocations(protocol::BlockNumber _fromBlock, protocol::BlockNumber _toBlock,
+        std::set<std::string> const& _addresses, std::vector<std::set<std::string>> const& _topics,
+        std::function<void(Error::Ptr, std::vector<LogLocation>)> _onGetLogs) override;
+
     void asyncGetTotalTransactionCount(
         std::function<void(Error::Ptr, int64_t, int64_t, bcos::protocol::BlockNumber)> _callback)
         override;
@@ -128,6 +137,12 @@ private:
 
     void createFileSystemTables();
 
+    // the locations of the logs in the rows of the prefixes within the block range, the
+    // locations of every prefix group are merged and the groups are intersected
+    void asyncGetLogLocationsFromIndex(protocol::BlockNumber _fromBlock,
+        protocol::BlockNumber _toBlock, std::vector<std::vector<std::string>> _prefixGroups,
+        std::function<void(Error::Ptr, std::vector<LogLocation>)> _onGetLogs);
+
     void buildDir(const std::string& _absoluteDir);
 
     // only for /sys/
@@ -136,7 +151,13 @@ private:
         return _s.substr(_s.find_last_of('/') + 1);
     }
 
+    // whether the first block covered by the log index is recorded
+    bool logIndexFromRecorded(bcos::storage::StorageInterface::Ptr const& _storage);
+    // create the log index table of the chains built before it
+    void createLogIndexTable();
+
     bcos::protocol::BlockFactory::Ptr m_blockFactory;
     bcos::storage::StorageInterface::Ptr m_storage;
+    std::atomic_bool m_logIndexFromRecorded = {false};
 };
 }  // namespace bcos::ledger
\ No newline at end of file
@@ -68,6 +68,7 @@ enum LedgerError : int32_t
     GetStorageError = 3008,
     EmptyEntry = 3009,
     UnknownError = 3010,
+    LogIndexNotFound = 3011,
 };
 
 }  // namespace bcos::ledger
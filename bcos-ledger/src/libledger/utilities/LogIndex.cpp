@@ -0,0 +1,122 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the keys and the postings of the log index
+ * @file LogIndex.cpp
+ */
+
+#include "LogIndex.h"
+#include <cstdio>
+
+using namespace bcos;
+using namespace bcos::ledger;
+
+static constexpr size_t c_blockNumberDigits = 16;
+
+std::string LogIndex::addressPrefix(std::string_view _address)
+{
+    return "a" + std::to_string(_address.size()) + ":" + std::string(_address) + ":";
+}
+
+std::string LogIndex::topicPrefix(size_t _position, std::string_view _topic)
+{
+    return "t" + std::to_string(_position) + "_" + std::to_string(_topic.size()) + ":" +
+           std::string(_topic) + ":";
+}
+
+std::string LogIndex::key(std::string const& _prefix, protocol::BlockNumber _number)
+{
+    char number[c_blockNumberDigits + 1];
+    std::snprintf(number, sizeof(number), "%016llx", (unsigned long long)_number);
+    return _prefix + number;
+}
+
+std::map<std::string, std::string> LogIndex::buildRows(
+    protocol::Block const& _block, protocol::BlockNumber _number)
+{
+    std::map<std::string, std::string> rows;
+    for (size_t txIndex = 0; txIndex < _block.receiptsSize(); ++txIndex)
+    {
+        auto receipt = _block.receipt(txIndex);
+        uint32_t logIndex = 0;
+        for (auto const& logEntry : receipt->logEntries())
+        {
+            encodePosting(rows[key(addressPrefix(logEntry.address()), _number)], txIndex, logIndex);
+            auto const& topics = logEntry.topics();
+            for (size_t position = 0; position < topics.size(); ++position)
+            {
+                encodePosting(rows[key(topicPrefix(position, topics[position].hex()), _number)],
+                    txIndex, logIndex);
+            }
+            ++logIndex;
+        }
+    }
+    return rows;
+}
+
+static void encodeVarint(std::string& _buffer, uint32_t _value)
+{
+    while (_value >= 0x80)
+    {
+        _buffer.push_back((char)((_value & 0x7f) | 0x80));
+        _value >>= 7;
+    }
+    _buffer.push_back((char)_value);
+}
+
+static bool decodeVarint(std::string_view& _buffer, uint32_t& _value)
+{
+    _value = 0;
+    for (size_t shift = 0; shift < 35 && !_buffer.empty(); shift += 7)
+    {
+        auto byte = (uint8_t)_buffer.front();
+        _buffer.remove_prefix(1);
+        _value |= (uint32_t)(byte & 0x7f) << shift;
+        if (!(byte & 0x80))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void LogIndex::encodePosting(std::string& _postings, uint32_t _txIndex, uint32_t _logIndex)
+{
+    encodeVarint(_postings, _txIndex);
+    encodeVarint(_postings, _logIndex);
+}
+
+bool LogIndex::decodePostings(
+    std::string_view _key, std::string_view _postings, std::vector<LogLocation>& _locations)
+{
+    if (_key.size() < c_blockNumberDigits)
+    {
+        return false;
+    }
+    auto number = std::stoull(
+        std::string(_key.substr(_key.size() - c_blockNumberDigits)), nullptr, 16);
+    while (!_postings.empty())
+    {
+        LogLocation location;
+        location.blockNumber = (protocol::BlockNumber)number;
+        if (!decodeVarint(_postings, location.txIndex) ||
+            !decodeVarint(_postings, location.logIndex))
+        {
+            return false;
+        }
+        _locations.push_back(location);
+    }
+    return true;
+}
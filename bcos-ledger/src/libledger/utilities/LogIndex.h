@@ -0,0 +1,54 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the keys and the postings of the log index
+ * @file LogIndex.h
+ */
+
+#pragma once
+
+#include <bcos-framework/interfaces/ledger/LedgerTypeDef.h>
+#include <bcos-framework/interfaces/protocol/Block.h>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace bcos::ledger
+{
+/// The log index maps the address and the topics of the logs to their locations. Every indexed
+/// value has one row per block, keyed by the prefix of the value followed by the block number in
+/// 16 hex digits, so the rows of a value are adjacent and ordered by block number and a block
+/// range is one range scan. The row holds the varint encoded (tx index, log index) postings of
+/// the block
+class LogIndex
+{
+public:
+    // the prefix of the rows of a value, the value is length prefixed so no prefix of a value is
+    // the prefix of another value
+    static std::string addressPrefix(std::string_view _address);
+    static std::string topicPrefix(size_t _position, std::string_view _topic);
+    static std::string key(std::string const& _prefix, protocol::BlockNumber _number);
+
+    // the rows of the logs in the receipts of the block, key => postings
+    static std::map<std::string, std::string> buildRows(
+        protocol::Block const& _block, protocol::BlockNumber _number);
+
+    static void encodePosting(std::string& _postings, uint32_t _txIndex, uint32_t _logIndex);
+    // append the locations of the postings in the row of _key to _locations
+    static bool decodePostings(std::string_view _key, std::string_view _postings,
+        std::vector<LogLocation>& _locations);
+};
+}  // namespace bcos::ledger
@@ -41,6 +41,7 @@
 #include <bcos-utilities/testutils/TestPromptFixture.h>
 #include <boost/lexical_cast.hpp>
 #include <boost/test/unit_test.hpp>
+#include <algorithm>
 #include <memory>
 
 using namespace bcos;
@@ -839,6 +840,91 @@ BOOST_AUTO_TEST_CASE(getTransactionReceiptByHash)
     BOOST_CHECK_EQUAL(f4.get(), true);
 }
 
+BOOST_AUTO_TEST_CASE(getBatchReceiptsByHashList)
+{
+    initFixture();
+    initChain(5);
+
+    auto hashList = std::make_shared<HashList>();
+    hashList->push_back(m_fakeBlocks->at(3)->transactionHash(0));
+    hashList->push_back(HashType());
+    hashList->push_back(m_fakeBlocks->at(4)->transactionHash(0));
+
+    std::promise<bool> p1;
+    auto f1 = p1.get_future();
+    // the receipts not found are nullptr
+    m_ledger->asyncGetBatchReceiptsByHashList(
+        hashList, [&](Error::Ptr _error, std::vector<TransactionReceipt::ConstPtr> _receipts) {
+            BOOST_CHECK_EQUAL(_error, nullptr);
+            BOOST_CHECK_EQUAL(_receipts.size(), 3);
+            BOOST_CHECK_EQUAL(
+                _receipts[0]->hash().hex(), m_fakeBlocks->at(3)->receipt(0)->hash().hex());
+            BOOST_CHECK(_receipts[1] == nullptr);
+            BOOST_CHECK_EQUAL(
+                _receipts[2]->hash().hex(), m_fakeBlocks->at(4)->receipt(0)->hash().hex());
+            p1.set_value(true);
+        });
+    BOOST_CHECK_EQUAL(f1.get(), true);
+}
+
+BOOST_AUTO_TEST_CASE(getLogLocations)
+{
+    initFixture();
+    initChain(5);
+
+    // every receipt of the fake blocks has the logs of the topic hash("0") and hash("1"), and the
+    // block i has i receipts
+    auto hashImpl = m_blockFactory->cryptoSuite()->hashImpl();
+    auto topic0 = hashImpl->hash(std::to_string(0));
+    auto topic1 = hashImpl->hash(std::to_string(1));
+    auto address0 = right160(topic0).asBytes();
+
+    std::promise<bool> p1;
+    auto f1 = p1.get_future();
+    m_ledger->asyncGetLogLocations(2, 4, {}, {{topic1.hex()}},
+        [&](Error::Ptr _error, std::vector<LogLocation> _locations) {
+            BOOST_CHECK_EQUAL(_error, nullptr);
+            BOOST_CHECK_EQUAL(_locations.size(), 2 + 3 + 4);
+            BOOST_CHECK(std::is_sorted(_locations.begin(), _locations.end()));
+            BOOST_CHECK_EQUAL(_locations.front().blockNumber, 2);
+            BOOST_CHECK_EQUAL(_locations.back().blockNumber, 4);
+            BOOST_CHECK_EQUAL(_locations.back().txIndex, 3);
+            for (auto const& location : _locations)
+            {
+                BOOST_CHECK_EQUAL(location.logIndex, 1);
+            }
+            p1.set_value(true);
+        });
+    BOOST_CHECK_EQUAL(f1.get(), true);
+
+    // the address and the topics are matched in the same log
+    std::promise<bool> p2;
+    auto f2 = p2.get_future();
+    std::set<std::string> addresses{std::string(address0.begin(), address0.end())};
+    m_ledger->asyncGetLogLocations(1, 5, addresses, {{topic0.hex(), topic1.hex()}},
+        [&](Error::Ptr _error, std::vector<LogLocation> _locations) {
+            BOOST_CHECK_EQUAL(_error, nullptr);
+            BOOST_CHECK_EQUAL(_locations.size(), 1 + 2 + 3 + 4 + 5);
+            for (auto const& location : _locations)
+            {
+                BOOST_CHECK_EQUAL(location.logIndex, 0);
+            }
+            p2.set_value(true);
+        });
+    BOOST_CHECK_EQUAL(f2.get(), true);
+
+    std::promise<bool> p3;
+    auto f3 = p3.get_future();
+    m_ledger->asyncGetLogLocations(
+        1, 5, {}, {}, [&](Error::Ptr _error, std::vector<LogLocation> _locations) {
+            BOOST_CHECK(_error != nullptr);
+            BOOST_CHECK_EQUAL(_error->errorCode(), LedgerError::ErrorArgument);
+            BOOST_CHECK(_locations.empty());
+            p3.set_value(true);
+        });
+    BOOST_CHECK_EQUAL(f3.get(), true);
+}
+
 BOOST_AUTO_TEST_CASE(getNonceList)
 {
     initFixture();
@@ -25,6 +25,7 @@
 #include "protocol/PB/PBFTMessageFactoryImpl.h"
 #include "storage/LedgerStorage.h"
 #include "utilities/Common.h"
+#include <boost/filesystem.hpp>
 
 using namespace bcos;
 using namespace bcos::consensus;
@@ -64,6 +65,16 @@ PBFTImpl::Ptr PBFTFactory::createPBFT()
     PBFT_LOG(INFO) << LOG_DESC("create pbftStorage");
     auto pbftStorage =
         std::make_shared<LedgerStorage>(m_scheduler, m_storage, m_blockFactory, pbftMessageFactory);
+    if (!m_walPath.empty() && m_enableWAL)
+    {
+        PBFT_LOG(INFO) << LOG_DESC("create consensus wal") << LOG_KV("path", m_walPath);
+        pbftStorage->setWAL(std::make_shared<ConsensusWAL>(m_walPath));
+    }
+    else if (!m_walPath.empty() && boost::filesystem::exists(m_walPath))
+    {
+        PBFT_LOG(INFO) << LOG_DESC("open the disabled consensus wal") << LOG_KV("path", m_walPath);
+        pbftStorage->setRetiredWAL(std::make_shared<ConsensusWAL>(m_walPath));
+    }
 
     PBFT_LOG(INFO) << LOG_DESC("create pbftConfig");
     auto pbftConfig = std::make_shared<PBFTConfig>(m_cryptoSuite, m_keyPair, pbftMessageFactory,
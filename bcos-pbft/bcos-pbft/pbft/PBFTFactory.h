@@ -46,6 +46,14 @@ public:
     virtual ~PBFTFactory() {}
     virtual PBFTImpl::Ptr createPBFT();
 
+    // the committed proposals are appended to the wal file of _walPath if _enableWAL, otherwise
+    // the proposals of the existing wal file are moved back to the kv-storage
+    void setWALPath(std::string const& _walPath, bool _enableWAL)
+    {
+        m_walPath = _walPath;
+        m_enableWAL = _enableWAL;
+    }
+
 protected:
     bcos::crypto::CryptoSuite::Ptr m_cryptoSuite;
     bcos::crypto::KeyPairInterface::Ptr m_keyPair;
@@ -56,6 +64,8 @@ protected:
     bcos::txpool::TxPoolInterface::Ptr m_txpool;
     bcos::protocol::BlockFactory::Ptr m_blockFactory;
     bcos::protocol::TransactionSubmitResultFactory::Ptr m_txResultFactory;
+    std::string m_walPath;
+    bool m_enableWAL = false;
 };
 }  // namespace consensus
 }  // namespace bcos
\ No newline at end of file
@@ -19,6 +19,7 @@
  * @date 2021-04-23
  */
 #include "PBFTCache.h"
+#include <bcos-framework/interfaces/metrics/Metrics.h>
 
 using namespace bcos;
 using namespace bcos::consensus;
@@ -261,6 +262,11 @@ bool PBFTCache::checkAndPreCommit()
     }
     // update and backup the proposal into precommit-status
     intoPrecommit();
+    static auto& prepareLatency = metrics::histogram(metrics::c_prepareStage);
+    m_precommitTime = std::chrono::steady_clock::now();
+    prepareLatency.record(std::chrono::duration_cast<std::chrono::microseconds>(
+        m_precommitTime - m_prePrepareTime)
+                              .count());
     // generate the commitReq
     auto commitReq = m_config->pbftMessageFactory()->populateFrom(PacketType::CommitPacket,
         m_config->pbftMsgDefaultVersion(), m_config->view(), utcTime(), m_config->nodeIndex(),
@@ -310,6 +316,12 @@ bool PBFTCache::checkAndCommit()
                    << printPBFTProposal(m_precommit->consensusProposal())
                    << m_config->printCurrentState();
     m_submitted.store(true);
+    // the precommit recovered from the other nodes has no precommit time
+    if (m_precommitted)
+    {
+        static auto& commitLatency = metrics::histogram(metrics::c_commitStage);
+        commitLatency.recordElapsed(m_precommitTime);
+    }
     return true;
 }
 
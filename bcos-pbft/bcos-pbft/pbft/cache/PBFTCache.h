@@ -21,6 +21,7 @@
 #pragma once
 #include "../config/PBFTConfig.h"
 #include "../interfaces/PBFTMessageInterface.h"
+#include <chrono>
 
 namespace bcos
 {
@@ -65,6 +66,7 @@ public:
             return;
         }
         m_prePrepare = _prePrepareMsg;
+        m_prePrepareTime = std::chrono::steady_clock::now();
         PBFT_LOG(INFO) << LOG_DESC("addPrePrepareCache") << printPBFTMsgInfo(_prePrepareMsg)
                        << LOG_KV("sys", _prePrepareMsg->consensusProposal()->systemProposal())
                        << m_config->printCurrentState();
@@ -194,6 +196,9 @@ protected:
     std::atomic_bool m_stableCommitted = {false};
     std::atomic_bool m_precommitted = {false};
     std::atomic<bcos::protocol::BlockNumber> m_index;
+    // the time the prePrepare is accepted and the time into precommit, for the stage latencies
+    std::chrono::steady_clock::time_point m_prePrepareTime;
+    std::chrono::steady_clock::time_point m_precommitTime;
     // prepareCacheList
     CollectionCacheType m_prepareCacheList;
     QuorumRecoderType m_prepareReqWeight;
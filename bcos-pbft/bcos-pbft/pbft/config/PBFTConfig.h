@@ -164,6 +164,11 @@ public:
         m_checkPointTimeoutInterval = _timeoutInterval;
     }
 
+    // broadcast the pre-prepare with the transactions replaced by short ids, all the consensus
+    // nodes must support the compact proposal
+    bool compactProposal() const { return m_compactProposal; }
+    void setCompactProposal(bool _compactProposal) { m_compactProposal = _compactProposal; }
+
     void resetToView()
     {
         m_toView.store(m_view);
@@ -394,6 +399,7 @@ protected:
 
     int64_t m_waterMarkLimit = 10;
     std::atomic<int64_t> m_checkPointTimeoutInterval = {3000};
+    bool m_compactProposal = false;
 
     std::atomic<uint64_t> m_leaderSwitchPeriod = {1};
     const unsigned c_pbftMsgDefaultVersion = 0;
@@ -22,6 +22,7 @@
 #include "../cache/PBFTCacheFactory.h"
 #include "../cache/PBFTCacheProcessor.h"
 #include <bcos-framework/interfaces/ledger/LedgerConfig.h>
+#include <bcos-framework/interfaces/metrics/Metrics.h>
 #include <bcos-framework/interfaces/protocol/Protocol.h>
 #include <bcos-utilities/ThreadPool.h>
 #include <boost/bind/bind.hpp>
@@ -311,8 +312,20 @@ void PBFTEngine::onRecvProposal(bool _containSysTxs, bytesConstRef _proposalData
     // only broadcast the prePrepareMsg when local handlePrePrepareMsg success
     if (ret)
     {
-        // broadcast the pre-prepare packet
-        auto encodedData = m_config->codec()->encode(pbftMessage);
+        // broadcast the pre-prepare packet, the local cache keeps the full proposal
+        auto broadcastMsg = pbftMessage;
+        if (m_config->compactProposal())
+        {
+            auto compactProposal = m_config->validator()->compactProposal(
+                m_config->pbftMessageFactory(), pbftProposal);
+            if (compactProposal)
+            {
+                broadcastMsg = m_config->pbftMessageFactory()->populateFrom(
+                    PacketType::PrePreparePacket, compactProposal, pbftMessage->version(),
+                    pbftMessage->view(), pbftMessage->timestamp(), pbftMessage->generatedFrom());
+            }
+        }
+        auto encodedData = m_config->codec()->encode(broadcastMsg);
         // only broadcast pbft message to the consensus nodes
         m_config->frontService()->asyncSendBroadcastMessage(
             bcos::protocol::NodeType::CONSENSUS_NODE, ModuleID::PBFT, ref(*encodedData));
@@ -736,6 +749,11 @@ bool PBFTEngine::handlePrePrepareMsg(PBFTMessageInterface::Ptr _prePrepareMsg,
             }
         }
     }
+    // the compact proposal is handled again after its transactions are resolved
+    if (_prePrepareMsg->consensusProposal()->shortTxIDSalt() != 0)
+    {
+        return resolveCompactPrePrepareMsg(_prePrepareMsg, _generatedFromNewView);
+    }
     // add the prePrepareReq to the cache
     if (!_needVerifyProposal)
     {
@@ -762,7 +780,8 @@ bool PBFTEngine::handlePrePrepareMsg(PBFTMessageInterface::Ptr _prePrepareMsg,
     }
     m_config->validator()->verifyProposal(leaderNodeInfo->nodeID(),
         _prePrepareMsg->consensusProposal(),
-        [self, _prePrepareMsg, _generatedFromNewView](Error::Ptr _error, bool _verifyResult) {
+        [self, _prePrepareMsg, _generatedFromNewView, startT = std::chrono::steady_clock::now()](
+            Error::Ptr _error, bool _verifyResult) {
             try
             {
                 auto pbftEngine = self.lock();
@@ -800,6 +819,8 @@ bool PBFTEngine::handlePrePrepareMsg(PBFTMessageInterface::Ptr _prePrepareMsg,
                     return;
                 }
                 // verify success
+                static auto& prePrepareLatency = metrics::histogram(metrics::c_prePrepareStage);
+                prePrepareLatency.recordElapsed(startT);
                 RecursiveGuard l(pbftEngine->m_mutex);
                 pbftEngine->handlePrePrepareMsg(
                     _prePrepareMsg, false, _generatedFromNewView, false);
@@ -814,6 +835,52 @@ bool PBFTEngine::handlePrePrepareMsg(PBFTMessageInterface::Ptr _prePrepareMsg,
     return true;
 }
 
+bool PBFTEngine::resolveCompactPrePrepareMsg(
+    PBFTMessageInterface::Ptr _prePrepareMsg, bool _generatedFromNewView)
+{
+    auto leaderNodeInfo = m_config->getConsensusNodeByIndex(_prePrepareMsg->generatedFrom());
+    if (!leaderNodeInfo)
+    {
+        return false;
+    }
+    auto self = std::weak_ptr<PBFTEngine>(shared_from_this());
+    m_config->validator()->asyncResolveCompactProposal(leaderNodeInfo->nodeID(),
+        m_config->pbftMessageFactory(), _prePrepareMsg->consensusProposal(),
+        [self, _prePrepareMsg, _generatedFromNewView](
+            Error::Ptr _error, PBFTProposalInterface::Ptr _proposal) {
+            try
+            {
+                auto pbftEngine = self.lock();
+                if (!pbftEngine)
+                {
+                    return;
+                }
+                if (_error != nullptr)
+                {
+                    PBFT_LOG(WARNING) << LOG_DESC("resolve compact proposal failed")
+                                      << printPBFTMsgInfo(_prePrepareMsg)
+                                      << LOG_KV("errorCode", _error->errorCode())
+                                      << LOG_KV("errorMsg", _error->errorMessage());
+                    pbftEngine->m_config->notifySealer(_prePrepareMsg->index(), true);
+                    return;
+                }
+                // the received message is kept as it is, the full proposal is verified with
+                // a new message carrying the same signature
+                auto prePrepareMsg = _prePrepareMsg->populateWithoutProposal();
+                prePrepareMsg->setConsensusProposal(_proposal);
+                RecursiveGuard l(pbftEngine->m_mutex);
+                pbftEngine->handlePrePrepareMsg(prePrepareMsg, true, _generatedFromNewView, false);
+            }
+            catch (std::exception const& _e)
+            {
+                PBFT_LOG(WARNING) << LOG_DESC("exception when resolve compact proposal")
+                                  << printPBFTMsgInfo(_prePrepareMsg)
+                                  << LOG_KV("error", boost::diagnostic_information(_e));
+            }
+        });
+    return true;
+}
+
 void PBFTEngine::broadcastPrepareMsg(PBFTMessageInterface::Ptr _prePrepareMsg)
 {
     auto prepareMsg = m_config->pbftMessageFactory()->populateFrom(PacketType::PreparePacket,
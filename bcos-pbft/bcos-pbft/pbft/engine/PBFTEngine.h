@@ -105,6 +105,9 @@ protected:
     virtual bool handlePrePrepareMsg(std::shared_ptr<PBFTMessageInterface> _prePrepareMsg,
         bool _needVerifyProposal, bool _generatedFromNewView = false,
         bool _needCheckSignature = true);
+    // resolve the transactions of the compact proposal, and handle the full proposal after that
+    virtual bool resolveCompactPrePrepareMsg(
+        std::shared_ptr<PBFTMessageInterface> _prePrepareMsg, bool _generatedFromNewView);
     virtual void resetSealedTxs(std::shared_ptr<PBFTMessageInterface> _prePrepareMsg);
 
     virtual CheckResult checkPrePrepareMsg(std::shared_ptr<PBFTMessageInterface> _prePrepareMsg);
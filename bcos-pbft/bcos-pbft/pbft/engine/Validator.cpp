@@ -19,6 +19,7 @@
  * @date 2021-04-21
  */
 #include "Validator.h"
+#include <unordered_set>
 using namespace bcos;
 using namespace bcos::consensus;
 using namespace bcos::crypto;
@@ -40,9 +41,130 @@ void TxsValidator::verifyProposal(bcos::crypto::PublicPtr _fromNode,
         }
         return;
     }
+    // the compact proposal must be resolved by asyncResolveCompactProposal first
+    if (_proposal->shortTxIDSalt() != 0)
+    {
+        if (_verifyFinishedHandler)
+        {
+            auto error = std::make_shared<Error>(-1, "Unresolved compact proposal");
+            _verifyFinishedHandler(error, false);
+        }
+        return;
+    }
     m_txPool->asyncVerifyBlock(_fromNode, _proposal->data(), _verifyFinishedHandler);
 }
 
+void TxsValidator::asyncResolveCompactProposal(PublicPtr _fromNode,
+    PBFTMessageFactory::Ptr _factory, PBFTProposalInterface::Ptr _proposal,
+    std::function<void(Error::Ptr, PBFTProposalInterface::Ptr)> _onResolved)
+{
+    auto startT = utcTime();
+    auto shortTxIDs = std::make_shared<bcos::txpool::ShortTxIDs>(_proposal->shortTxIDs());
+    auto self = std::weak_ptr<TxsValidator>(shared_from_this());
+    m_txPool->asyncResolveShortTxIDs(_fromNode, _proposal->hash(), _proposal->shortTxIDSalt(),
+        shortTxIDs, _proposal->txsDigest(),
+        [self, startT, _factory, _proposal, _onResolved](
+            Error::Ptr _error, Block::Ptr _txsMetaData) {
+            try
+            {
+                auto validator = self.lock();
+                if (!validator)
+                {
+                    return;
+                }
+                if (_error)
+                {
+                    PBFT_LOG(WARNING) << LOG_DESC("asyncResolveCompactProposal: resolve txs failed")
+                                      << printPBFTProposal(_proposal)
+                                      << LOG_KV("code", _error->errorCode())
+                                      << LOG_KV("msg", _error->errorMessage());
+                    _onResolved(_error, nullptr);
+                    return;
+                }
+                // the received proposal is kept as it is, the resolved one is a new proposal
+                auto block = validator->m_blockFactory->createBlock(_proposal->data());
+                for (size_t i = 0; i < _txsMetaData->transactionsMetaDataSize(); i++)
+                {
+                    block->appendTransactionMetaData(std::const_pointer_cast<TransactionMetaData>(
+                        _txsMetaData->transactionMetaData(i)));
+                }
+                auto encodedData = std::make_shared<bytes>();
+                block->encode(*encodedData);
+                auto proposal = _factory->populateFrom(_proposal, false, true);
+                proposal->setSystemProposal(_proposal->systemProposal());
+                proposal->setData(std::move(*encodedData));
+                PBFT_LOG(INFO) << LOG_DESC("asyncResolveCompactProposal: resolve txs success")
+                               << printPBFTProposal(proposal)
+                               << LOG_KV("txs", block->transactionsMetaDataSize())
+                               << LOG_KV("timecost", (utcTime() - startT));
+                _onResolved(nullptr, proposal);
+            }
+            catch (std::exception const& e)
+            {
+                PBFT_LOG(WARNING) << LOG_DESC("asyncResolveCompactProposal exception")
+                                  << LOG_KV("error", boost::diagnostic_information(e));
+                _onResolved(
+                    std::make_shared<Error>(-1, "asyncResolveCompactProposal exception"), nullptr);
+            }
+        });
+}
+
+PBFTProposalInterface::Ptr TxsValidator::compactProposal(
+    PBFTMessageFactory::Ptr _factory, PBFTProposalInterface::Ptr _proposal)
+{
+    auto block = m_blockFactory->createBlock(_proposal->data());
+    auto txsSize = block->transactionsMetaDataSize();
+    // the proposals with full transactions are not generated by the sealer
+    if (txsSize == 0 || block->transactionsSize() > 0)
+    {
+        return nullptr;
+    }
+    auto salt = bcos::txpool::proposalShortTxIDSalt(_proposal->index());
+    bcos::txpool::ShortTxIDs shortTxIDs(txsSize);
+    HashList txsHash(txsSize);
+    std::unordered_set<uint64_t> uniqueShortTxIDs;
+    uniqueShortTxIDs.reserve(txsSize);
+    for (size_t i = 0; i < txsSize; i++)
+    {
+        txsHash[i] = block->transactionHash(i);
+        shortTxIDs[i] = bcos::txpool::shortTxID(salt, txsHash[i]);
+        // the ids must be unique in the proposal
+        if (!uniqueShortTxIDs.insert(shortTxIDs[i]).second)
+        {
+            PBFT_LOG(INFO) << LOG_DESC("compactProposal: short ids collided, send the full block")
+                           << printPBFTProposal(_proposal);
+            return nullptr;
+        }
+    }
+    auto compactBlock = m_blockFactory->createBlock();
+    compactBlock->setVersion(block->version());
+    compactBlock->setBlockType(block->blockType());
+    compactBlock->setBlockHeader(block->blockHeader());
+    compactBlock->setNonceList(block->nonceList());
+    auto encodedData = std::make_shared<bytes>();
+    compactBlock->encode(*encodedData);
+
+    auto proposal = _factory->populateFrom(_proposal, false, true);
+    proposal->setSystemProposal(_proposal->systemProposal());
+    proposal->setData(std::move(*encodedData));
+    proposal->setShortTxIDs(salt, shortTxIDs,
+        bcos::txpool::txsHashDigest(m_blockFactory->cryptoSuite()->hashImpl(), txsHash));
+    // the txpool serves the missed txs of the replicas from the marked batch, which must be
+    // recorded before the compact proposal is broadcasted
+    auto blockHeader = block->blockHeader();
+    m_txPool->asyncMarkTxs(std::make_shared<HashList>(std::move(txsHash)), true,
+        blockHeader->number(), blockHeader->hash(), [blockHeader](Error::Ptr _error) {
+            if (_error)
+            {
+                PBFT_LOG(WARNING) << LOG_DESC("compactProposal: mark txs failed")
+                                  << LOG_KV("index", blockHeader->number())
+                                  << LOG_KV("code", _error->errorCode())
+                                  << LOG_KV("msg", _error->errorMessage());
+            }
+        });
+    return proposal;
+}
+
 void TxsValidator::asyncResetTxsFlag(bytesConstRef _data, bool _flag)
 {
     auto block = m_blockFactory->createBlock(_data);
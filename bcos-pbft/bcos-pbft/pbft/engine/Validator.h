@@ -43,6 +43,14 @@ public:
     virtual void asyncResetTxsFlag(bytesConstRef _data, bool _flag) = 0;
     virtual PBFTProposalInterface::Ptr generateEmptyProposal(
         PBFTMessageFactory::Ptr _factory, int64_t _index, int64_t _sealerId) = 0;
+    // the proposal with the transactions replaced by the short ids, nullptr if not compactable
+    virtual PBFTProposalInterface::Ptr compactProposal(
+        PBFTMessageFactory::Ptr _factory, PBFTProposalInterface::Ptr _proposal) = 0;
+    // the full proposal of the compact _proposal, whose transactions are resolved through the
+    // txpool and checked against the digest of the proposal, _proposal is not modified
+    virtual void asyncResolveCompactProposal(bcos::crypto::PublicPtr _fromNode,
+        PBFTMessageFactory::Ptr _factory, PBFTProposalInterface::Ptr _proposal,
+        std::function<void(Error::Ptr, PBFTProposalInterface::Ptr)> _onResolved) = 0;
 
     virtual void notifyTransactionsResult(
         bcos::protocol::Block::Ptr _block, bcos::protocol::BlockHeader::Ptr _header) = 0;
@@ -94,6 +102,11 @@ public:
         std::function<void(Error::Ptr, bool)> _verifyFinishedHandler) override;
 
     void asyncResetTxsFlag(bytesConstRef _data, bool _flag) override;
+    PBFTProposalInterface::Ptr compactProposal(
+        PBFTMessageFactory::Ptr _factory, PBFTProposalInterface::Ptr _proposal) override;
+    void asyncResolveCompactProposal(bcos::crypto::PublicPtr _fromNode,
+        PBFTMessageFactory::Ptr _factory, PBFTProposalInterface::Ptr _proposal,
+        std::function<void(Error::Ptr, PBFTProposalInterface::Ptr)> _onResolved) override;
     ssize_t resettingProposalSize() const override
     {
         ReadGuard l(x_resettingProposals);
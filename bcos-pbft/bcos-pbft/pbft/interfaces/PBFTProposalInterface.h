@@ -21,6 +21,7 @@
 #pragma once
 #include "../../framework/ProposalInterface.h"
 #include "../utilities/Common.h"
+#include <bcos-framework/interfaces/txpool/TxPoolTypeDef.h>
 
 namespace bcos
 {
@@ -37,6 +38,16 @@ public:
     virtual std::pair<int64_t, bytesConstRef> signatureProof(size_t _index) const = 0;
     virtual void appendSignatureProof(int64_t _nodeIdx, bytesConstRef _signatureData) = 0;
     virtual void clearSignatureProof() = 0;
+
+    // the short ids of the transactions stripped from the data of the compact proposal, the
+    // salt of the compact proposal is never zero
+    virtual uint64_t shortTxIDSalt() const = 0;
+    virtual bcos::txpool::ShortTxIDs shortTxIDs() const = 0;
+    // the digest of the full hashes of the stripped transactions, the transactions resolved from
+    // the short ids are checked against it
+    virtual bcos::crypto::HashType txsDigest() const = 0;
+    virtual void setShortTxIDs(uint64_t _salt, bcos::txpool::ShortTxIDs const& _shortTxIDs,
+        bcos::crypto::HashType const& _txsDigest) = 0;
 };
 using PBFTProposalList = std::vector<PBFTProposalInterface::Ptr>;
 using PBFTProposalListPtr = std::shared_ptr<PBFTProposalList>;
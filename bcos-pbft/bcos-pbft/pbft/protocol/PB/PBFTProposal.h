@@ -71,6 +71,32 @@ public:
         m_pbftRawProposal->clear_signaturelist();
     }
 
+    uint64_t shortTxIDSalt() const override { return m_pbftRawProposal->shorttxidsalt(); }
+
+    bcos::txpool::ShortTxIDs shortTxIDs() const override
+    {
+        auto const& shortTxIDs = m_pbftRawProposal->shorttxids();
+        return bcos::txpool::ShortTxIDs(shortTxIDs.begin(), shortTxIDs.end());
+    }
+
+    bcos::crypto::HashType txsDigest() const override
+    {
+        auto const& txsDigest = m_pbftRawProposal->txsdigest();
+        if (txsDigest.size() < bcos::crypto::HashType::size)
+        {
+            return bcos::crypto::HashType();
+        }
+        return bcos::crypto::HashType((byte const*)txsDigest.data(), bcos::crypto::HashType::size);
+    }
+
+    void setShortTxIDs(uint64_t _salt, bcos::txpool::ShortTxIDs const& _shortTxIDs,
+        bcos::crypto::HashType const& _txsDigest) override
+    {
+        m_pbftRawProposal->set_shorttxidsalt(_salt);
+        m_pbftRawProposal->mutable_shorttxids()->Assign(_shortTxIDs.begin(), _shortTxIDs.end());
+        m_pbftRawProposal->set_txsdigest(_txsDigest.data(), bcos::crypto::HashType::size);
+    }
+
     bool operator==(PBFTProposal const& _proposal)
     {
         if (!Proposal::operator==(_proposal))
@@ -0,0 +1,374 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief append-only write-ahead log of the committed proposals
+ * @file ConsensusWAL.cpp
+ */
+#include "ConsensusWAL.h"
+#include "../utilities/Common.h"
+#include <fcntl.h>
+#include <unistd.h>
+#include <boost/crc.hpp>
+#include <boost/filesystem.hpp>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+using namespace bcos;
+using namespace bcos::consensus;
+using namespace bcos::protocol;
+
+// payload size, crc32, type, index
+static constexpr size_t c_recordHeaderSize = 4 + 4 + 1 + 8;
+
+static void putUint(bytes& _buffer, uint64_t _value, size_t _size)
+{
+    for (size_t i = 0; i < _size; ++i)
+    {
+        _buffer.push_back((byte)(_value >> (8 * i)));
+    }
+}
+
+static uint64_t getUint(byte const* _data, size_t _size)
+{
+    uint64_t value = 0;
+    for (size_t i = 0; i < _size; ++i)
+    {
+        value |= (uint64_t)_data[i] << (8 * i);
+    }
+    return value;
+}
+
+// the crc32 of the type, the index and the payload
+static uint32_t recordChecksum(byte const* _typeAndIndex, bytesConstRef _data)
+{
+    boost::crc_32_type crc;
+    crc.process_bytes(_typeAndIndex, 1 + 8);
+    crc.process_bytes(_data.data(), _data.size());
+    return crc.checksum();
+}
+
+static int syncFile(int _fd)
+{
+#ifdef __APPLE__
+    return ::fsync(_fd);
+#else
+    return ::fdatasync(_fd);
+#endif
+}
+
+ConsensusWAL::ConsensusWAL(std::string const& _path, size_t _compactThreshold)
+  : m_path(_path), m_compactThreshold(_compactThreshold)
+{
+    auto parentPath = boost::filesystem::path(m_path).parent_path();
+    if (!parentPath.empty())
+    {
+        boost::filesystem::create_directories(parentPath);
+    }
+    m_fd = ::open(m_path.c_str(), O_RDWR | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+    if (m_fd < 0)
+    {
+        BOOST_THROW_EXCEPTION(InitPBFTException() << errinfo_comment(
+                                  "Open consensus WAL " + m_path + " failed: " + strerror(errno)));
+    }
+    recover();
+    m_flushThread = std::thread([this]() { flushLoop(); });
+}
+
+ConsensusWAL::~ConsensusWAL()
+{
+    {
+        std::lock_guard<std::mutex> l(m_mutex);
+        m_stopped = true;
+    }
+    m_signalled.notify_all();
+    if (m_flushThread.joinable())
+    {
+        m_flushThread.join();
+    }
+    if (m_fd >= 0)
+    {
+        ::close(m_fd);
+    }
+}
+
+void ConsensusWAL::recover()
+{
+    bytes content;
+    byte block[64 * 1024];
+    ssize_t readBytes = 0;
+    ::lseek(m_fd, 0, SEEK_SET);
+    while ((readBytes = ::read(m_fd, block, sizeof(block))) > 0)
+    {
+        content.insert(content.end(), block, block + readBytes);
+    }
+
+    size_t offset = 0;
+    size_t records = 0;
+    while (offset + c_recordHeaderSize <= content.size())
+    {
+        auto header = content.data() + offset;
+        auto payloadSize = (size_t)getUint(header, 4);
+        auto checksum = (uint32_t)getUint(header + 4, 4);
+        if (offset + c_recordHeaderSize + payloadSize > content.size())
+        {
+            break;
+        }
+        auto payload = bytesConstRef(header + c_recordHeaderSize, payloadSize);
+        if (recordChecksum(header + 8, payload) != checksum)
+        {
+            break;
+        }
+        Record record{(RecordType)header[8], (BlockNumber)getUint(header + 9, 8), nullptr};
+        if (record.type == CommitRecord)
+        {
+            record.data = std::make_shared<bytes>(payload.begin(), payload.end());
+        }
+        applyRecord(m_syncedProposals, record);
+        m_syncedMaxIndex = std::max(m_syncedMaxIndex, record.index);
+        offset += c_recordHeaderSize + payloadSize;
+        ++records;
+    }
+    if (offset < content.size())
+    {
+        // the tail written partly when the node crashed, the records after it are never synced
+        PBFT_STORAGE_LOG(WARNING) << LOG_DESC("ConsensusWAL: truncate the torn tail")
+                                  << LOG_KV("path", m_path) << LOG_KV("validSize", offset)
+                                  << LOG_KV("fileSize", content.size());
+        if (::ftruncate(m_fd, offset) != 0 || syncFile(m_fd) != 0)
+        {
+            BOOST_THROW_EXCEPTION(InitPBFTException() << errinfo_comment(
+                                      "Truncate consensus WAL " + m_path + " failed"));
+        }
+    }
+    m_fileSize = offset;
+    m_proposals = m_syncedProposals;
+    m_maxIndex = m_syncedMaxIndex;
+    PBFT_STORAGE_LOG(INFO) << LOG_DESC("ConsensusWAL: recovered") << LOG_KV("path", m_path)
+                           << LOG_KV("records", records) << LOG_KV("size", offset)
+                           << LOG_KV("proposals", m_proposals.size())
+                           << LOG_KV("maxIndex", m_maxIndex);
+}
+
+void ConsensusWAL::applyRecord(
+    std::map<BlockNumber, bytesPointer>& _proposals, Record const& _record)
+{
+    if (_record.type == CommitRecord)
+    {
+        _proposals[_record.index] = _record.data;
+    }
+    else
+    {
+        _proposals.erase(_record.index);
+    }
+}
+
+void ConsensusWAL::encodeRecord(
+    bytes& _buffer, RecordType _type, BlockNumber _index, bytesConstRef _data)
+{
+    byte typeAndIndex[1 + 8];
+    typeAndIndex[0] = _type;
+    for (size_t i = 0; i < 8; ++i)
+    {
+        typeAndIndex[1 + i] = (byte)((uint64_t)_index >> (8 * i));
+    }
+    putUint(_buffer, _data.size(), 4);
+    putUint(_buffer, recordChecksum(typeAndIndex, _data), 4);
+    _buffer.insert(_buffer.end(), typeAndIndex, typeAndIndex + sizeof(typeAndIndex));
+    _buffer.insert(_buffer.end(), _data.begin(), _data.end());
+}
+
+void ConsensusWAL::appendCommit(BlockNumber _index, bytesConstRef _data, SyncedCallback _onSynced)
+{
+    appendRecord(CommitRecord, _index, _data, std::move(_onSynced));
+}
+
+void ConsensusWAL::appendRemove(BlockNumber _index, SyncedCallback _onSynced)
+{
+    appendRecord(RemoveRecord, _index, bytesConstRef(), std::move(_onSynced));
+}
+
+void ConsensusWAL::appendRecord(
+    RecordType _type, BlockNumber _index, bytesConstRef _data, SyncedCallback _onSynced)
+{
+    Record record{_type, _index, nullptr};
+    if (_type == CommitRecord)
+    {
+        record.data = std::make_shared<bytes>(_data.begin(), _data.end());
+    }
+    {
+        std::lock_guard<std::mutex> l(m_mutex);
+        encodeRecord(m_buffer, _type, _index, _data);
+        m_callbacks.emplace_back(std::move(_onSynced));
+        applyRecord(m_proposals, record);
+        if (_index > m_maxIndex)
+        {
+            m_maxIndex = _index;
+        }
+        m_records.emplace_back(std::move(record));
+    }
+    m_signalled.notify_one();
+}
+
+std::vector<bytesPointer> ConsensusWAL::proposals(BlockNumber _start, BlockNumber _end) const
+{
+    std::vector<bytesPointer> proposals;
+    std::lock_guard<std::mutex> l(m_mutex);
+    for (auto index = _start; index <= _end; ++index)
+    {
+        auto it = m_proposals.find(index);
+        if (it == m_proposals.end())
+        {
+            return {};
+        }
+        proposals.push_back(it->second);
+    }
+    return proposals;
+}
+
+void ConsensusWAL::flushLoop()
+{
+    while (true)
+    {
+        bytes buffer;
+        std::vector<SyncedCallback> callbacks;
+        std::vector<Record> records;
+        {
+            std::unique_lock<std::mutex> l(m_mutex);
+            m_signalled.wait(l, [this]() { return m_stopped || !m_records.empty(); });
+            if (m_records.empty())
+            {
+                return;
+            }
+            // all the records appended since the last sync are synced together
+            buffer.swap(m_buffer);
+            callbacks.swap(m_callbacks);
+            records.swap(m_records);
+        }
+        auto success = writeAndSync(m_fd, buffer);
+        if (success)
+        {
+            m_fileSize += buffer.size();
+            ++m_syncedBatches;
+            m_syncedRecords += records.size();
+            for (auto const& record : records)
+            {
+                applyRecord(m_syncedProposals, record);
+                m_syncedMaxIndex = std::max(m_syncedMaxIndex, record.index);
+            }
+        }
+        else
+        {
+            PBFT_STORAGE_LOG(ERROR) << LOG_DESC("ConsensusWAL: write failed")
+                                    << LOG_KV("path", m_path) << LOG_KV("records", records.size())
+                                    << LOG_KV("error", strerror(errno));
+            // drop the part written, or the records appended later are not recovered
+            if (::ftruncate(m_fd, m_fileSize) != 0)
+            {
+                PBFT_STORAGE_LOG(ERROR) << LOG_DESC("ConsensusWAL: truncate failed")
+                                        << LOG_KV("path", m_path) << LOG_KV("size", m_fileSize);
+            }
+            // roll the failed records back, the records appended after them are kept
+            std::lock_guard<std::mutex> l(m_mutex);
+            m_proposals = m_syncedProposals;
+            auto maxIndex = m_syncedMaxIndex;
+            for (auto const& record : m_records)
+            {
+                applyRecord(m_proposals, record);
+                maxIndex = std::max(maxIndex, record.index);
+            }
+            m_maxIndex = maxIndex;
+        }
+        for (auto& callback : callbacks)
+        {
+            if (callback)
+            {
+                callback(success);
+            }
+        }
+        // the live proposals may be larger than the threshold, so the file is compacted again
+        // only after the threshold is appended since the last compaction
+        if (m_fileSize > m_compactedSize + m_compactThreshold)
+        {
+            compact();
+        }
+    }
+}
+
+bool ConsensusWAL::writeAndSync(int _fd, bytes const& _buffer)
+{
+    size_t written = 0;
+    while (written < _buffer.size())
+    {
+        auto ret = ::write(_fd, _buffer.data() + written, _buffer.size() - written);
+        if (ret < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return false;
+        }
+        written += ret;
+    }
+    return syncFile(_fd) == 0;
+}
+
+void ConsensusWAL::compact()
+{
+    // the synced records are rewritten, the records appended after them are written into the new
+    // file by the next loop
+    bytes content;
+    if (m_syncedProposals.count(m_syncedMaxIndex) == 0)
+    {
+        // keep the max index for the next recovery
+        encodeRecord(content, RemoveRecord, m_syncedMaxIndex, bytesConstRef());
+    }
+    for (auto const& [index, data] : m_syncedProposals)
+    {
+        encodeRecord(content, CommitRecord, index, bytesConstRef(data->data(), data->size()));
+    }
+
+    auto compactPath = m_path + ".compact";
+    auto fd = ::open(compactPath.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_APPEND | O_CLOEXEC, 0644);
+    if (fd < 0 || !writeAndSync(fd, content) || ::rename(compactPath.c_str(), m_path.c_str()) != 0)
+    {
+        PBFT_STORAGE_LOG(WARNING) << LOG_DESC("ConsensusWAL: compact failed")
+                                  << LOG_KV("path", m_path) << LOG_KV("error", strerror(errno));
+        if (fd >= 0)
+        {
+            ::close(fd);
+        }
+        ::unlink(compactPath.c_str());
+        // retry after another threshold is appended
+        m_compactedSize = m_fileSize;
+        return;
+    }
+    // persist the rename
+    auto dirFd = ::open(boost::filesystem::path(m_path).parent_path().string().c_str(),
+        O_RDONLY | O_CLOEXEC);
+    if (dirFd >= 0)
+    {
+        ::fsync(dirFd);
+        ::close(dirFd);
+    }
+    PBFT_STORAGE_LOG(INFO) << LOG_DESC("ConsensusWAL: compacted") << LOG_KV("path", m_path)
+                           << LOG_KV("size", m_fileSize) << LOG_KV("compactedSize", content.size());
+    ::close(m_fd);
+    m_fd = fd;
+    m_fileSize = content.size();
+    m_compactedSize = content.size();
+    ++m_compactions;
+}
@@ -0,0 +1,124 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief append-only write-ahead log of the committed proposals
+ * @file ConsensusWAL.h
+ */
+#pragma once
+#include <bcos-framework/interfaces/protocol/ProtocolTypeDef.h>
+#include <bcos-utilities/Common.h>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace bcos
+{
+namespace consensus
+{
+/// The committed proposals are appended to one file instead of being put into the kv-storage one
+/// by one. The appended records are written and synced by a flush thread, the records appended
+/// while a sync is in progress are synced together by the next one (group commit). Every record
+/// is [payload size, crc32, type, index, payload], the torn tail left by a crash is truncated when
+/// the log is opened. The live proposals are kept in memory, the records failed to be written are
+/// rolled back from them, and the file is rewritten with the synced ones when it grows by the compact
+/// threshold since the last compaction.
+class ConsensusWAL
+{
+public:
+    using Ptr = std::shared_ptr<ConsensusWAL>;
+    using SyncedCallback = std::function<void(bool _success)>;
+    enum RecordType : uint8_t
+    {
+        CommitRecord = 1,
+        RemoveRecord = 2,
+    };
+
+    explicit ConsensusWAL(
+        std::string const& _path, size_t _compactThreshold = c_defaultCompactThreshold);
+    virtual ~ConsensusWAL();
+
+    // the committed proposal _data of _index, _onSynced is called after the record is synced
+    void appendCommit(bcos::protocol::BlockNumber _index, bytesConstRef _data,
+        SyncedCallback _onSynced = nullptr);
+    void appendRemove(bcos::protocol::BlockNumber _index, SyncedCallback _onSynced = nullptr);
+
+    // the encoded proposals of [_start, _end], empty if any of them is missing
+    std::vector<bytesPointer> proposals(
+        bcos::protocol::BlockNumber _start, bcos::protocol::BlockNumber _end) const;
+
+    // no record has been appended since the log was created
+    bool empty() const { return m_maxIndex < 0; }
+    bcos::protocol::BlockNumber maxIndex() const { return m_maxIndex; }
+    size_t fileSize() const { return m_fileSize; }
+    std::string const& path() const { return m_path; }
+    uint64_t syncedBatches() const { return m_syncedBatches; }
+    uint64_t syncedRecords() const { return m_syncedRecords; }
+    uint64_t compactions() const { return m_compactions; }
+
+private:
+    struct Record
+    {
+        RecordType type;
+        bcos::protocol::BlockNumber index;
+        bytesPointer data;
+    };
+    static void applyRecord(
+        std::map<bcos::protocol::BlockNumber, bytesPointer>& _proposals, Record const& _record);
+
+    void recover();
+    void appendRecord(RecordType _type, bcos::protocol::BlockNumber _index, bytesConstRef _data,
+        SyncedCallback _onSynced);
+    void flushLoop();
+    bool writeAndSync(int _fd, bytes const& _buffer);
+    // rewrite the file with the live proposals
+    void compact();
+    static void encodeRecord(bytes& _buffer, RecordType _type,
+        bcos::protocol::BlockNumber _index, bytesConstRef _data);
+
+    static constexpr size_t c_defaultCompactThreshold = 64 * 1024 * 1024;
+
+    std::string m_path;
+    size_t m_compactThreshold;
+    int m_fd = -1;
+
+    // the live proposals including the records not synced, index => encoded proposal
+    std::map<bcos::protocol::BlockNumber, bytesPointer> m_proposals;
+    std::atomic<bcos::protocol::BlockNumber> m_maxIndex = {-1};
+    // the proposals of the synced records, only accessed by the flush thread after the recovery
+    std::map<bcos::protocol::BlockNumber, bytesPointer> m_syncedProposals;
+    bcos::protocol::BlockNumber m_syncedMaxIndex = -1;
+
+    // the records to be written and the callbacks of them
+    bytes m_buffer;
+    std::vector<SyncedCallback> m_callbacks;
+    std::vector<Record> m_records;
+    mutable std::mutex m_mutex;
+    std::condition_variable m_signalled;
+    bool m_stopped = false;
+
+    std::atomic<size_t> m_fileSize = {0};
+    // the file size after the last compaction, only accessed by the flush thread
+    size_t m_compactedSize = 0;
+    std::atomic<uint64_t> m_syncedBatches = {0};
+    std::atomic<uint64_t> m_syncedRecords = {0};
+    std::atomic<uint64_t> m_compactions = {0};
+    std::thread m_flushThread;
+};
+}  // namespace consensus
+}  // namespace bcos
@@ -23,6 +23,8 @@
 #include <bcos-framework/interfaces/protocol/CommonError.h>
 #include <bcos-framework/interfaces/protocol/ProtocolTypeDef.h>
 #include <bcos-framework/interfaces/storage/Table.h>
+#include <boost/filesystem.hpp>
+#include <future>
 
 using namespace bcos;
 using namespace bcos::consensus;
@@ -31,6 +33,42 @@ using namespace bcos::protocol;
 using namespace bcos::storage;
 
 PBFTProposalListPtr LedgerStorage::loadState(BlockNumber _stabledIndex)
+{
+    if (m_wal && !m_wal->empty())
+    {
+        return loadStateFromWAL(m_wal, _stabledIndex);
+    }
+    if (m_retiredWAL)
+    {
+        // the wal has been disabled, move the proposals committed into it back to the kv-storage
+        PBFTProposalListPtr proposals = nullptr;
+        if (m_retiredWAL->empty())
+        {
+            proposals = loadStateFromStorage(_stabledIndex);
+        }
+        else
+        {
+            proposals = loadStateFromWAL(m_retiredWAL, _stabledIndex);
+            putProposalsIntoStorage(proposals);
+        }
+        auto walPath = m_retiredWAL->path();
+        m_retiredWAL.reset();
+        boost::filesystem::remove(walPath);
+        PBFT_STORAGE_LOG(INFO) << LOG_DESC("loadState: remove the disabled wal")
+                               << LOG_KV("path", walPath)
+                               << LOG_KV("proposals", proposals ? proposals->size() : 0);
+        return proposals;
+    }
+    auto proposals = loadStateFromStorage(_stabledIndex);
+    if (m_wal && proposals)
+    {
+        // the wal has just been enabled, seed it with the proposals committed into the kv-storage
+        appendProposalsToWAL(proposals);
+    }
+    return proposals;
+}
+
+PBFTProposalListPtr LedgerStorage::loadStateFromStorage(BlockNumber _stabledIndex)
 {
     m_maxCommittedProposalIndexFetched = false;
     asyncGetLatestCommittedProposalIndex();
@@ -116,6 +154,105 @@ PBFTProposalListPtr LedgerStorage::loadState(BlockNumber _stabledIndex)
     return m_stateProposals;
 }
 
+PBFTProposalListPtr LedgerStorage::loadStateFromWAL(
+    ConsensusWAL::Ptr const& _wal, BlockNumber _stabledIndex)
+{
+    auto startT = utcTime();
+    if (m_maxCommittedProposalIndex < _wal->maxIndex())
+    {
+        m_maxCommittedProposalIndex = _wal->maxIndex();
+    }
+    if (m_maxCommittedProposalIndex <= _stabledIndex)
+    {
+        PBFT_STORAGE_LOG(INFO) << LOG_DESC("loadStateFromWAL: no need to fetch committed proposal")
+                               << LOG_KV("maxCommittedProposal", m_maxCommittedProposalIndex)
+                               << LOG_KV("stableCheckPoint", _stabledIndex);
+        m_maxCommittedProposalIndex = _stabledIndex;
+        return nullptr;
+    }
+    auto proposals =
+        decodeProposals(_wal->proposals(_stabledIndex + 1, m_maxCommittedProposalIndex));
+    PBFT_STORAGE_LOG(INFO) << LOG_DESC("loadStateFromWAL: recover committed proposal")
+                           << LOG_KV("start", _stabledIndex + 1)
+                           << LOG_KV("end", m_maxCommittedProposalIndex)
+                           << LOG_KV("proposals", proposals ? proposals->size() : 0)
+                           << LOG_KV("timecost", (utcTime() - startT));
+    if (!proposals)
+    {
+        m_maxCommittedProposalIndex = _stabledIndex;
+    }
+    return proposals;
+}
+
+void LedgerStorage::appendProposalsToWAL(PBFTProposalListPtr _proposals)
+{
+    std::vector<std::future<bool>> synced;
+    for (auto const& proposal : *_proposals)
+    {
+        auto promise = std::make_shared<std::promise<bool>>();
+        synced.emplace_back(promise->get_future());
+        auto encodedData = proposal->encode();
+        m_wal->appendCommit(proposal->index(),
+            bytesConstRef(encodedData->data(), encodedData->size()),
+            [promise](bool _success) { promise->set_value(_success); });
+    }
+    for (auto& future : synced)
+    {
+        if (!future.get())
+        {
+            BOOST_THROW_EXCEPTION(InitPBFTException() << errinfo_comment(
+                                      "loadState failed for append the proposals to the wal"));
+        }
+    }
+    PBFT_STORAGE_LOG(INFO) << LOG_DESC("loadState: append the storage proposals to the wal")
+                           << LOG_KV("proposals", _proposals->size());
+}
+
+void LedgerStorage::putProposalsIntoStorage(PBFTProposalListPtr _proposals)
+{
+    std::vector<std::pair<std::string, bytesPointer>> entries;
+    if (_proposals)
+    {
+        for (auto const& proposal : *_proposals)
+        {
+            entries.emplace_back(
+                boost::lexical_cast<std::string>(proposal->index()), proposal->encode());
+        }
+    }
+    // put the max index after the proposals
+    auto maxIndexStr = boost::lexical_cast<std::string>(m_maxCommittedProposalIndex);
+    entries.emplace_back(m_maxCommittedProposalKey,
+        std::make_shared<bytes>(maxIndexStr.begin(), maxIndexStr.end()));
+    for (auto const& [key, data] : entries)
+    {
+        std::promise<bool> putPromise;
+        m_storage->asyncPut(m_pbftCommitDB, key,
+            std::string((const char*)data->data(), data->size()),
+            [&putPromise](Error::UniquePtr&& _error) { putPromise.set_value(_error == nullptr); });
+        if (!putPromise.get_future().get())
+        {
+            BOOST_THROW_EXCEPTION(InitPBFTException() << errinfo_comment(
+                                      "loadState failed for put the wal proposals into storage"));
+        }
+    }
+}
+
+PBFTProposalListPtr LedgerStorage::decodeProposals(
+    std::vector<bytesPointer> const& _encodedProposals)
+{
+    if (_encodedProposals.empty())
+    {
+        return nullptr;
+    }
+    auto proposalList = std::make_shared<PBFTProposalList>();
+    for (auto const& encodedProposal : _encodedProposals)
+    {
+        proposalList->push_back(m_messageFactory->createPBFTProposal(
+            bytesConstRef(encodedProposal->data(), encodedProposal->size())));
+    }
+    return proposalList;
+}
+
 void LedgerStorage::asyncGetCommittedProposals(
     BlockNumber _start, size_t _offset, std::function<void(PBFTProposalListPtr)> _onSuccess)
 {
@@ -128,9 +265,22 @@ void LedgerStorage::asyncGetCommittedProposals(
                                   << LOG_KV("requestedMinIndex", _start);
         return;
     }
-    auto keys = std::make_shared<std::vector<std::string>>();
     auto endIndex =
         std::min((int64_t)(_start + _offset - 1), (int64_t)m_maxCommittedProposalIndex.load());
+    if (m_wal)
+    {
+        try
+        {
+            _onSuccess(decodeProposals(m_wal->proposals(_start, endIndex)));
+        }
+        catch (std::exception const& e)
+        {
+            PBFT_STORAGE_LOG(WARNING) << LOG_DESC("asyncGetCommittedProposals exception")
+                                      << LOG_KV("error", boost::diagnostic_information(e));
+        }
+        return;
+    }
+    auto keys = std::make_shared<std::vector<std::string>>();
     for (int64_t i = _start; i <= endIndex; i++)
     {
         keys->push_back(boost::lexical_cast<std::string>(i));
@@ -236,6 +386,26 @@ void LedgerStorage::asyncCommitProposal(PBFTProposalInterface::Ptr _committedPro
         return;
     }
     m_maxCommittedProposalIndex.store(_committedProposal->index());
+    if (m_wal)
+    {
+        // the max committed index is recovered from the records of the wal
+        auto startT = utcTime();
+        auto index = _committedProposal->index();
+        auto encodedData = _committedProposal->encode();
+        m_wal->appendCommit(index, bytesConstRef(encodedData->data(), encodedData->size()),
+            [startT, index, dataSize = encodedData->size()](bool _success) {
+                if (!_success)
+                {
+                    PBFT_STORAGE_LOG(WARNING) << LOG_DESC("asyncCommitProposal: append wal failed")
+                                              << LOG_KV("index", index);
+                    return;
+                }
+                PBFT_STORAGE_LOG(INFO)
+                    << LOG_DESC("asyncCommitProposal: commit success") << LOG_KV("index", index)
+                    << LOG_KV("timecost", (utcTime() - startT)) << LOG_KV("dataSize", dataSize);
+            });
+        return;
+    }
     PBFT_STORAGE_LOG(INFO) << LOG_DESC("asyncCommitProposal: write the committed proposal into db")
                            << LOG_KV("index", _committedProposal->index());
     // commit the max-index proposal information
@@ -299,25 +469,23 @@ void LedgerStorage::asyncPutProposal(std::string const& _dbName, std::string con
 
 void LedgerStorage::asyncCommitStableCheckPoint(PBFTProposalInterface::Ptr _stableProposal)
 {
-    std::shared_ptr<std::vector<protocol::Signature>> signatureList =
-        std::make_shared<std::vector<protocol::Signature>>();
+    SignatureList signatureList;
+    signatureList.reserve(_stableProposal->signatureProofSize());
     for (size_t i = 0; i < _stableProposal->signatureProofSize(); i++)
     {
         auto proof = _stableProposal->signatureProof(i);
         Signature signature;
         signature.index = proof.first;
         signature.signature = proof.second.toBytes();
-        signatureList->push_back(signature);
+        signatureList.emplace_back(std::move(signature));
     }
     auto blockHeader =
         m_blockFactory->blockHeaderFactory()->createBlockHeader(_stableProposal->data());
-    blockHeader->setSignatureList(*signatureList);
-    auto blockSignatureList = blockHeader->signatureList();
+    blockHeader->setSignatureList(signatureList);
     PBFT_LOG(INFO) << LOG_DESC("asyncCommitStableCheckPoint: set signatureList")
                    << LOG_KV("index", blockHeader->number())
                    << LOG_KV("hash", blockHeader->hash().abridged())
-                   << LOG_KV("proofSize", signatureList->size())
-                   << LOG_KV("blockProofSize", blockSignatureList.size());
+                   << LOG_KV("proofSize", signatureList.size());
     // Note: enqueue here to increase the performance since commitBlock is a sync implementation
     m_commitBlockWorker->enqueue([this, blockHeader, _stableProposal]() {
         // get the transactions list
@@ -394,6 +562,11 @@ void LedgerStorage::asyncRemoveStabledCheckPoint(size_t _stabledCheckPointIndex)
 {
     PBFT_STORAGE_LOG(INFO) << LOG_DESC("asyncRemoveStabledCheckPoint")
                            << LOG_KV("index", _stabledCheckPointIndex);
+    if (m_wal)
+    {
+        m_wal->appendRemove(_stabledCheckPointIndex);
+        return;
+    }
     asyncRemove(m_pbftCommitDB, boost::lexical_cast<std::string>(_stabledCheckPointIndex));
 }
 
@@ -21,6 +21,7 @@
 #pragma once
 #include "../interfaces/PBFTMessageFactory.h"
 #include "../interfaces/PBFTStorage.h"
+#include "ConsensusWAL.h"
 #include <bcos-framework/interfaces/dispatcher/SchedulerInterface.h>
 #include <bcos-framework/interfaces/protocol/BlockFactory.h>
 #include <bcos-framework/interfaces/storage/KVStorageHelper.h>
@@ -66,6 +67,14 @@ public:
 
     void asyncRemoveStabledCheckPoint(size_t _stabledCheckPointIndex) override;
 
+    // the committed proposals are appended to _wal instead of the kv-storage, the proposals
+    // committed into the kv-storage before are appended to the empty _wal when loading the state
+    void setWAL(ConsensusWAL::Ptr _wal) { m_wal = std::move(_wal); }
+    ConsensusWAL::Ptr wal() const { return m_wal; }
+    // the wal left after it's disabled, its proposals are put back into the kv-storage and the
+    // file is removed when loading the state
+    void setRetiredWAL(ConsensusWAL::Ptr _wal) { m_retiredWAL = std::move(_wal); }
+
 protected:
     virtual void asyncPutProposal(std::string const& _dbName, std::string const& _key,
         bytesPointer _committedData, bcos::protocol::BlockNumber _proposalIndex,
@@ -73,6 +82,13 @@ protected:
 
     virtual void asyncRemove(std::string const& _dbName, std::string const& _key);
 
+    virtual PBFTProposalListPtr loadStateFromStorage(bcos::protocol::BlockNumber _stabledIndex);
+    virtual PBFTProposalListPtr loadStateFromWAL(
+        ConsensusWAL::Ptr const& _wal, bcos::protocol::BlockNumber _stabledIndex);
+    void appendProposalsToWAL(PBFTProposalListPtr _proposals);
+    void putProposalsIntoStorage(PBFTProposalListPtr _proposals);
+    PBFTProposalListPtr decodeProposals(std::vector<bytesPointer> const& _encodedProposals);
+
     virtual void commitStableCheckPoint(
         bcos::protocol::BlockHeader::Ptr _blockHeader, bcos::protocol::Block::Ptr _blockInfo);
     virtual void asyncGetLatestCommittedProposalIndex();
@@ -104,6 +120,8 @@ protected:
     std::function<void(bcos::ledger::LedgerConfig::Ptr, bool _syncBlock)> m_finalizeHandler;
 
     std::shared_ptr<ThreadPool> m_commitBlockWorker;
+    ConsensusWAL::Ptr m_wal;
+    ConsensusWAL::Ptr m_retiredWAL;
 };
 }  // namespace consensus
 }  // namespace bcos
\ No newline at end of file
@@ -0,0 +1,99 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the commit latency of the consensus wal, serial commits against concurrent committers
+ * @file consensus-wal-bench.cpp
+ */
+#include "bcos-pbft/pbft/storage/ConsensusWAL.h"
+#include <boost/filesystem.hpp>
+#include <chrono>
+#include <future>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace bcos;
+using namespace bcos::consensus;
+
+namespace
+{
+// append the proposal and wait for the sync
+bool commit(ConsensusWAL& _wal, int64_t _index, size_t _size)
+{
+    std::promise<bool> synced;
+    bytes data(_size, (byte)_index);
+    _wal.appendCommit(_index, bytesConstRef(data.data(), data.size()),
+        [&synced](bool _success) { synced.set_value(_success); });
+    return synced.get_future().get();
+}
+}  // namespace
+
+int main(int argc, const char* argv[])
+{
+    if (argc > 1 && (std::string(argv[1]) == "-h" || std::string(argv[1]) == "--help"))
+    {
+        std::cerr << "./consensus-wal-bench [proposalKB] [commits] [committers]" << std::endl;
+        return -1;
+    }
+    size_t proposalSize = (argc > 1 ? std::stoul(argv[1]) : 32) * 1024;
+    size_t commits = argc > 2 ? std::stoul(argv[2]) : 100;
+    size_t committers = argc > 3 ? std::stoul(argv[3]) : 8;
+
+    auto path = (boost::filesystem::temp_directory_path() /
+                 boost::filesystem::unique_path("consensus_wal_bench_%%%%%%%%"))
+                    .string();
+    {
+        ConsensusWAL wal(path);
+        // every commit waits for its sync, so every record is synced alone
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < commits; ++i)
+        {
+            commit(wal, i + 1, proposalSize);
+        }
+        auto serialElapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start);
+        auto serialSyncs = wal.syncedBatches();
+
+        // the records appended during a sync are synced together
+        start = std::chrono::steady_clock::now();
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < committers; ++t)
+        {
+            threads.emplace_back([&wal, t, commits, proposalSize]() {
+                for (size_t i = 0; i < commits; ++i)
+                {
+                    commit(wal, (int64_t)(commits * (t + 1) + i + 1), proposalSize);
+                }
+            });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        auto groupElapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start);
+        auto groupSyncs = wal.syncedBatches() - serialSyncs;
+
+        std::cout << "Commit " << proposalSize / 1024 << "KB proposals"
+                  << ", serial: " << serialElapsed.count() / commits << "us/commit, "
+                  << serialSyncs << " syncs for " << commits << " commits"
+                  << ", " << committers
+                  << " committers: " << groupElapsed.count() / (commits * committers)
+                  << "us/commit, " << groupSyncs << " syncs for " << commits * committers
+                  << " commits" << std::endl;
+    }
+    boost::filesystem::remove(path);
+    return 0;
+}
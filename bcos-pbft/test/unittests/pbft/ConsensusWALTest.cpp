@@ -0,0 +1,174 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief unit tests of the consensus wal
+ * @file ConsensusWALTest.cpp
+ */
+#include "bcos-pbft/pbft/storage/ConsensusWAL.h"
+#include <bcos-utilities/testutils/TestPromptFixture.h>
+#include <sys/resource.h>
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+#include <csignal>
+#include <fstream>
+#include <future>
+
+using namespace bcos;
+using namespace bcos::consensus;
+namespace bcos
+{
+namespace test
+{
+class ConsensusWALFixture : public TestPromptFixture
+{
+public:
+    ConsensusWALFixture()
+      : m_path((boost::filesystem::temp_directory_path() /
+                boost::filesystem::unique_path("consensus_wal_%%%%%%%%"))
+                   .string())
+    {}
+    ~ConsensusWALFixture() { boost::filesystem::remove(m_path); }
+
+    static bytes proposalData(int64_t _index, size_t _size = 100)
+    {
+        return bytes(_size, (byte)_index);
+    }
+
+    // append the proposal and wait for the sync
+    static bool commit(ConsensusWAL& _wal, int64_t _index, size_t _size = 100)
+    {
+        std::promise<bool> synced;
+        auto data = proposalData(_index, _size);
+        _wal.appendCommit(_index, bytesConstRef(data.data(), data.size()),
+            [&synced](bool _success) { synced.set_value(_success); });
+        return synced.get_future().get();
+    }
+
+    std::string m_path;
+};
+
+BOOST_FIXTURE_TEST_SUITE(ConsensusWALTest, ConsensusWALFixture)
+
+BOOST_AUTO_TEST_CASE(recoverAndTruncate)
+{
+    {
+        ConsensusWAL wal(m_path);
+        BOOST_CHECK(wal.empty());
+        for (int64_t i = 1; i <= 3; ++i)
+        {
+            BOOST_CHECK(commit(wal, i));
+        }
+        std::promise<bool> synced;
+        wal.appendRemove(1, [&synced](bool _success) { synced.set_value(_success); });
+        BOOST_CHECK(synced.get_future().get());
+    }
+    auto validSize = boost::filesystem::file_size(m_path);
+    {
+        // the torn record of a crash
+        std::ofstream file(m_path, std::ios::binary | std::ios::app);
+        file << "torn record";
+    }
+
+    ConsensusWAL wal(m_path);
+    BOOST_CHECK(!wal.empty());
+    BOOST_CHECK_EQUAL(wal.maxIndex(), 3);
+    BOOST_CHECK_EQUAL(wal.fileSize(), validSize);
+    BOOST_CHECK_EQUAL(boost::filesystem::file_size(m_path), validSize);
+    BOOST_CHECK(wal.proposals(1, 3).empty());
+    auto proposals = wal.proposals(2, 3);
+    BOOST_CHECK_EQUAL(proposals.size(), 2);
+    BOOST_CHECK(*proposals[0] == proposalData(2));
+    BOOST_CHECK(*proposals[1] == proposalData(3));
+
+    // the records appended after the recovery follow the valid records
+    BOOST_CHECK(commit(wal, 4));
+    BOOST_CHECK_EQUAL(wal.proposals(2, 4).size(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(compact)
+{
+    {
+        ConsensusWAL wal(m_path, 4096);
+        for (int64_t i = 1; i <= 100; ++i)
+        {
+            BOOST_CHECK(commit(wal, i));
+            if (i > 5)
+            {
+                wal.appendRemove(i - 5);
+            }
+        }
+        // the max index is kept though its proposal has been removed
+        std::promise<bool> synced;
+        wal.appendRemove(100, [&synced](bool _success) { synced.set_value(_success); });
+        BOOST_CHECK(synced.get_future().get());
+        BOOST_CHECK_LT(wal.fileSize(), 4096 + 200);
+    }
+
+    ConsensusWAL wal(m_path, 4096);
+    BOOST_CHECK_EQUAL(wal.maxIndex(), 100);
+    BOOST_CHECK(wal.proposals(95, 96).empty());
+    auto proposals = wal.proposals(96, 99);
+    BOOST_CHECK_EQUAL(proposals.size(), 4);
+    BOOST_CHECK(*proposals[3] == proposalData(99));
+}
+
+BOOST_AUTO_TEST_CASE(rollbackFailedRecords)
+{
+    ConsensusWAL wal(m_path);
+    BOOST_CHECK(commit(wal, 1));
+    auto validSize = wal.fileSize();
+
+    // the writes beyond the file size limit fail with EFBIG
+    rlimit limit;
+    BOOST_REQUIRE(::getrlimit(RLIMIT_FSIZE, &limit) == 0);
+    auto sigHandler = std::signal(SIGXFSZ, SIG_IGN);
+    rlimit smallLimit = limit;
+    smallLimit.rlim_cur = validSize + 10;
+    BOOST_REQUIRE(::setrlimit(RLIMIT_FSIZE, &smallLimit) == 0);
+    auto success = commit(wal, 2);
+    ::setrlimit(RLIMIT_FSIZE, &limit);
+    std::signal(SIGXFSZ, sigHandler);
+
+    BOOST_CHECK(!success);
+    BOOST_CHECK_EQUAL(wal.maxIndex(), 1);
+    BOOST_CHECK(wal.proposals(2, 2).empty());
+    BOOST_CHECK_EQUAL(wal.proposals(1, 1).size(), 1);
+    BOOST_CHECK_EQUAL(boost::filesystem::file_size(m_path), validSize);
+
+    BOOST_CHECK(commit(wal, 3));
+    BOOST_CHECK_EQUAL(wal.maxIndex(), 3);
+    BOOST_CHECK_EQUAL(wal.proposals(3, 3).size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(compactLargeLiveProposals)
+{
+    // the live proposals are larger than the threshold, the file is compacted once the threshold
+    // is appended since the last compaction instead of after every sync
+    constexpr size_t threshold = 1024;
+    constexpr size_t proposalSize = 200;
+    constexpr int64_t commits = 50;
+    ConsensusWAL wal(m_path, threshold);
+    for (int64_t i = 1; i <= commits; ++i)
+    {
+        BOOST_CHECK(commit(wal, i, proposalSize));
+    }
+    BOOST_CHECK_GT(wal.compactions(), 0);
+    BOOST_CHECK_LE(wal.compactions(), commits * proposalSize / threshold);
+    BOOST_CHECK_EQUAL(wal.proposals(1, commits).size(), commits);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+}  // namespace test
+}  // namespace bcos
@@ -140,6 +140,109 @@ BOOST_AUTO_TEST_CASE(testPBFTEngineWithAllNonFaulty)
     testPBFTEngineWithFaulty(consensusNodeSize, 7);
 }
 
+BOOST_AUTO_TEST_CASE(testCompactProposal)
+{
+    auto hashImpl = std::make_shared<Keccak256>();
+    auto signatureImpl = std::make_shared<Secp256k1Crypto>();
+    auto cryptoSuite = std::make_shared<CryptoSuite>(hashImpl, signatureImpl, nullptr);
+
+    size_t consensusNodeSize = 4;
+    BlockNumber currentBlockNumber = 10;
+    auto fakerMap =
+        createFakers(cryptoSuite, consensusNodeSize, currentBlockNumber, consensusNodeSize);
+    IndexType leaderIndex = 0;
+    auto leaderFaker = fakerMap[leaderIndex];
+    auto block = fakeBlock(cryptoSuite, leaderFaker, currentBlockNumber + 1, 10);
+    auto blockData = std::make_shared<bytes>();
+    block->encode(*blockData);
+    auto blockHeader = block->blockHeader();
+
+    // the replica 3 knows none of the txs of the proposal
+    auto otherTxs = leaderFaker->blockFactory()->createBlock();
+    for (size_t i = 0; i < block->transactionsMetaDataSize(); i++)
+    {
+        auto hash = hashImpl->hash(std::to_string(i) + "other");
+        otherTxs->appendTransactionMetaData(
+            leaderFaker->blockFactory()->createTransactionMetaData(hash, hash.abridged()));
+    }
+    for (auto const& node : fakerMap)
+    {
+        node.second->pbftConfig()->setCompactProposal(true);
+        node.second->txpool()->setKnownTxs(
+            node.second->blockFactory(), node.first < 3 ? block : otherTxs);
+    }
+
+    // the compact proposal generated by the leader
+    auto pbftProposal = leaderFaker->pbftConfig()->pbftMessageFactory()->createPBFTProposal();
+    pbftProposal->setData(*blockData);
+    pbftProposal->setIndex(blockHeader->number());
+    pbftProposal->setHash(blockHeader->hash());
+    auto compactProposal = leaderFaker->pbftConfig()->validator()->compactProposal(
+        leaderFaker->pbftConfig()->pbftMessageFactory(), pbftProposal);
+    BOOST_CHECK(compactProposal);
+    BOOST_CHECK(compactProposal->shortTxIDSalt() != 0);
+    BOOST_CHECK_EQUAL(compactProposal->shortTxIDs().size(), block->transactionsMetaDataSize());
+    BOOST_CHECK(compactProposal->data().size() < blockData->size());
+    BOOST_CHECK(pbftProposal->shortTxIDSalt() == 0);
+
+    // the replicas resolve the compact proposal into a new proposal
+    auto compactData = compactProposal->data().toBytes();
+    std::promise<PBFTProposalInterface::Ptr> resolved;
+    fakerMap[1]->pbftConfig()->validator()->asyncResolveCompactProposal(
+        leaderFaker->keyPair()->publicKey(), fakerMap[1]->pbftConfig()->pbftMessageFactory(),
+        compactProposal, [&resolved](Error::Ptr _error, PBFTProposalInterface::Ptr _proposal) {
+            BOOST_CHECK(_error == nullptr);
+            resolved.set_value(_proposal);
+        });
+    auto resolvedProposal = resolved.get_future().get();
+    BOOST_CHECK(resolvedProposal->shortTxIDSalt() == 0);
+    BOOST_CHECK(resolvedProposal->hash() == blockHeader->hash());
+    auto resolvedBlock = fakerMap[1]->blockFactory()->createBlock(resolvedProposal->data());
+    BOOST_CHECK_EQUAL(resolvedBlock->transactionsMetaDataSize(), block->transactionsMetaDataSize());
+    for (size_t i = 0; i < block->transactionsMetaDataSize(); i++)
+    {
+        BOOST_CHECK(resolvedBlock->transactionHash(i) == block->transactionHash(i));
+    }
+    BOOST_CHECK(compactProposal->shortTxIDSalt() != 0);
+    BOOST_CHECK(compactProposal->data().toBytes() == compactData);
+
+    // the proposal with the unknown txs, or with the txs mismatching the digest is rejected
+    auto tamperedProposal =
+        leaderFaker->pbftConfig()->pbftMessageFactory()->populateFrom(compactProposal);
+    tamperedProposal->setShortTxIDs(compactProposal->shortTxIDSalt(),
+        compactProposal->shortTxIDs(), hashImpl->hash(std::string("tampered")));
+    std::vector<std::pair<IndexType, PBFTProposalInterface::Ptr>> rejectedCases = {
+        {3, compactProposal}, {1, tamperedProposal}};
+    std::vector<int32_t> expectedErrors = {
+        CommonError::TransactionsMissing, CommonError::InconsistentTransactions};
+    for (size_t i = 0; i < rejectedCases.size(); i++)
+    {
+        auto replica = fakerMap[rejectedCases[i].first];
+        std::promise<Error::Ptr> rejected;
+        replica->pbftConfig()->validator()->asyncResolveCompactProposal(
+            leaderFaker->keyPair()->publicKey(), replica->pbftConfig()->pbftMessageFactory(),
+            rejectedCases[i].second, [&rejected](Error::Ptr _error, PBFTProposalInterface::Ptr) {
+                rejected.set_value(_error);
+            });
+        auto error = rejected.get_future().get();
+        BOOST_CHECK(error && error->errorCode() == expectedErrors[i]);
+    }
+
+    // the leader broadcasts the compact proposal, the quorum is reached without the replica 3
+    leaderFaker->pbftEngine()->asyncSubmitProposal(
+        false, ref(*blockData), blockHeader->number(), blockHeader->hash(), nullptr);
+    auto startT = utcTime();
+    while (!shouldExit(fakerMap, currentBlockNumber + 1, 3) && (utcTime() - startT <= 60 * 1000))
+    {
+        for (auto const& node : fakerMap)
+        {
+            node.second->pbftEngine()->executeWorkerByRoundbin();
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    BOOST_CHECK(shouldExit(fakerMap, currentBlockNumber + 1, 3));
+}
+
 BOOST_AUTO_TEST_CASE(testHandlePrePrepareMsg)
 {
     auto hashImpl = std::make_shared<Keccak256>();
@@ -22,13 +22,99 @@
 
 #include "ParallelMerkleProof.h"
 #include <tbb/parallel_for.h>
-#include <mutex>
+#include <boost/endian/conversion.hpp>
+#include <algorithm>
 
 using namespace bcos;
 using namespace bcos::crypto;
 
 const uint32_t MAX_CHILD_COUNT = 16;
 
+namespace
+{
+static_assert(sizeof(HashType) == HashType::size, "hashes must be packed in flat arrays");
+
+// Hash one level of the tree. The children of parent i are nodes [16i, 16i + 16), which are
+// adjacent in _data, so every parent is the hash of one contiguous range, node i spans
+// [_offset(i), _offset(i + 1))
+template <class Offset>
+std::vector<HashType> hashLevel(
+    const CryptoSuite::Ptr& _cryptoSuite, const byte* _data, size_t _count, Offset _offset)
+{
+    std::vector<HashType> parents((_count + MAX_CHILD_COUNT - 1) / MAX_CHILD_COUNT);
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, parents.size()), [&](const tbb::blocked_range<size_t>& _r) {
+            for (auto i = _r.begin(); i < _r.end(); ++i)
+            {
+                auto begin = _offset(i * MAX_CHILD_COUNT);
+                auto end = _offset(std::min<size_t>((i + 1) * MAX_CHILD_COUNT, _count));
+                parents[i] = _cryptoSuite->hash(bytesConstRef(_data + begin, end - begin));
+            }
+        });
+    return parents;
+}
+
+std::vector<HashType> hashLevel(
+    const CryptoSuite::Ptr& _cryptoSuite, const std::vector<HashType>& _nodes)
+{
+    return hashLevel(_cryptoSuite, _nodes.data()->data(), _nodes.size(),
+        [](size_t _index) { return _index * HashType::size; });
+}
+
+// the levels above the leaves, the last one holds a single node
+template <class Offset>
+std::vector<std::vector<HashType>> hashLevels(
+    const CryptoSuite::Ptr& _cryptoSuite, const byte* _data, size_t _count, Offset _offset)
+{
+    std::vector<std::vector<HashType>> levels;
+    levels.emplace_back(hashLevel(_cryptoSuite, _data, _count, _offset));
+    while (levels.back().size() > 1)
+    {
+        auto parents = hashLevel(_cryptoSuite, levels.back());
+        levels.emplace_back(std::move(parents));
+    }
+    return levels;
+}
+
+template <class Offset>
+HashType calculateRoot(
+    const CryptoSuite::Ptr& _cryptoSuite, const byte* _data, size_t _count, Offset _offset)
+{
+    if (_count == 1)
+    {
+        return _cryptoSuite->hash(bytesConstRef(_data + _offset(0), _offset(1) - _offset(0)));
+    }
+
+    auto level = hashLevel(_cryptoSuite, _data, _count, _offset);
+    while (level.size() > 1)
+    {
+        level = hashLevel(_cryptoSuite, level);
+    }
+    return _cryptoSuite->hash(bytesConstRef(level[0].data(), HashType::size));
+}
+
+// pack the leaves in one buffer, offsets[i] is the start of leaf i, offsets.back() the end
+std::tuple<bytes, std::vector<size_t>> packLeaves(const std::vector<bcos::bytes>& _bytesCaches)
+{
+    std::vector<size_t> offsets(_bytesCaches.size() + 1);
+    for (size_t i = 0; i < _bytesCaches.size(); ++i)
+    {
+        offsets[i + 1] = offsets[i] + _bytesCaches[i].size();
+    }
+
+    bytes data(offsets.back());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, _bytesCaches.size()),
+        [&](const tbb::blocked_range<size_t>& _r) {
+            for (auto i = _r.begin(); i < _r.end(); ++i)
+            {
+                std::copy(
+                    _bytesCaches[i].begin(), _bytesCaches[i].end(), data.begin() + offsets[i]);
+            }
+        });
+    return {std::move(data), std::move(offsets)};
+}
+}  // namespace
+
 HashType bcos::protocol::calculateMerkleProofRoot(
     CryptoSuite::Ptr _cryptoSuite, const std::vector<bcos::bytes>& _bytesCaches)
 {
@@ -36,36 +122,36 @@ HashType bcos::protocol::calculateMerkleProofRoot(
     {
         return _cryptoSuite->hash(bytes());
     }
-    std::vector<bcos::bytes> bytesCachesTemp;
-    bytesCachesTemp.insert(bytesCachesTemp.end(),
-        std::make_move_iterator(const_cast<std::vector<bcos::bytes>&>(_bytesCaches).begin()),
-        std::make_move_iterator(const_cast<std::vector<bcos::bytes>&>(_bytesCaches).end()));
 
-    while (bytesCachesTemp.size() > 1)
+    auto [data, offsets] = packLeaves(_bytesCaches);
+    return calculateRoot(_cryptoSuite, data.data(), _bytesCaches.size(),
+        [&offsets = offsets](size_t _index) { return offsets[_index]; });
+}
+
+HashType bcos::protocol::calculateMerkleProofRoot(CryptoSuite::Ptr _cryptoSuite,
+    size_t _leafCount, std::function<HashType(size_t _index)> const& _hashFunc)
+{
+    if (_leafCount == 0)
     {
-        std::vector<bcos::bytes> higherLevelList;
-        int size = (bytesCachesTemp.size() + MAX_CHILD_COUNT - 1) / MAX_CHILD_COUNT;
-        higherLevelList.resize(size);
-        tbb::parallel_for(
-            tbb::blocked_range<size_t>(0, size), [&](const tbb::blocked_range<size_t>& _r) {
-                for (uint32_t i = _r.begin(); i < _r.end(); ++i)
-                {
-                    bytes byteValue;
-                    for (uint32_t j = 0; j < MAX_CHILD_COUNT; j++)
-                    {
-                        uint32_t index = i * MAX_CHILD_COUNT + j;
-                        if (index < bytesCachesTemp.size())
-                        {
-                            byteValue.insert(byteValue.end(), bytesCachesTemp[index].begin(),
-                                bytesCachesTemp[index].end());
-                        }
-                    }
-                    higherLevelList[i] = _cryptoSuite->hash(byteValue).asBytes();
-                }
-            });
-        bytesCachesTemp = std::move(higherLevelList);
+        return _cryptoSuite->hash(bytes());
     }
-    return _cryptoSuite->hash(bytesCachesTemp[0]);
+
+    // the leaves of encodeToCalculateRoot: 8 bytes little endian index + hash
+    constexpr size_t leafSize = sizeof(uint64_t) + HashType::size;
+    bytes data(_leafCount * leafSize);
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, _leafCount), [&](const tbb::blocked_range<size_t>& _r) {
+            for (auto i = _r.begin(); i < _r.end(); ++i)
+            {
+                auto leaf = data.data() + i * leafSize;
+                boost::endian::store_little_u64(leaf, i);
+                auto hash = _hashFunc(i);
+                std::copy(hash.begin(), hash.end(), leaf + sizeof(uint64_t));
+            }
+        });
+
+    return calculateRoot(_cryptoSuite, data.data(), _leafCount,
+        [](size_t _index) { return _index * leafSize; });
 }
 
 void bcos::protocol::calculateMerkleProof(bcos::crypto::CryptoSuite::Ptr _cryptoSuite,
@@ -76,44 +162,51 @@ void bcos::protocol::calculateMerkleProof(bcos::crypto::CryptoSuite::Ptr _crypto
     {
         return;
     }
-    std::vector<bcos::bytes> bytesCachesTemp;
-    bytesCachesTemp.insert(bytesCachesTemp.end(),
-        std::make_move_iterator(const_cast<std::vector<bcos::bytes>&>(_bytesCaches).begin()),
-        std::make_move_iterator(const_cast<std::vector<bcos::bytes>&>(_bytesCaches).end()));
-    std::mutex mapMutex;
-    while (bytesCachesTemp.size() > 1)
+
+    if (_bytesCaches.size() == 1)
     {
-        std::vector<bcos::bytes> higherLevelList;
-        int size = (bytesCachesTemp.size() + MAX_CHILD_COUNT - 1) / MAX_CHILD_COUNT;
-        higherLevelList.resize(size);
-        tbb::parallel_for(
-            tbb::blocked_range<size_t>(0, size), [&](const tbb::blocked_range<size_t>& _r) {
-                for (uint32_t i = _r.begin(); i < _r.end(); ++i)
+        (*_parent2ChildList)[*toHexString(_cryptoSuite->hash(_bytesCaches[0]).asBytes())]
+            .push_back(*toHexString(_bytesCaches[0]));
+        return;
+    }
+
+    auto [data, offsets] = packLeaves(_bytesCaches);
+    auto levels = hashLevels(_cryptoSuite, data.data(), _bytesCaches.size(),
+        [&offsets = offsets](size_t _index) { return offsets[_index]; });
+
+    // the hex of the children of every parent, converted in parallel and inserted in order
+    auto addLevel = [&_parent2ChildList](const std::vector<HashType>& _parents, size_t _childCount,
+                        auto&& _childHex) {
+        std::vector<std::vector<std::string>> childLists(_parents.size());
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, _parents.size()),
+            [&](const tbb::blocked_range<size_t>& _r) {
+                for (auto i = _r.begin(); i < _r.end(); ++i)
                 {
-                    bytes byteValue;
-                    std::vector<bcos::bytes> childList;
-                    for (uint32_t j = 0; j < MAX_CHILD_COUNT; j++)
-                    {
-                        uint32_t index = i * MAX_CHILD_COUNT + j;
-                        if (index < bytesCachesTemp.size())
-                        {
-                            byteValue.insert(byteValue.end(), bytesCachesTemp[index].begin(),
-                                bytesCachesTemp[index].end());
-                            childList.push_back(bytesCachesTemp[index]);
-                        }
-                    }
-                    higherLevelList[i] = _cryptoSuite->hash(byteValue).asBytes();
-                    std::lock_guard<std::mutex> l(mapMutex);
-                    std::string parentNode = *toHexString(higherLevelList[i]);
-                    for (const auto& child : childList)
+                    auto end = std::min<size_t>((i + 1) * MAX_CHILD_COUNT, _childCount);
+                    for (auto index = i * MAX_CHILD_COUNT; index < end; ++index)
                     {
-                        (*_parent2ChildList)[parentNode].emplace_back(*toHexString(child));
+                        childLists[i].emplace_back(_childHex(index));
                     }
                 }
             });
-        bytesCachesTemp = std::move(higherLevelList);
+        for (size_t i = 0; i < _parents.size(); ++i)
+        {
+            auto& childList = (*_parent2ChildList)[_parents[i].hex()];
+            childList.insert(childList.end(), std::make_move_iterator(childLists[i].begin()),
+                std::make_move_iterator(childLists[i].end()));
+        }
+    };
+
+    addLevel(levels[0], _bytesCaches.size(),
+        [&_bytesCaches](size_t _index) { return *toHexString(_bytesCaches[_index]); });
+    for (size_t level = 1; level < levels.size(); ++level)
+    {
+        auto& children = levels[level - 1];
+        addLevel(levels[level], children.size(),
+            [&children](size_t _index) { return children[_index].hex(); });
     }
 
-    (*_parent2ChildList)[*toHexString(_cryptoSuite->hash(bytesCachesTemp[0]).asBytes())].push_back(
-        *toHexString(bytesCachesTemp[0]));
+    auto& top = levels.back()[0];
+    (*_parent2ChildList)[_cryptoSuite->hash(bytesConstRef(top.data(), HashType::size)).hex()]
+        .push_back(top.hex());
 }
@@ -23,6 +23,8 @@
 
 #include <bcos-crypto/interfaces/crypto/CryptoSuite.h>
 #include <bcos-utilities/FixedBytes.h>
+#include <functional>
+#include <map>
 #include <vector>
 
 namespace bcos
@@ -31,6 +33,10 @@ namespace protocol
 {
 bcos::crypto::HashType calculateMerkleProofRoot(
     bcos::crypto::CryptoSuite::Ptr _cryptoSuite, const std::vector<bcos::bytes>& _bytesCaches);
+// the root of the leaves built by encodeToCalculateRoot(_leafCount, _hashFunc), the leaves are
+// packed in one buffer instead of being built one by one
+bcos::crypto::HashType calculateMerkleProofRoot(bcos::crypto::CryptoSuite::Ptr _cryptoSuite,
+    size_t _leafCount, std::function<bcos::crypto::HashType(size_t _index)> const& _hashFunc);
 void calculateMerkleProof(bcos::crypto::CryptoSuite::Ptr _cryptoSuite,
     const std::vector<bcos::bytes>& _bytesCaches,
     std::shared_ptr<std::map<std::string, std::vector<std::string>>> _parent2ChildList);
@@ -180,20 +180,17 @@ public:
             return txsRoot;
         }
 
-        std::vector<bytes> transactionsList;
         if (transactionsSize() > 0)
         {
-            transactionsList = bcos::protocol::encodeToCalculateRoot(
+            txsRoot = bcos::protocol::calculateMerkleProofRoot(m_transactionFactory->cryptoSuite(),
                 transactionsSize(), [this](size_t _index) { return transaction(_index)->hash(); });
         }
         else if (transactionsMetaDataSize() > 0)
         {
-            transactionsList = bcos::protocol::encodeToCalculateRoot(transactionsHashSize(),
+            txsRoot = bcos::protocol::calculateMerkleProofRoot(m_transactionFactory->cryptoSuite(),
+                transactionsHashSize(),
                 [this](size_t _index) { return transactionMetaData(_index)->hash(); });
         }
-
-        txsRoot = bcos::protocol::calculateMerkleProofRoot(
-            m_transactionFactory->cryptoSuite(), transactionsList);
         return txsRoot;
     }
 
@@ -206,10 +203,8 @@ public:
             return receiptsRoot;
         }
 
-        auto receiptsList = bcos::protocol::encodeToCalculateRoot(
+        receiptsRoot = bcos::protocol::calculateMerkleProofRoot(m_receiptFactory->cryptoSuite(),
             receiptsSize(), [this](size_t _index) { return receipt(_index)->hash(); });
-        receiptsRoot =
-            bcos::protocol::calculateMerkleProofRoot(m_receiptFactory->cryptoSuite(), receiptsList);
 
         return receiptsRoot;
     }
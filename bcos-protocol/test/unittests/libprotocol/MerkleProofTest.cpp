@@ -0,0 +1,138 @@
+/*
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief test for the merkle root and proof of ParallelMerkleProof
+ * @file MerkleProofTest.cpp
+ */
+#include "bcos-protocol/Common.h"
+#include "bcos-protocol/ParallelMerkleProof.h"
+#include "bcos-protocol/testutils/protocol/FakeBlock.h"
+#include <bcos-utilities/testutils/TestPromptFixture.h>
+#include <boost/test/unit_test.hpp>
+#include <chrono>
+#include <iostream>
+using namespace bcos;
+using namespace bcos::protocol;
+using namespace bcos::crypto;
+
+namespace bcos
+{
+namespace test
+{
+BOOST_FIXTURE_TEST_SUITE(MerkleProofTest, TestPromptFixture)
+
+// the root computed node by node
+HashType calculateRootSerially(CryptoSuite::Ptr _cryptoSuite, std::vector<bytes> _nodes)
+{
+    if (_nodes.empty())
+    {
+        return _cryptoSuite->hash(bytes());
+    }
+    while (_nodes.size() > 1)
+    {
+        std::vector<bytes> parents;
+        for (size_t i = 0; i < _nodes.size(); i += 16)
+        {
+            bytes data;
+            for (size_t j = i; j < std::min<size_t>(i + 16, _nodes.size()); ++j)
+            {
+                data.insert(data.end(), _nodes[j].begin(), _nodes[j].end());
+            }
+            parents.emplace_back(_cryptoSuite->hash(data).asBytes());
+        }
+        _nodes = std::move(parents);
+    }
+    return _cryptoSuite->hash(_nodes[0]);
+}
+
+void checkRoot(CryptoSuite::Ptr _cryptoSuite, size_t _leafCount)
+{
+    auto hashFunc = [&_cryptoSuite](size_t _index) {
+        return _cryptoSuite->hash(std::to_string(_index));
+    };
+    auto leaves = encodeToCalculateRoot(_leafCount, hashFunc);
+    auto expected = calculateRootSerially(_cryptoSuite, leaves);
+
+    BOOST_CHECK_EQUAL(calculateMerkleProofRoot(_cryptoSuite, leaves), expected);
+    BOOST_CHECK_EQUAL(calculateMerkleProofRoot(_cryptoSuite, _leafCount, hashFunc), expected);
+
+    // every node of the proof is the hash of its children
+    auto parent2ChildList = std::make_shared<std::map<std::string, std::vector<std::string>>>();
+    calculateMerkleProof(_cryptoSuite, leaves, parent2ChildList);
+    if (_leafCount == 0)
+    {
+        BOOST_CHECK(parent2ChildList->empty());
+        return;
+    }
+    BOOST_CHECK(parent2ChildList->count(expected.hex()));
+    size_t leafCount = 0;
+    for (auto const& it : *parent2ChildList)
+    {
+        bytes data;
+        for (auto const& child : it.second)
+        {
+            auto childData = fromHex(child);
+            data.insert(data.end(), childData.begin(), childData.end());
+        }
+        BOOST_CHECK_EQUAL(_cryptoSuite->hash(data).hex(), it.first);
+        if (it.second.front().size() != HashType::size * 2)
+        {
+            leafCount += it.second.size();
+        }
+    }
+    BOOST_CHECK_EQUAL(leafCount, _leafCount);
+}
+
+BOOST_AUTO_TEST_CASE(testMerkleProofRoot)
+{
+    for (auto cryptoSuite : {createNormalCryptoSuite(), createSMCryptoSuite()})
+    {
+        for (size_t leafCount : {0, 1, 2, 15, 16, 17, 256, 257, 1000})
+        {
+            checkRoot(cryptoSuite, leafCount);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(testMerkleProofRootPerformance)
+{
+    auto cryptoSuite = createNormalCryptoSuite();
+    for (size_t leafCount : {1000, 10000, 100000})
+    {
+        std::vector<HashType> hashes(leafCount);
+        for (size_t i = 0; i < leafCount; ++i)
+        {
+            hashes[i] = cryptoSuite->hash(std::to_string(i));
+        }
+        auto hashFunc = [&hashes](size_t _index) { return hashes[_index]; };
+
+        auto startT = std::chrono::steady_clock::now();
+        auto expected =
+            calculateMerkleProofRoot(cryptoSuite, encodeToCalculateRoot(leafCount, hashFunc));
+        auto listT = std::chrono::steady_clock::now();
+        auto root = calculateMerkleProofRoot(cryptoSuite, leafCount, hashFunc);
+        auto flatT = std::chrono::steady_clock::now();
+        BOOST_CHECK_EQUAL(root, expected);
+
+        std::cout << "merkle root of " << leafCount << " leaves, encoded list: "
+                  << std::chrono::duration_cast<std::chrono::microseconds>(listT - startT).count()
+                  << "us, flat: "
+                  << std::chrono::duration_cast<std::chrono::microseconds>(flatT - listT).count()
+                  << "us" << std::endl;
+    }
+}
+BOOST_AUTO_TEST_SUITE_END()
+}  // namespace test
+}  // namespace bcos
@@ -38,6 +38,8 @@ enum MessageType
     BLOCK_NOTIFY = 0x101,  // 257
     RPC_REQUEST = 0x102,   // 258
     GROUP_NOTIFY = 0x103,  // 259
+    // the results of sendTransactions pushed to the ws session of the request
+    TRANSACTION_NOTIFY = 0x104,  // 260
 };
 }  // namespace rpc
 }  // namespace bcos
\ No newline at end of file
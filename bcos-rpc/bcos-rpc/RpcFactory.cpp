@@ -189,8 +189,9 @@ void RpcFactory::registerHandlers(std::shared_ptr<boostssl::ws::WsService> _wsSe
                 });
         });
 
+    auto messageFactory = _wsService->messageFactory();
     _wsService->registerMsgHandler(bcos::rpc::MessageType::RPC_REQUEST,
-        [_jsonRpcInterface](std::shared_ptr<boostssl::ws::WsMessage> _msg,
+        [_jsonRpcInterface, messageFactory](std::shared_ptr<boostssl::ws::WsMessage> _msg,
             std::shared_ptr<boostssl::ws::WsSession> _session) {
             if (!_jsonRpcInterface)
             {
@@ -200,7 +201,17 @@ void RpcFactory::registerHandlers(std::shared_ptr<boostssl::ws::WsService> _wsSe
             // Note: Clean up request data to prevent taking up too much memory
             bytes emptyBuffer;
             _msg->data()->swap(emptyBuffer);
-            _jsonRpcInterface->onRPCRequest(req, [req, _msg, _session](const std::string& _resp) {
+            auto notifier = [messageFactory, _session](const std::string& _notification) {
+                if (!_session || !_session->isConnected())
+                {
+                    return;
+                }
+                auto message = messageFactory->buildMessage(
+                    bcos::rpc::MessageType::TRANSACTION_NOTIFY,
+                    std::make_shared<bcos::bytes>(_notification.begin(), _notification.end()));
+                _session->asyncSendMessage(message);
+            };
+            auto sender = [req, _msg, _session](const std::string& _resp) {
                 if (_session && _session->isConnected())
                 {
                     auto buffer = std::make_shared<bcos::bytes>(_resp.begin(), _resp.end());
@@ -218,7 +229,8 @@ void RpcFactory::registerHandlers(std::shared_ptr<boostssl::ws::WsService> _wsSe
                         << LOG_KV("req", req) << LOG_KV("resp", _resp) << LOG_KV("seq", seq)
                         << LOG_KV("endpoint", _session ? _session->endPoint() : std::string(""));
                 }
-            });
+            };
+            _jsonRpcInterface->onWsRPCRequest(req, std::move(sender), std::move(notifier));
         });
 }
 bcos::rpc::JsonRpcImpl_2_0::Ptr RpcFactory::buildJsonRpc(
@@ -20,6 +20,7 @@
  */
 #include "AMOPClient.h"
 #include <bcos-framework/interfaces/gateway/GatewayTypeDef.h>
+#include <bcos-framework/interfaces/metrics/Metrics.h>
 #include <bcos-framework/interfaces/protocol/CommonError.h>
 #include <bcos-protocol/amop/TopicItem.h>
 #include <bcos-rpc/Common.h>
@@ -240,9 +241,24 @@ void AMOPClient::sendMessageToClient(std::string const& _topic,
     std::shared_ptr<WsSession> _selectSession, std::shared_ptr<WsMessage> _msg,
     std::function<void(Error::Ptr&&, bytesPointer)> _callback)
 {
+    auto endPoint = _selectSession->endPoint();
+    if (!acquireSessionSlot(endPoint))
+    {
+        AMOP_CLIENT_LOG(WARNING) << LOG_BADGE("asyncNotifyAMOPMessage")
+                                 << LOG_DESC("the session is busy") << LOG_KV("topic", _topic)
+                                 << LOG_KV("endpoint", endPoint);
+        _callback(std::make_shared<Error>(-1, "the AMOP client session is busy"), nullptr);
+        return;
+    }
+    auto weakClient = std::weak_ptr<AMOPClient>(shared_from_this());
     _selectSession->asyncSendMessage(_msg, Options(30000),
-        [_msg, _topic, _callback](bcos::Error::Ptr _error, std::shared_ptr<WsMessage> _responseMsg,
-            std::shared_ptr<WsSession> _session) {
+        [_msg, _topic, _callback, weakClient, endPoint](bcos::Error::Ptr _error,
+            std::shared_ptr<WsMessage> _responseMsg, std::shared_ptr<WsSession> _session) {
+            auto amopClient = weakClient.lock();
+            if (amopClient)
+            {
+                amopClient->releaseSessionSlot(endPoint);
+            }
             auto seq = std::string(_msg->seq()->begin(), _msg->seq()->end());
             if (_error && _error->errorCode() != bcos::protocol::CommonError::SUCCESS)
             {
@@ -315,6 +331,8 @@ void AMOPClient::asyncNotifyAMOPBroadcastMessage(std::string const& _topic, byte
     requestMsg->setType(AMOPClientMessageType::AMOP_BROADCAST);
     requestMsg->setData(std::make_shared<bytes>(_data.begin(), _data.end()));
     broadcastAMOPMessage(_topic, requestMsg);
+    // the broadcast messages are bounded per sdk session by broadcastAMOPMessage, so the gateway
+    // slot is released once the message is handed to the sessions
     if (_callback)
     {
         _callback(nullptr, nullptr);
@@ -325,10 +343,52 @@ void AMOPClient::broadcastAMOPMessage(std::string const& _topic, std::shared_ptr
 {
     AMOP_CLIENT_LOG(DEBUG) << LOG_DESC("broadcastAMOPMessage") << LOG_KV("topic", _topic);
     auto sessions = querySessionsByTopic(_topic);
+    auto weakClient = std::weak_ptr<AMOPClient>(shared_from_this());
     for (auto const& session : sessions)
     {
-        session.second->asyncSendMessage(_msg, Options(30000));
+        auto const& endPoint = session.first;
+        if (!acquireSessionSlot(endPoint))
+        {
+            static auto& droppedCounter = metrics::counter(metrics::c_amopSessionDropped);
+            droppedCounter.add();
+            AMOP_CLIENT_LOG(WARNING) << LOG_DESC("broadcastAMOPMessage: drop for the busy session")
+                                     << LOG_KV("topic", _topic) << LOG_KV("endpoint", endPoint);
+            continue;
+        }
+        session.second->asyncSendMessage(_msg, Options(m_broadcastTimeout),
+            [weakClient, endPoint](bcos::Error::Ptr, std::shared_ptr<WsMessage>,
+                std::shared_ptr<WsSession>) {
+                auto amopClient = weakClient.lock();
+                if (amopClient)
+                {
+                    amopClient->releaseSessionSlot(endPoint);
+                }
+            });
+    }
+}
+
+bool AMOPClient::acquireSessionSlot(std::string const& _endPoint)
+{
+    Guard l(x_sessionInflight);
+    auto& inflight = m_sessionInflight[_endPoint];
+    if (inflight >= m_maxSessionInflight)
+    {
+        return false;
     }
+    inflight++;
+    return true;
+}
+
+void AMOPClient::releaseSessionSlot(std::string const& _endPoint)
+{
+    Guard l(x_sessionInflight);
+    auto it = m_sessionInflight.find(_endPoint);
+    // the slots of a disconnected session are dropped with the session
+    if (it == m_sessionInflight.end() || it->second == 0)
+    {
+        return;
+    }
+    it->second--;
 }
 std::shared_ptr<WsSession> AMOPClient::randomChooseSession(std::string const& _topic)
 {
@@ -366,6 +426,10 @@ std::shared_ptr<WsSession> AMOPClient::randomChooseSession(std::string const& _t
 
 void AMOPClient::onClientDisconnect(std::shared_ptr<WsSession> _session)
 {
+    {
+        Guard l(x_sessionInflight);
+        m_sessionInflight.erase(_session->endPoint());
+    }
     std::vector<std::string> topicsToRemove;
     {
         WriteGuard l(x_topicToSessions);
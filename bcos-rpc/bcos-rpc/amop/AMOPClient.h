@@ -59,25 +59,37 @@ public:
     virtual void asyncNotifyAMOPMessage(int16_t _type, std::string const& _topic,
         bytesConstRef _data, std::function<void(Error::Ptr&&, bytesPointer)> _callback)
     {
+        // the gateway holds a slot of the client until the callback, which is called only once,
+        // even if it throws into the catch below
+        auto called = std::make_shared<std::atomic_bool>(false);
+        auto callback = [_callback, called](Error::Ptr&& _error, bytesPointer _response) {
+            if (!_callback || called->exchange(true))
+            {
+                return;
+            }
+            _callback(std::move(_error), std::move(_response));
+        };
         try
         {
             switch (_type)
             {
             case AMOPNotifyMessageType::Unicast:
-                asyncNotifyAMOPMessage(_topic, _data, _callback);
+                asyncNotifyAMOPMessage(_topic, _data, callback);
                 break;
             case AMOPNotifyMessageType::Broadcast:
-                asyncNotifyAMOPBroadcastMessage(_topic, _data, _callback);
+                asyncNotifyAMOPBroadcastMessage(_topic, _data, callback);
                 break;
             default:
                 BCOS_LOG(WARNING) << LOG_DESC("asyncNotifyAMOPMessage: unknown message type")
                                   << LOG_KV("type", _type);
+                callback(std::make_shared<Error>(-1, "unknown AMOP message type"), nullptr);
             }
         }
         catch (std::exception const& e)
         {
             BCOS_LOG(WARNING) << LOG_DESC("asyncNotifyAMOPMessage exception")
                               << LOG_KV("error", boost::diagnostic_information(e));
+            callback(std::make_shared<Error>(-1, "asyncNotifyAMOPMessage exception"), nullptr);
         }
     }
 
@@ -170,6 +182,10 @@ protected:
     void broadcastAMOPMessage(
         std::string const& _topic, std::shared_ptr<boostssl::ws::WsMessage> _msg);
 
+    // return false if the session already holds m_maxSessionInflight messages
+    bool acquireSessionSlot(std::string const& _endPoint);
+    void releaseSessionSlot(std::string const& _endPoint);
+
     virtual void pingGatewayAndNotifyTopics();
 
     virtual bool onGatewayInactivated(std::shared_ptr<boostssl::ws::WsMessage> _msg,
@@ -190,6 +206,15 @@ protected:
         m_topicToSessions;
     mutable SharedMutex x_topicToSessions;
 
+    // the AMOP messages pushed to each sdk session and not yet finished: [endpoint->count]
+    // the ws session exposes no write completion, so a broadcast message holds its slot until the
+    // session responds or the response timer fires, which bounds the messages buffered for a slow
+    // session
+    std::unordered_map<std::string, size_t> m_sessionInflight;
+    mutable Mutex x_sessionInflight;
+    size_t m_maxSessionInflight = 10000;
+    int32_t m_broadcastTimeout = 1000;
+
     std::shared_ptr<Timer> m_gatewayStatusDetector;
     std::atomic_bool m_gatewayActivated = {true};
     std::atomic_bool m_notifyTopicSuccess = {true};
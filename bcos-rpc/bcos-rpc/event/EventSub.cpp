@@ -29,6 +29,7 @@
 #include <chrono>
 #include <cstddef>
 #include <memory>
+#include <numeric>
 #include <thread>
 
 using namespace bcos;
@@ -375,31 +376,116 @@ int64_t EventSub::executeEventSubTask(EventSubTask::Ptr _task, int64_t _blockNum
 
     int64_t blockCanProcess = _blockNumber - currentBlockNumber + 1;
     int64_t maxBlockProcessPerLoop = m_maxBlockProcessPerLoop;
+    auto const& params = _task->params();
+    if (blockCanProcess > maxBlockProcessPerLoop &&
+        (!params->addresses().empty() || !params->topics().empty()))
+    {
+        // too many blocks to scan in one loop, locate the matched blocks by the log index
+        return executeEventSubTaskByIndex(_task, currentBlockNumber, _blockNumber);
+    }
     blockCanProcess =
         (blockCanProcess > maxBlockProcessPerLoop ? maxBlockProcessPerLoop : blockCanProcess);
 
+    std::vector<int64_t> blocks(blockCanProcess);
+    std::iota(blocks.begin(), blocks.end(), currentBlockNumber);
+    processBlocks(_task, std::move(blocks), currentBlockNumber + blockCanProcess - 1);
+
+    return blockCanProcess;
+}
+
+int64_t EventSub::executeEventSubTaskByIndex(
+    EventSubTask::Ptr _task, int64_t _fromBlock, int64_t _toBlock)
+{
+    _toBlock = std::min(_toBlock, _fromBlock + c_maxIndexedBlocksPerLoop - 1);
+    auto nodeService = m_groupManager->getNodeService(_task->group(), "");
+    if (!nodeService)
+    {
+        EVENT_SUB(ERROR)
+            << LOG_BADGE("executeEventSubTaskByIndex")
+            << LOG_DESC("cannot get node service of the group maybe the group has been removed")
+            << LOG_KV("id", _task->id()) << LOG_KV("group", _task->group());
+        unsubscribeEventSub(_task->id());
+        return 0;
+    }
+
+    auto self = std::weak_ptr<EventSub>(shared_from_this());
+    auto const& params = _task->params();
+    nodeService->ledger()->asyncGetLogLocations(_fromBlock, _toBlock, params->addresses(),
+        params->topics(),
+        [self, _task, _fromBlock, _toBlock](
+            Error::Ptr _error, std::vector<ledger::LogLocation> _locations) {
+            auto eventSub = self.lock();
+            if (!eventSub)
+            {
+                return;
+            }
+            std::vector<int64_t> blocks;
+            int64_t endBlockNumber = _toBlock;
+            if (_error && _error->errorCode() != bcos::protocol::CommonError::SUCCESS)
+            {
+                // the blocks are not indexed, scan them
+                EVENT_SUB(DEBUG) << LOG_BADGE("executeEventSubTaskByIndex")
+                                 << LOG_DESC("asyncGetLogLocations failed, scan the blocks")
+                                 << LOG_KV("id", _task->id())
+                                 << LOG_KV("errorCode", _error->errorCode())
+                                 << LOG_KV("errorMessage", _error->errorMessage());
+                endBlockNumber = _fromBlock + eventSub->maxBlockProcessPerLoop() - 1;
+                blocks.resize(endBlockNumber - _fromBlock + 1);
+                std::iota(blocks.begin(), blocks.end(), _fromBlock);
+            }
+            else
+            {
+                for (auto const& location : _locations)
+                {
+                    if (blocks.empty() || blocks.back() != location.blockNumber)
+                    {
+                        blocks.push_back(location.blockNumber);
+                    }
+                }
+                // the rest of the matched blocks are processed by the next loops
+                if ((int64_t)blocks.size() > c_maxMatchedBlocksPerLoop)
+                {
+                    blocks.resize(c_maxMatchedBlocksPerLoop);
+                    endBlockNumber = blocks.back();
+                }
+            }
+            EVENT_SUB(TRACE) << LOG_BADGE("executeEventSubTaskByIndex")
+                             << LOG_KV("id", _task->id()) << LOG_KV("fromBlock", _fromBlock)
+                             << LOG_KV("endBlock", endBlockNumber)
+                             << LOG_KV("blocks", blocks.size());
+            eventSub->processBlocks(_task, std::move(blocks), endBlockNumber);
+        });
+
+    return _toBlock - _fromBlock + 1;
+}
+
+void EventSub::processBlocks(
+    EventSubTask::Ptr _task, std::vector<int64_t> _blocks, int64_t _endBlockNumber)
+{
     class RecursiveProcess : public std::enable_shared_from_this<RecursiveProcess>
     {
     public:
-        void process(int64_t _blockNumber)
+        void process(size_t _index)
         {
-            if (_blockNumber > m_endBlockNumber)
+            if (_index >= m_blocks.size())
             {  // all block has been proccessed
+                m_task->state()->setCurrentBlockNumber(m_endBlockNumber + 1);
                 m_task->freeWork();
                 return;
             }
 
+            auto blockNumber = m_blocks[_index];
             EVENT_SUB(TRACE) << LOG_BADGE("executeEventSubTask:process")
                              << LOG_KV("id", m_task->id())
                              << LOG_KV("fromBlock", m_task->params()->fromBlock())
                              << LOG_KV("toBlock", m_task->params()->toBlock())
-                             << LOG_KV("blockNumber", _blockNumber);
+                             << LOG_KV("blockNumber", blockNumber);
 
             auto eventSub = m_eventSub;
             auto task = m_task;
             auto p = shared_from_this();
             eventSub->processNextBlock(
-                _blockNumber, task, [task, _blockNumber, p](Error::Ptr _error) {
+                blockNumber, task, [task, blockNumber, _index, p](Error::Ptr _error) {
                     if (_error && _error->errorCode() != bcos::protocol::CommonError::SUCCESS)
                     {
                         // error occur, wait for the next loop ???
@@ -407,24 +493,26 @@ int64_t EventSub::executeEventSubTask(EventSubTask::Ptr _task, int64_t _blockNum
                         return;
                     }
                     // next block
-                    task->state()->setCurrentBlockNumber(_blockNumber + 1);
-                    p->process(_blockNumber + 1);
+                    task->state()->setCurrentBlockNumber(blockNumber + 1);
+                    p->process(_index + 1);
                 });
         }
 
     public:
+        // the blocks to be processed, the blocks before m_endBlockNumber not in the list have no
+        // matched logs
+        std::vector<int64_t> m_blocks;
         bcos::protocol::BlockNumber m_endBlockNumber;
         std::shared_ptr<EventSub> m_eventSub;
         EventSubTask::Ptr m_task;
     };
 
     auto p = std::make_shared<RecursiveProcess>();
-    p->m_endBlockNumber = currentBlockNumber + blockCanProcess - 1;
+    p->m_blocks = std::move(_blocks);
+    p->m_endBlockNumber = _endBlockNumber;
     p->m_eventSub = shared_from_this();
     p->m_task = _task;
-    p->process(currentBlockNumber);
-
-    return blockCanProcess;
+    p->process(0);
 }
 
 int64_t EventSub::executeEventSubTask(EventSubTask::Ptr _task)
@@ -101,6 +101,12 @@ public:
 
 public:
     int64_t executeEventSubTask(EventSubTask::Ptr _task, int64_t _currentBlockNumber);
+    // process the blocks of [_fromBlock, _toBlock] that the log index matches
+    int64_t executeEventSubTaskByIndex(
+        EventSubTask::Ptr _task, int64_t _fromBlock, int64_t _toBlock);
+    // process _blocks in order, the task is at _endBlockNumber + 1 when all are processed
+    void processBlocks(
+        EventSubTask::Ptr _task, std::vector<int64_t> _blocks, int64_t _endBlockNumber);
     void onTaskComplete(bcos::event::EventSubTask::Ptr _task);
     bool checkConnAvailable(bcos::event::EventSubTask::Ptr _task);
     void processNextBlock(int64_t _blockNumber, bcos::event::EventSubTask::Ptr _task,
@@ -166,6 +172,11 @@ private:
 
     //
     int64_t m_maxBlockProcessPerLoop = 10;
+
+    // the max blocks searched by the log index per loop
+    static constexpr int64_t c_maxIndexedBlocksPerLoop = 100000;
+    // the max matched blocks processed per loop
+    static constexpr int64_t c_maxMatchedBlocksPerLoop = 100;
 };
 
 class EventSubFactory : public std::enable_shared_from_this<EventSubFactory>
@@ -170,6 +170,67 @@ std::string EventSubRequest::generateJson() const
     return result;
 }
 
+EventSubParams::Ptr EventSubRequest::parseParams(const Json::Value& _jParams)
+{
+    // the addresses and the topics are matched in lower case hex without 0x prefix
+    auto normalize = [](std::string _value) {
+        if ((_value.compare(0, 2, "0x") == 0) || (_value.compare(0, 2, "0X") == 0))
+        {
+            _value = _value.substr(2);
+        }
+        std::transform(_value.begin(), _value.end(), _value.begin(), ::tolower);
+        return _value;
+    };
+
+    auto params = std::make_shared<EventSubParams>();
+    if (_jParams.isMember("fromBlock"))
+    {
+        params->setFromBlock(_jParams["fromBlock"].asInt64());
+    }
+
+    if (_jParams.isMember("toBlock"))
+    {
+        params->setToBlock(_jParams["toBlock"].asInt64());
+    }
+
+    if (_jParams.isMember("addresses"))
+    {
+        auto& jAddresses = _jParams["addresses"];
+        for (Json::Value::ArrayIndex index = 0; index < jAddresses.size(); ++index)
+        {
+            params->addAddress(normalize(jAddresses[index].asString()));
+        }
+    }
+
+    if (_jParams.isMember("topics"))
+    {
+        auto& jTopics = _jParams["topics"];
+
+        for (Json::Value::ArrayIndex index = 0; index < jTopics.size(); ++index)
+        {
+            auto& jIndex = jTopics[index];
+            if (jIndex.isNull())
+            {
+                continue;
+            }
+
+            if (jIndex.isArray())
+            {  // array topics
+                for (Json::Value::ArrayIndex innerIndex = 0; innerIndex < jIndex.size();
+                     ++innerIndex)
+                {
+                    params->addTopic(index, normalize(jIndex[innerIndex].asString()));
+                }
+            }
+            else
+            {  // single topic, string value
+                params->addTopic(index, normalize(jIndex.asString()));
+            }
+        }
+    }
+    return params;
+}
+
 bool EventSubRequest::fromJson(const std::string& _request)
 {
     std::string id;
@@ -210,65 +271,7 @@ bool EventSubRequest::fromJson(const std::string& _request)
                 break;
             }
 
-            auto& jParams = root["params"];
-            if (jParams.isMember("fromBlock"))
-            {
-                params->setFromBlock(jParams["fromBlock"].asInt64());
-            }
-
-            if (jParams.isMember("toBlock"))
-            {
-                params->setToBlock(jParams["toBlock"].asInt64());
-            }
-
-            if (jParams.isMember("addresses"))
-            {
-                auto& jAddresses = jParams["addresses"];
-                for (Json::Value::ArrayIndex index = 0; index < jAddresses.size(); ++index)
-                {
-                    std::string address = jAddresses[index].asString();
-                    if ((address.compare(0, 2, "0x") == 0) || (address.compare(0, 2, "0X") == 0))
-                    {
-                        address = address.substr(2);
-                    }
-                    std::transform(address.begin(), address.end(), address.begin(), ::tolower);
-                    params->addAddress(address);
-                }
-            }
-
-            if (jParams.isMember("topics"))
-            {
-                auto& jTopics = jParams["topics"];
-
-                for (Json::Value::ArrayIndex index = 0; index < jTopics.size(); ++index)
-                {
-                    auto& jIndex = jTopics[index];
-                    if (jIndex.isNull())
-                    {
-                        continue;
-                    }
-
-                    if (jIndex.isArray())
-                    {  // array topics
-                        for (Json::Value::ArrayIndex innerIndex = 0; innerIndex < jIndex.size();
-                             ++innerIndex)
-                        {
-                            std::string topic = jIndex[innerIndex].asString();
-                            if ((topic.compare(0, 2, "0x") == 0) ||
-                                (topic.compare(0, 2, "0XC") == 0))
-                            {
-                                topic = topic.substr(2);
-                            }
-                            std::transform(topic.begin(), topic.end(), topic.begin(), ::tolower);
-                            params->addTopic(index, topic);
-                        }
-                    }
-                    else
-                    {  // single topic, string value
-                        params->addTopic(index, jIndex.asString());
-                    }
-                }
-            }
+            params = parseParams(root["params"]);
 
             setId(id);
             setGroup(group);
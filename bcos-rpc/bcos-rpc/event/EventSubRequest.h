@@ -20,6 +20,7 @@
 
 #pragma once
 #include <bcos-rpc/event/EventSubParams.h>
+#include <json/json.h>
 
 namespace bcos
 {
@@ -62,6 +63,9 @@ public:
     std::string generateJson() const override;
     bool fromJson(const std::string& _request) override;
 
+    // parse the fromBlock, toBlock, addresses and topics of the event sub params
+    static EventSubParams::Ptr parseParams(const Json::Value& _jParams);
+
 private:
     std::shared_ptr<EventSubParams> m_params;
     std::shared_ptr<EventSubTaskState> m_state;
@@ -18,10 +18,13 @@
  * @author: octopus
  * @date: 2021-07-09
  */
+#include <bcos-framework/interfaces/metrics/Metrics.h>
 #include <bcos-framework/interfaces/protocol/Transaction.h>
 #include <bcos-framework/interfaces/protocol/TransactionReceipt.h>
 #include <bcos-protocol/LogEntry.h>
 #include <bcos-protocol/TransactionStatus.h>
+#include <bcos-rpc/event/EventSubMatcher.h>
+#include <bcos-rpc/event/EventSubRequest.h>
 #include <bcos-rpc/jsonrpc/Common.h>
 #include <bcos-rpc/jsonrpc/JsonRpcImpl_2_0.h>
 #include <bcos-utilities/Base64.h>
@@ -34,6 +37,10 @@
 #include <boost/uuid/uuid.hpp>
 #include <boost/uuid/uuid_generators.hpp>
 #include <boost/uuid/uuid_io.hpp>
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <numeric>
 #include <string>
 
 using namespace std;
@@ -49,6 +56,11 @@ void JsonRpcImpl_2_0::initMethod()
         std::bind(&JsonRpcImpl_2_0::callI, this, std::placeholders::_1, std::placeholders::_2);
     m_methodToFunc["sendTransaction"] = std::bind(
         &JsonRpcImpl_2_0::sendTransactionI, this, std::placeholders::_1, std::placeholders::_2);
+    m_methodToFunc["sendTransactions"] = std::bind(
+        &JsonRpcImpl_2_0::sendTransactionsI, this, std::placeholders::_1, std::placeholders::_2);
+    m_notifyMethodToFunc["sendTransactions"] =
+        std::bind(&JsonRpcImpl_2_0::notifySendTransactionsI, this, std::placeholders::_1,
+            std::placeholders::_2, std::placeholders::_3);
     m_methodToFunc["getTransaction"] = std::bind(
         &JsonRpcImpl_2_0::getTransactionI, this, std::placeholders::_1, std::placeholders::_2);
     m_methodToFunc["getTransactionReceipt"] = std::bind(&JsonRpcImpl_2_0::getTransactionReceiptI,
@@ -61,6 +73,8 @@ void JsonRpcImpl_2_0::initMethod()
         this, std::placeholders::_1, std::placeholders::_2);
     m_methodToFunc["getBlockNumber"] = std::bind(
         &JsonRpcImpl_2_0::getBlockNumberI, this, std::placeholders::_1, std::placeholders::_2);
+    m_methodToFunc["getLogs"] =
+        std::bind(&JsonRpcImpl_2_0::getLogsI, this, std::placeholders::_1, std::placeholders::_2);
     m_methodToFunc["getCode"] =
         std::bind(&JsonRpcImpl_2_0::getCodeI, this, std::placeholders::_1, std::placeholders::_2);
     m_methodToFunc["getABI"] =
@@ -95,6 +109,8 @@ void JsonRpcImpl_2_0::initMethod()
         &JsonRpcImpl_2_0::getGroupInfoListI, this, std::placeholders::_1, std::placeholders::_2);
     m_methodToFunc["getGroupNodeInfo"] = std::bind(
         &JsonRpcImpl_2_0::getGroupNodeInfoI, this, std::placeholders::_1, std::placeholders::_2);
+    m_methodToFunc["getMetrics"] = std::bind(
+        &JsonRpcImpl_2_0::getMetricsI, this, std::placeholders::_1, std::placeholders::_2);
 
     for (const auto& method : m_methodToFunc)
     {
@@ -113,6 +129,30 @@ void JsonRpcImpl_2_0::parseRpcRequestJson(
 {
     Json::Value root;
     Json::Reader jsonReader;
+    bool parsed = false;
+    try
+    {
+        parsed = jsonReader.parse(_requestBody, root);
+    }
+    catch (const std::exception& e)
+    {
+        RPC_IMPL_LOG(ERROR) << LOG_BADGE("parseRpcRequestJson") << LOG_KV("request", _requestBody)
+                            << LOG_KV("error", boost::diagnostic_information(e));
+        BOOST_THROW_EXCEPTION(
+            JsonRpcException(JsonRpcError::ParseError, "Invalid JSON was received by the server."));
+    }
+    if (!parsed)
+    {
+        RPC_IMPL_LOG(ERROR) << LOG_BADGE("parseRpcRequestJson") << LOG_KV("request", _requestBody)
+                            << LOG_KV("errorMessage", "invalid request json object");
+        BOOST_THROW_EXCEPTION(JsonRpcException(
+            JsonRpcError::InvalidRequest, "The JSON sent is not a valid Request object."));
+    }
+    parseRpcRequestJson(root, _jsonRequest);
+}
+
+void JsonRpcImpl_2_0::parseRpcRequestJson(const Json::Value& _root, JsonRequest& _jsonRequest)
+{
     std::string errorMessage;
 
     try
@@ -122,52 +162,47 @@ void JsonRpcImpl_2_0::parseRpcRequestJson(
         int64_t id = 0;
         do
         {
-            if (!jsonReader.parse(_requestBody, root))
+            if (!_root.isObject())
             {
                 errorMessage = "invalid request json object";
                 break;
             }
 
-            if (!root.isMember("jsonrpc"))
+            if (!_root.isMember("jsonrpc"))
             {
                 errorMessage = "request has no jsonrpc field";
                 break;
             }
-            jsonrpc = root["jsonrpc"].asString();
+            jsonrpc = _root["jsonrpc"].asString();
 
-            if (!root.isMember("method"))
+            if (!_root.isMember("method"))
             {
                 errorMessage = "request has no method field";
                 break;
             }
-            method = root["method"].asString();
+            method = _root["method"].asString();
 
-            if (root.isMember("id"))
+            if (_root.isMember("id"))
             {
-                id = root["id"].asInt64();
+                id = _root["id"].asInt64();
             }
 
-            if (!root.isMember("params"))
+            if (!_root.isMember("params"))
             {
                 errorMessage = "request has no params field";
                 break;
             }
 
-            if (!root["params"].isArray())
+            if (!_root["params"].isArray())
             {
                 errorMessage = "request params is not array object";
                 break;
             }
 
-            auto jParams = root["params"];
-
             _jsonRequest.jsonrpc = jsonrpc;
             _jsonRequest.method = method;
             _jsonRequest.id = id;
-            _jsonRequest.params = jParams;
-
-            // RPC_IMPL_LOG(DEBUG) << LOG_BADGE("parseRpcRequestJson") << LOG_KV("method", method)
-            //                     << LOG_KV("requestMessage", _requestBody);
+            _jsonRequest.params = _root["params"];
 
             // success return
             return;
@@ -175,13 +210,15 @@ void JsonRpcImpl_2_0::parseRpcRequestJson(
     }
     catch (const std::exception& e)
     {
-        RPC_IMPL_LOG(ERROR) << LOG_BADGE("parseRpcRequestJson") << LOG_KV("request", _requestBody)
+        RPC_IMPL_LOG(ERROR) << LOG_BADGE("parseRpcRequestJson")
+                            << LOG_KV("request", Json::FastWriter().write(_root))
                             << LOG_KV("error", boost::diagnostic_information(e));
         BOOST_THROW_EXCEPTION(
             JsonRpcException(JsonRpcError::ParseError, "Invalid JSON was received by the server."));
     }
 
-    RPC_IMPL_LOG(ERROR) << LOG_BADGE("parseRpcRequestJson") << LOG_KV("request", _requestBody)
+    RPC_IMPL_LOG(ERROR) << LOG_BADGE("parseRpcRequestJson")
+                        << LOG_KV("request", Json::FastWriter().write(_root))
                         << LOG_KV("errorMessage", errorMessage);
 
     BOOST_THROW_EXCEPTION(JsonRpcException(
@@ -285,18 +322,76 @@ Json::Value JsonRpcImpl_2_0::toJsonResponse(const JsonResponse& _jsonResponse)
     return jResp;
 }
 
-void JsonRpcImpl_2_0::onRPCRequest(const std::string& _requestBody, Sender _sender)
+void JsonRpcImpl_2_0::onWsRPCRequest(
+    const std::string& _requestBody, Sender _sender, Sender _notifier)
+{
+    Json::Value root;
+    Json::Reader jsonReader;
+    bool parsed = false;
+    try
+    {
+        parsed = jsonReader.parse(_requestBody, root);
+    }
+    catch (const std::exception&)
+    {}
+    if (parsed && root.isArray())
+    {
+        onRPCBatchRequest(root, std::move(_sender));
+        return;
+    }
+
+    auto onResponse = [_requestBody, _sender](JsonResponse&& _response) {
+        auto strResp = toStringResponse(_response);
+        _sender(strResp);
+        RPC_IMPL_LOG(TRACE) << LOG_BADGE("onRPCRequest") << LOG_KV("request", _requestBody)
+                            << LOG_KV("response", strResp);
+    };
+    if (parsed)
+    {
+        handleRpcRequest(root, std::move(onResponse), std::move(_notifier));
+        return;
+    }
+    // parse the body again for the error response
+    handleRpcRequest(_requestBody, std::move(onResponse));
+}
+
+template <class Request>
+void JsonRpcImpl_2_0::handleRpcRequest(
+    Request const& _request, std::function<void(JsonResponse&&)> _onResponse, Sender _notifier)
 {
     JsonRequest request;
     JsonResponse response;
     try
     {
-        parseRpcRequestJson(_requestBody, request);
+        parseRpcRequestJson(_request, request);
 
         response.jsonrpc = request.jsonrpc;
         response.id = request.id;
 
         const auto& method = request.method;
+        RespFunc respFunc = [response, _onResponse](
+                                Error::Ptr _error, Json::Value& _result) mutable {
+            if (_error && (_error->errorCode() != bcos::protocol::CommonError::SUCCESS))
+            {
+                // error
+                response.error.code = _error->errorCode();
+                response.error.message = _error->errorMessage();
+            }
+            else
+            {
+                response.result.swap(_result);
+            }
+            _onResponse(std::move(response));
+        };
+        if (_notifier)
+        {
+            auto notifyIt = m_notifyMethodToFunc.find(method);
+            if (notifyIt != m_notifyMethodToFunc.end())
+            {
+                notifyIt->second(request.params, std::move(respFunc), std::move(_notifier));
+                return;
+            }
+        }
         auto it = m_methodToFunc.find(method);
         if (it == m_methodToFunc.end())
         {
@@ -304,23 +399,7 @@ void JsonRpcImpl_2_0::onRPCRequest(const std::string& _requestBody, Sender _send
                 JsonRpcError::MethodNotFound, "The method does not exist/is not available."));
         }
 
-        it->second(request.params,
-            [_requestBody, response, _sender](Error::Ptr _error, Json::Value& _result) mutable {
-                if (_error && (_error->errorCode() != bcos::protocol::CommonError::SUCCESS))
-                {
-                    // error
-                    response.error.code = _error->errorCode();
-                    response.error.message = _error->errorMessage();
-                }
-                else
-                {
-                    response.result.swap(_result);
-                }
-                auto strResp = toStringResponse(response);
-                _sender(strResp);
-                RPC_IMPL_LOG(TRACE) << LOG_BADGE("onRPCRequest") << LOG_KV("request", _requestBody)
-                                    << LOG_KV("response", strResp);
-            });
+        it->second(request.params, std::move(respFunc));
 
         // success response
         return;
@@ -337,12 +416,197 @@ void JsonRpcImpl_2_0::onRPCRequest(const std::string& _requestBody, Sender _send
         response.error.message = std::string(e.what());
     }
 
-    auto strResp = toStringResponse(response);
     // error response
-    _sender(strResp);
+    _onResponse(std::move(response));
+}
 
-    // RPC_IMPL_LOG(DEBUG) << LOG_BADGE("onRPCRequest") << LOG_KV("request", _requestBody)
-    //                     << LOG_KV("response", strResp);
+void JsonRpcImpl_2_0::onRPCBatchRequest(const Json::Value& _requests, Sender _sender)
+{
+    if (_requests.empty() || _requests.size() > c_maxBatchRequests)
+    {
+        JsonResponse response;
+        response.error.code = JsonRpcError::InvalidRequest;
+        response.error.message =
+            _requests.empty() ? "The batch request is empty." :
+                                "The batch request has more than " +
+                                    std::to_string(c_maxBatchRequests) + " requests.";
+        _sender(toStringResponse(response));
+        return;
+    }
+
+    struct BatchResponse
+    {
+        std::vector<Json::Value> responses;
+        std::atomic_size_t remaining;
+        Sender sender;
+    };
+    auto batch = std::make_shared<BatchResponse>();
+    batch->responses.resize(_requests.size());
+    batch->remaining = _requests.size();
+    batch->sender = std::move(_sender);
+    auto onResponse = [batch](size_t _index, JsonResponse&& _response) {
+        // every request responds once, the slots are written by different threads
+        batch->responses[_index] = toJsonResponse(_response);
+        if (batch->remaining.fetch_sub(1) != 1)
+        {
+            return;
+        }
+        Json::Value responses(Json::arrayValue);
+        for (auto& response : batch->responses)
+        {
+            responses.append(std::move(response));
+        }
+        batch->sender(Json::FastWriter().write(responses));
+    };
+    auto requests = std::make_shared<Json::Value>(_requests);
+    auto handle = [this, requests, onResponse](size_t _index) {
+        handleRpcRequest((*requests)[(Json::ArrayIndex)_index],
+            [_index, onResponse](JsonResponse&& _response) {
+                onResponse(_index, std::move(_response));
+            });
+    };
+
+    // the getTransactionReceipt requests without proof to the same node are coalesced
+    std::map<std::pair<std::string, std::string>, std::vector<std::pair<size_t, JsonRequest>>>
+        receiptRequests;
+    for (Json::ArrayIndex i = 0; i < _requests.size(); ++i)
+    {
+        auto const& request = _requests[i];
+        if (!request.isObject() || request["method"].asString() != "getTransactionReceipt")
+        {
+            handle(i);
+            continue;
+        }
+        JsonRequest receiptRequest;
+        try
+        {
+            parseRpcRequestJson(request, receiptRequest);
+        }
+        catch (const std::exception&)
+        {
+            handle(i);
+            continue;
+        }
+        auto const& params = receiptRequest.params;
+        if (params.size() < 3 || params[3u].asBool())
+        {
+            handle(i);
+            continue;
+        }
+        receiptRequests[{params[0u].asString(), params[1u].asString()}].emplace_back(
+            i, std::move(receiptRequest));
+    }
+    for (auto& it : receiptRequests)
+    {
+        if (it.second.size() == 1)
+        {
+            handle(it.second.front().first);
+            continue;
+        }
+        batchGetTransactionReceipts(
+            it.first.first, it.first.second, std::move(it.second), onResponse, handle);
+    }
+}
+
+void JsonRpcImpl_2_0::batchGetTransactionReceipts(std::string const& _groupID,
+    std::string const& _nodeName, std::vector<std::pair<size_t, JsonRequest>> _requests,
+    std::function<void(size_t, JsonResponse&&)> _onResponse, std::function<void(size_t)> _fallback)
+{
+    auto nodeService = m_groupManager->getNodeService(_groupID, _nodeName);
+    auto ledger = nodeService ? nodeService->ledger() : nullptr;
+    auto requests = std::make_shared<std::vector<std::pair<size_t, JsonRequest>>>();
+    auto hashes = std::make_shared<bcos::crypto::HashList>();
+    for (auto& it : _requests)
+    {
+        try
+        {
+            auto hash = bcos::crypto::HashType(it.second.params[2u].asString());
+            if (ledger)
+            {
+                hashes->push_back(hash);
+                requests->push_back(std::move(it));
+                continue;
+            }
+        }
+        catch (const std::exception&)
+        {}
+        // respond the errors one by one
+        _fallback(it.first);
+    }
+    if (requests->empty())
+    {
+        return;
+    }
+    auto fallbackAll = [requests, _fallback](std::vector<size_t> const& _positions) {
+        for (auto position : _positions)
+        {
+            _fallback((*requests)[position].first);
+        }
+    };
+
+    RPC_IMPL_LOG(TRACE) << LOG_DESC("batchGetTransactionReceipts") << LOG_KV("group", _groupID)
+                        << LOG_KV("node", _nodeName) << LOG_KV("size", hashes->size());
+    ledger->asyncGetBatchReceiptsByHashList(hashes,
+        [ledger, hashes, requests, _onResponse, fallbackAll](
+            Error::Ptr _error, std::vector<protocol::TransactionReceipt::ConstPtr> _receipts) {
+            std::vector<size_t> positions(requests->size());
+            std::iota(positions.begin(), positions.end(), 0);
+            if (_error || _receipts.size() != hashes->size())
+            {
+                RPC_IMPL_LOG(WARNING) << LOG_BADGE("batchGetTransactionReceipts")
+                                      << LOG_KV("errorCode", _error ? _error->errorCode() : 0)
+                                      << LOG_KV("receipts", _receipts.size());
+                fallbackAll(positions);
+                return;
+            }
+            // the missed receipts are queried one by one for the proper errors
+            std::vector<size_t> missed;
+            std::vector<size_t> found;
+            auto foundHashes = std::make_shared<bcos::crypto::HashList>();
+            for (auto position : positions)
+            {
+                if (!_receipts[position])
+                {
+                    missed.push_back(position);
+                    continue;
+                }
+                found.push_back(position);
+                foundHashes->push_back((*hashes)[position]);
+            }
+            fallbackAll(missed);
+            if (found.empty())
+            {
+                return;
+            }
+            auto receipts = std::make_shared<std::vector<protocol::TransactionReceipt::ConstPtr>>(
+                std::move(_receipts));
+            ledger->asyncGetBatchTxsByHashList(foundHashes, false,
+                [requests, receipts, foundHashes, found = std::move(found), _onResponse,
+                    fallbackAll](Error::Ptr _error, bcos::protocol::TransactionsPtr _transactions,
+                    std::shared_ptr<std::map<std::string, ledger::MerkleProofPtr>>) {
+                    if (_error || !_transactions || _transactions->size() != found.size())
+                    {
+                        fallbackAll(found);
+                        return;
+                    }
+                    for (size_t i = 0; i < found.size(); ++i)
+                    {
+                        auto& [index, request] = (*requests)[found[i]];
+                        JsonResponse response;
+                        response.jsonrpc = request.jsonrpc;
+                        response.id = request.id;
+                        toJsonResp(response.result, (*foundHashes)[i].hexPrefixed(),
+                            (*receipts)[found[i]]);
+                        Json::Value jTx;
+                        toJsonResp(jTx, (*_transactions)[i]);
+                        response.result["input"] = jTx["input"];
+                        response.result["from"] = jTx["from"];
+                        response.result["to"] = jTx["to"];
+                        response.result["transactionProof"] = Json::Value();
+                        _onResponse(index, std::move(response));
+                    }
+                });
+        });
 }
 
 void JsonRpcImpl_2_0::toJsonResp(
@@ -564,25 +828,11 @@ void JsonRpcImpl_2_0::sendTransaction(std::string const& _groupID, std::string c
 
             if (_transactionSubmitResult->transactionReceipt())
             {
-                // get transaction receipt
-                auto txHash = _transactionSubmitResult->txHash();
-                auto hexPreTxHash = txHash.hexPrefixed();
-
                 RPC_IMPL_LOG(TRACE)
                     << LOG_BADGE("sendTransaction") << LOG_DESC("getTransactionReceipt")
-                    << LOG_KV("hexPreTxHash", hexPreTxHash)
+                    << LOG_KV("hexPreTxHash", _transactionSubmitResult->txHash().hexPrefixed())
                     << LOG_KV("requireProof", _requireProof);
-                if (_transactionSubmitResult->status() !=
-                    (int32_t)bcos::protocol::TransactionStatus::None)
-                {
-                    std::stringstream errorMsg;
-                    errorMsg << (bcos::protocol::TransactionStatus)(
-                        _transactionSubmitResult->status());
-                    (*jResp)["errorMessage"] = errorMsg.str();
-                }
-                toJsonResp(*jResp, hexPreTxHash, _transactionSubmitResult->transactionReceipt());
-                (*jResp)["to"] = string(_transactionSubmitResult->to());
-                (*jResp)["from"] = toHexStringWithPrefix(_transactionSubmitResult->sender());
+                toJsonResp(*jResp, _transactionSubmitResult);
                 // TODO: notify transactionProof
                 respFunc(nullptr, (*jResp));
             }
@@ -590,6 +840,154 @@ void JsonRpcImpl_2_0::sendTransaction(std::string const& _groupID, std::string c
     txpool->asyncSubmit(transactionDataPtr, submitCallback);
 }
 
+void JsonRpcImpl_2_0::sendTransactions(std::string const& _groupID, std::string const& _nodeName,
+    const Json::Value& _data, bool _requireProof, RespFunc _respFunc, Sender _notifier)
+{
+    if (!_data.isArray() || _data.empty() || _data.size() > c_maxBatchTransactions)
+    {
+        BOOST_THROW_EXCEPTION(JsonRpcException(JsonRpcError::InvalidParams,
+            "The transactions should be a non-empty array of at most " +
+                std::to_string(c_maxBatchTransactions) + " transactions."));
+    }
+    if (_requireProof)
+    {
+        BOOST_THROW_EXCEPTION(JsonRpcException(
+            JsonRpcError::InvalidParams, "sendTransactions does not support requireProof."));
+    }
+    auto nodeService = getNodeService(_groupID, _nodeName, "sendTransactions");
+    auto txpool = nodeService->txpool();
+    checkService(txpool, "txpool");
+
+    // without the notifier the results are responded together in the order of the transactions,
+    // with the notifier every result is pushed once resolved, so a pending transaction holds back
+    // no other receipt
+    struct BatchResults
+    {
+        std::vector<Json::Value> results;
+        std::atomic_size_t remaining;
+        RespFunc respFunc;
+    };
+    auto batch = std::make_shared<BatchResults>();
+    batch->results.resize(_data.size());
+    batch->remaining = _data.size();
+    batch->respFunc = std::move(_respFunc);
+    auto onResult = [batch, _notifier](size_t _index, Error::Ptr _error,
+                        bcos::protocol::TransactionSubmitResult::Ptr _result) {
+        Json::Value notification;
+        auto& jResp = _notifier ? notification : batch->results[_index];
+        if (_error && _error->errorCode() != bcos::protocol::CommonError::SUCCESS)
+        {
+            jResp["error"]["code"] = _error->errorCode();
+            jResp["error"]["message"] = _error->errorMessage();
+            if (_result)
+            {
+                jResp["transactionHash"] = _result->txHash().hexPrefixed();
+            }
+        }
+        else if (_result && _result->transactionReceipt())
+        {
+            toJsonResp(jResp, _result);
+        }
+        else
+        {
+            return;
+        }
+        if (_notifier)
+        {
+            jResp["index"] = (Json::UInt64)_index;
+            _notifier(Json::FastWriter().write(jResp));
+            return;
+        }
+        if (batch->remaining.fetch_sub(1) != 1)
+        {
+            return;
+        }
+        Json::Value results(Json::arrayValue);
+        for (auto& result : batch->results)
+        {
+            results.append(std::move(result));
+        }
+        batch->respFunc(nullptr, results);
+    };
+
+    std::vector<bytesPointer> txsData;
+    std::vector<bcos::protocol::TxSubmitCallback> submitCallbacks;
+    txsData.reserve(_data.size());
+    submitCallbacks.reserve(_data.size());
+    auto txFactory = nodeService->blockFactory()->transactionFactory();
+    for (Json::ArrayIndex i = 0; i < _data.size(); ++i)
+    {
+        auto transactionDataPtr = decodeData(_data[i].asString());
+        try
+        {
+            // Note: the signatures are verified by the txpool
+            auto tx = txFactory->createTransaction(*transactionDataPtr, false);
+            batch->results[i]["input"] = toHexStringWithPrefix(tx->input());
+            if (_notifier)
+            {
+                batch->results[i]["transactionHash"] = tx->hash().hexPrefixed();
+            }
+        }
+        catch (std::exception const& e)
+        {
+            std::stringstream errorMsg;
+            errorMsg << bcos::protocol::TransactionStatus::Malform;
+            auto error = std::make_shared<Error>(
+                (int32_t)bcos::protocol::TransactionStatus::Malform, errorMsg.str());
+            if (_notifier)
+            {
+                batch->results[i]["error"]["code"] = error->errorCode();
+                batch->results[i]["error"]["message"] = error->errorMessage();
+                continue;
+            }
+            onResult(i, std::move(error), nullptr);
+            continue;
+        }
+        txsData.emplace_back(std::move(transactionDataPtr));
+        submitCallbacks.emplace_back(
+            [i, onResult](Error::Ptr _error,
+                bcos::protocol::TransactionSubmitResult::Ptr _transactionSubmitResult) {
+                onResult(i, std::move(_error), std::move(_transactionSubmitResult));
+            });
+    }
+    RPC_IMPL_LOG(TRACE) << LOG_DESC("sendTransactions") << LOG_KV("group", _groupID)
+                        << LOG_KV("node", _nodeName) << LOG_KV("txs", txsData.size())
+                        << LOG_KV("notify", _notifier != nullptr);
+    // the response of the notified request lists the hashes of the submitted transactions, and
+    // the errors of the malformed ones
+    Json::Value submitted(Json::arrayValue);
+    if (_notifier)
+    {
+        for (auto& result : batch->results)
+        {
+            submitted.append(std::move(result));
+        }
+    }
+    if (!txsData.empty())
+    {
+        txpool->asyncSubmitBatch(std::move(txsData), std::move(submitCallbacks));
+    }
+    if (_notifier)
+    {
+        batch->respFunc(nullptr, submitted);
+    }
+}
+
+void JsonRpcImpl_2_0::toJsonResp(
+    Json::Value& jResp, bcos::protocol::TransactionSubmitResult::Ptr _transactionSubmitResult)
+{
+    if (_transactionSubmitResult->status() != (int32_t)bcos::protocol::TransactionStatus::None)
+    {
+        std::stringstream errorMsg;
+        errorMsg << (bcos::protocol::TransactionStatus)(_transactionSubmitResult->status());
+        jResp["errorMessage"] = errorMsg.str();
+    }
+    toJsonResp(jResp, _transactionSubmitResult->txHash().hexPrefixed(),
+        _transactionSubmitResult->transactionReceipt());
+    jResp["to"] = string(_transactionSubmitResult->to());
+    jResp["from"] = toHexStringWithPrefix(_transactionSubmitResult->sender());
+}
+
 
 void JsonRpcImpl_2_0::addProofToResponse(
     Json::Value& jResp, std::string const& _key, ledger::MerkleProofPtr _merkleProofPtr)
@@ -866,6 +1264,170 @@ void JsonRpcImpl_2_0::getBlockNumber(
     });
 }
 
+void JsonRpcImpl_2_0::getLogs(std::string const& _groupID, std::string const& _nodeName,
+    const Json::Value& _filter, RespFunc _respFunc)
+{
+    RPC_IMPL_LOG(TRACE) << LOG_BADGE("getLogs") << LOG_KV("group", _groupID)
+                        << LOG_KV("node", _nodeName);
+
+    if (!_filter.isObject())
+    {
+        BOOST_THROW_EXCEPTION(
+            JsonRpcException(JsonRpcError::InvalidParams, "The filter should be an object."));
+    }
+    event::EventSubParams::ConstPtr params = event::EventSubRequest::parseParams(_filter);
+    auto const& topics = params->topics();
+    auto noTopic = std::all_of(
+        topics.begin(), topics.end(), [](auto const& _topic) { return _topic.empty(); });
+    if (params->addresses().empty() && noTopic)
+    {
+        // without any address or topic all the logs match, which the index does not help
+        BOOST_THROW_EXCEPTION(JsonRpcException(JsonRpcError::InvalidParams,
+            "The filter should contain at least one address or topic."));
+    }
+
+    auto nodeService = getNodeService(_groupID, _nodeName, "getLogs");
+    auto ledger = nodeService->ledger();
+    checkService(ledger, "ledger");
+    ledger->asyncGetBlockNumber([ledger, params, _respFunc](
+                                    Error::Ptr _error, protocol::BlockNumber _blockNumber) {
+        Json::Value jResp(Json::arrayValue);
+        if (_error && (_error->errorCode() != bcos::protocol::CommonError::SUCCESS))
+        {
+            RPC_IMPL_LOG(ERROR) << LOG_BADGE("getLogs") << LOG_DESC("asyncGetBlockNumber failed")
+                                << LOG_KV("errorCode", _error->errorCode())
+                                << LOG_KV("errorMessage", _error->errorMessage());
+            _respFunc(_error, jResp);
+            return;
+        }
+        // the range defaults to the latest block
+        auto toBlock =
+            params->toBlock() >= 0 ? std::min(params->toBlock(), _blockNumber) : _blockNumber;
+        auto fromBlock = params->fromBlock() >= 0 ? params->fromBlock() : toBlock;
+        if (fromBlock > toBlock || toBlock - fromBlock >= c_maxLogsBlockRange)
+        {
+            _respFunc(std::make_shared<Error>(JsonRpcError::InvalidParams,
+                          "Invalid block range [" + std::to_string(fromBlock) + ", " +
+                              std::to_string(toBlock) + "], at most " +
+                              std::to_string(c_maxLogsBlockRange) + " blocks are searched."),
+                jResp);
+            return;
+        }
+
+        ledger->asyncGetLogLocations(fromBlock, toBlock, params->addresses(), params->topics(),
+            [ledger, params, fromBlock, toBlock, _respFunc](
+                Error::Ptr _error, std::vector<ledger::LogLocation> _locations) {
+                std::vector<int64_t> blocks;
+                if (_error && (_error->errorCode() != bcos::protocol::CommonError::SUCCESS))
+                {
+                    // the blocks are not indexed, scan them if the range is small
+                    RPC_IMPL_LOG(DEBUG) << LOG_BADGE("getLogs")
+                                        << LOG_DESC("asyncGetLogLocations failed")
+                                        << LOG_KV("fromBlock", fromBlock)
+                                        << LOG_KV("toBlock", toBlock)
+                                        << LOG_KV("errorCode", _error->errorCode())
+                                        << LOG_KV("errorMessage", _error->errorMessage());
+                    if (toBlock - fromBlock >= c_maxLogsScanBlocks)
+                    {
+                        Json::Value jResp(Json::arrayValue);
+                        _respFunc(std::make_shared<Error>(JsonRpcError::InvalidParams,
+                                      "The blocks are not indexed, at most " +
+                                          std::to_string(c_maxLogsScanBlocks) +
+                                          " blocks are searched."),
+                            jResp);
+                        return;
+                    }
+                    blocks.resize(toBlock - fromBlock + 1);
+                    std::iota(blocks.begin(), blocks.end(), fromBlock);
+                }
+                else
+                {
+                    if (_locations.size() > c_maxLogs)
+                    {
+                        Json::Value jResp(Json::arrayValue);
+                        _respFunc(std::make_shared<Error>(JsonRpcError::InvalidParams,
+                                      "More than " + std::to_string(c_maxLogs) +
+                                          " logs are matched, please narrow the block range."),
+                            jResp);
+                        return;
+                    }
+                    for (auto const& location : _locations)
+                    {
+                        if (blocks.empty() || blocks.back() != location.blockNumber)
+                        {
+                            blocks.push_back(location.blockNumber);
+                        }
+                    }
+                }
+                getLogsOfBlocks(ledger, params, std::move(blocks), _respFunc);
+            });
+    });
+}
+
+void JsonRpcImpl_2_0::getLogsOfBlocks(bcos::ledger::LedgerInterface::Ptr _ledger,
+    event::EventSubParams::ConstPtr _params, std::vector<int64_t> _blocks, RespFunc _respFunc)
+{
+    if (_blocks.empty())
+    {
+        Json::Value jResp(Json::arrayValue);
+        _respFunc(nullptr, jResp);
+        return;
+    }
+
+    // the blocks are fetched concurrently and the logs are responded in the order of the blocks
+    struct BlockLogs
+    {
+        std::vector<Json::Value> logs;
+        std::atomic<size_t> pending;
+        std::atomic<bool> failed = {false};
+        RespFunc respFunc;
+    };
+    auto blockLogs = std::make_shared<BlockLogs>();
+    blockLogs->logs.resize(_blocks.size());
+    blockLogs->pending = _blocks.size();
+    blockLogs->respFunc = std::move(_respFunc);
+
+    for (size_t i = 0; i < _blocks.size(); ++i)
+    {
+        auto blockNumber = _blocks[i];
+        _ledger->asyncGetBlockDataByNumber(blockNumber,
+            bcos::ledger::RECEIPTS | bcos::ledger::TRANSACTIONS,
+            [blockLogs, _params, blockNumber, i](Error::Ptr _error, protocol::Block::Ptr _block) {
+                if (_error && (_error->errorCode() != bcos::protocol::CommonError::SUCCESS))
+                {
+                    RPC_IMPL_LOG(ERROR) << LOG_BADGE("getLogs")
+                                        << LOG_DESC("asyncGetBlockDataByNumber failed")
+                                        << LOG_KV("blockNumber", blockNumber)
+                                        << LOG_KV("errorCode", _error->errorCode())
+                                        << LOG_KV("errorMessage", _error->errorMessage());
+                    if (!blockLogs->failed.exchange(true))
+                    {
+                        Json::Value jResp(Json::arrayValue);
+                        blockLogs->respFunc(_error, jResp);
+                    }
+                    return;
+                }
+
+                Json::Value logs(Json::arrayValue);
+                event::EventSubMatcher().matches(_params, _block, logs);
+                blockLogs->logs[i] = std::move(logs);
+                if (--blockLogs->pending > 0 || blockLogs->failed)
+                {
+                    return;
+                }
+                Json::Value jResp(Json::arrayValue);
+                for (auto const& logs : blockLogs->logs)
+                {
+                    for (auto const& log : logs)
+                    {
+                        jResp.append(log);
+                    }
+                }
+                blockLogs->respFunc(nullptr, jResp);
+            });
+    }
+}
+
 void JsonRpcImpl_2_0::getCode(std::string const& _groupID, std::string const& _nodeName,
     const std::string _contractAddress, RespFunc _callback)
 {
@@ -1261,6 +1823,35 @@ void JsonRpcImpl_2_0::getGroupBlockNumber(RespFunc _respFunc)
     _respFunc(nullptr, response);
 }
 
+void JsonRpcImpl_2_0::getMetrics(RespFunc _respFunc)
+{
+    Json::Value histograms(Json::objectValue);
+    for (auto const& it : metrics::MetricsRegistry::instance().histograms())
+    {
+        auto const& histogram = *it.second;
+        Json::Value item;
+        item["unit"] = "us";
+        item["count"] = (Json::UInt64)histogram.count();
+        item["mean"] =
+            (Json::UInt64)(histogram.count() == 0 ? 0 : histogram.sum() / histogram.count());
+        item["max"] = (Json::UInt64)histogram.max();
+        item["p50"] = (Json::UInt64)histogram.percentile(50);
+        item["p90"] = (Json::UInt64)histogram.percentile(90);
+        item["p99"] = (Json::UInt64)histogram.percentile(99);
+        item["p999"] = (Json::UInt64)histogram.percentile(99.9);
+        histograms[it.first] = item;
+    }
+    Json::Value counters(Json::objectValue);
+    for (auto const& it : metrics::MetricsRegistry::instance().counters())
+    {
+        counters[it.first] = (Json::UInt64)it.second->value();
+    }
+    Json::Value response;
+    response["histograms"] = histograms;
+    response["counters"] = counters;
+    _respFunc(nullptr, response);
+}
+
 // get the information of a given node
 void JsonRpcImpl_2_0::getGroupNodeInfo(
     std::string const& _groupID, std::string const& _nodeName, RespFunc _respFunc)
@@ -22,6 +22,8 @@
 #pragma once
 #include "groupmgr/GroupManager.h"
 #include <bcos-framework/interfaces/gateway/GatewayInterface.h>
+#include <bcos-framework/interfaces/protocol/TransactionSubmitResult.h>
+#include <bcos-rpc/event/EventSubParams.h>
 #include <bcos-rpc/jsonrpc/JsonRpcInterface.h>
 #include <json/json.h>
 #include <tbb/concurrent_hash_map.h>
@@ -51,6 +53,7 @@ public:
 public:
     static std::shared_ptr<bcos::bytes> decodeData(const std::string& _data);
     static void parseRpcRequestJson(const std::string& _requestBody, JsonRequest& _jsonRequest);
+    static void parseRpcRequestJson(const Json::Value& _root, JsonRequest& _jsonRequest);
     static void parseRpcResponseJson(const std::string& _responseBody, JsonResponse& _jsonResponse);
     static Json::Value toJsonResponse(const JsonResponse& _jsonResponse);
     static std::string toStringResponse(const JsonResponse& _jsonResponse);
@@ -62,10 +65,17 @@ public:
         Json::Value& jResp, bcos::protocol::Block::Ptr _blockPtr, bool _onlyTxHash);
     static void toJsonResp(Json::Value& jResp, const std::string& _txHash,
         bcos::protocol::TransactionReceipt::ConstPtr _transactionReceiptPtr);
+    static void toJsonResp(
+        Json::Value& jResp, bcos::protocol::TransactionSubmitResult::Ptr _transactionSubmitResult);
     static void addProofToResponse(
         Json::Value& jResp, std::string const& _key, ledger::MerkleProofPtr _merkleProofPtr);
 
-    void onRPCRequest(const std::string& _requestBody, Sender _sender) override;
+    void onRPCRequest(const std::string& _requestBody, Sender _sender) override
+    {
+        onWsRPCRequest(_requestBody, std::move(_sender), nullptr);
+    }
+    void onWsRPCRequest(
+        const std::string& _requestBody, Sender _sender, Sender _notifier) override;
 
 public:
     void call(std::string const& _groupID, std::string const& _nodeName, const std::string& _to,
@@ -74,6 +84,10 @@ public:
     void sendTransaction(std::string const& _groupID, std::string const& _nodeName,
         const std::string& _data, bool _requireProof, RespFunc _respFunc) override;
 
+    void sendTransactions(std::string const& _groupID, std::string const& _nodeName,
+        const Json::Value& _data, bool _requireProof, RespFunc _respFunc,
+        Sender _notifier = nullptr) override;
+
     void getTransaction(std::string const& _groupID, std::string const& _nodeName,
         const std::string& _txHash, bool _requireProof, RespFunc _respFunc) override;
 
@@ -93,6 +107,9 @@ public:
     void getBlockNumber(
         std::string const& _groupID, std::string const& _nodeName, RespFunc _respFunc) override;
 
+    void getLogs(std::string const& _groupID, std::string const& _nodeName,
+        const Json::Value& _filter, RespFunc _respFunc) override;
+
     void getCode(std::string const& _groupID, std::string const& _nodeName,
         const std::string _contractAddress, RespFunc _respFunc) override;
 
@@ -136,6 +153,7 @@ public:
         std::string const& _groupID, std::string const& _nodeName, RespFunc _respFunc) override;
 
     void getGroupBlockNumber(RespFunc _respFunc) override;
+    void getMetrics(RespFunc _respFunc) override;
 
 public:
     void callI(const Json::Value& req, RespFunc _respFunc)
@@ -150,6 +168,17 @@ public:
             req[3u].asBool(), _respFunc);
     }
 
+    void sendTransactionsI(const Json::Value& req, RespFunc _respFunc)
+    {
+        sendTransactions(
+            req[0u].asString(), req[1u].asString(), req[2u], req[3u].asBool(), _respFunc);
+    }
+    void notifySendTransactionsI(const Json::Value& req, RespFunc _respFunc, Sender _notifier)
+    {
+        sendTransactions(req[0u].asString(), req[1u].asString(), req[2u], req[3u].asBool(),
+            _respFunc, std::move(_notifier));
+    }
+
     void getTransactionI(const Json::Value& req, RespFunc _respFunc)
     {
         getTransaction(req[0u].asString(), req[1u].asString(), req[2u].asString(), req[3u].asBool(),
@@ -187,6 +216,11 @@ public:
         getBlockNumber(req[0u].asString(), req[1u].asString(), _respFunc);
     }
 
+    void getLogsI(const Json::Value& req, RespFunc _respFunc)
+    {
+        getLogs(req[0u].asString(), req[1u].asString(), req[2u], _respFunc);
+    }
+
     void getCodeI(const Json::Value& req, RespFunc _respFunc)
     {
         getCode(req[0u].asString(), req[1u].asString(), req[2u].asString(), _respFunc);
@@ -277,6 +311,11 @@ public:
     {
         getGroupNodeInfo(_req[0u].asString(), _req[1u].asString(), _respFunc);
     }
+    void getMetricsI(const Json::Value& _req, RespFunc _respFunc)
+    {
+        (void)_req;
+        getMetrics(_respFunc);
+    }
 
 public:
     const std::unordered_map<std::string, std::function<void(Json::Value, RespFunc _respFunc)>>&
@@ -315,9 +354,43 @@ private:
         bcos::gateway::GatewayInfo::Ptr _localP2pInfo, bcos::gateway::GatewayInfosPtr _peersInfo);
     void getGroupPeers(std::string const& _groupID, RespFunc _respFunc) override;
 
+    // parse and dispatch one request, _request is the request body or the parsed request object
+    // the method of m_notifyMethodToFunc is preferred if _notifier is set
+    template <class Request>
+    void handleRpcRequest(Request const& _request,
+        std::function<void(JsonResponse&&)> _onResponse, Sender _notifier = nullptr);
+    // the requests of the batch are dispatched together and the responses are sent in one array
+    // after all of them are responded
+    void onRPCBatchRequest(const Json::Value& _requests, Sender _sender);
+    // the receipts of the getTransactionReceipt requests without proof are queried in one batch,
+    // the requests failed in the batch are handled one by one by _fallback
+    void batchGetTransactionReceipts(std::string const& _groupID, std::string const& _nodeName,
+        std::vector<std::pair<size_t, JsonRequest>> _requests,
+        std::function<void(size_t, JsonResponse&&)> _onResponse,
+        std::function<void(size_t)> _fallback);
+    // respond the logs of _blocks matching _params in the order of the blocks
+    static void getLogsOfBlocks(bcos::ledger::LedgerInterface::Ptr _ledger,
+        std::shared_ptr<const event::EventSubParams> _params, std::vector<int64_t> _blocks,
+        RespFunc _respFunc);
+
 private:
+    // the max requests of one batch request
+    constexpr static size_t c_maxBatchRequests = 1000;
+    // the max transactions of one sendTransactions request
+    constexpr static size_t c_maxBatchTransactions = 10000;
+    // the max blocks searched by one getLogs request
+    constexpr static int64_t c_maxLogsBlockRange = 1000000;
+    // the max blocks scanned by getLogs when the blocks are not indexed
+    constexpr static int64_t c_maxLogsScanBlocks = 1000;
+    // the max logs responded by one getLogs request
+    constexpr static size_t c_maxLogs = 10000;
+
     std::unordered_map<std::string, std::function<void(Json::Value, RespFunc _respFunc)>>
         m_methodToFunc;
+    // the methods pushing notifications to the ws session of the request
+    std::unordered_map<std::string,
+        std::function<void(Json::Value, RespFunc _respFunc, Sender _notifier)>>
+        m_notifyMethodToFunc;
 
     GroupManager::Ptr m_groupManager;
     bcos::gateway::GatewayInterface::Ptr m_gatewayInterface;
@@ -43,6 +43,10 @@ public:
 
 public:
     virtual void onRPCRequest(const std::string& _requestBody, Sender _sender) = 0;
+    // the request of a ws session, _notifier pushes the notifications of the request, such as the
+    // receipts of sendTransactions, to the session
+    virtual void onWsRPCRequest(
+        const std::string& _requestBody, Sender _sender, Sender _notifier) = 0;
 
 public:
     virtual void call(std::string const& _groupID, std::string const& _nodeName,
@@ -51,6 +55,12 @@ public:
     virtual void sendTransaction(std::string const& _groupID, std::string const& _nodeName,
         const std::string& _data, bool _requireProof, RespFunc _respFunc) = 0;
 
+    // submit the transactions of _data in one batch, respond with the results in the same order,
+    // or if _notifier is set, respond with the hashes and push every result once resolved
+    virtual void sendTransactions(std::string const& _groupID, std::string const& _nodeName,
+        const Json::Value& _data, bool _requireProof, RespFunc _respFunc,
+        Sender _notifier = nullptr) = 0;
+
     virtual void getTransaction(std::string const& _groupID, std::string const& _nodeName,
         const std::string& _txHash, bool _requireProof, RespFunc _respFunc) = 0;
 
@@ -69,6 +79,11 @@ public:
     virtual void getBlockNumber(
         std::string const& _groupID, std::string const& _nodeName, RespFunc _respFunc) = 0;
 
+    // the logs of the blocks in [fromBlock, toBlock] matching the addresses and the topics of
+    // _filter, in the same format as the event subscription
+    virtual void getLogs(std::string const& _groupID, std::string const& _nodeName,
+        const Json::Value& _filter, RespFunc _respFunc) = 0;
+
     virtual void getCode(std::string const& _groupID, std::string const& _nodeName,
         const std::string _contractAddress, RespFunc _respFunc) = 0;
 
@@ -111,6 +126,8 @@ public:
         std::string const& _groupID, std::string const& _nodeName, RespFunc _respFunc) = 0;
 
     virtual void getGroupBlockNumber(RespFunc _respFunc) = 0;
+    // get the block lifecycle latencies and counters of the rpc process
+    virtual void getMetrics(RespFunc _respFunc) = 0;
 };
 
 }  // namespace rpc
@@ -0,0 +1,207 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief test for the JSON-RPC batch requests
+ * @file BatchRequestTest.cpp
+ */
+#include "JsonRpcFixture.h"
+#include <boost/test/unit_test.hpp>
+
+using namespace bcos;
+using namespace bcos::rpc;
+namespace bcos
+{
+namespace test
+{
+inline Json::Value rpcRequest(int64_t _id, std::string const& _method, Json::Value _params)
+{
+    Json::Value request;
+    request["jsonrpc"] = "2.0";
+    request["id"] = (Json::Int64)_id;
+    request["method"] = _method;
+    request["params"] = std::move(_params);
+    return request;
+}
+
+inline Json::Value receiptRequest(
+    int64_t _id, bcos::crypto::HashType const& _txHash, bool _requireProof = false)
+{
+    Json::Value params(Json::arrayValue);
+    params.append("group0");
+    params.append("");
+    params.append(_txHash.hexPrefixed());
+    params.append(_requireProof);
+    return rpcRequest(_id, "getTransactionReceipt", std::move(params));
+}
+
+// the max requests of one batch request accepted by the rpc
+constexpr static size_t c_maxBatchRequests = 1000;
+
+class BatchRequestFixture : public JsonRpcFixture
+{
+public:
+    BatchRequestFixture()
+    {
+        ledger = std::make_shared<MockLedger>();
+        setNodeService(ledger);
+    }
+
+    Json::Value batchRequest(Json::Value const& _requests)
+    {
+        return request(Json::FastWriter().write(_requests), nullptr);
+    }
+
+    MockLedger::Ptr ledger;
+};
+
+BOOST_FIXTURE_TEST_SUITE(BatchRequestTest, BatchRequestFixture)
+BOOST_AUTO_TEST_CASE(parseBatch)
+{
+    auto tx = fakeReceipt(*ledger, 1);
+    Json::Value requests(Json::arrayValue);
+    requests.append(receiptRequest(1, tx->hash()));
+    // not a request object
+    requests.append(1);
+    requests.append(rpcRequest(3, "noSuchMethod", Json::Value(Json::arrayValue)));
+    auto response = batchRequest(requests);
+
+    // every entry responds in its own slot
+    BOOST_CHECK(response.isArray());
+    BOOST_CHECK_EQUAL(response.size(), 3);
+    BOOST_CHECK_EQUAL(response[0]["id"].asInt64(), 1);
+    BOOST_CHECK_EQUAL(
+        response[0]["result"]["transactionHash"].asString(), tx->hash().hexPrefixed());
+    BOOST_CHECK(response[1].isMember("error"));
+    BOOST_CHECK_EQUAL(response[2]["id"].asInt64(), 3);
+    BOOST_CHECK_EQUAL(response[2]["error"]["code"].asInt(), (int)JsonRpcError::MethodNotFound);
+
+    // a single request still responds with an object
+    auto single = request(Json::FastWriter().write(receiptRequest(4, tx->hash())), nullptr);
+    BOOST_CHECK(single.isObject());
+    BOOST_CHECK_EQUAL(single["result"]["transactionHash"].asString(), tx->hash().hexPrefixed());
+}
+
+BOOST_AUTO_TEST_CASE(sizeLimit)
+{
+    // the empty batch is rejected with one error
+    auto response = batchRequest(Json::Value(Json::arrayValue));
+    BOOST_CHECK(response.isObject());
+    BOOST_CHECK_EQUAL(response["error"]["code"].asInt(), (int)JsonRpcError::InvalidRequest);
+
+    Json::Value requests(Json::arrayValue);
+    for (int64_t i = 0; i < (int64_t)c_maxBatchRequests; ++i)
+    {
+        requests.append(rpcRequest(i, "noSuchMethod", Json::Value(Json::arrayValue)));
+    }
+    response = batchRequest(requests);
+    BOOST_CHECK(response.isArray());
+    BOOST_CHECK_EQUAL(response.size(), c_maxBatchRequests);
+
+    // one more request than the limit rejects the whole batch
+    requests.append(rpcRequest(c_maxBatchRequests, "noSuchMethod", Json::Value(Json::arrayValue)));
+    response = batchRequest(requests);
+    BOOST_CHECK(response.isObject());
+    BOOST_CHECK_EQUAL(response["error"]["code"].asInt(), (int)JsonRpcError::InvalidRequest);
+}
+
+BOOST_AUTO_TEST_CASE(coalesceReceipts)
+{
+    std::vector<bcos::protocol::Transaction::Ptr> txs;
+    Json::Value requests(Json::arrayValue);
+    for (int64_t i = 0; i < 10; ++i)
+    {
+        txs.emplace_back(fakeReceipt(*ledger, i + 1));
+        requests.append(receiptRequest(i, txs.back()->hash()));
+    }
+    auto response = batchRequest(requests);
+    BOOST_CHECK_EQUAL(response.size(), 10);
+    for (Json::ArrayIndex i = 0; i < response.size(); ++i)
+    {
+        BOOST_CHECK_EQUAL(
+            response[i]["result"]["transactionHash"].asString(), txs[i]->hash().hexPrefixed());
+        BOOST_CHECK_EQUAL(
+            response[i]["result"]["from"].asString(), toHexStringWithPrefix(txs[i]->sender()));
+    }
+    // the receipts and the transactions are each read with one query
+    BOOST_CHECK_EQUAL(ledger->getBatchReceiptsCalls, 1);
+    BOOST_CHECK_EQUAL(ledger->getTxsCalls, 1);
+    BOOST_CHECK_EQUAL(ledger->getReceiptCalls, 0);
+}
+
+BOOST_AUTO_TEST_CASE(fallbackReceipts)
+{
+    auto tx1 = fakeReceipt(*ledger, 1);
+    auto tx2 = fakeReceipt(*ledger, 2);
+    auto missing = fakeTransaction(3);
+    Json::Value requests(Json::arrayValue);
+    requests.append(receiptRequest(1, tx1->hash()));
+    requests.append(receiptRequest(2, missing->hash()));
+    // the receipt with proof is queried alone
+    requests.append(receiptRequest(3, tx2->hash(), true));
+    requests.append(receiptRequest(4, tx2->hash()));
+    auto response = batchRequest(requests);
+
+    BOOST_CHECK_EQUAL(response.size(), 4);
+    BOOST_CHECK_EQUAL(
+        response[0]["result"]["transactionHash"].asString(), tx1->hash().hexPrefixed());
+    // the missed receipt responds the error of the single query
+    BOOST_CHECK_EQUAL(response[1]["id"].asInt64(), 2);
+    BOOST_CHECK_EQUAL(response[1]["error"]["message"].asString(), "receipt not found");
+    BOOST_CHECK_EQUAL(
+        response[2]["result"]["transactionHash"].asString(), tx2->hash().hexPrefixed());
+    BOOST_CHECK_EQUAL(
+        response[3]["result"]["transactionHash"].asString(), tx2->hash().hexPrefixed());
+
+    // one batch query for the three receipts without proof, the missed one and the one with
+    // proof are queried alone
+    BOOST_CHECK_EQUAL(ledger->getBatchReceiptsCalls, 1);
+    BOOST_CHECK_EQUAL(ledger->getReceiptCalls, 2);
+}
+
+BOOST_AUTO_TEST_CASE(responseOrder)
+{
+    // the receipts of the coalesced group respond after the requests handled alone, the
+    // responses still follow the order of the requests
+    std::vector<bcos::protocol::Transaction::Ptr> txs;
+    Json::Value requests(Json::arrayValue);
+    for (int64_t i = 0; i < 6; ++i)
+    {
+        if (i % 2)
+        {
+            requests.append(rpcRequest(i, "noSuchMethod", Json::Value(Json::arrayValue)));
+            continue;
+        }
+        txs.emplace_back(fakeReceipt(*ledger, i + 1));
+        requests.append(receiptRequest(i, txs.back()->hash()));
+    }
+    auto response = batchRequest(requests);
+
+    BOOST_CHECK_EQUAL(response.size(), 6);
+    for (Json::ArrayIndex i = 0; i < response.size(); ++i)
+    {
+        BOOST_CHECK_EQUAL(response[i]["id"].asInt64(), (int64_t)i);
+        if (i % 2)
+        {
+            BOOST_CHECK(response[i].isMember("error"));
+            continue;
+        }
+        BOOST_CHECK_EQUAL(response[i]["result"]["transactionHash"].asString(),
+            txs[i / 2]->hash().hexPrefixed());
+    }
+    BOOST_CHECK_EQUAL(ledger->getBatchReceiptsCalls, 1);
+}
+BOOST_AUTO_TEST_SUITE_END()
+}  // namespace test
+}  // namespace bcos
@@ -0,0 +1,191 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief fixture for the JsonRpcImpl_2_0 tests
+ * @file JsonRpcFixture.h
+ */
+#pragma once
+#include <bcos-crypto/hash/Keccak256.h>
+#include <bcos-crypto/interfaces/crypto/CryptoSuite.h>
+#include <bcos-crypto/signature/secp256k1/Secp256k1Crypto.h>
+#include <bcos-framework/testutils/faker/FakeLedger.h>
+#include <bcos-framework/testutils/faker/FakeTxPool.h>
+#include <bcos-protocol/LogEntry.h>
+#include <bcos-rpc/jsonrpc/JsonRpcImpl_2_0.h>
+#include <bcos-rpc/jsonrpc/groupmgr/GroupManager.h>
+#include <bcos-tars-protocol/protocol/BlockFactoryImpl.h>
+#include <bcos-tars-protocol/protocol/BlockHeaderFactoryImpl.h>
+#include <bcos-tars-protocol/protocol/TransactionFactoryImpl.h>
+#include <bcos-tars-protocol/protocol/TransactionReceiptFactoryImpl.h>
+#include <bcos-utilities/testutils/TestPromptFixture.h>
+#include <json/json.h>
+
+namespace bcos
+{
+namespace test
+{
+class MockTxPool : public FakeTxPool
+{
+public:
+    using Ptr = std::shared_ptr<MockTxPool>;
+    void asyncSubmit(bytesPointer _tx, bcos::protocol::TxSubmitCallback _callback) override
+    {
+        submitted.emplace_back(std::move(_tx), std::move(_callback));
+    }
+
+    std::vector<std::pair<bytesPointer, bcos::protocol::TxSubmitCallback>> submitted;
+};
+
+// serve the transactions and receipts put in, and count the ledger queries
+class MockLedger : public FakeLedger
+{
+public:
+    using Ptr = std::shared_ptr<MockLedger>;
+
+    void asyncGetBatchTxsByHashList(bcos::crypto::HashListPtr _txHashList, bool,
+        std::function<void(Error::Ptr, bcos::protocol::TransactionsPtr,
+            std::shared_ptr<std::map<std::string, bcos::ledger::MerkleProofPtr>>)>
+            _onGetTx) override
+    {
+        ++getTxsCalls;
+        auto txs = std::make_shared<bcos::protocol::Transactions>();
+        for (auto const& hash : *_txHashList)
+        {
+            auto it = transactions.find(hash);
+            if (it != transactions.end())
+            {
+                txs->emplace_back(it->second);
+            }
+        }
+        _onGetTx(nullptr, txs, nullptr);
+    }
+
+    void asyncGetTransactionReceiptByHash(bcos::crypto::HashType const& _txHash, bool,
+        std::function<void(Error::Ptr, bcos::protocol::TransactionReceipt::ConstPtr,
+            bcos::ledger::MerkleProofPtr)>
+            _onGetReceipt) override
+    {
+        ++getReceiptCalls;
+        auto it = receipts.find(_txHash);
+        if (it == receipts.end())
+        {
+            _onGetReceipt(std::make_shared<Error>(-1, "receipt not found"), nullptr, nullptr);
+            return;
+        }
+        _onGetReceipt(nullptr, it->second, nullptr);
+    }
+
+    void asyncGetBatchReceiptsByHashList(bcos::crypto::HashListPtr _txHashList,
+        std::function<void(Error::Ptr, std::vector<bcos::protocol::TransactionReceipt::ConstPtr>)>
+            _onGetReceipts) override
+    {
+        ++getBatchReceiptsCalls;
+        std::vector<bcos::protocol::TransactionReceipt::ConstPtr> result;
+        for (auto const& hash : *_txHashList)
+        {
+            auto it = receipts.find(hash);
+            result.emplace_back(it != receipts.end() ? it->second : nullptr);
+        }
+        _onGetReceipts(nullptr, std::move(result));
+    }
+
+    std::map<bcos::crypto::HashType, bcos::protocol::Transaction::Ptr> transactions;
+    std::map<bcos::crypto::HashType, bcos::protocol::TransactionReceipt::ConstPtr> receipts;
+    size_t getTxsCalls = 0;
+    size_t getReceiptCalls = 0;
+    size_t getBatchReceiptsCalls = 0;
+};
+
+class MockGroupManager : public bcos::rpc::GroupManager
+{
+public:
+    using Ptr = std::shared_ptr<MockGroupManager>;
+    MockGroupManager() : GroupManager("chain0", nullptr) {}
+
+    bcos::rpc::NodeService::Ptr getNodeService(
+        std::string const&, std::string const&) const override
+    {
+        return nodeService;
+    }
+
+    bcos::rpc::NodeService::Ptr nodeService;
+};
+
+class JsonRpcFixture : public TestPromptFixture
+{
+public:
+    JsonRpcFixture()
+    {
+        auto cryptoSuite = std::make_shared<bcos::crypto::CryptoSuite>(
+            std::make_shared<bcos::crypto::Keccak256>(),
+            std::make_shared<bcos::crypto::Secp256k1Crypto>(), nullptr);
+        keyPair = cryptoSuite->signatureImpl()->generateKeyPair();
+        auto transactionFactory =
+            std::make_shared<bcostars::protocol::TransactionFactoryImpl>(cryptoSuite);
+        blockFactory = std::make_shared<bcostars::protocol::BlockFactoryImpl>(cryptoSuite,
+            std::make_shared<bcostars::protocol::BlockHeaderFactoryImpl>(cryptoSuite),
+            transactionFactory,
+            std::make_shared<bcostars::protocol::TransactionReceiptFactoryImpl>(cryptoSuite));
+        txpool = std::make_shared<MockTxPool>();
+        groupManager = std::make_shared<MockGroupManager>();
+        jsonRpc = std::make_shared<bcos::rpc::JsonRpcImpl_2_0>(groupManager, nullptr);
+    }
+
+    void setNodeService(bcos::ledger::LedgerInterface::Ptr _ledger)
+    {
+        groupManager->nodeService = std::make_shared<bcos::rpc::NodeService>(
+            _ledger, nullptr, txpool, nullptr, nullptr, blockFactory);
+    }
+
+    bcos::protocol::Transaction::Ptr fakeTransaction(int64_t _nonce)
+    {
+        return blockFactory->transactionFactory()->createTransaction(0, "", bytes{0x01, 0x02},
+            u256(_nonce), 100, "chain0", "group0", utcTime(), keyPair);
+    }
+
+    // put a transaction and its receipt into the ledger
+    bcos::protocol::Transaction::Ptr fakeReceipt(MockLedger& _ledger, int64_t _nonce)
+    {
+        auto tx = fakeTransaction(_nonce);
+        _ledger.transactions[tx->hash()] = tx;
+        _ledger.receipts[tx->hash()] = blockFactory->receiptFactory()->createReceipt(u256(_nonce),
+            "", std::make_shared<std::vector<bcos::protocol::LogEntry>>(), 0, bytes(), 1);
+        return tx;
+    }
+
+    // send the request and collect the response and the notifications
+    Json::Value request(std::string const& _request, std::vector<Json::Value>* _notifications)
+    {
+        Json::Value response;
+        auto notifier = [_notifications](std::string const& _data) {
+            Json::Value notification;
+            Json::Reader().parse(_data, notification);
+            _notifications->emplace_back(std::move(notification));
+        };
+        jsonRpc->onWsRPCRequest(
+            _request,
+            [&response](std::string const& _data) { Json::Reader().parse(_data, response); },
+            _notifications ? bcos::rpc::Sender(notifier) : nullptr);
+        return response;
+    }
+
+    bcos::crypto::KeyPairInterface::Ptr keyPair;
+    bcos::protocol::BlockFactory::Ptr blockFactory;
+    MockTxPool::Ptr txpool;
+    MockGroupManager::Ptr groupManager;
+    bcos::rpc::JsonRpcImpl_2_0::Ptr jsonRpc;
+};
+}  // namespace test
+}  // namespace bcos
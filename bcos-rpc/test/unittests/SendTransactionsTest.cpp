@@ -0,0 +1,104 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief test for the sendTransactions request
+ * @file SendTransactionsTest.cpp
+ */
+#include "JsonRpcFixture.h"
+#include <boost/test/unit_test.hpp>
+
+using namespace bcos;
+using namespace bcos::rpc;
+namespace bcos
+{
+namespace test
+{
+inline std::string sendTransactionsRequest(
+    std::vector<bcos::protocol::Transaction::Ptr> const& _txs, bool _requireProof)
+{
+    Json::Value request;
+    request["jsonrpc"] = "2.0";
+    request["id"] = 1;
+    request["method"] = "sendTransactions";
+    request["params"].append("group0");
+    request["params"].append("");
+    Json::Value txs(Json::arrayValue);
+    for (auto const& tx : _txs)
+    {
+        txs.append(toHexStringWithPrefix(tx->encode()));
+    }
+    // a malformed transaction
+    txs.append("0x01");
+    request["params"].append(txs);
+    request["params"].append(_requireProof);
+    return Json::FastWriter().write(request);
+}
+
+BOOST_FIXTURE_TEST_SUITE(SendTransactionsTest, JsonRpcFixture)
+BOOST_AUTO_TEST_CASE(rejectRequireProof)
+{
+    setNodeService(nullptr);
+    auto response = request(sendTransactionsRequest({fakeTransaction(1)}, true), nullptr);
+    BOOST_CHECK_EQUAL(response["error"]["code"].asInt(), (int)JsonRpcError::InvalidParams);
+    BOOST_CHECK(txpool->submitted.empty());
+}
+
+BOOST_AUTO_TEST_CASE(notifyEveryResult)
+{
+    setNodeService(nullptr);
+    std::vector<bcos::protocol::Transaction::Ptr> txs{fakeTransaction(1), fakeTransaction(2)};
+    std::vector<Json::Value> notifications;
+    auto response = request(sendTransactionsRequest(txs, false), &notifications);
+
+    // the response carries the hashes, and the error of the malformed transaction
+    auto const& result = response["result"];
+    BOOST_CHECK_EQUAL(result.size(), 3);
+    BOOST_CHECK_EQUAL(result[0]["transactionHash"].asString(), txs[0]->hash().hexPrefixed());
+    BOOST_CHECK_EQUAL(result[1]["transactionHash"].asString(), txs[1]->hash().hexPrefixed());
+    BOOST_CHECK(result[2].isMember("error"));
+    BOOST_CHECK(notifications.empty());
+
+    // the second transaction resolves first, and is pushed without waiting for the first one
+    BOOST_CHECK_EQUAL(txpool->submitted.size(), 2);
+    txpool->submitted[1].second(std::make_shared<Error>(-1, "rejected"), nullptr);
+    BOOST_CHECK_EQUAL(notifications.size(), 1);
+    BOOST_CHECK_EQUAL(notifications[0]["index"].asUInt64(), 1);
+    BOOST_CHECK_EQUAL(notifications[0]["error"]["message"].asString(), "rejected");
+
+    txpool->submitted[0].second(std::make_shared<Error>(-2, "expired"), nullptr);
+    BOOST_CHECK_EQUAL(notifications.size(), 2);
+    BOOST_CHECK_EQUAL(notifications[1]["index"].asUInt64(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(combinedResponse)
+{
+    setNodeService(nullptr);
+    std::vector<bcos::protocol::Transaction::Ptr> txs{fakeTransaction(1), fakeTransaction(2)};
+    auto response = request(sendTransactionsRequest(txs, false), nullptr);
+    // the http response waits for every transaction
+    BOOST_CHECK(response.isNull());
+    BOOST_CHECK_EQUAL(txpool->submitted.size(), 2);
+    txpool->submitted[1].second(std::make_shared<Error>(-1, "rejected"), nullptr);
+    BOOST_CHECK(response.isNull());
+    txpool->submitted[0].second(std::make_shared<Error>(-2, "expired"), nullptr);
+    auto const& result = response["result"];
+    BOOST_CHECK_EQUAL(result.size(), 3);
+    BOOST_CHECK_EQUAL(result[0]["error"]["message"].asString(), "expired");
+    BOOST_CHECK_EQUAL(result[1]["error"]["message"].asString(), "rejected");
+    BOOST_CHECK(result[2].isMember("error"));
+}
+BOOST_AUTO_TEST_SUITE_END()
+}  // namespace test
+}  // namespace bcos
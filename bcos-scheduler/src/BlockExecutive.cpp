@@ -6,6 +6,7 @@
 #include "bcos-framework/interfaces/executor/NativeExecutionMessage.h"
 #include "bcos-framework/interfaces/executor/ParallelTransactionExecutorInterface.h"
 #include "bcos-framework/interfaces/executor/PrecompiledTypeDef.h"
+#include "bcos-framework/interfaces/metrics/Metrics.h"
 #include "bcos-framework/interfaces/protocol/Transaction.h"
 #include "bcos-table/src/StateStorage.h"
 #include <bcos-utilities/Error.h>
@@ -18,6 +19,7 @@
 #include <boost/thread/latch.hpp>
 #include <boost/thread/lock_options.hpp>
 #include <boost/throw_exception.hpp>
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <cstdint>
@@ -71,6 +73,7 @@ void BlockExecutive::asyncExecute(
                              << LOG_KV("meta tx count", m_block->transactionsMetaDataSize());
 
         m_executiveResults.resize(m_block->transactionsMetaDataSize());
+        m_executiveStates.resize(m_block->transactionsMetaDataSize());
 
 #pragma omp parallel for
         for (size_t i = 0; i < m_block->transactionsMetaDataSize(); ++i)
@@ -112,10 +115,7 @@ void BlockExecutive::asyncExecute(
 
             bool enableDAG = metaData->attribute() & bcos::protocol::Transaction::Attribute::DAG;
 
-            auto to = message->to();
-#pragma omp critical
-            m_executiveStates.emplace(std::make_tuple(std::move(to), contextID),
-                ExecutiveState(contextID, std::move(message), enableDAG));
+            m_executiveStates[i] = ExecutiveState(contextID, std::move(message), enableDAG);
 
             if (metaData)
             {
@@ -133,6 +133,7 @@ void BlockExecutive::asyncExecute(
                              << LOG_KV("tx count", m_block->transactionsSize());
 
         m_executiveResults.resize(m_block->transactionsSize());
+        m_executiveStates.resize(m_block->transactionsSize());
 
 #pragma omp parallel for
         for (size_t i = 0; i < m_block->transactionsSize(); ++i)
@@ -198,15 +199,13 @@ void BlockExecutive::asyncExecute(
 
             bool enableDAG = tx->attribute() & bcos::protocol::Transaction::Attribute::DAG;
 
-            auto to = std::string(message->to());
-#pragma omp critical
-            m_executiveStates.emplace(std::make_tuple(std::move(to), contextID),
-                ExecutiveState(contextID, std::move(message), enableDAG));
+            m_executiveStates[i] = ExecutiveState(contextID, std::move(message), enableDAG);
 
             hasDAG = enableDAG;
         }
 #pragma omp flush(hasDAG)
     }
+    initContractStates();
 
     if (!m_staticCall)
     {
@@ -310,8 +309,13 @@ void BlockExecutive::asyncCommit(std::function<void(Error::UniquePtr)> callback)
                         return;
                     }
 
-                    m_commitElapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
-                        std::chrono::system_clock::now() - m_currentTimePoint);
+                    auto commitElapsed = std::chrono::system_clock::now() - m_currentTimePoint;
+                    m_commitElapsed =
+                        std::chrono::duration_cast<std::chrono::milliseconds>(commitElapsed);
+                    static auto& twoPCLatency = metrics::histogram(metrics::c_twoPCStage);
+                    twoPCLatency.record(
+                        std::chrono::duration_cast<std::chrono::microseconds>(commitElapsed)
+                            .count());
                     SCHEDULER_LOG(INFO) << "CommitBlock: " << number()
                                         << " success, execute elapsed: " << m_executeElapsed.count()
                                         << "ms hash elapsed: " << m_hashElapsed.count()
@@ -412,13 +416,24 @@ void BlockExecutive::asyncNotify(
 
 void BlockExecutive::DAGExecute(std::function<void(Error::UniquePtr)> callback)
 {
-    std::multimap<std::string, decltype(m_executiveStates)::iterator> requests;
+    std::vector<std::tuple<std::string_view, std::vector<ExecutiveState*>>> requests;
+    size_t requestCount = 0;
 
-    for (auto it = m_executiveStates.begin(); it != m_executiveStates.end(); ++it)
+    for (auto contract : m_readyContracts)
     {
-        if (it->second.enableDAG)
+        std::vector<ExecutiveState*> states;
+        for (auto index : m_contractStates[contract])
         {
-            requests.emplace(std::get<0>(it->first), it);
+            if (m_executiveStates[index].enableDAG)
+            {
+                states.push_back(&m_executiveStates[index]);
+            }
+        }
+
+        if (!states.empty())
+        {
+            requestCount += states.size();
+            requests.emplace_back(m_contracts[contract], std::move(states));
         }
     }
 
@@ -428,36 +443,33 @@ void BlockExecutive::DAGExecute(std::function<void(Error::UniquePtr)> callback)
         return;
     }
 
-    auto totalCount = std::make_shared<std::atomic_size_t>(requests.size());
+    auto totalCount = std::make_shared<std::atomic_size_t>(requestCount);
     auto failed = std::make_shared<std::atomic_size_t>(0);
     auto callbackPtr = std::make_shared<decltype(callback)>(std::move(callback));
 
-    for (auto it = requests.begin(); it != requests.end(); it = requests.upper_bound(it->first))
+    for (auto& [contract, states] : requests)
     {
-        SCHEDULER_LOG(TRACE) << "DAG contract: " << it->first;
+        SCHEDULER_LOG(TRACE) << "DAG contract: " << contract;
 
-        auto executor = m_scheduler->m_executorManager->dispatchExecutor(it->first);
-        auto count = requests.count(it->first);
-        auto range = requests.equal_range(it->first);
+        auto executor = m_scheduler->m_executorManager->dispatchExecutor(contract);
 
-        auto messages = std::make_shared<std::vector<protocol::ExecutionMessage::UniquePtr>>(count);
-        auto iterators = std::vector<decltype(m_executiveStates)::iterator>(count);
-        size_t i = 0;
-        for (auto messageIt = range.first; messageIt != range.second; ++messageIt)
+        auto messages =
+            std::make_shared<std::vector<protocol::ExecutionMessage::UniquePtr>>(states.size());
+        for (size_t i = 0; i < states.size(); ++i)
         {
-            SCHEDULER_LOG(TRACE) << "DAG message: " << messageIt->second->second.message.get()
-                                 << " to: " << messageIt->first;
-            messageIt->second->second.callStack.push(messageIt->second->second.currentSeq++);
-            messages->at(i) = std::move(messageIt->second->second.message);
-            iterators[i] = messageIt->second;
-
-            ++i;
+            SCHEDULER_LOG(TRACE) << "DAG message: " << states[i]->message.get()
+                                 << " to: " << contract;
+            states[i]->callStack.push(states[i]->currentSeq++);
+            messages->at(i) = std::move(states[i]->message);
         }
 
         executor->dagExecuteTransactions(*messages,
-            [messages, iterators = std::move(iterators), totalCount, failed, callbackPtr](
+            [this, contract = std::string(contract), messages, states = std::move(states),
+                totalCount, failed, callbackPtr, startTime = std::chrono::steady_clock::now()](
                 bcos::Error::UniquePtr error,
                 std::vector<bcos::protocol::ExecutionMessage::UniquePtr> responseMessages) {
+                m_scheduler->m_executorManager->recordExecution(
+                    contract, messages->size(), std::chrono::steady_clock::now() - startTime);
                 if (error)
                 {
                     ++(*failed);
@@ -475,7 +487,7 @@ void BlockExecutive::DAGExecute(std::function<void(Error::UniquePtr)> callback)
                     for (size_t j = 0; j < responseMessages.size(); ++j)
                     {
                         assert(responseMessages[j]);
-                        iterators[j]->second.message = std::move(responseMessages[j]);
+                        states[j]->message = std::move(responseMessages[j]);
                     }
                 }
 
@@ -507,7 +519,7 @@ void BlockExecutive::DMTExecute(
                 nullptr, m_sysBlock);
             return;
         }
-        if (!m_executiveStates.empty())
+        if (!m_readyContracts.empty())
         {
             SCHEDULER_LOG(TRACE) << "Non empty states, continue startBatch";
             DMTExecute(callback);
@@ -518,6 +530,13 @@ void BlockExecutive::DMTExecute(
             auto now = std::chrono::system_clock::now();
             m_executeElapsed =
                 std::chrono::duration_cast<std::chrono::milliseconds>(now - m_currentTimePoint);
+            if (!m_staticCall)
+            {
+                static auto& executeLatency = metrics::histogram(metrics::c_executeStage);
+                executeLatency.record(
+                    std::chrono::duration_cast<std::chrono::microseconds>(now - m_currentTimePoint)
+                        .count());
+            }
             m_currentTimePoint = now;
 
             if (m_staticCall)
@@ -542,8 +561,12 @@ void BlockExecutive::DMTExecute(
                         return;
                     }
 
-                    m_hashElapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
-                        std::chrono::system_clock::now() - m_currentTimePoint);
+                    auto hashElapsed = std::chrono::system_clock::now() - m_currentTimePoint;
+                    m_hashElapsed =
+                        std::chrono::duration_cast<std::chrono::milliseconds>(hashElapsed);
+                    static auto& hashLatency = metrics::histogram(metrics::c_hashStage);
+                    hashLatency.record(
+                        std::chrono::duration_cast<std::chrono::microseconds>(hashElapsed).count());
 
                     // Set result to m_block
                     for (auto& it : m_executiveResults)
@@ -789,8 +812,13 @@ void BlockExecutive::startBatch(std::function<void(Error::UniquePtr)> callback)
     auto batchStatus = std::make_shared<BatchStatus>();
     batchStatus->callback = std::move(callback);
 
-    traverseExecutive([this, &batchStatus, calledContract = std::set<std::string, std::less<>>()](
-                          ExecutiveState& executiveState) mutable {
+    // Messages to the same contract are sent together and executed by the executor in the order
+    // of contextID, static calls are kept out of the contract batches and sent alone by call(),
+    // a contract receives either one static call or the other messages in a batch
+    std::map<std::string, std::vector<ExecutiveState*>, std::less<>> contractMessages;
+    std::map<std::string, ExecutiveState*, std::less<>> staticCalls;
+    traverseExecutive([this, &batchStatus, &contractMessages, &staticCalls](
+                          ExecutiveState& executiveState) {
         if (executiveState.error)
         {
             batchStatus->allSended = true;
@@ -807,18 +835,15 @@ void BlockExecutive::startBatch(std::function<void(Error::UniquePtr)> callback)
         auto contextID = executiveState.contextID;
         auto seq = message->seq();
 
-        // Check if another context processing same contract
-        auto contractIt = calledContract.end();
-        if (!message->to().empty())
+        // Check if another context calling same contract
+        if (!message->to().empty() && (staticCalls.count(message->to()) ||
+                                          (message->staticCall() &&
+                                              contractMessages.count(message->to()))))
         {
-            contractIt = calledContract.lower_bound(message->to());
-            if (contractIt != calledContract.end() && *contractIt == message->to())
-            {
-                SCHEDULER_LOG(TRACE)
-                    << "Skip, " << contextID << " | " << seq << " | " << message->to();
-                executiveState.skip = true;
-                return SKIP;
-            }
+            SCHEDULER_LOG(TRACE) << "Skip, " << contextID << " | " << seq << " | "
+                                 << message->to();
+            executiveState.skip = true;
+            return SKIP;
         }
 
         switch (message->type())
@@ -950,10 +975,24 @@ void BlockExecutive::startBatch(std::function<void(Error::UniquePtr)> callback)
         }
         }
 
-        calledContract.emplace_hint(contractIt, message->to());
+        if (message->staticCall())
+        {
+            staticCalls[message->to()] = &executiveState;
+        }
+        else
+        {
+            contractMessages[message->to()].push_back(&executiveState);
+        }
+        ++batchStatus->total;
+
+        return PASS;
+    });
 
-        // Set current key lock into message
-        auto keyLocks = m_keyLocks.getKeyLocksNotHoldingByContext(message->to(), contextID);
+    // Set current key lock into message, after the key locks of this batch are all acquired
+    auto setKeyLocks = [this](std::string_view _contract, ExecutiveState& _executiveState) {
+        auto& message = _executiveState.message;
+        auto keyLocks =
+            m_keyLocks.getKeyLocksNotHoldingByContext(_contract, _executiveState.contextID);
         message->setKeyLocks(std::move(keyLocks));
 
         if (c_fileLogLevel >= bcos::LogLevel::TRACE)
@@ -965,58 +1004,137 @@ void BlockExecutive::startBatch(std::function<void(Error::UniquePtr)> callback)
                            "Dispatch key lock type: %s, from: %s, to: %s, key: %s, "
                            "contextID: %ld, seq: %ld") %
                            message->type() % message->from() % message->to() % toHex(keyIt) %
-                           contextID % message->seq();
+                           _executiveState.contextID % message->seq();
             }
         }
+    };
+    for (auto& [contract, states] : contractMessages)
+    {
+        for (auto* executiveState : states)
+        {
+            setKeyLocks(contract, *executiveState);
+        }
 
-        ++batchStatus->total;
-        auto executor = m_scheduler->m_executorManager->dispatchExecutor(message->to());
+        auto executor = m_scheduler->m_executorManager->dispatchExecutor(contract);
+        if (states.size() > 1)
+        {
+            executeContractMessages(executor, contract, std::move(states), batchStatus);
+            continue;
+        }
+        executeContractMessage(executor, contract, *states.front(), batchStatus);
+    }
+    for (auto& [contract, executiveState] : staticCalls)
+    {
+        setKeyLocks(contract, *executiveState);
+        executeContractMessage(m_scheduler->m_executorManager->dispatchExecutor(contract),
+            contract, *executiveState, batchStatus);
+    }
 
-        auto executeCallback = [this, &executiveState, batchStatus](bcos::Error::UniquePtr error,
-                                   bcos::protocol::ExecutionMessage::UniquePtr response) {
-            if (error)
-            {
-                SCHEDULER_LOG(ERROR)
-                    << "Execute transaction error: " << boost::diagnostic_information(*error);
+    batchStatus->allSended = true;
+    checkBatch(*batchStatus);
+}
 
-                executiveState.error = std::move(error);
-                executiveState.message.reset();
+void BlockExecutive::executeContractMessage(
+    bcos::executor::ParallelTransactionExecutorInterface::Ptr executor, std::string contract,
+    ExecutiveState& executiveState, std::shared_ptr<BatchStatus> batchStatus)
+{
+    auto executeCallback = [this, &executiveState, batchStatus, contract = std::move(contract),
+                               startTime = std::chrono::steady_clock::now()](
+                               bcos::Error::UniquePtr error,
+                               bcos::protocol::ExecutionMessage::UniquePtr response) {
+        m_scheduler->m_executorManager->recordExecution(
+            contract, 1, std::chrono::steady_clock::now() - startTime);
+        if (error)
+        {
+            SCHEDULER_LOG(ERROR)
+                << "Execute transaction error: " << boost::diagnostic_information(*error);
 
-                // Set error to batch
-                ++batchStatus->error;
-            }
-            else if (!response)
+            executiveState.error = std::move(error);
+            executiveState.message.reset();
+
+            // Set error to batch
+            ++batchStatus->error;
+        }
+        else if (!response)
+        {
+            SCHEDULER_LOG(ERROR) << "Execute transaction with null response!";
+
+            ++batchStatus->error;
+        }
+        else
+        {
+            executiveState.message = std::move(response);
+        }
+
+        SCHEDULER_LOG(TRACE) << "Execute is finished!";
+
+        ++batchStatus->received;
+        checkBatch(*batchStatus);
+    };
+
+    if (executiveState.message->staticCall())
+    {
+        executor->call(std::move(executiveState.message), std::move(executeCallback));
+    }
+    else
+    {
+        executor->executeTransaction(
+            std::move(executiveState.message), std::move(executeCallback));
+    }
+}
+
+void BlockExecutive::executeContractMessages(
+    bcos::executor::ParallelTransactionExecutorInterface::Ptr executor, std::string contract,
+    std::vector<ExecutiveState*> states, std::shared_ptr<BatchStatus> batchStatus)
+{
+    SCHEDULER_LOG(TRACE) << "Execute messages in batch" << LOG_KV("to", contract)
+                         << LOG_KV("size", states.size());
+
+    std::vector<bcos::protocol::ExecutionMessage::UniquePtr> messages;
+    messages.reserve(states.size());
+    for (auto* executiveState : states)
+    {
+        messages.emplace_back(std::move(executiveState->message));
+    }
+
+    executor->executeTransactions(contract, messages,
+        [this, contract, states = std::move(states), batchStatus,
+            startTime = std::chrono::steady_clock::now()](bcos::Error::UniquePtr error,
+            std::vector<bcos::protocol::ExecutionMessage::UniquePtr> responses) {
+            m_scheduler->m_executorManager->recordExecution(
+                contract, states.size(), std::chrono::steady_clock::now() - startTime);
+            if (!error && responses.size() != states.size())
             {
-                SCHEDULER_LOG(ERROR) << "Execute transaction with null response!";
+                error = BCOS_ERROR_UNIQUE_PTR(SchedulerError::BatchError,
+                    "Execute transactions with " + std::to_string(responses.size()) +
+                        " responses of " + std::to_string(states.size()) + " messages");
+            }
 
-                ++batchStatus->error;
+            if (error)
+            {
+                SCHEDULER_LOG(ERROR)
+                    << "Execute transactions error: " << boost::diagnostic_information(*error);
+                for (auto* executiveState : states)
+                {
+                    executiveState->error = BCOS_ERROR_WITH_PREV_UNIQUE_PTR(
+                        SchedulerError::BatchError, "Execute transactions error", *error);
+                    executiveState->message.reset();
+                }
+                batchStatus->error += states.size();
             }
             else
             {
-                executiveState.message = std::move(response);
+                for (size_t i = 0; i < states.size(); ++i)
+                {
+                    states[i]->message = std::move(responses[i]);
+                }
             }
 
-            SCHEDULER_LOG(TRACE) << "Execute is finished!";
+            SCHEDULER_LOG(TRACE) << "Execute transactions is finished!";
 
-            ++batchStatus->received;
+            batchStatus->received += states.size();
             checkBatch(*batchStatus);
-        };
-
-        if (executiveState.message->staticCall())
-        {
-            executor->call(std::move(executiveState.message), std::move(executeCallback));
-        }
-        else
-        {
-            executor->executeTransaction(
-                std::move(executiveState.message), std::move(executeCallback));
-        }
-
-        return PASS;
-    });
-
-    batchStatus->allSended = true;
-    checkBatch(*batchStatus);
+        });
 }
 
 void BlockExecutive::checkBatch(BatchStatus& status)
@@ -1042,7 +1160,7 @@ void BlockExecutive::checkBatch(BatchStatus& status)
                 return;
             }
 
-            if (!m_executiveStates.empty() && status.total == 0)
+            if (!m_readyContracts.empty() && status.total == 0)
             {
                 SCHEDULER_LOG(INFO)
                     << "No transaction executed this batch, start processing dead lock";
@@ -1161,55 +1279,141 @@ std::string BlockExecutive::preprocessAddress(const std::string_view& address)
     return out;
 }
 
-void BlockExecutive::traverseExecutive(std::function<TraverseHint(ExecutiveState&)> callback)
+size_t BlockExecutive::contractIndex(std::string_view contract)
 {
-    std::forward_list<decltype(m_executiveStates)::node_type> updateNodes;
+    auto it = m_contractIndexes.find(contract);
+    if (it != m_contractIndexes.end())
+    {
+        return it->second;
+    }
+    auto index = m_contracts.size();
+    m_contractIndexes.emplace(m_contracts.emplace_back(contract), index);
+    m_contractStates.emplace_back();
+    return index;
+}
 
-    for (auto it = m_executiveStates.begin(); it != m_executiveStates.end();)
+void BlockExecutive::initContractStates()
+{
+    m_contracts.clear();
+    m_contractIndexes.clear();
+    m_contractStates.clear();
+    m_readyContracts.clear();
+    for (size_t i = 0; i < m_executiveStates.size(); ++i)
     {
-        SCHEDULER_LOG(TRACE) << "Traverse " << std::get<0>(it->first) << " | "
-                             << std::get<1>(it->first);
-        auto hint = callback(it->second);
-        switch (hint)
-        {
-        case PASS:
+        auto index = contractIndex(m_executiveStates[i].message->to());
+        auto& states = m_contractStates[index];
+        if (states.empty())
         {
-            ++it;
-            break;
-        }
-        case DELETE:
-        {
-            m_executiveStates.erase(it++);
-            break;
+            // The contracts are interned in the order they are met, the ready queue is ascending
+            m_readyContracts.push_back(index);
         }
-        case SKIP:
+        states.push_back(i);
+    }
+}
+
+void BlockExecutive::traverseExecutive(std::function<TraverseHint(ExecutiveState&)> callback)
+{
+    std::vector<size_t> updateStates;
+
+    bool end = false;
+    size_t keptContracts = 0;
+    size_t c = 0;
+    for (; c < m_readyContracts.size() && !end; ++c)
+    {
+        // Compact the kept states in place, the order is unchanged
+        auto contract = m_readyContracts[c];
+        auto& states = m_contractStates[contract];
+        size_t kept = 0;
+        size_t i = 0;
+        bool skip = false;
+        for (; i < states.size() && !skip && !end; ++i)
         {
-            it = m_executiveStates.upper_bound({std::get<0>(it->first), INT64_MAX});
-            break;
+            auto index = states[i];
+            auto& executiveState = m_executiveStates[index];
+            SCHEDULER_LOG(TRACE) << "Traverse " << m_contracts[contract] << " | "
+                                 << executiveState.contextID;
+            auto hint = callback(executiveState);
+            switch (hint)
+            {
+            case PASS:
+            {
+                states[kept++] = index;
+                break;
+            }
+            case DELETE:
+            {
+                break;
+            }
+            case SKIP:
+            {
+                states[kept++] = index;
+                skip = true;
+                break;
+            }
+            case UPDATE:
+            {
+                updateStates.push_back(index);
+                break;
+            }
+            case END:
+            {
+                states[kept++] = index;
+                end = true;
+                break;
+            }
+            }
         }
-        case UPDATE:
+        for (; i < states.size(); ++i)
         {
-            updateNodes.emplace_front(m_executiveStates.extract(it++));
-            break;
+            states[kept++] = states[i];
         }
-        case END:
+        states.resize(kept);
+
+        // Contracts without state leave the ready queue
+        if (!states.empty())
         {
-            goto OUT;
-        }
+            m_readyContracts[keptContracts++] = contract;
         }
     }
+    for (; c < m_readyContracts.size(); ++c)
+    {
+        m_readyContracts[keptContracts++] = m_readyContracts[c];
+    }
+    m_readyContracts.resize(keptContracts);
 
-OUT:
-    // Process the update nodes
-    if (!updateNodes.empty())
+    // Process the update states, append them to the contract they are sent to, then restore the
+    // order of each touched contract and of the ready queue
+    if (!updateStates.empty())
     {
-        for (auto it = updateNodes.begin(); it != updateNodes.end(); ++it)
+        std::map<size_t, size_t> sortedSizes;
+        for (auto index : updateStates)
         {
-            it->key() = std::make_tuple(it->mapped().message->to(), it->mapped().contextID);
+            auto& executiveState = m_executiveStates[index];
+            auto to = executiveState.message->to();
+
+            SCHEDULER_LOG(TRACE) << "Reinsert context: " << executiveState.contextID << " | "
+                                 << executiveState.message->seq() << " | " << to;
+
+            auto toIndex = contractIndex(to);
+            auto& states = m_contractStates[toIndex];
+            if (states.empty())
+            {
+                m_readyContracts.push_back(toIndex);
+            }
+            sortedSizes.emplace(toIndex, states.size());
+            states.push_back(index);
+        }
 
-            SCHEDULER_LOG(TRACE) << "Reinsert context: " << it->mapped().contextID << " | "
-                                 << it->mapped().message->seq() << " | " << std::get<0>(it->key());
-            m_executiveStates.insert(std::move(*it));
+        for (auto& [toIndex, sortedSize] : sortedSizes)
+        {
+            auto& states = m_contractStates[toIndex];
+            auto middle = states.begin() + sortedSize;
+            std::sort(middle, states.end());
+            std::inplace_merge(states.begin(), middle, states.end());
         }
+
+        auto middle = m_readyContracts.begin() + keptContracts;
+        std::sort(middle, m_readyContracts.end());
+        std::inplace_merge(m_readyContracts.begin(), middle, m_readyContracts.end());
     }
 }
\ No newline at end of file
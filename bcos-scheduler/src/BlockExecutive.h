@@ -18,11 +18,15 @@
 #include <boost/iterator/iterator_categories.hpp>
 #include <boost/range/any_range.hpp>
 #include <chrono>
+#include <deque>
 #include <forward_list>
+#include <map>
 #include <mutex>
 #include <ratio>
 #include <stack>
 #include <thread>
+#include <unordered_map>
+#include <vector>
 
 namespace bcos::scheduler
 {
@@ -81,6 +85,8 @@ public:
     bool isCall() { return m_staticCall; }
     bool sysBlock() const { return m_sysBlock; }
 
+    static std::string preprocessAddress(const std::string_view& address);
+
 private:
     void DAGExecute(std::function<void(Error::UniquePtr)> error);
     void DMTExecute(
@@ -124,26 +130,42 @@ private:
     std::string newEVMAddress(
         const std::string_view& _sender, bytesConstRef _init, u256 const& _salt);
 
-    std::string preprocessAddress(const std::string_view& address);
-
     struct ExecutiveState  // Executive state per tx
     {
+        ExecutiveState() = default;
         ExecutiveState(int64_t _contextID, bcos::protocol::ExecutionMessage::UniquePtr _message,
             bool _enableDAG)
           : contextID(_contextID), message(std::move(_message)), enableDAG(_enableDAG)
         {}
 
-        int64_t contextID;
-        std::stack<int64_t, std::list<int64_t>> callStack;
+        int64_t contextID = 0;
+        std::stack<int64_t, std::vector<int64_t>> callStack;
         bcos::protocol::ExecutionMessage::UniquePtr message;
         bcos::Error::UniquePtr error;
         int64_t currentSeq = 0;
-        bool enableDAG;
+        bool enableDAG = false;
         bool skip = false;
     };
 
-    std::map<std::tuple<std::string, ContextID>, ExecutiveState, std::less<>> m_executiveStates;
+    // Executive states indexed by contextID - m_startContextID, never resized during execution
+    std::vector<ExecutiveState> m_executiveStates;
+    // The contracts the states are sent to, interned to dense indexes in the order they are met,
+    // the deque never moves the interned addresses viewed by the keys
+    std::deque<std::string> m_contracts;
+    std::unordered_map<std::string_view, size_t> m_contractIndexes;
+    // Contract index => the unfinished state indexes in ascending order
+    std::vector<std::vector<size_t>> m_contractStates;
+    // The contracts with unfinished states in ascending order of the index, traversed in turn
+    std::vector<size_t> m_readyContracts;
+    size_t contractIndex(std::string_view contract);
+    void initContractStates();
     void traverseExecutive(std::function<TraverseHint(ExecutiveState&)> callback);
+    void executeContractMessage(bcos::executor::ParallelTransactionExecutorInterface::Ptr executor,
+        std::string contract, ExecutiveState& executiveState,
+        std::shared_ptr<BatchStatus> batchStatus);
+    void executeContractMessages(bcos::executor::ParallelTransactionExecutorInterface::Ptr executor,
+        std::string contract, std::vector<ExecutiveState*> states,
+        std::shared_ptr<BatchStatus> batchStatus);
 
     struct ExecutiveResult
     {
@@ -0,0 +1,105 @@
+#include "CallExecutive.h"
+#include "BlockExecutive.h"
+#include "SchedulerImpl.h"
+#include "bcos-framework/interfaces/protocol/TransactionReceiptFactory.h"
+#include <boost/exception/diagnostic_information.hpp>
+
+using namespace bcos::scheduler;
+
+void CallExecutive::asyncCall(Callback callback)
+{
+    m_callback = std::move(callback);
+
+    auto message = m_scheduler->m_executionMessageFactory->createExecutionMessage();
+    message->setType(protocol::ExecutionMessage::MESSAGE);
+    message->setContextID(m_contextID);
+    message->setOrigin(toHex(m_tx->sender()));
+    message->setFrom(std::string(message->origin()));
+    if (m_tx->attribute() & bcos::protocol::Transaction::Attribute::LIQUID_SCALE_CODEC)
+    {
+        message->setTo(std::string(m_tx->to()));
+    }
+    else
+    {
+        message->setTo(BlockExecutive::preprocessAddress(m_tx->to()));
+    }
+    message->setDepth(0);
+    message->setGasAvailable(m_gasLimit);
+    message->setData(m_tx->input().toBytes());
+    message->setStaticCall(true);
+
+    send(std::move(message));
+}
+
+void CallExecutive::send(protocol::ExecutionMessage::UniquePtr message)
+{
+    switch (message->type())
+    {
+    // Request type, push stack
+    case protocol::ExecutionMessage::MESSAGE:
+    {
+        // static call never creates contract
+        if (message->to().empty())
+        {
+            m_callback(BCOS_ERROR_UNIQUE_PTR(
+                           SchedulerError::InvalidStatus, "Create contract in static call"),
+                nullptr);
+            return;
+        }
+        auto seq = m_currentSeq++;
+        m_callStack.push(seq);
+        message->setSeq(seq);
+        break;
+    }
+    // Return type, pop stack
+    case protocol::ExecutionMessage::FINISHED:
+    case protocol::ExecutionMessage::REVERT:
+    {
+        m_callStack.pop();
+        if (m_callStack.empty())
+        {
+            onFinished(std::move(message));
+            return;
+        }
+        message->setSeq(m_callStack.top());
+        message->setCreate(false);
+        break;
+    }
+    // the static call holds no key lock and is never sent back
+    default:
+    {
+        SCHEDULER_LOG(ERROR) << "Unexpected call message" << LOG_KV("contextID", m_contextID)
+                             << LOG_KV("seq", message->seq()) << LOG_KV("type", message->type());
+        m_callback(BCOS_ERROR_UNIQUE_PTR(SchedulerError::InvalidStatus,
+                       "Unexpected call message type: " + std::to_string(message->type())),
+            nullptr);
+        return;
+    }
+    }
+
+    auto executor = m_scheduler->m_executorManager->dispatchExecutor(message->to());
+    executor->call(std::move(message), [self = shared_from_this()](Error::UniquePtr error,
+                                           protocol::ExecutionMessage::UniquePtr response) {
+        if (error)
+        {
+            SCHEDULER_LOG(ERROR) << "Call error, " << boost::diagnostic_information(*error);
+            self->m_callback(BCOS_ERROR_WITH_PREV_UNIQUE_PTR(
+                                 SchedulerError::UnknownError, "Call error", *error),
+                nullptr);
+            return;
+        }
+        self->send(std::move(response));
+    });
+}
+
+void CallExecutive::onFinished(protocol::ExecutionMessage::UniquePtr message)
+{
+    auto gasUsed = m_gasLimit - message->gasAvailable();
+    // the call is not in any block
+    auto receipt = m_scheduler->m_blockFactory->receiptFactory()->createReceipt(gasUsed,
+        message->newEVMContractAddress(),
+        std::make_shared<std::vector<bcos::protocol::LogEntry>>(message->takeLogEntries()),
+        message->status(), message->takeData(), 0);
+    receipt->setMessage(std::string(message->message()));
+    m_callback(nullptr, std::move(receipt));
+}
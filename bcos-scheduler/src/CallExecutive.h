@@ -0,0 +1,52 @@
+#pragma once
+
+#include "Common.h"
+#include "bcos-framework/interfaces/executor/ExecutionMessage.h"
+#include "bcos-framework/interfaces/protocol/Transaction.h"
+#include "bcos-framework/interfaces/protocol/TransactionReceipt.h"
+#include <bcos-utilities/Error.h>
+#include <functional>
+#include <memory>
+#include <stack>
+#include <vector>
+
+namespace bcos::scheduler
+{
+class SchedulerImpl;
+
+// Static call of one transaction, the messages of the call are sent one by one to the executor of
+// their contract following the call stack, without the temp block, the batches and the key locks
+// of BlockExecutive, so the calls run on the caller threads independently of block execution
+class CallExecutive : public std::enable_shared_from_this<CallExecutive>
+{
+public:
+    using Ptr = std::shared_ptr<CallExecutive>;
+    using Callback =
+        std::function<void(Error::UniquePtr&&, protocol::TransactionReceipt::Ptr&&)>;
+
+    CallExecutive(protocol::Transaction::Ptr tx, SchedulerImpl* scheduler, ContextID contextID,
+        uint64_t gasLimit)
+      : m_tx(std::move(tx)), m_scheduler(scheduler), m_contextID(contextID), m_gasLimit(gasLimit)
+    {}
+
+    CallExecutive(const CallExecutive&) = delete;
+    CallExecutive(CallExecutive&&) = delete;
+    CallExecutive& operator=(const CallExecutive&) = delete;
+    CallExecutive& operator=(CallExecutive&&) = delete;
+
+    void asyncCall(Callback callback);
+
+private:
+    void send(protocol::ExecutionMessage::UniquePtr message);
+    void onFinished(protocol::ExecutionMessage::UniquePtr message);
+
+    protocol::Transaction::Ptr m_tx;
+    SchedulerImpl* m_scheduler;
+    ContextID m_contextID;
+    uint64_t m_gasLimit;
+
+    std::stack<Seq, std::vector<Seq>> m_callStack;
+    Seq m_currentSeq = 0;
+    Callback m_callback;
+};
+}  // namespace bcos::scheduler
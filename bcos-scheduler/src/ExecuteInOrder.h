@@ -0,0 +1,95 @@
+#pragma once
+
+#include "bcos-framework/interfaces/executor/ParallelTransactionExecutorInterface.h"
+#include <bcos-utilities/Error.h>
+#include <atomic>
+#include <gsl/span>
+#include <memory>
+
+namespace bcos::scheduler
+{
+// Implement executeTransactions by sending the messages one by one with executeTransaction, for
+// the executors which can't execute a batch in one call
+class ExecuteInOrder : public std::enable_shared_from_this<ExecuteInOrder>
+{
+public:
+    using Callback = std::function<void(
+        bcos::Error::UniquePtr, std::vector<bcos::protocol::ExecutionMessage::UniquePtr>)>;
+
+    static void execute(bcos::executor::ParallelTransactionExecutorInterface& executor,
+        gsl::span<bcos::protocol::ExecutionMessage::UniquePtr> inputs, Callback callback)
+    {
+        auto batch = std::make_shared<ExecuteInOrder>(executor, std::move(callback));
+        batch->m_inputs.reserve(inputs.size());
+        for (auto& input : inputs)
+        {
+            batch->m_inputs.emplace_back(std::move(input));
+        }
+        batch->m_outputs.reserve(inputs.size());
+        batch->next();
+    }
+
+    ExecuteInOrder(
+        bcos::executor::ParallelTransactionExecutorInterface& executor, Callback callback)
+      : m_executor(executor), m_callback(std::move(callback))
+    {}
+
+private:
+    void next()
+    {
+        // responses called back inside executeTransaction continue this loop instead of
+        // recursing, so a long batch doesn't overflow the stack
+        while (!m_failed)
+        {
+            auto index = m_outputs.size();
+            if (index == m_inputs.size())
+            {
+                m_callback(nullptr, std::move(m_outputs));
+                return;
+            }
+
+            auto& input = m_inputs[index];
+            bcos::executor::ParallelTransactionExecutorInterface::appendKeyLocks(
+                *input, m_lockedKeys);
+            m_stage = 0;
+            m_executor.executeTransaction(std::move(input),
+                [self = shared_from_this()](bcos::Error::UniquePtr error,
+                    bcos::protocol::ExecutionMessage::UniquePtr output) {
+                    if (error || !output)
+                    {
+                        self->m_failed = true;
+                        self->m_callback(error ? std::move(error) :
+                                                 BCOS_ERROR_UNIQUE_PTR(
+                                                     -1, "Execute with null response"),
+                            {});
+                    }
+                    else
+                    {
+                        bcos::executor::ParallelTransactionExecutorInterface::collectKeyLocks(
+                            *output, self->m_lockedKeys);
+                        self->m_outputs.emplace_back(std::move(output));
+                    }
+
+                    if (self->m_stage.exchange(1) == 2)
+                    {
+                        self->next();
+                    }
+                });
+            if (m_stage.exchange(2) == 0)
+            {
+                // the callback continues the batch
+                return;
+            }
+        }
+    }
+
+    bcos::executor::ParallelTransactionExecutorInterface& m_executor;
+    std::vector<bcos::protocol::ExecutionMessage::UniquePtr> m_inputs;
+    std::vector<bcos::protocol::ExecutionMessage::UniquePtr> m_outputs;
+    std::vector<std::string> m_lockedKeys;
+    Callback m_callback;
+    bool m_failed = false;
+    // 0: waiting for the response, 1: responded inside executeTransaction, 2: responds later
+    std::atomic<int> m_stage = {0};
+};
+}  // namespace bcos::scheduler
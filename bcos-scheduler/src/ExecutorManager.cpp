@@ -1,5 +1,7 @@
 #include "ExecutorManager.h"
+#include "Common.h"
 #include <bcos-utilities/Error.h>
+#include <bcos-utilities/Log.h>
 #include <tbb/parallel_sort.h>
 #include <boost/concept_check.hpp>
 #include <boost/core/ignore_unused.hpp>
@@ -38,36 +40,37 @@ bcos::executor::ParallelTransactionExecutorInterface::Ptr ExecutorManager::dispa
         return nullptr;
     }
 
-    while (true)
     {
+        std::shared_lock lock(m_mutex);
         auto executorIt = m_contract2ExecutorInfo.find(contract);
         if (executorIt != m_contract2ExecutorInfo.end())
         {
             return executorIt->second->executor;
         }
-        else
-        {
-            std::unique_lock lock(m_mutex, std::try_to_lock);
-            if (!lock.owns_lock())
-            {
-                continue;
-            }
-
-            auto executorInfo = m_executorPriorityQueue.top();
-            m_executorPriorityQueue.pop();
+    }
 
-            auto [contractStr, success] = executorInfo->contracts.insert(std::string(contract));
-            if (!success)
-            {
-                BOOST_THROW_EXCEPTION(BCOS_ERROR(-1, "Insert into contracts fail!"));
-            }
-            m_executorPriorityQueue.push(executorInfo);
+    // rebalance moves contracts, so the lookup above can't go without the lock
+    std::unique_lock lock(m_mutex);
+    auto executorIt = m_contract2ExecutorInfo.find(contract);
+    if (executorIt != m_contract2ExecutorInfo.end())
+    {
+        return executorIt->second->executor;
+    }
 
-            (void)m_contract2ExecutorInfo.emplace(*contractStr, executorInfo);
+    auto executorInfo = m_executorPriorityQueue.top();
+    m_executorPriorityQueue.pop();
 
-            return executorInfo->executor;
-        }
+    auto [contractStr, success] = executorInfo->contracts.insert(std::string(contract));
+    if (!success)
+    {
+        BOOST_THROW_EXCEPTION(BCOS_ERROR(-1, "Insert into contracts fail!"));
     }
+    executorInfo->load += m_newContractLoad;
+    m_executorPriorityQueue.push(executorInfo);
+
+    (void)m_contract2ExecutorInfo.emplace(*contractStr, executorInfo);
+
+    return executorInfo->executor;
 }
 
 void ExecutorManager::removeExecutor(const std::string_view& name)
@@ -91,16 +94,183 @@ void ExecutorManager::removeExecutor(const std::string_view& name)
 
         m_name2Executors.erase(it);
 
-        m_executorPriorityQueue = std::priority_queue<ExecutorInfo::Ptr,
-            std::vector<ExecutorInfo::Ptr>, ExecutorInfoComp>();
+        resetPriorityQueue();
+    }
+    else
+    {
+        BOOST_THROW_EXCEPTION(BCOS_ERROR(-1, "Not found executor: " + std::string(name)));
+    }
+}
+
+void ExecutorManager::recordExecution(
+    const std::string_view& contract, size_t txCount, std::chrono::nanoseconds elapsed)
+{
+    std::unique_lock lock(m_loadMutex);
+    auto& contractLoad = m_contractLoads[std::string(contract)];
+    contractLoad.txCount += txCount;
+    contractLoad.elapsed +=
+        std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+}
+
+void ExecutorManager::rebalance()
+{
+    std::unique_lock lock(m_mutex);
+    std::unique_lock loadLock(m_loadMutex);
 
-        for (auto& it : m_name2Executors)
+    if (c_fileLogLevel >= bcos::LogLevel::DEBUG)
+    {
+        for (auto& executorLoad : collectLoads())
         {
-            m_executorPriorityQueue.push(it.second);
+            SCHEDULER_LOG(DEBUG) << "Executor load" << LOG_KV("name", executorLoad.name)
+                                 << LOG_KV("contracts", executorLoad.contracts)
+                                 << LOG_KV("txCount", executorLoad.txCount)
+                                 << LOG_KV("elapsed(us)", executorLoad.elapsed.count())
+                                 << LOG_KV("utilization", executorLoad.utilization);
         }
     }
-    else
+
+    uint64_t totalLoad = 0;
+    for (auto it = m_contractLoads.begin(); it != m_contractLoads.end();)
     {
-        BOOST_THROW_EXCEPTION(BCOS_ERROR(-1, "Not found executor: " + std::string(name)));
+        auto& contractLoad = it->second;
+        contractLoad.load = (contractLoad.load + contractLoad.elapsed) / 2;
+        contractLoad.txCount = 0;
+        contractLoad.elapsed = 0;
+
+        // idle contracts decay to zero and are forgotten
+        if (contractLoad.load == 0)
+        {
+            it = m_contractLoads.erase(it);
+            continue;
+        }
+        totalLoad += contractLoad.load;
+        ++it;
+    }
+    m_newContractLoad = m_contractLoads.empty() ? 0 : totalLoad / m_contractLoads.size();
+
+    auto contractLoadOf = [this](const std::string& contract) -> uint64_t {
+        auto it = m_contractLoads.find(contract);
+        return it != m_contractLoads.end() ? it->second.load : 0;
+    };
+
+    std::vector<ExecutorInfo::Ptr> executors;
+    executors.reserve(m_name2Executors.size());
+    for (auto& it : m_name2Executors)
+    {
+        auto& executorInfo = it.second;
+        executorInfo->load = 0;
+        for (auto& contract : executorInfo->contracts)
+        {
+            executorInfo->load += contractLoadOf(contract);
+        }
+        executors.push_back(executorInfo);
+    }
+
+    for (size_t moves = 0; moves < MAX_REBALANCE_MOVES && executors.size() > 1; ++moves)
+    {
+        auto [minIt, maxIt] = std::minmax_element(executors.begin(), executors.end(),
+            [](const ExecutorInfo::Ptr& lhs, const ExecutorInfo::Ptr& rhs) {
+                return lhs->load < rhs->load;
+            });
+        auto from = *maxIt;
+        auto to = *minIt;
+        auto gap = from->load - to->load;
+
+        // moving a load in (0, gap) lowers the max, the one closest to gap / 2 evens them out best
+        const std::string* best = nullptr;
+        uint64_t bestLoad = 0;
+        for (auto& contract : from->contracts)
+        {
+            auto load = contractLoadOf(contract);
+            if (load == 0 || load >= gap || to->movedContracts.count(contract))
+            {
+                continue;
+            }
+
+            auto distance = [gap](uint64_t value) {
+                return value * 2 > gap ? value * 2 - gap : gap - value * 2;
+            };
+            if (!best || distance(load) < distance(bestLoad))
+            {
+                best = &contract;
+                bestLoad = load;
+            }
+        }
+
+        if (!best)
+        {
+            break;
+        }
+
+        auto contract = *best;
+        m_contract2ExecutorInfo.unsafe_erase(contract);
+        from->contracts.erase(contract);
+        from->load -= bestLoad;
+        from->movedContracts.insert(contract);
+
+        auto [contractStr, success] = to->contracts.insert(std::move(contract));
+        boost::ignore_unused(success);
+        to->load += bestLoad;
+        (void)m_contract2ExecutorInfo.emplace(*contractStr, to);
+
+        SCHEDULER_LOG(INFO) << "Rebalance contract" << LOG_KV("contract", *contractStr)
+                            << LOG_KV("load", bestLoad) << LOG_KV("from", from->name)
+                            << LOG_KV("fromLoad", from->load) << LOG_KV("to", to->name)
+                            << LOG_KV("toLoad", to->load);
+    }
+
+    resetPriorityQueue();
+}
+
+std::vector<ExecutorManager::ExecutorLoad> ExecutorManager::utilization() const
+{
+    std::shared_lock lock(m_mutex);
+    std::unique_lock loadLock(m_loadMutex);
+
+    return collectLoads();
+}
+
+std::vector<ExecutorManager::ExecutorLoad> ExecutorManager::collectLoads() const
+{
+    uint64_t totalLoad = 0;
+    for (auto& it : m_name2Executors)
+    {
+        totalLoad += it.second->load;
     }
-}
\ No newline at end of file
+
+    std::vector<ExecutorLoad> executorLoads;
+    executorLoads.reserve(m_name2Executors.size());
+    for (auto& it : m_name2Executors)
+    {
+        auto& executorInfo = it.second;
+        ExecutorLoad executorLoad;
+        executorLoad.name = executorInfo->name;
+        executorLoad.contracts = executorInfo->contracts.size();
+        for (auto& contract : executorInfo->contracts)
+        {
+            auto contractIt = m_contractLoads.find(contract);
+            if (contractIt != m_contractLoads.end())
+            {
+                executorLoad.txCount += contractIt->second.txCount;
+                executorLoad.elapsed += std::chrono::microseconds(contractIt->second.elapsed);
+            }
+        }
+        executorLoad.utilization =
+            totalLoad > 0 ? (double)executorInfo->load / (double)totalLoad : 0;
+
+        executorLoads.push_back(std::move(executorLoad));
+    }
+
+    return executorLoads;
+}
+
+void ExecutorManager::resetPriorityQueue()
+{
+    m_executorPriorityQueue = std::priority_queue<ExecutorInfo::Ptr,
+        std::vector<ExecutorInfo::Ptr>, ExecutorInfoComp>();
+
+    for (auto& it : m_name2Executors)
+    {
+        m_executorPriorityQueue.push(it.second);
+    }
+}
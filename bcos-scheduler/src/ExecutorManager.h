@@ -8,8 +8,10 @@
 #include <boost/iterator/iterator_categories.hpp>
 #include <boost/iterator/transform_iterator.hpp>
 #include <boost/range/any_range.hpp>
+#include <chrono>
 #include <functional>
 #include <iterator>
+#include <mutex>
 #include <queue>
 #include <shared_mutex>
 #include <string>
@@ -22,6 +24,20 @@ class ExecutorManager
 public:
     using Ptr = std::shared_ptr<ExecutorManager>;
 
+    // the max number of contracts moved by one rebalance
+    constexpr static size_t MAX_REBALANCE_MOVES = 8;
+
+    struct ExecutorLoad
+    {
+        std::string name;
+        size_t contracts = 0;
+        // tx count and execution time of the contracts since the last rebalance
+        uint64_t txCount = 0;
+        std::chrono::microseconds elapsed{0};
+        // share of the smoothed load of all executors, in [0, 1]
+        double utilization = 0;
+    };
+
     void addExecutor(
         std::string name, bcos::executor::ParallelTransactionExecutorInterface::Ptr executor);
 
@@ -30,6 +46,17 @@ public:
 
     void removeExecutor(const std::string_view& name);
 
+    // record the execution of _txCount messages of the contract, thread safe
+    void recordExecution(
+        const std::string_view& contract, size_t txCount, std::chrono::nanoseconds elapsed);
+
+    // fold the recorded executions into the contract loads and move the hottest contracts from the
+    // most loaded executor to the least loaded one, must be called between blocks, when the
+    // executors have no uncommitted state
+    void rebalance();
+
+    std::vector<ExecutorLoad> utilization() const;
+
     auto begin() const
     {
         return boost::make_transform_iterator(m_name2Executors.cbegin(),
@@ -52,23 +79,49 @@ private:
         std::string name;
         bcos::executor::ParallelTransactionExecutorInterface::Ptr executor;
         std::set<std::string> contracts;
+        // contracts moved away by rebalance, the cached storage of the executor may hold stale
+        // rows of them, so they never move back
+        std::set<std::string> movedContracts;
+        // sum of the smoothed loads of the contracts, plus the estimated load of the contracts
+        // dispatched since the last rebalance
+        uint64_t load = 0;
+    };
+
+    struct ContractLoad
+    {
+        uint64_t txCount = 0;
+        uint64_t elapsed = 0;  // microseconds since the last rebalance
+        uint64_t load = 0;     // exponential moving average of elapsed over the rebalances
     };
 
     struct ExecutorInfoComp
     {
         bool operator()(const ExecutorInfo::Ptr& lhs, const ExecutorInfo::Ptr& rhs) const
         {
+            if (lhs->load != rhs->load)
+            {
+                return lhs->load > rhs->load;
+            }
             return lhs->contracts.size() > rhs->contracts.size();
         }
     };
 
+    void resetPriorityQueue();
+    // m_mutex and m_loadMutex must be held
+    std::vector<ExecutorLoad> collectLoads() const;
+
     tbb::concurrent_unordered_map<std::string_view, ExecutorInfo::Ptr, std::hash<std::string_view>>
         m_contract2ExecutorInfo;
     std::unordered_map<std::string_view, ExecutorInfo::Ptr, std::hash<std::string_view>>
         m_name2Executors;
     std::priority_queue<ExecutorInfo::Ptr, std::vector<ExecutorInfo::Ptr>, ExecutorInfoComp>
         m_executorPriorityQueue;
-    std::shared_mutex m_mutex;
+    mutable std::shared_mutex m_mutex;
+
+    std::unordered_map<std::string, ContractLoad> m_contractLoads;
+    // the average contract load, estimated load of a new contract
+    uint64_t m_newContractLoad = 0;
+    mutable std::mutex m_loadMutex;
 
     bcos::executor::ParallelTransactionExecutorInterface::Ptr const& executorView(
         const decltype(m_name2Executors)::value_type& value) const
@@ -1,6 +1,7 @@
 #include "SchedulerImpl.h"
 #include "Common.h"
 #include "bcos-framework/interfaces/ledger/LedgerConfig.h"
+#include "bcos-framework/interfaces/metrics/Metrics.h"
 #include "bcos-framework/interfaces/protocol/ProtocolTypeDef.h"
 #include <bcos-utilities/Error.h>
 #include <boost/exception/diagnostic_information.hpp>
@@ -97,6 +98,13 @@ void SchedulerImpl::executeBlock(bcos::protocol::Block::Ptr block, bool verify,
             return;
         }
     }
+
+    if (m_blocks.empty())
+    {
+        // All executed blocks are committed, the executors hold no block state, so contracts can
+        // move between them
+        m_executorManager->rebalance();
+    }
     m_blocks.emplace_back(std::move(block), this, 0, m_transactionSubmitResultFactory, false,
         m_blockFactory, m_gasLimit, verify);
     auto& blockExecutive = m_blocks.back();
@@ -221,6 +229,10 @@ void SchedulerImpl::commitBlock(bcos::protocol::BlockHeader::Ptr header,
                 nullptr);
             return;
         }
+        static auto& committedBlocks = metrics::counter(metrics::c_committedBlocks);
+        static auto& committedTxs = metrics::counter(metrics::c_committedTxs);
+        committedBlocks.add();
+        committedTxs.add(block->receiptsSize());
 
         asyncGetLedgerConfig([this, commitLock = std::move(commitLock),
                                  callback = std::move(callback)](
@@ -254,8 +266,10 @@ void SchedulerImpl::commitBlock(bcos::protocol::BlockHeader::Ptr header,
                 SCHEDULER_LOG(INFO) << "Start notify block result: " << blockNumber;
                 frontBlock.asyncNotify(m_txNotifier,
                     [this, blockNumber, callback = std::move(callback),
-                        ledgerConfig = std::move(ledgerConfig),
-                        commitLock = std::move(commitLock)](Error::Ptr _error) mutable {
+                        ledgerConfig = std::move(ledgerConfig), commitLock = std::move(commitLock),
+                        startT = std::chrono::steady_clock::now()](Error::Ptr _error) mutable {
+                        static auto& notifyLatency = metrics::histogram(metrics::c_notifyStage);
+                        notifyLatency.recordElapsed(startT);
                         if (m_blockNumberReceiver)
                         {
                             m_blockNumberReceiver(blockNumber);
@@ -309,17 +323,18 @@ void SchedulerImpl::call(protocol::Transaction::Ptr tx,
     // set attribute before call
     tx->setAttribute(m_isWasm ? bcos::protocol::Transaction::Attribute::LIQUID_SCALE_CODEC :
                                 bcos::protocol::Transaction::Attribute::EVM_ABI_CODEC);
-    // Create temp block
-    auto block = m_blockFactory->createBlock();
-    block->appendTransaction(std::move(tx));
-
-    // Create temp executive
-    auto blockExecutive =
-        std::make_shared<BlockExecutive>(std::move(block), this, m_calledContextID.fetch_add(1),
-            m_transactionSubmitResultFactory, true, m_blockFactory, m_gasLimit, false);
+    if (m_executorManager->size() == 0)
+    {
+        callback(BCOS_ERROR_PTR(
+                     SchedulerError::ExecutorNotEstablishedError, "The executor has not started!"),
+            nullptr);
+        return;
+    }
 
-    blockExecutive->asyncCall([callback = std::move(callback)](Error::UniquePtr&& error,
-                                  protocol::TransactionReceipt::Ptr&& receipt) {
+    auto callExecutive = std::make_shared<CallExecutive>(
+        std::move(tx), this, m_calledContextID.fetch_add(1), m_gasLimit);
+    callExecutive->asyncCall([callback = std::move(callback)](Error::UniquePtr&& error,
+                                 protocol::TransactionReceipt::Ptr&& receipt) {
         if (error)
         {
             SCHEDULER_LOG(ERROR) << "Unknown error, " << boost::diagnostic_information(*error);
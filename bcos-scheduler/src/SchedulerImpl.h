@@ -1,6 +1,7 @@
 #pragma once
 
 #include "BlockExecutive.h"
+#include "CallExecutive.h"
 #include "ExecutorManager.h"
 #include "bcos-framework/interfaces/dispatcher/SchedulerInterface.h"
 #include "bcos-framework/interfaces/ledger/LedgerInterface.h"
@@ -20,6 +21,7 @@ class SchedulerImpl : public SchedulerInterface, public std::enable_shared_from_
 {
 public:
     friend class BlockExecutive;
+    friend class CallExecutive;
 
     SchedulerImpl(ExecutorManager::Ptr executorManager, bcos::ledger::LedgerInterface::Ptr ledger,
         bcos::storage::TransactionalStorageInterface::Ptr storage,
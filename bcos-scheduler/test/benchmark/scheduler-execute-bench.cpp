@@ -0,0 +1,72 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the elapsed time of the scheduler executing a block of many txs to many contracts,
+ * the mock executors check the messages with Boost.Test so it runs as a test module:
+ * scheduler-execute-bench -- [txCount] [contractCount]
+ * @file scheduler-execute-bench.cpp
+ */
+#define BOOST_TEST_MODULE SchedulerExecuteBench
+#include "SchedulerFixture.h"
+#include "mock/MockMultiParallelExecutor.h"
+#include <bcos-tars-protocol/protocol/TransactionMetaDataImpl.h>
+#include <boost/lexical_cast.hpp>
+#include <boost/test/unit_test.hpp>
+#include <chrono>
+#include <future>
+#include <iostream>
+
+using namespace bcos;
+
+namespace bcos::test
+{
+BOOST_FIXTURE_TEST_CASE(executeBlock, SchedulerFixture)
+{
+    auto& suite = boost::unit_test::framework::master_test_suite();
+    size_t txCount = suite.argc > 1 ? std::stoul(suite.argv[1]) : 50000;
+    size_t contractCount = suite.argc > 2 ? std::stoul(suite.argv[2]) : 100;
+
+    executorManager->addExecutor(
+        "executor1", std::make_shared<MockMultiParallelExecutor>("executor1"));
+    executorManager->addExecutor(
+        "executor2", std::make_shared<MockMultiParallelExecutor>("executor2"));
+
+    // tx hashes stay clear of the error hash of the mock executor
+    auto block = blockFactory->createBlock();
+    block->blockHeader()->setNumber(100);
+    for (size_t i = 0; i < txCount; ++i)
+    {
+        auto metaTx = std::make_shared<bcostars::protocol::TransactionMetaDataImpl>(
+            h256(i + 100000), "contract" + boost::lexical_cast<std::string>(i % contractCount));
+        block->appendTransactionMetaData(std::move(metaTx));
+    }
+
+    std::promise<bcos::protocol::BlockHeader::Ptr> executedHeader;
+    auto startTime = std::chrono::steady_clock::now();
+    scheduler->executeBlock(
+        block, false, [&](bcos::Error::Ptr error, bcos::protocol::BlockHeader::Ptr header, bool) {
+            BOOST_CHECK(!error);
+            executedHeader.set_value(std::move(header));
+        });
+
+    auto header = executedHeader.get_future().get();
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - startTime);
+    BOOST_CHECK(header);
+
+    std::cout << "Execute block with " << txCount << " txs to " << contractCount
+              << " contracts, elapsed: " << elapsed.count() << "ms" << std::endl;
+}
+}  // namespace bcos::test
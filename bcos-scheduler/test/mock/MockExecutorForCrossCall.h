@@ -0,0 +1,86 @@
+#pragma once
+
+#include "Common.h"
+#include "MockExecutor.h"
+#include "bcos-framework/interfaces/executor/ExecutionMessage.h"
+#include <tuple>
+#include <vector>
+
+namespace bcos::test
+{
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+// contract_a calls contract_b, the executors log the messages of the call in order
+class MockParallelExecutorForCrossCall : public MockParallelExecutor
+{
+public:
+    using CallLog = std::vector<std::tuple<std::string, protocol::ExecutionMessage::Type, int64_t>>;
+
+    MockParallelExecutorForCrossCall(const std::string& name, std::shared_ptr<CallLog> callLog)
+      : MockParallelExecutor(name), m_callLog(std::move(callLog))
+    {}
+
+    ~MockParallelExecutorForCrossCall() override {}
+
+    void executeTransaction(bcos::protocol::ExecutionMessage::UniquePtr input,
+        std::function<void(bcos::Error::UniquePtr, bcos::protocol::ExecutionMessage::UniquePtr)>
+            callback) override
+    {
+        BOOST_FAIL("Unexpected execute!");
+    }
+
+    void call(bcos::protocol::ExecutionMessage::UniquePtr input,
+        std::function<void(bcos::Error::UniquePtr, bcos::protocol::ExecutionMessage::UniquePtr)>
+            callback) override
+    {
+        BOOST_CHECK(input->staticCall());
+        m_callLog->emplace_back(name(), input->type(), input->seq());
+
+        auto inputBytes = input->data();
+        std::string inputStr((char*)inputBytes.data(), inputBytes.size());
+        if (input->type() == protocol::ExecutionMessage::MESSAGE && input->to() == "contract_a")
+        {
+            // contract_a calls contract_b
+            BOOST_CHECK_EQUAL(input->depth(), 0);
+            input->setFrom("contract_a");
+            input->setTo("contract_b");
+            input->setDepth(1);
+            std::string data = "request b";
+            input->setData(bcos::bytes(data.begin(), data.end()));
+            callback(nullptr, std::move(input));
+            return;
+        }
+        if (input->type() == protocol::ExecutionMessage::MESSAGE && input->to() == "contract_b")
+        {
+            // contract_b returns to contract_a
+            BOOST_CHECK_EQUAL(input->depth(), 1);
+            BOOST_CHECK_EQUAL(inputStr, "request b");
+            input->setType(protocol::ExecutionMessage::FINISHED);
+            input->setFrom("contract_b");
+            input->setTo("contract_a");
+            std::string data = "response b";
+            input->setData(bcos::bytes(data.begin(), data.end()));
+            input->setStatus(0);
+            input->setGasAvailable(input->gasAvailable() - 100);
+            callback(nullptr, std::move(input));
+            return;
+        }
+
+        // contract_a resumes with the output of contract_b and finishes the call
+        BOOST_CHECK_EQUAL(input->type(), protocol::ExecutionMessage::FINISHED);
+        BOOST_CHECK_EQUAL(input->to(), "contract_a");
+        BOOST_CHECK_EQUAL(inputStr, "response b");
+        input->setFrom("contract_a");
+        input->setTo(std::string(input->origin()));
+        input->setDepth(0);
+        std::string data = "response a";
+        input->setData(bcos::bytes(data.begin(), data.end()));
+        input->setGasAvailable(input->gasAvailable() - 100);
+        callback(nullptr, std::move(input));
+    }
+
+private:
+    std::shared_ptr<CallLog> m_callLog;
+};
+#pragma GCC diagnostic pop
+}  // namespace bcos::test
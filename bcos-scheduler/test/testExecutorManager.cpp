@@ -1,8 +1,10 @@
 #include "ExecutorManager.h"
 #include "bcos-framework/interfaces/executor/ParallelTransactionExecutorInterface.h"
 #include "mock/MockExecutor.h"
+#include <bcos-framework/interfaces/executor/NativeExecutionMessage.h>
 #include <bcos-utilities/Common.h>
 #include <boost/test/unit_test.hpp>
+#include <chrono>
 #include <memory>
 
 namespace bcos::test
@@ -176,5 +178,128 @@ BOOST_AUTO_TEST_CASE(remove)
     BOOST_CHECK_THROW(executorManager->removeExecutor("2"), bcos::Exception);
 }
 
+BOOST_AUTO_TEST_CASE(executeTransactionsInOrder)
+{
+    // the first message waits for an external call holding key1
+    class MockInOrderExecutor : public MockParallelExecutor
+    {
+    public:
+        MockInOrderExecutor() : MockParallelExecutor("inOrder") {}
+
+        void executeTransaction(bcos::protocol::ExecutionMessage::UniquePtr input,
+            std::function<void(bcos::Error::UniquePtr, bcos::protocol::ExecutionMessage::UniquePtr)>
+                callback) override
+        {
+            contextIDs.push_back(input->contextID());
+            if (input->contextID() == 0)
+            {
+                input->setType(bcos::protocol::ExecutionMessage::MESSAGE);
+                input->setKeyLocks({"key1"});
+            }
+            else
+            {
+                BOOST_CHECK_EQUAL(input->keyLocks().size(), 2);
+                BOOST_CHECK_EQUAL(input->keyLocks()[1], "key1");
+                input->setType(bcos::protocol::ExecutionMessage::FINISHED);
+            }
+            callback(nullptr, std::move(input));
+        }
+
+        std::vector<int64_t> contextIDs;
+    };
+
+    auto executor = std::make_shared<MockInOrderExecutor>();
+    std::vector<bcos::protocol::ExecutionMessage::UniquePtr> messages;
+    for (int64_t i = 0; i < 100; ++i)
+    {
+        auto message = std::make_unique<bcos::executor::NativeExecutionMessage>();
+        message->setType(bcos::protocol::ExecutionMessage::MESSAGE);
+        message->setContextID(i);
+        message->setTo("contract1");
+        message->setKeyLocks({"key0"});
+        messages.emplace_back(std::move(message));
+    }
+
+    bool finished = false;
+    executor->executeTransactions("contract1", messages,
+        [&](bcos::Error::UniquePtr error,
+            std::vector<bcos::protocol::ExecutionMessage::UniquePtr> responses) {
+            BOOST_CHECK(!error);
+            BOOST_CHECK_EQUAL(responses.size(), 100);
+            for (size_t i = 0; i < responses.size(); ++i)
+            {
+                BOOST_CHECK_EQUAL(responses[i]->contextID(), i);
+            }
+            finished = true;
+        });
+    BOOST_CHECK(finished);
+    BOOST_CHECK_EQUAL(executor->contextIDs.size(), 100);
+    BOOST_CHECK(std::is_sorted(executor->contextIDs.begin(), executor->contextIDs.end()));
+}
+
+BOOST_AUTO_TEST_CASE(rebalance)
+{
+    BOOST_CHECK_NO_THROW(
+        executorManager->addExecutor("1", std::make_shared<MockParallelExecutor>("1")));
+    BOOST_CHECK_NO_THROW(
+        executorManager->addExecutor("2", std::make_shared<MockParallelExecutor>("2")));
+
+    auto executorName = [this](const std::string& contract) {
+        return std::dynamic_pointer_cast<MockParallelExecutor>(
+            executorManager->dispatchExecutor(contract))
+            ->name();
+    };
+
+    // the contracts of executor 1 are hot
+    std::set<std::string> hotContracts;
+    for (auto contract : {"a", "b", "c", "d"})
+    {
+        if (executorName(contract) == "1")
+        {
+            hotContracts.insert(contract);
+            executorManager->recordExecution(contract, 10, std::chrono::milliseconds(100));
+        }
+        else
+        {
+            executorManager->recordExecution(contract, 1, std::chrono::milliseconds(1));
+        }
+    }
+    BOOST_CHECK_EQUAL(hotContracts.size(), 2);
+
+    for (auto& executorLoad : executorManager->utilization())
+    {
+        BOOST_CHECK_EQUAL(executorLoad.contracts, 2);
+        BOOST_CHECK_EQUAL(executorLoad.txCount, executorLoad.name == "1" ? 20 : 2);
+    }
+
+    executorManager->rebalance();
+
+    std::map<std::string, int> executor2hot;
+    for (auto& contract : hotContracts)
+    {
+        ++executor2hot[executorName(contract)];
+    }
+    BOOST_CHECK_EQUAL(executor2hot["1"], 1);
+    BOOST_CHECK_EQUAL(executor2hot["2"], 1);
+
+    auto executorLoads = executorManager->utilization();
+    BOOST_CHECK_EQUAL(executorLoads.size(), 2);
+    for (auto& executorLoad : executorLoads)
+    {
+        BOOST_CHECK_EQUAL(executorLoad.contracts, 2);
+        BOOST_CHECK_EQUAL(executorLoad.txCount, 0);
+        BOOST_CHECK_CLOSE(executorLoad.utilization, 0.5, 0.001);
+    }
+
+    // the balanced contracts stay in place
+    executorManager->rebalance();
+    for (auto& contract : hotContracts)
+    {
+        ++executor2hot[executorName(contract)];
+    }
+    BOOST_CHECK_EQUAL(executor2hot["1"], 2);
+    BOOST_CHECK_EQUAL(executor2hot["2"], 2);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 }  // namespace bcos::test
\ No newline at end of file
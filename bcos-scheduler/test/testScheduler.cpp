@@ -10,11 +10,13 @@
 #include "bcos-framework/interfaces/protocol/TransactionSubmitResult.h"
 #include "bcos-framework/interfaces/storage/StorageInterface.h"
 #include "bcos-protocol/TransactionSubmitResultFactoryImpl.h"
+#include "SchedulerFixture.h"
 #include "mock/MockDeadLockExecutor.h"
 #include "mock/MockExecutor.h"
 #include "mock/MockExecutor3.h"
 #include "mock/MockExecutorForCall.h"
 #include "mock/MockExecutorForCreate.h"
+#include "mock/MockExecutorForCrossCall.h"
 #include "mock/MockExecutorForMessageDAG.h"
 #include "mock/MockLedger.h"
 #include "mock/MockMultiParallelExecutor.h"
@@ -43,87 +45,6 @@ using namespace bcos::crypto;
 
 namespace bcos::test
 {
-struct SchedulerFixture
-{
-    SchedulerFixture()
-    {
-        hashImpl = std::make_shared<Keccak256>();
-        signature = std::make_shared<Secp256k1Crypto>();
-        suite = std::make_shared<bcos::crypto::CryptoSuite>(hashImpl, signature, nullptr);
-
-        ledger = std::make_shared<MockLedger>();
-        executorManager = std::make_shared<scheduler::ExecutorManager>();
-        storage = std::make_shared<MockTransactionalStorage>();
-
-        auto stateStorage = std::make_shared<storage::StateStorage>(nullptr);
-        storage->m_storage = stateStorage;
-
-        transactionFactory = std::make_shared<bcostars::protocol::TransactionFactoryImpl>(suite);
-        transactionReceiptFactory =
-            std::make_shared<bcostars::protocol::TransactionReceiptFactoryImpl>(suite);
-        executionMessageFactory = std::make_shared<bcos::executor::NativeExecutionMessageFactory>();
-
-        blockHeaderFactory = std::make_shared<bcostars::protocol::BlockHeaderFactoryImpl>(suite);
-        blockFactory = std::make_shared<bcostars::protocol::BlockFactoryImpl>(
-            suite, blockHeaderFactory, transactionFactory, transactionReceiptFactory);
-
-        transactionSubmitResultFactory =
-            std::make_shared<bcos::protocol::TransactionSubmitResultFactoryImpl>();
-        auto notifier = [/*latch = &latch*/](bcos::protocol::BlockNumber,
-                            bcos::protocol::TransactionSubmitResultsPtr _results,
-                            std::function<void(Error::Ptr)> _callback) {
-            SCHEDULER_LOG(TRACE) << "Submit callback execute, results size:" << _results->size();
-            if (_callback)
-            {
-                _callback(nullptr);
-            }
-            // BOOST_CHECK(_results->size() == 8000);
-            /*BOOST_CHECK_EQUAL(result->status(), 0);
-            BOOST_CHECK_NE(result->blockHash(), h256(0));
-            BOOST_CHECK(result->transactionReceipt());
-            BOOST_CHECK_LT(result->transactionIndex(), 1000 * 8);*/
-
-            // auto receipt = result->transactionReceipt();
-            // auto output = receipt->output();
-            // std::string_view outputStr((char*)output.data(), output.size());
-            // BOOST_CHECK_EQUAL(outputStr, "Hello world!");
-            /*if (latch)
-            {
-                latch->get()->count_down();
-            }*/
-        };
-
-        scheduler = std::make_shared<scheduler::SchedulerImpl>(executorManager, ledger, storage,
-            executionMessageFactory, blockFactory, transactionSubmitResultFactory, hashImpl, true,
-            false);
-
-        std::dynamic_pointer_cast<scheduler::SchedulerImpl>(scheduler)->registerTransactionNotifier(
-            std::move(notifier));
-
-        std::dynamic_pointer_cast<scheduler::SchedulerImpl>(scheduler)->fetchGasLimit();
-
-        keyPair = suite->signatureImpl()->generateKeyPair();
-    }
-
-    ledger::LedgerInterface::Ptr ledger;
-    scheduler::ExecutorManager::Ptr executorManager;
-    std::shared_ptr<MockTransactionalStorage> storage;
-    protocol::ExecutionMessageFactory::Ptr executionMessageFactory;
-    protocol::TransactionReceiptFactory::Ptr transactionReceiptFactory;
-    protocol::BlockHeaderFactory::Ptr blockHeaderFactory;
-    bcos::crypto::Hash::Ptr hashImpl;
-    scheduler::SchedulerImpl::Ptr scheduler;
-    bcos::crypto::KeyPairInterface::Ptr keyPair;
-
-    bcostars::protocol::TransactionFactoryImpl::Ptr transactionFactory;
-    bcos::crypto::SignatureCrypto::Ptr signature;
-    bcos::crypto::CryptoSuite::Ptr suite;
-    bcostars::protocol::BlockFactoryImpl::Ptr blockFactory;
-    bcos::protocol::TransactionSubmitResultFactory::Ptr transactionSubmitResultFactory;
-
-    std::unique_ptr<boost::latch> latch;
-};
-
 BOOST_FIXTURE_TEST_SUITE(Scheduler, SchedulerFixture)
 
 BOOST_AUTO_TEST_CASE(executeBlock)
@@ -315,6 +236,47 @@ BOOST_AUTO_TEST_CASE(call)
     }
 }
 
+BOOST_AUTO_TEST_CASE(crossExecutorCall)
+{
+    auto callLog = std::make_shared<MockParallelExecutorForCrossCall::CallLog>();
+    executorManager->addExecutor("executor1",
+        std::make_shared<MockParallelExecutorForCrossCall>("executor1", callLog));
+    executorManager->addExecutor("executor2",
+        std::make_shared<MockParallelExecutorForCrossCall>("executor2", callLog));
+
+    // the contracts are dispatched to the least loaded executors
+    auto executorA = executorManager->dispatchExecutor("contract_a");
+    auto executorB = executorManager->dispatchExecutor("contract_b");
+    BOOST_CHECK_NE(executorA, executorB);
+    auto nameA = std::dynamic_pointer_cast<MockParallelExecutor>(executorA)->name();
+    auto nameB = std::dynamic_pointer_cast<MockParallelExecutor>(executorB)->name();
+
+    std::string inputStr = "request a";
+    auto tx = blockFactory->transactionFactory()->createTransaction(0, "contract_a",
+        bytes(inputStr.begin(), inputStr.end()), 200, 300, "chain", "group", 500, keyPair);
+
+    bcos::protocol::TransactionReceipt::Ptr receipt;
+    scheduler->call(
+        tx, [&](bcos::Error::Ptr error, bcos::protocol::TransactionReceipt::Ptr receiptResponse) {
+            BOOST_CHECK(!error);
+            receipt = std::move(receiptResponse);
+        });
+    BOOST_REQUIRE(receipt);
+    BOOST_CHECK_EQUAL(receipt->status(), 0);
+    BOOST_CHECK_EQUAL(receipt->gasUsed(), 200);
+    auto output = receipt->output();
+    BOOST_CHECK_EQUAL(std::string((char*)output.data(), output.size()), "response a");
+
+    // the call to contract_b is pushed with a new seq, its return is popped back to the seq of
+    // contract_a on the other executor
+    auto expected = MockParallelExecutorForCrossCall::CallLog{
+        {nameA, protocol::ExecutionMessage::MESSAGE, 0},
+        {nameB, protocol::ExecutionMessage::MESSAGE, 1},
+        {nameA, protocol::ExecutionMessage::FINISHED, 0},
+    };
+    BOOST_CHECK(*callLog == expected);
+}
+
 BOOST_AUTO_TEST_CASE(registerExecutor)
 {
     auto executor = std::make_shared<MockParallelExecutor>("executor1");
@@ -19,6 +19,7 @@
  */
 #include "Sealer.h"
 #include "Common.h"
+#include <bcos-framework/interfaces/metrics/Metrics.h>
 using namespace bcos;
 using namespace bcos::sealer;
 using namespace bcos::protocol;
@@ -100,9 +101,15 @@ void Sealer::executeWorker()
     // try to generateProposal
     if (m_sealingManager->shouldGenerateProposal())
     {
+        auto startT = std::chrono::steady_clock::now();
         auto ret = m_sealingManager->generateProposal();
         auto proposal = ret.second;
         submitProposal(ret.first, proposal);
+        if (proposal)
+        {
+            static auto& sealLatency = metrics::histogram(metrics::c_sealStage);
+            sealLatency.recordElapsed(startT);
+        }
     }
     // try to fetch transactions
     if (m_sealingManager->shouldFetchTransaction())
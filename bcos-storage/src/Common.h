@@ -26,6 +26,53 @@
 namespace bcos::storage
 {
 const char* const TABLE_KEY_SPLIT = ":";
+// the dictionary of table name to table id, stored as SYS_TABLE_IDS:tableName => varint(id)
+const char* const SYS_TABLE_IDS = "s_table_ids";
+// the column family of the table, stored as SYS_COLUMN_FAMILIES:tableName => column family name
+const char* const SYS_COLUMN_FAMILIES = "s_column_families";
+// the key encoding of the db, stored without TABLE_KEY_SPLIT so it never clashes with a row
+const char* const SYS_KEY_ENCODING = "s_key_encoding";
+// the keys encoded with table id start with this byte, table names never do
+constexpr char TABLE_ID_KEY_PREFIX = '\0';
+
+enum class KeyEncoding : int8_t
+{
+    TABLE_NAME = 0,  // tableName:key
+    TABLE_ID = 1,    // \0 varint(tableID) key
+};
+
+inline void appendVarint(std::string& _out, uint64_t _value)
+{
+    while (_value >= 0x80)
+    {
+        _out.push_back(static_cast<char>((_value & 0x7f) | 0x80));
+        _value >>= 7;
+    }
+    _out.push_back(static_cast<char>(_value));
+}
+
+// return the value and the size of the varint at the front of _data, size 0 if it is invalid
+inline std::pair<uint64_t, size_t> decodeVarint(const std::string_view& _data)
+{
+    uint64_t value = 0;
+    for (size_t i = 0; i < _data.size() && i < 10; ++i)
+    {
+        auto byte = static_cast<uint8_t>(_data[i]);
+        value |= static_cast<uint64_t>(byte & 0x7f) << (7 * i);
+        if ((byte & 0x80) == 0)
+        {
+            return {value, i + 1};
+        }
+    }
+    return {0, 0};
+}
+
+inline std::string toTableIDPrefix(uint64_t _tableID)
+{
+    std::string prefix(1, TABLE_ID_KEY_PREFIX);
+    appendVarint(prefix, _tableID);
+    return prefix;
+}
 
 inline std::string toDBKey(const std::string_view& tableName, const std::string_view& key)
 {
@@ -20,15 +20,22 @@
  */
 #include "RocksDBStorage.h"
 #include "Common.h"
+#include "bcos-framework/interfaces/metrics/Metrics.h"
 #include "bcos-framework/interfaces/protocol/ProtocolTypeDef.h"
 #include "bcos-framework/interfaces/storage/Table.h"
 #include <bcos-utilities/Error.h>
 #include <rocksdb/cleanable.h>
 #include <rocksdb/options.h>
 #include <rocksdb/slice.h>
+#include <rocksdb/sst_file_writer.h>
+#include <rocksdb/write_batch.h>
 #include <tbb/concurrent_vector.h>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_sort.h>
 #include <tbb/spin_mutex.h>
 #include <boost/algorithm/hex.hpp>
+#include <boost/exception/diagnostic_information.hpp>
+#include <boost/filesystem.hpp>
 #include <exception>
 #include <future>
 #include <optional>
@@ -39,9 +46,587 @@ using namespace std;
 
 #define STORAGE_ROCKSDB_LOG(LEVEL) BCOS_LOG(LEVEL) << "[STORAGE-RocksDB]"
 
-RocksDBStorage::RocksDBStorage(std::unique_ptr<rocksdb::DB>&& db) : m_db(std::move(db))
+namespace
+{
+// replay the records of the per-thread batches into one batch through the public api
+class WriteBatchAppender : public WriteBatch::Handler
+{
+public:
+    WriteBatchAppender(WriteBatch& _target, const std::vector<ColumnFamilyHandle*>& _handles)
+      : m_target(_target)
+    {
+        for (auto handle : _handles)
+        {
+            m_handles[handle->GetID()] = handle;
+        }
+    }
+
+    Status PutCF(uint32_t _columnFamilyID, const Slice& _key, const Slice& _value) override
+    {
+        return m_target.Put(m_handles.at(_columnFamilyID), _key, _value);
+    }
+
+    Status DeleteCF(uint32_t _columnFamilyID, const Slice& _key) override
+    {
+        return m_target.Delete(m_handles.at(_columnFamilyID), _key);
+    }
+
+private:
+    WriteBatch& m_target;
+    std::map<uint32_t, ColumnFamilyHandle*> m_handles;
+};
+
+struct SSTItem
+{
+    Slice key;
+    Slice value;
+    bool deleted;
+};
+
+// collect the records of a write batch per column family as slices referring to the batch itself
+class SSTItemCollector : public WriteBatch::Handler
+{
+public:
+    explicit SSTItemCollector(std::map<uint32_t, std::vector<SSTItem>>& _items) : m_items(_items)
+    {}
+
+    Status PutCF(uint32_t _columnFamilyID, const Slice& _key, const Slice& _value) override
+    {
+        m_items[_columnFamilyID].push_back(SSTItem{_key, _value, false});
+        return Status::OK();
+    }
+
+    Status DeleteCF(uint32_t _columnFamilyID, const Slice& _key) override
+    {
+        m_items[_columnFamilyID].push_back(SSTItem{_key, Slice(), true});
+        return Status::OK();
+    }
+
+private:
+    std::map<uint32_t, std::vector<SSTItem>>& m_items;
+};
+
+// extract \0 varint(tableID) from the TABLE_ID encoded keys
+class TableIDPrefixExtractor : public SliceTransform
+{
+public:
+    const char* Name() const override { return "bcos.TableIDPrefixExtractor"; }
+
+    Slice Transform(const Slice& _key) const override
+    {
+        return Slice(_key.data(), prefixSize(_key));
+    }
+
+    bool InDomain(const Slice& _key) const override { return prefixSize(_key) > 0; }
+
+private:
+    static size_t prefixSize(const Slice& _key)
+    {
+        if (_key.empty() || _key[0] != TABLE_ID_KEY_PREFIX)
+        {
+            return 0;
+        }
+        auto [tableID, size] = decodeVarint(std::string_view(_key.data() + 1, _key.size() - 1));
+        std::ignore = tableID;
+        return size == 0 ? 0 : size + 1;
+    }
+};
+}  // namespace
+
+RocksDBStorage::RocksDBStorage(std::unique_ptr<rocksdb::DB>&& db, KeyEncoding _keyEncoding,
+    std::vector<rocksdb::ColumnFamilyHandle*> _columnFamilies,
+    std::map<std::string, std::string> const& _tableColumnFamilies, bool _readOnly)
+  : m_db(std::move(db)), m_readOnly(_readOnly), m_columnFamilies(std::move(_columnFamilies))
 {
     m_writeBatch = std::make_shared<WriteBatch>();
+    initColumnFamilies(_tableColumnFamilies);
+    initKeyEncoding(_keyEncoding);
+}
+
+RocksDBStorage::~RocksDBStorage()
+{
+    // the column family handles must be released before the db
+    for (auto handle : m_columnFamilies)
+    {
+        m_db->DestroyColumnFamilyHandle(handle);
+    }
+    m_columnFamilies.clear();
+    m_db.reset();
+}
+
+void RocksDBStorage::initColumnFamilies(
+    std::map<std::string, std::string> const& _tableColumnFamilies)
+{
+    // the mapping is persisted at the first open whatever the config is, the entry of the empty
+    // table name marks it as persisted even if no table is mapped
+    std::map<std::string, std::string> tableColumnFamilies;
+    bool persisted = false;
+    std::string mappingPrefix = toDBKey(SYS_COLUMN_FAMILIES, "");
+    ReadOptions readOptions;
+    readOptions.total_order_seek = true;
+    std::unique_ptr<Iterator> iter(m_db->NewIterator(readOptions));
+    for (iter->Seek(mappingPrefix); iter->Valid() && iter->key().starts_with(mappingPrefix);
+         iter->Next())
+    {
+        persisted = true;
+        auto table = iter->key().ToString().substr(mappingPrefix.size());
+        if (!table.empty())
+        {
+            tableColumnFamilies.emplace(std::move(table), iter->value().ToString());
+        }
+    }
+
+    if (!persisted)
+    {
+        iter->SeekToFirst();
+        if (iter->Valid() && !_tableColumnFamilies.empty())
+        {
+            // the rows of the existing db are all in the default column family
+            STORAGE_ROCKSDB_LOG(WARNING)
+                << LOG_DESC("the db is not empty, ignore the column families of the config");
+        }
+        else
+        {
+            tableColumnFamilies = _tableColumnFamilies;
+        }
+    }
+    if (!persisted && !m_readOnly)
+    {
+        WriteBatch writeBatch;
+        writeBatch.Put(mappingPrefix, "");
+        for (auto& [table, columnFamilyName] : tableColumnFamilies)
+        {
+            writeBatch.Put(toDBKey(SYS_COLUMN_FAMILIES, table), columnFamilyName);
+        }
+        WriteOptions options;
+        options.sync = true;
+        auto status = m_db->Write(options, &writeBatch);
+        if (!status.ok())
+        {
+            BOOST_THROW_EXCEPTION(
+                BCOS_ERROR(WriteError, "Persist column families failed! " + status.ToString()));
+        }
+    }
+    else if (persisted && tableColumnFamilies != _tableColumnFamilies)
+    {
+        STORAGE_ROCKSDB_LOG(WARNING)
+            << LOG_DESC("the column families of the db differ from the config, use the db's")
+            << LOG_KV("db", tableColumnFamilies.size())
+            << LOG_KV("config", _tableColumnFamilies.size());
+    }
+
+    for (auto& [table, columnFamilyName] : tableColumnFamilies)
+    {
+        auto it = std::find_if(m_columnFamilies.begin(), m_columnFamilies.end(),
+            [&columnFamilyName = columnFamilyName](rocksdb::ColumnFamilyHandle* handle) {
+                return handle->GetName() == columnFamilyName;
+            });
+        if (it == m_columnFamilies.end())
+        {
+            BOOST_THROW_EXCEPTION(
+                BCOS_ERROR(ReadError, "The column family " + columnFamilyName + " of table " +
+                                          table + " is not opened!"));
+        }
+        m_tableColumnFamilies.emplace(table, *it);
+    }
+    STORAGE_ROCKSDB_LOG(INFO) << LOG_DESC("initColumnFamilies")
+                              << LOG_KV("columnFamilies", m_columnFamilies.size())
+                              << LOG_KV("tables", m_tableColumnFamilies.size());
+}
+
+rocksdb::ColumnFamilyHandle* RocksDBStorage::columnFamily(std::string_view _table) const
+{
+    if (m_tableColumnFamilies.empty())
+    {
+        return m_db->DefaultColumnFamily();
+    }
+    auto it = m_tableColumnFamilies.find(_table);
+    return it == m_tableColumnFamilies.end() ? m_db->DefaultColumnFamily() : it->second;
+}
+
+std::vector<rocksdb::ColumnFamilyHandle*> RocksDBStorage::columnFamilies() const
+{
+    if (m_columnFamilies.empty())
+    {
+        return {m_db->DefaultColumnFamily()};
+    }
+    return m_columnFamilies;
+}
+
+std::shared_ptr<const SliceTransform> RocksDBStorage::newTableIDPrefixExtractor()
+{
+    return std::make_shared<TableIDPrefixExtractor>();
+}
+
+std::optional<KeyEncoding> RocksDBStorage::persistedKeyEncoding(std::string const& _path)
+{
+    // the column families other than the default one needn't be opened in read only mode
+    DB* db = nullptr;
+    auto status = DB::OpenForReadOnly(Options(), _path, &db);
+    if (!status.ok())
+    {
+        return std::nullopt;
+    }
+    std::unique_ptr<DB> readOnlyDB(db);
+    std::string value;
+    status = readOnlyDB->Get(ReadOptions(), SYS_KEY_ENCODING, &value);
+    if (status.ok())
+    {
+        return static_cast<KeyEncoding>(boost::lexical_cast<int>(value));
+    }
+    if (!status.IsNotFound())
+    {
+        BOOST_THROW_EXCEPTION(
+            BCOS_ERROR(ReadError, "Get key encoding failed! " + status.ToString()));
+    }
+    // the table ids are allocated by an interrupted migration
+    std::string dictPrefix = toDBKey(SYS_TABLE_IDS, "");
+    ReadOptions readOptions;
+    readOptions.total_order_seek = true;
+    std::unique_ptr<Iterator> iter(readOnlyDB->NewIterator(readOptions));
+    iter->Seek(dictPrefix);
+    if (iter->Valid() && iter->key().starts_with(dictPrefix))
+    {
+        return KeyEncoding::TABLE_ID;
+    }
+    return KeyEncoding::TABLE_NAME;
+}
+
+void RocksDBStorage::initKeyEncoding(KeyEncoding _keyEncoding)
+{
+    std::string value;
+    auto status = m_db->Get(ReadOptions(), SYS_KEY_ENCODING, &value);
+    if (status.ok())
+    {
+        m_keyEncoding = static_cast<KeyEncoding>(boost::lexical_cast<int>(value));
+        if (m_keyEncoding != _keyEncoding)
+        {
+            STORAGE_ROCKSDB_LOG(WARNING)
+                << LOG_DESC("the key encoding of the db differs from the config, use the db's")
+                << LOG_KV("db", value) << LOG_KV("config", static_cast<int>(_keyEncoding));
+        }
+    }
+    else if (!status.IsNotFound())
+    {
+        BOOST_THROW_EXCEPTION(
+            BCOS_ERROR(ReadError, "Get key encoding failed! " + status.ToString()));
+    }
+
+    // load the table id dictionary
+    std::string dictPrefix = toDBKey(SYS_TABLE_IDS, "");
+    ReadOptions readOptions;
+    readOptions.total_order_seek = true;
+    std::unique_ptr<Iterator> iter(m_db->NewIterator(readOptions));
+    for (iter->Seek(dictPrefix); iter->Valid() && iter->key().starts_with(dictPrefix);
+         iter->Next())
+    {
+        auto tableName = iter->key().ToString().substr(dictPrefix.size());
+        auto [tableID, size] =
+            decodeVarint(std::string_view(iter->value().data(), iter->value().size()));
+        if (size == 0)
+        {
+            BOOST_THROW_EXCEPTION(BCOS_ERROR(ReadError, "Invalid table id of " + tableName));
+        }
+        m_tableKeyPrefixes.emplace(std::move(tableName), toTableIDPrefix(tableID));
+        m_nextTableID = std::max(m_nextTableID, tableID + 1);
+    }
+
+    // the migration interrupted before is resumed whatever _keyEncoding is, the rows already
+    // migrated can't be read by table name
+    if (status.IsNotFound() && m_readOnly && !m_tableKeyPrefixes.empty())
+    {
+        STORAGE_ROCKSDB_LOG(WARNING)
+            << LOG_DESC("the migration to table id of the read only db is not finished");
+    }
+    else if (status.IsNotFound() &&
+             (_keyEncoding == KeyEncoding::TABLE_ID || !m_tableKeyPrefixes.empty()))
+    {
+        // an empty db is migrated without rewriting any row
+        auto count = migrateToTableIDEncoding();
+        STORAGE_ROCKSDB_LOG(INFO) << LOG_DESC("initKeyEncoding migrate to table id")
+                                  << LOG_KV("count", count);
+    }
+    STORAGE_ROCKSDB_LOG(INFO) << LOG_DESC("initKeyEncoding")
+                              << LOG_KV("keyEncoding", static_cast<int>(m_keyEncoding))
+                              << LOG_KV("tables", m_tableKeyPrefixes.size());
+}
+
+size_t RocksDBStorage::migrateToTableIDEncoding()
+{
+    if (m_keyEncoding == KeyEncoding::TABLE_ID)
+    {
+        return 0;
+    }
+    constexpr size_t MIGRATE_BATCH_SIZE = 10000;
+    std::string dictPrefix = toDBKey(SYS_TABLE_IDS, "");
+    std::string mappingPrefix = toDBKey(SYS_COLUMN_FAMILIES, "");
+    WriteOptions writeOptions;
+    writeOptions.sync = true;
+    size_t count = 0;
+    ReadOptions readOptions;
+    readOptions.total_order_seek = true;
+    WriteBatch writeBatch;
+    // every batch moves the rows atomically, an interrupted migration resumes on next start
+    for (auto handle : columnFamilies())
+    {
+        std::unique_ptr<Iterator> iter(m_db->NewIterator(readOptions, handle));
+        for (iter->SeekToFirst(); iter->Valid(); iter->Next())
+        {
+            auto key = std::string_view(iter->key().data(), iter->key().size());
+            auto splitPos = key.find(TABLE_KEY_SPLIT);
+            if (key.empty() || key[0] == TABLE_ID_KEY_PREFIX ||
+                iter->key().starts_with(dictPrefix) || iter->key().starts_with(mappingPrefix) ||
+                splitPos == std::string_view::npos || splitPos == 0)
+            {
+                continue;
+            }
+            auto newKey = tableKeyPrefix(key.substr(0, splitPos), true);
+            if (!newKey)
+            {
+                BOOST_THROW_EXCEPTION(BCOS_ERROR(WriteError, "Allocate table id failed!"));
+            }
+            newKey->append(key.substr(splitPos + 1));
+            writeBatch.Put(handle, *newKey, iter->value());
+            writeBatch.Delete(handle, iter->key());
+            if (++count % MIGRATE_BATCH_SIZE == 0)
+            {
+                auto tables = writeTableIDs(writeBatch);
+                auto status = m_db->Write(writeOptions, &writeBatch);
+                publishTableIDs(tables, status.ok());
+                if (!status.ok())
+                {
+                    BOOST_THROW_EXCEPTION(BCOS_ERROR(
+                        WriteError, "Migrate key encoding failed! " + status.ToString()));
+                }
+                writeBatch.Clear();
+                STORAGE_ROCKSDB_LOG(INFO)
+                    << LOG_DESC("migrateToTableIDEncoding") << LOG_KV("count", count);
+            }
+        }
+    }
+    auto tables = writeTableIDs(writeBatch);
+    writeBatch.Put(SYS_KEY_ENCODING,
+        boost::lexical_cast<std::string>(static_cast<int>(KeyEncoding::TABLE_ID)));
+    auto status = m_db->Write(writeOptions, &writeBatch);
+    publishTableIDs(tables, status.ok());
+    if (!status.ok())
+    {
+        BOOST_THROW_EXCEPTION(
+            BCOS_ERROR(WriteError, "Migrate key encoding failed! " + status.ToString()));
+    }
+    m_keyEncoding = KeyEncoding::TABLE_ID;
+    STORAGE_ROCKSDB_LOG(INFO) << LOG_DESC("migrateToTableIDEncoding finished")
+                              << LOG_KV("count", count);
+    return count;
+}
+
+std::optional<std::string> RocksDBStorage::tableKeyPrefix(std::string_view _table, bool _create)
+{
+    {
+        std::shared_lock lock(m_tableKeyPrefixesMutex);
+        auto it = m_tableKeyPrefixes.find(_table);
+        if (it != m_tableKeyPrefixes.end())
+        {
+            return it->second;
+        }
+        if (!_create)
+        {
+            return std::nullopt;
+        }
+        it = m_pendingTableKeyPrefixes.find(_table);
+        if (it != m_pendingTableKeyPrefixes.end())
+        {
+            return it->second;
+        }
+    }
+
+    std::unique_lock lock(m_tableKeyPrefixesMutex);
+    auto it = m_pendingTableKeyPrefixes.find(_table);
+    if (it != m_pendingTableKeyPrefixes.end())
+    {
+        return it->second;
+    }
+    // the id is persisted by the write batch of the records, the dropped ids are never reused
+    auto tableID = m_nextTableID++;
+    m_unwrittenTableIDs.emplace_back(std::string(_table), tableID);
+    auto [inserted, success] =
+        m_pendingTableKeyPrefixes.emplace(std::string(_table), toTableIDPrefix(tableID));
+    std::ignore = success;
+    return inserted->second;
+}
+
+std::vector<std::string> RocksDBStorage::writeTableIDs(WriteBatch& _writeBatch)
+{
+    std::vector<std::string> tables;
+    std::unique_lock lock(m_tableKeyPrefixesMutex);
+    for (auto& [table, tableID] : m_unwrittenTableIDs)
+    {
+        std::string encodedID;
+        appendVarint(encodedID, tableID);
+        _writeBatch.Put(toDBKey(SYS_TABLE_IDS, table), encodedID);
+        tables.push_back(std::move(table));
+    }
+    m_unwrittenTableIDs.clear();
+    return tables;
+}
+
+void RocksDBStorage::publishTableIDs(std::vector<std::string> const& _tables, bool _success)
+{
+    if (_tables.empty())
+    {
+        return;
+    }
+    std::unique_lock lock(m_tableKeyPrefixesMutex);
+    for (auto const& table : _tables)
+    {
+        auto it = m_pendingTableKeyPrefixes.find(table);
+        if (it == m_pendingTableKeyPrefixes.end())
+        {
+            continue;
+        }
+        if (_success)
+        {
+            m_tableKeyPrefixes.emplace(table, std::move(it->second));
+        }
+        m_pendingTableKeyPrefixes.erase(it);
+    }
+}
+
+std::optional<std::string> RocksDBStorage::encodeDBKey(
+    std::string_view _table, std::string_view _key, bool _create)
+{
+    if (m_keyEncoding == KeyEncoding::TABLE_NAME)
+    {
+        return toDBKey(_table, _key);
+    }
+    auto prefix = tableKeyPrefix(_table, _create);
+    if (prefix)
+    {
+        prefix->append(_key);
+    }
+    return prefix;
+}
+
+void RocksDBStorage::setSSTIngestThreshold(size_t _threshold, std::string const& _sstPath)
+{
+    if (_threshold > 0)
+    {
+        boost::filesystem::create_directories(_sstPath);
+    }
+    m_sstIngestThreshold = _threshold;
+    m_sstIngestPath = _sstPath;
+    STORAGE_ROCKSDB_LOG(INFO) << LOG_DESC("setSSTIngestThreshold")
+                              << LOG_KV("threshold", _threshold) << LOG_KV("path", _sstPath);
+}
+
+std::vector<IngestExternalFileArg> RocksDBStorage::writeSSTFiles(
+    const TwoPCParams& params, const std::vector<const WriteBatch*>& writeBatches, size_t count)
+{
+    std::map<uint32_t, std::vector<SSTItem>> columnFamilyItems;
+    SSTItemCollector collector(columnFamilyItems);
+    for (auto batch : writeBatches)
+    {
+        auto status = batch->Iterate(&collector);
+        if (!status.ok())
+        {
+            STORAGE_ROCKSDB_LOG(WARNING) << LOG_DESC("writeSSTFiles iterate batch failed")
+                                         << LOG_KV("message", status.ToString());
+            return {};
+        }
+    }
+
+    std::vector<IngestExternalFileArg> ingestFiles;
+    auto handles = columnFamilies();
+    for (auto& [columnFamilyID, items] : columnFamilyItems)
+    {
+        auto handle = *std::find_if(handles.begin(), handles.end(),
+            [columnFamilyID = columnFamilyID](
+                ColumnFamilyHandle* handle) { return handle->GetID() == columnFamilyID; });
+        tbb::parallel_sort(items.begin(), items.end(),
+            [](const SSTItem& lhs, const SSTItem& rhs) { return lhs.key.compare(rhs.key) < 0; });
+
+        auto sstFile = (boost::filesystem::path(m_sstIngestPath) /
+                        ("prepare_" + boost::lexical_cast<std::string>(params.number) + "_" +
+                            boost::lexical_cast<std::string>(params.startTS) + "_" +
+                            boost::lexical_cast<std::string>(columnFamilyID) + ".sst"))
+                           .string();
+        SstFileWriter writer(EnvOptions(), m_db->GetOptions(handle), handle);
+        auto status = writer.Open(sstFile);
+        for (auto it = items.begin(); status.ok() && it != items.end(); ++it)
+        {
+            status = it->deleted ? writer.Delete(it->key) : writer.Put(it->key, it->value);
+        }
+        if (status.ok())
+        {
+            status = writer.Finish();
+        }
+
+        IngestExternalFileArg ingestFile;
+        ingestFile.column_family = handle;
+        ingestFile.external_files.push_back(std::move(sstFile));
+        // the files are moved into the db directory
+        ingestFile.options.move_files = true;
+        ingestFiles.push_back(std::move(ingestFile));
+        if (!status.ok())
+        {
+            // the sst writer requires strictly ascending keys, fallback to the write batch
+            STORAGE_ROCKSDB_LOG(WARNING)
+                << LOG_DESC("writeSSTFiles failed, fallback to write batch")
+                << LOG_KV("number", params.number) << LOG_KV("count", count)
+                << LOG_KV("message", status.ToString());
+            for (auto& it : ingestFiles)
+            {
+                boost::system::error_code ec;
+                boost::filesystem::remove(it.external_files[0], ec);
+            }
+            return {};
+        }
+    }
+    return ingestFiles;
+}
+
+void RocksDBStorage::appendWriteBatches(const std::vector<const WriteBatch*>& writeBatches)
+{
+    if (!m_writeBatch)
+    {
+        m_writeBatch = std::make_shared<WriteBatch>();
+    }
+    WriteBatchAppender appender(*m_writeBatch, columnFamilies());
+    for (auto batch : writeBatches)
+    {
+        auto status = batch->Iterate(&appender);
+        if (!status.ok())
+        {
+            BOOST_THROW_EXCEPTION(
+                BCOS_ERROR(WriteError, "Append write batch failed! " + status.ToString()));
+        }
+    }
+}
+
+void RocksDBStorage::ingestBatchesToWriteBatch()
+{
+    std::vector<const WriteBatch*> ingestBatches;
+    for (auto& batch : m_ingestBatches)
+    {
+        ingestBatches.push_back(&batch);
+    }
+    // m_writeBatch is empty while there are sst files
+    appendWriteBatches(ingestBatches);
+    removeIngestFiles();
+}
+
+void RocksDBStorage::removeIngestFiles()
+{
+    for (auto& ingestFile : m_ingestFiles)
+    {
+        for (auto& file : ingestFile.external_files)
+        {
+            boost::system::error_code ec;
+            boost::filesystem::remove(file, ec);
+        }
+    }
+    m_ingestFiles.clear();
+    m_ingestBatches.clear();
 }
 
 void RocksDBStorage::asyncGetPrimaryKeys(std::string_view _table,
@@ -51,22 +636,71 @@ void RocksDBStorage::asyncGetPrimaryKeys(std::string_view _table,
     auto start = utcTime();
     std::vector<std::string> result;
 
-    std::string keyPrefix;
-    keyPrefix = string(_table) + TABLE_KEY_SPLIT;
+    auto keyPrefix = encodeDBKey(_table, "", false);
+    if (!keyPrefix)
+    {
+        _callback(nullptr, std::move(result));
+        return;
+    }
+
+    // scan the key range of the conditions only, and stop once the limit is reached
+    std::string lowerBound = *keyPrefix;
+    std::optional<std::string> keyUpperBound;
+    size_t offset = 0;
+    size_t count = 0;
+    if (_condition)
+    {
+        lowerBound.append(_condition->lowerBound());
+        keyUpperBound = _condition->upperBound();
+        std::tie(offset, count) = _condition->getLimit();
+    }
 
     ReadOptions read_options;
-    read_options.total_order_seek = true;
-    auto iter = m_db->NewIterator(read_options);
+    std::string upperBound;
+    Slice upperBoundSlice;
+    if (keyUpperBound)
+    {
+        upperBound = *keyPrefix + *keyUpperBound;
+        upperBoundSlice = Slice(upperBound);
+        read_options.iterate_upper_bound = &upperBoundSlice;
+    }
+    if (m_keyEncoding == KeyEncoding::TABLE_ID)
+    {
+        if (!keyUpperBound)
+        {
+            // the last byte of varint is less than 0x80, the successor of the prefix never
+            // overflow
+            upperBound = *keyPrefix;
+            ++upperBound.back();
+            upperBoundSlice = Slice(upperBound);
+            read_options.iterate_upper_bound = &upperBoundSlice;
+        }
+        read_options.prefix_same_as_start = true;
+    }
+    else
+    {
+        read_options.total_order_seek = true;
+    }
+    auto iter = m_db->NewIterator(read_options, columnFamily(_table));
 
-    // FIXME: check performance and add limit of primary keys
-    for (iter->Seek(keyPrefix); iter->Valid() && iter->key().starts_with(keyPrefix); iter->Next())
+    size_t matched = 0;
+    for (iter->Seek(lowerBound); iter->Valid() && iter->key().starts_with(*keyPrefix);
+         iter->Next())
     {
-        size_t start = keyPrefix.size();
+        size_t start = keyPrefix->size();
         if (!_condition || _condition->isValid(std::string_view(
                                iter->key().data() + start, iter->key().size() - start)))
         {  // filter by condition, the key need
            // remove TABLE_PREFIX
+            if (matched++ < offset)
+            {
+                continue;
+            }
             result.emplace_back(iter->key().ToString().substr(start));
+            if (count > 0 && result.size() >= count)
+            {
+                break;
+            }
         }
     }
     delete iter;
@@ -92,10 +726,15 @@ void RocksDBStorage::asyncGetRow(std::string_view _table, std::string_view _key,
         }
         auto start = utcTime();
         std::string value;
-        auto dbKey = toDBKey(_table, _key);
+        auto dbKey = encodeDBKey(_table, _key, false);
+        if (!dbKey)
+        {
+            _callback(nullptr, {});
+            return;
+        }
 
         auto status = m_db->Get(
-            ReadOptions(), m_db->DefaultColumnFamily(), Slice(dbKey.data(), dbKey.size()), &value);
+            ReadOptions(), columnFamily(_table), Slice(dbKey->data(), dbKey->size()), &value);
 
         if (!status.ok())
         {
@@ -148,9 +787,16 @@ void RocksDBStorage::asyncGetRows(std::string_view _table,
             return;
         }
         auto start = utcTime();
+        auto keyPrefix = encodeDBKey(_table, "", false);
         std::visit(
             [&](auto const& keys) {
                 std::vector<std::optional<Entry>> entries(keys.size());
+                if (!keyPrefix)
+                {
+                    // the table has no id, so none of its rows exists
+                    _callback(nullptr, std::move(entries));
+                    return;
+                }
 
                 std::vector<std::string> dbKeys(keys.size());
                 std::vector<Slice> slices(keys.size());
@@ -158,14 +804,15 @@ void RocksDBStorage::asyncGetRows(std::string_view _table,
                     [&](const tbb::blocked_range<size_t>& range) {
                         for (size_t i = range.begin(); i != range.end(); ++i)
                         {
-                            dbKeys[i] = toDBKey(_table, keys[i]);
+                            dbKeys[i].reserve(keyPrefix->size() + keys[i].size());
+                            dbKeys[i].append(*keyPrefix).append(keys[i]);
                             slices[i] = Slice(dbKeys[i].data(), dbKeys[i].size());
                         }
                     });
 
                 std::vector<PinnableSlice> values(keys.size());
                 std::vector<Status> statusList(keys.size());
-                m_db->MultiGet(ReadOptions(), m_db->DefaultColumnFamily(), slices.size(),
+                m_db->MultiGet(ReadOptions(), columnFamily(_table), slices.size(),
                     slices.data(), values.data(), statusList.data());
                 auto end = utcTime();
                 tbb::parallel_for(tbb::blocked_range<size_t>(0, keys.size()),
@@ -227,23 +874,32 @@ void RocksDBStorage::asyncSetRow(std::string_view _table, std::string_view _key,
             _callback(BCOS_ERROR_UNIQUE_PTR(TableNotExists, "empty tableName or key"));
             return;
         }
-        auto dbKey = toDBKey(_table, _key);
+        auto dbKey = encodeDBKey(_table, _key, true);
+        if (!dbKey)
+        {
+            _callback(BCOS_ERROR_UNIQUE_PTR(WriteError, "Allocate table id failed!"));
+            return;
+        }
         WriteOptions options;
-        rocksdb::Status status;
+        // the id of a new table is written with the row
+        WriteBatch writeBatch;
+        auto tables = writeTableIDs(writeBatch);
         if (_entry.status() == Entry::DELETED)
         {
             STORAGE_ROCKSDB_LOG(TRACE)
                 << LOG_DESC("asyncSetRow delete") << LOG_KV("table", _table)
                 << LOG_KV("key", boost::algorithm::hex_lower(std::string(_key)));
-            status = m_db->Delete(options, dbKey);
+            writeBatch.Delete(columnFamily(_table), *dbKey);
         }
         else
         {
             STORAGE_ROCKSDB_LOG(TRACE)
                 << LOG_DESC("asyncSetRow") << LOG_KV("table", _table)
                 << LOG_KV("key", boost::algorithm::hex_lower(std::string(_key)));
-            status = m_db->Put(options, dbKey, _entry.get());
+            writeBatch.Put(columnFamily(_table), *dbKey, _entry.get());
         }
+        auto status = m_db->Write(options, &writeBatch);
+        publishTableIDs(tables, status.ok());
 
         if (!status.ok())
         {
@@ -267,17 +923,12 @@ void RocksDBStorage::asyncSetRow(std::string_view _table, std::string_view _key,
 void RocksDBStorage::asyncPrepare(const TwoPCParams& param, const TraverseStorageInterface& storage,
     std::function<void(Error::Ptr, uint64_t startTS)> callback)
 {
-    std::ignore = param;
     try
     {
         auto start = utcTime();
-        {
-            tbb::spin_mutex::scoped_lock lock(m_writeBatchMutex);
-            if (!m_writeBatch)
-            {
-                m_writeBatch = std::make_shared<WriteBatch>();
-            }
-        }
+        auto startT = std::chrono::steady_clock::now();
+        // every traverse thread writes into its own batch, the batches are merged after traverse
+        tbb::enumerable_thread_specific<WriteBatch> localWriteBatches;
         atomic_bool isTableValid = true;
         storage.parallelTraverse(true,
             [&](const std::string_view& table, const std::string_view& key, Entry const& entry) {
@@ -286,33 +937,109 @@ void RocksDBStorage::asyncPrepare(const TwoPCParams& param, const TraverseStorag
                     isTableValid = false;
                     return false;
                 }
-                auto dbKey = toDBKey(table, key);
-
+                auto dbKey = encodeDBKey(table, key, true);
+                if (!dbKey)
+                {
+                    isTableValid = false;
+                    return false;
+                }
+                auto& writeBatch = localWriteBatches.local();
                 if (entry.status() == Entry::DELETED)
                 {
-                    tbb::spin_mutex::scoped_lock lock(m_writeBatchMutex);
-                    m_writeBatch->Delete(dbKey);
+                    writeBatch.Delete(columnFamily(table), *dbKey);
                 }
                 else
                 {
-                    tbb::spin_mutex::scoped_lock lock(m_writeBatchMutex);
-                    auto status = m_writeBatch->Put(dbKey, entry.get());
+                    writeBatch.Put(columnFamily(table), *dbKey, entry.get());
                 }
                 return true;
             });
         if (!isTableValid)
         {
+            std::vector<std::string> preparedTables;
             {
                 tbb::spin_mutex::scoped_lock lock(m_writeBatchMutex);
                 m_writeBatch = nullptr;
+                removeIngestFiles();
+                preparedTables.swap(m_preparedTables);
             }
+            publishTableIDs(preparedTables, false);
             callback(BCOS_ERROR_UNIQUE_PTR(TableNotExists, "empty tableName or key"), 0);
             return;
         }
+        auto traverseEnd = utcTime();
+
+        // the ids of the new tables are committed with the records, and published at commit
+        WriteBatch tableIDBatch;
+        auto tables = writeTableIDs(tableIDBatch);
+        std::vector<const WriteBatch*> writeBatches;
+        size_t count = 0;
+        for (auto& writeBatch : localWriteBatches)
+        {
+            if (writeBatch.Count() > 0)
+            {
+                writeBatches.push_back(&writeBatch);
+                count += writeBatch.Count();
+            }
+        }
+        if (tableIDBatch.Count() > 0)
+        {
+            writeBatches.push_back(&tableIDBatch);
+            count += tableIDBatch.Count();
+        }
+
+        bool pending = false;
+        {
+            tbb::spin_mutex::scoped_lock lock(m_writeBatchMutex);
+            pending = !m_ingestFiles.empty() || (m_writeBatch && m_writeBatch->Count() > 0);
+        }
+        // a commit either ingests the sst files or writes the write batch, so only a prepare
+        // without pending records can write sst files
+        std::vector<IngestExternalFileArg> ingestFiles;
+        if (m_sstIngestThreshold > 0 && count >= m_sstIngestThreshold && !pending)
+        {
+            ingestFiles = writeSSTFiles(param, writeBatches, count);
+        }
+        auto ingest = !ingestFiles.empty();
+        {
+            tbb::spin_mutex::scoped_lock lock(m_writeBatchMutex);
+            m_preparedTables.insert(m_preparedTables.end(), std::make_move_iterator(tables.begin()),
+                std::make_move_iterator(tables.end()));
+            if (ingest)
+            {
+                m_ingestFiles = std::move(ingestFiles);
+                // kept for the fallback to the write batch, only copied if it happens
+                for (auto& writeBatch : localWriteBatches)
+                {
+                    if (writeBatch.Count() > 0)
+                    {
+                        m_ingestBatches.push_back(std::move(writeBatch));
+                    }
+                }
+                if (tableIDBatch.Count() > 0)
+                {
+                    m_ingestBatches.push_back(std::move(tableIDBatch));
+                }
+            }
+            else if (!writeBatches.empty())
+            {
+                if (!m_ingestFiles.empty())
+                {
+                    // a later prepare of the same commit, drop the sst files and write all the
+                    // records with one write batch
+                    ingestBatchesToWriteBatch();
+                }
+                appendWriteBatches(writeBatches);
+            }
+        }
+        static auto& prepareLatency = metrics::histogram(metrics::c_storagePrepareStage);
+        prepareLatency.recordElapsed(startT);
         auto end = utcTime();
         callback(nullptr, 0);
         STORAGE_ROCKSDB_LOG(INFO) << LOG_DESC("asyncPrepare") << LOG_KV("number", param.number)
-                                  << LOG_KV("startTS", param.startTS)
+                                  << LOG_KV("startTS", param.startTS) << LOG_KV("count", count)
+                                  << LOG_KV("ingest", ingest)
+                                  << LOG_KV("traverse time(ms)", traverseEnd - start)
                                   << LOG_KV("time(ms)", end - start)
                                   << LOG_KV("callback time(ms)", utcTime() - end);
     }
@@ -326,26 +1053,65 @@ void RocksDBStorage::asyncCommit(
     const TwoPCParams& params, std::function<void(Error::Ptr)> callback)
 {
     size_t count = 0;
+    size_t ingestFiles = 0;
     auto start = utcTime();
+    auto startT = std::chrono::steady_clock::now();
     std::ignore = params;
+    rocksdb::Status status;
+    std::vector<std::string> tables;
     {
         tbb::spin_mutex::scoped_lock lock(m_writeBatchMutex);
-        if (m_writeBatch)
+        try
+        {
+            if (!m_ingestFiles.empty())
+            {
+                // the files of all column families are ingested atomically, the write batch is
+                // empty when there are sst files
+                ingestFiles = m_ingestFiles.size();
+                status = m_db->IngestExternalFiles(m_ingestFiles);
+                if (!status.ok())
+                {
+                    STORAGE_ROCKSDB_LOG(WARNING)
+                        << LOG_DESC("asyncCommit ingest failed, fallback to write batch")
+                        << LOG_KV("number", params.number) << LOG_KV("message", status.ToString());
+                    ingestFiles = 0;
+                    ingestBatchesToWriteBatch();
+                }
+            }
+            if (ingestFiles == 0 && m_writeBatch)
+            {
+                WriteOptions options;
+                options.sync = true;
+                count = m_writeBatch->Count();
+                status = m_db->Write(options, m_writeBatch.get());
+            }
+        }
+        catch (const std::exception& e)
         {
-            WriteOptions options;
-            options.sync = true;
-            count = m_writeBatch->Count();
-            m_db->Write(options, m_writeBatch.get());
-            m_writeBatch = nullptr;
+            status = Status::Aborted(boost::diagnostic_information(e));
         }
+        removeIngestFiles();
+        m_writeBatch = nullptr;
+        tables.swap(m_preparedTables);
     }
+    publishTableIDs(tables, status.ok());
     auto end = utcTime();
+    if (!status.ok())
+    {
+        STORAGE_ROCKSDB_LOG(ERROR) << LOG_DESC("asyncCommit failed")
+                                   << LOG_KV("number", params.number)
+                                   << LOG_KV("message", status.ToString());
+        callback(BCOS_ERROR_PTR(WriteError, "Commit failed! " + status.ToString()));
+        return;
+    }
+    static auto& commitLatency = metrics::histogram(metrics::c_storageCommitStage);
+    commitLatency.recordElapsed(startT);
     callback(nullptr);
     STORAGE_ROCKSDB_LOG(INFO) << LOG_DESC("asyncCommit") << LOG_KV("number", params.number)
                               << LOG_KV("startTS", params.startTS)
                               << LOG_KV("time(ms)", utcTime() - start)
                               << LOG_KV("callback time(ms)", utcTime() - end)
-                              << LOG_KV("count", count);
+                              << LOG_KV("count", count) << LOG_KV("ingestFiles", ingestFiles);
 }
 
 void RocksDBStorage::asyncRollback(
@@ -354,10 +1120,14 @@ void RocksDBStorage::asyncRollback(
     auto start = utcTime();
 
     std::ignore = params;
+    std::vector<std::string> tables;
     {
         tbb::spin_mutex::scoped_lock lock(m_writeBatchMutex);
         m_writeBatch = nullptr;
+        removeIngestFiles();
+        tables.swap(m_preparedTables);
     }
+    publishTableIDs(tables, false);
     auto end = utcTime();
     callback(nullptr);
     STORAGE_ROCKSDB_LOG(INFO) << LOG_DESC("asyncRollback") << LOG_KV("number", params.number)
@@ -23,9 +23,14 @@
  */
 #pragma once
 
+#include "Common.h"
 #include <bcos-framework/interfaces/storage/StorageInterface.h>
 #include <rocksdb/db.h>
+#include <rocksdb/slice_transform.h>
 #include <tbb/parallel_for.h>
+#include <tbb/spin_mutex.h>
+#include <map>
+#include <shared_mutex>
 
 namespace rocksdb
 {
@@ -38,9 +43,19 @@ class RocksDBStorage : public TransactionalStorageInterface
 {
 public:
     using Ptr = std::shared_ptr<RocksDBStorage>;
-    explicit RocksDBStorage(std::unique_ptr<rocksdb::DB>&& db);
+    // the key encoding persisted in the db takes precedence over _keyEncoding, a db with
+    // TABLE_NAME encoded rows is migrated when TABLE_ID is requested
+    // _columnFamilies are the handles returned by rocksdb::DB::Open and owned by the storage,
+    // _tableColumnFamilies maps table name to column family name for a new db, the mapping is
+    // persisted at the first open and takes precedence on every later open
+    // a _readOnly db opened by rocksdb::DB::OpenForReadOnly is neither written nor migrated
+    explicit RocksDBStorage(std::unique_ptr<rocksdb::DB>&& db,
+        KeyEncoding _keyEncoding = KeyEncoding::TABLE_NAME,
+        std::vector<rocksdb::ColumnFamilyHandle*> _columnFamilies = {},
+        std::map<std::string, std::string> const& _tableColumnFamilies = {},
+        bool _readOnly = false);
 
-    ~RocksDBStorage() {}
+    ~RocksDBStorage();
 
     void asyncGetPrimaryKeys(std::string_view _table,
         const std::optional<Condition const>& _condition,
@@ -66,9 +81,70 @@ public:
     void asyncRollback(
         const TwoPCParams& params, std::function<void(Error::Ptr)> callback) override;
 
+    // blocks with at least _threshold dirty entries are written into a sorted sst file in
+    // _sstPath at prepare and ingested atomically at commit, 0 means always use the write batch
+    void setSSTIngestThreshold(size_t _threshold, std::string const& _sstPath);
+    size_t sstIngestThreshold() const { return m_sstIngestThreshold; }
+
+    KeyEncoding keyEncoding() const { return m_keyEncoding; }
+    // rewrite all tableName:key rows into table id encoding, return the count of migrated rows
+    size_t migrateToTableIDEncoding();
+
+    // the key encoding of the rows of the db at _path read before the db is opened, TABLE_ID if
+    // a migration to it has started, std::nullopt if there is no db
+    static std::optional<KeyEncoding> persistedKeyEncoding(std::string const& _path);
+    // the prefix extractor of TABLE_ID encoded keys, used as rocksdb::Options::prefix_extractor
+    static std::shared_ptr<const rocksdb::SliceTransform> newTableIDPrefixExtractor();
+
+    // all column families including the default one
+    std::vector<rocksdb::ColumnFamilyHandle*> columnFamilies() const;
+    rocksdb::DB& db() { return *m_db; }
+
 private:
+    void initColumnFamilies(std::map<std::string, std::string> const& _tableColumnFamilies);
+    rocksdb::ColumnFamilyHandle* columnFamily(std::string_view _table) const;
+    void initKeyEncoding(KeyEncoding _keyEncoding);
+    // return the physical key prefix of the table, std::nullopt if the table has no id and
+    // _create is false, a new id is pending until it is written by writeTableIDs and published
+    std::optional<std::string> tableKeyPrefix(std::string_view _table, bool _create);
+    // put the pending table ids not written yet into _writeBatch, return their tables
+    std::vector<std::string> writeTableIDs(rocksdb::WriteBatch& _writeBatch);
+    // the ids of _tables are persisted, or dropped if _success is false
+    void publishTableIDs(std::vector<std::string> const& _tables, bool _success);
+    std::optional<std::string> encodeDBKey(
+        std::string_view _table, std::string_view _key, bool _create);
+
+    std::vector<rocksdb::IngestExternalFileArg> writeSSTFiles(const TwoPCParams& params,
+        const std::vector<const rocksdb::WriteBatch*>& writeBatches, size_t count);
+    // append the records of writeBatches to m_writeBatch
+    void appendWriteBatches(const std::vector<const rocksdb::WriteBatch*>& writeBatches);
+    // move the records of the sst files into m_writeBatch and drop the files
+    void ingestBatchesToWriteBatch();
+    void removeIngestFiles();
+
     std::shared_ptr<rocksdb::WriteBatch> m_writeBatch = nullptr;
+    // at most one sst file per column family, a commit ingests them or writes m_writeBatch but
+    // never both, the ingest batches hold the same records for the fallback to m_writeBatch
+    std::vector<rocksdb::IngestExternalFileArg> m_ingestFiles;
+    std::vector<rocksdb::WriteBatch> m_ingestBatches;
+    // the tables whose ids are written by the prepared records
+    std::vector<std::string> m_preparedTables;
     tbb::spin_mutex m_writeBatchMutex;
     std::unique_ptr<rocksdb::DB> m_db;
+    bool m_readOnly = false;
+
+    std::vector<rocksdb::ColumnFamilyHandle*> m_columnFamilies;
+    std::map<std::string, rocksdb::ColumnFamilyHandle*, std::less<>> m_tableColumnFamilies;
+
+    size_t m_sstIngestThreshold = 0;
+    std::string m_sstIngestPath;
+
+    KeyEncoding m_keyEncoding = KeyEncoding::TABLE_NAME;
+    std::map<std::string, std::string, std::less<>> m_tableKeyPrefixes;
+    // the ids allocated by the prepare, written with its records and published at commit
+    std::map<std::string, std::string, std::less<>> m_pendingTableKeyPrefixes;
+    std::vector<std::pair<std::string, uint64_t>> m_unwrittenTableIDs;
+    uint64_t m_nextTableID = 1;
+    mutable std::shared_mutex m_tableKeyPrefixesMutex;
 };
 }  // namespace bcos::storage
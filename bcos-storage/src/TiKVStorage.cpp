@@ -58,17 +58,40 @@ void TiKVStorage::asyncGetPrimaryKeys(std::string_view _table,
 
     std::string keyPrefix;
     keyPrefix = string(_table) + TABLE_KEY_SPLIT;
+    // scan the key range of the conditions only, and stop once the limit is reached
+    std::string lowerBound = keyPrefix;
+    std::optional<std::string> upperBound;
+    size_t offset = 0;
+    size_t count = 0;
+    if (_condition)
+    {
+        lowerBound.append(_condition->lowerBound());
+        upperBound = _condition->upperBound();
+        std::tie(offset, count) = _condition->getLimit();
+    }
     auto snap = Snapshot(m_cluster.get());
-    auto scanner = snap.Scan(keyPrefix, string());
+    auto scanner = snap.Scan(lowerBound, string());
 
-    // FIXME: check performance and add limit of primary keys
+    size_t matched = 0;
     for (; scanner.valid && scanner.key().rfind(keyPrefix, 0) == 0; scanner.next())
     {
         size_t start = keyPrefix.size();
         auto key = scanner.key().substr(start);
+        if (upperBound && key >= *upperBound)
+        {
+            break;
+        }
         if (!_condition || _condition->isValid(key))
         {  // filter by condition, remove keyPrefix
+            if (matched++ < offset)
+            {
+                continue;
+            }
             result.push_back(std::move(key));
+            if (count > 0 && result.size() >= count)
+            {
+                break;
+            }
         }
     }
     auto end = utcTime();
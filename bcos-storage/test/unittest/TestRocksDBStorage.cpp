@@ -196,12 +196,58 @@ struct TestRocksDBStorageFixture
              << endl;
     }
 
+    void prepareAndCommit(size_t count, size_t sstIngestThreshold)
+    {
+        auto storage = rocksDBStorage;
+        storage->setSSTIngestThreshold(sstIngestThreshold, path + "_ingest");
+        auto stateStorage = std::make_shared<bcos::storage::StateStorage>(storage);
+        auto testTable = stateStorage->openTable(testTableName);
+        BOOST_CHECK_EQUAL(testTable.has_value(), true);
+        for (size_t i = 0; i < count; ++i)
+        {
+            std::string key = "key" + boost::lexical_cast<std::string>(i);
+            Entry entry(testTableInfo);
+            entry.importFields({"value_" + boost::lexical_cast<std::string>(i)});
+            testTable->setRow(key, std::move(entry));
+        }
+
+        auto params = bcos::storage::TransactionalStorageInterface::TwoPCParams();
+        params.number = 100;
+        auto start = std::chrono::system_clock::now();
+        storage->asyncPrepare(params, *stateStorage,
+            [&](Error::Ptr error, uint64_t) { BOOST_CHECK_EQUAL(error.get(), nullptr); });
+        auto prepareEnd = std::chrono::system_clock::now();
+        storage->asyncCommit(params, [&](Error::Ptr error) { BOOST_CHECK_EQUAL(error, nullptr); });
+        auto commitEnd = std::chrono::system_clock::now();
+
+        std::vector<std::string> keys{"key0", "key" + boost::lexical_cast<std::string>(count - 1)};
+        storage->asyncGetRows(testTableName, keys,
+            [&](Error::UniquePtr error, std::vector<std::optional<Entry>> entries) {
+                BOOST_CHECK_EQUAL(error.get(), nullptr);
+                BOOST_CHECK_EQUAL(entries.size(), 2);
+                BOOST_CHECK_EQUAL(entries[0]->getField(0), "value_0");
+                BOOST_CHECK_EQUAL(entries[1]->getField(0),
+                    "value_" + boost::lexical_cast<std::string>(count - 1));
+            });
+        cerr << "entries count=" << count << "|sstIngestThreshold=" << sstIngestThreshold
+             << "|>>>>>>>>> prepare="
+             << std::chrono::duration_cast<chrono::milliseconds>(prepareEnd - start).count()
+             << "ms|commit="
+             << std::chrono::duration_cast<chrono::milliseconds>(commitEnd - prepareEnd).count()
+             << "ms" << endl;
+        storage->setSSTIngestThreshold(0, "");
+    }
+
     ~TestRocksDBStorageFixture()
     {
         if (boost::filesystem::exists(path))
         {
             boost::filesystem::remove_all(path);
         }
+        if (boost::filesystem::exists(path + "_ingest"))
+        {
+            boost::filesystem::remove_all(path + "_ingest");
+        }
     }
 
     std::string path = "./unittestdb";
@@ -373,6 +419,81 @@ BOOST_AUTO_TEST_CASE(asyncGetPrimaryKeys)
     cleanupTestTableData();
 }
 
+BOOST_AUTO_TEST_CASE(rangeScan)
+{
+    prepareTestTableData();
+
+    std::vector<std::string> sortedKeys;
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        sortedKeys.emplace_back("key" + boost::lexical_cast<std::string>(i));
+    }
+    std::sort(sortedKeys.begin(), sortedKeys.end());
+
+    Condition condition;
+    condition.GE("key1");
+    condition.LT("key2");
+    condition.NE("key15");
+    std::vector<std::string> expected;
+    std::copy_if(sortedKeys.begin(), sortedKeys.end(), std::back_inserter(expected),
+        [&condition](const std::string& key) { return condition.isValid(key); });
+    BOOST_CHECK_EQUAL(expected.size(), 110);
+    BOOST_CHECK_EQUAL(condition.lowerBound(), "key1");
+    BOOST_CHECK_EQUAL(*condition.upperBound(), "key2");
+
+    rocksDBStorage->asyncGetPrimaryKeys(testTableName, condition,
+        [&](Error::UniquePtr error, std::vector<std::string> keys) {
+            BOOST_CHECK_EQUAL(error.get(), nullptr);
+            BOOST_CHECK_EQUAL_COLLECTIONS(
+                expected.begin(), expected.end(), keys.begin(), keys.end());
+        });
+
+    // GT and LE are exclusive and inclusive bounds
+    Condition exclusive;
+    exclusive.GT("key1");
+    exclusive.LE("key101");
+    rocksDBStorage->asyncGetPrimaryKeys(testTableName, exclusive,
+        [&](Error::UniquePtr error, std::vector<std::string> keys) {
+            BOOST_CHECK_EQUAL(error.get(), nullptr);
+            BOOST_CHECK_EQUAL(keys.size(), 3);
+            BOOST_CHECK_EQUAL(keys[0], "key10");
+            BOOST_CHECK_EQUAL(keys[2], "key101");
+        });
+
+    condition.limit(10, 5);
+    rocksDBStorage->asyncGetPrimaryKeys(testTableName, condition,
+        [&](Error::UniquePtr error, std::vector<std::string> keys) {
+            BOOST_CHECK_EQUAL(error.get(), nullptr);
+            BOOST_CHECK_EQUAL_COLLECTIONS(
+                expected.begin() + 10, expected.begin() + 15, keys.begin(), keys.end());
+        });
+
+    // the keys deleted and added by the upper layer are merged before the limit applies
+    auto stateStorage = std::make_shared<bcos::storage::StateStorage>(rocksDBStorage);
+    stateStorage->setEnableTraverse(true);
+    Entry deleted(testTableInfo);
+    deleted.setStatus(Entry::DELETED);
+    stateStorage->asyncSetRow(testTableName, expected[10], deleted,
+        [](Error::UniquePtr error) { BOOST_CHECK_EQUAL(error.get(), nullptr); });
+    Entry added(testTableInfo);
+    added.importFields({"value"});
+    stateStorage->asyncSetRow(testTableName, "key1000a", added,
+        [](Error::UniquePtr error) { BOOST_CHECK_EQUAL(error.get(), nullptr); });
+
+    auto merged = expected;
+    merged.erase(merged.begin() + 10);
+    merged.push_back("key1000a");
+    std::sort(merged.begin(), merged.end());
+    stateStorage->asyncGetPrimaryKeys(testTableName, condition,
+        [&](Error::UniquePtr error, std::vector<std::string> keys) {
+            BOOST_CHECK_EQUAL(error.get(), nullptr);
+            BOOST_CHECK_EQUAL_COLLECTIONS(
+                merged.begin() + 10, merged.begin() + 15, keys.begin(), keys.end());
+        });
+
+    cleanupTestTableData();
+}
+
 BOOST_AUTO_TEST_CASE(asyncGetRows)
 {
     prepareTestTableData();
@@ -595,6 +716,246 @@ BOOST_AUTO_TEST_CASE(writeReadDelete_1Table)
     writeReadDeleteSingleTable(50000);
 }
 
+BOOST_AUTO_TEST_CASE(prepareAndCommit_100k)
+{
+    // write batch only
+    prepareAndCommit(100000, 0);
+    // sorted sst file ingested at commit
+    prepareAndCommit(100000, 10000);
+}
+
+BOOST_AUTO_TEST_CASE(prepareIngestAndWriteBatch)
+{
+    // the first prepare writes sst files, the second one of the same commit writes a batch
+    rocksDBStorage->setSSTIngestThreshold(100, path + "_ingest");
+    auto params = bcos::storage::TransactionalStorageInterface::TwoPCParams();
+    params.number = 100;
+    for (auto count : {1000, 10})
+    {
+        auto stateStorage = std::make_shared<bcos::storage::StateStorage>(rocksDBStorage);
+        auto testTable = stateStorage->openTable(testTableName);
+        BOOST_CHECK_EQUAL(testTable.has_value(), true);
+        for (int i = 0; i < count; ++i)
+        {
+            Entry entry(testTableInfo);
+            entry.importFields({"value_" + boost::lexical_cast<std::string>(count)});
+            testTable->setRow("key" + boost::lexical_cast<std::string>(i), std::move(entry));
+        }
+        rocksDBStorage->asyncPrepare(params, *stateStorage,
+            [&](Error::Ptr error, uint64_t) { BOOST_CHECK_EQUAL(error.get(), nullptr); });
+    }
+    rocksDBStorage->asyncCommit(
+        params, [&](Error::Ptr error) { BOOST_CHECK_EQUAL(error, nullptr); });
+    rocksDBStorage->setSSTIngestThreshold(0, "");
+    BOOST_CHECK(boost::filesystem::is_empty(path + "_ingest"));
+
+    // the records of both prepares are committed, the later ones win
+    std::vector<std::string> keys{"key0", "key9", "key10", "key999"};
+    rocksDBStorage->asyncGetRows(testTableName, keys,
+        [&](Error::UniquePtr error, std::vector<std::optional<Entry>> entries) {
+            BOOST_CHECK_EQUAL(error.get(), nullptr);
+            BOOST_CHECK_EQUAL(entries.size(), 4);
+            BOOST_CHECK_EQUAL(entries[0]->getField(0), "value_10");
+            BOOST_CHECK_EQUAL(entries[1]->getField(0), "value_10");
+            BOOST_CHECK_EQUAL(entries[2]->getField(0), "value_1000");
+            BOOST_CHECK_EQUAL(entries[3]->getField(0), "value_1000");
+        });
+}
+
+BOOST_AUTO_TEST_CASE(tableIDKeyEncoding)
+{
+    prepareTestTableData();
+    // reopen the db with table id encoding, the rows written by table name are migrated
+    rocksDBStorage.reset();
+    BOOST_CHECK(RocksDBStorage::persistedKeyEncoding(path) == KeyEncoding::TABLE_NAME);
+    BOOST_CHECK(!RocksDBStorage::persistedKeyEncoding(path + "_not_exists"));
+    rocksdb::DB* db;
+    rocksdb::Options options;
+    options.create_if_missing = true;
+    options.prefix_extractor = RocksDBStorage::newTableIDPrefixExtractor();
+    rocksdb::Status s = rocksdb::DB::Open(options, path, &db);
+    BOOST_CHECK_EQUAL(s.ok(), true);
+    rocksDBStorage = std::make_shared<RocksDBStorage>(
+        std::unique_ptr<rocksdb::DB>(db), KeyEncoding::TABLE_ID);
+    BOOST_CHECK(rocksDBStorage->keyEncoding() == KeyEncoding::TABLE_ID);
+
+    rocksDBStorage->asyncGetPrimaryKeys(testTableName, std::optional<storage::Condition const>(),
+        [&](Error::UniquePtr error, std::vector<std::string> keys) {
+            BOOST_CHECK_EQUAL(error.get(), nullptr);
+            BOOST_CHECK_EQUAL(keys.size(), 1000);
+        });
+    rocksDBStorage->asyncGetRow(
+        testTableName, "key1", [&](Error::UniquePtr error, std::optional<Entry> entry) {
+            BOOST_CHECK_EQUAL(error.get(), nullptr);
+            BOOST_CHECK_EQUAL(entry.has_value(), true);
+            BOOST_CHECK_EQUAL(entry->getField(0), "value_1");
+        });
+    rocksDBStorage->asyncGetRow(
+        "not_exists_table", "key1", [&](Error::UniquePtr error, std::optional<Entry> entry) {
+            BOOST_CHECK_EQUAL(error.get(), nullptr);
+            BOOST_CHECK_EQUAL(entry.has_value(), false);
+        });
+
+    // the persisted encoding wins over the requested one
+    rocksDBStorage.reset();
+    BOOST_CHECK(RocksDBStorage::persistedKeyEncoding(path) == KeyEncoding::TABLE_ID);
+    s = rocksdb::DB::Open(options, path, &db);
+    BOOST_CHECK_EQUAL(s.ok(), true);
+    rocksDBStorage = std::make_shared<RocksDBStorage>(std::unique_ptr<rocksdb::DB>(db));
+    BOOST_CHECK(rocksDBStorage->keyEncoding() == KeyEncoding::TABLE_ID);
+    writeReadDeleteSingleTable(1000);
+    cleanupTestTableData();
+}
+
+BOOST_AUTO_TEST_CASE(tableIDAllocatedByPrepare)
+{
+    rocksDBStorage.reset();
+    rocksdb::DB* db;
+    rocksdb::Options options;
+    options.create_if_missing = true;
+    options.prefix_extractor = RocksDBStorage::newTableIDPrefixExtractor();
+    auto openStorage = [&]() {
+        rocksDBStorage.reset();
+        rocksdb::Status s = rocksdb::DB::Open(options, path, &db);
+        BOOST_CHECK_EQUAL(s.ok(), true);
+        rocksDBStorage = std::make_shared<RocksDBStorage>(
+            std::unique_ptr<rocksdb::DB>(db), KeyEncoding::TABLE_ID);
+    };
+    openStorage();
+
+    std::string newTable = "NewTable";
+    auto prepare = [&](bcos::protocol::BlockNumber _number) {
+        auto params = bcos::storage::TransactionalStorageInterface::TwoPCParams();
+        params.number = _number;
+        auto stateStorage = std::make_shared<bcos::storage::StateStorage>(rocksDBStorage);
+        Entry entry(testTableInfo);
+        entry.importFields({"value"});
+        stateStorage->asyncSetRow(newTable, "key", std::move(entry),
+            [](Error::UniquePtr error) { BOOST_CHECK_EQUAL(error.get(), nullptr); });
+        rocksDBStorage->asyncPrepare(params, *stateStorage,
+            [&](Error::Ptr error, uint64_t) { BOOST_CHECK_EQUAL(error.get(), nullptr); });
+        return params;
+    };
+    auto checkRow = [&](bool _exists) {
+        rocksDBStorage->asyncGetRow(
+            newTable, "key", [&](Error::UniquePtr error, std::optional<Entry> entry) {
+                BOOST_CHECK_EQUAL(error.get(), nullptr);
+                BOOST_CHECK_EQUAL(entry.has_value(), _exists);
+            });
+    };
+
+    // the id allocated by the prepare is not visible before the commit, and dropped by rollback
+    auto params = prepare(1);
+    checkRow(false);
+    rocksDBStorage->asyncRollback(
+        params, [](Error::Ptr error) { BOOST_CHECK_EQUAL(error.get(), nullptr); });
+    checkRow(false);
+    openStorage();
+    checkRow(false);
+
+    // the id is written with the records of the prepare and published by the commit
+    params = prepare(1);
+    rocksDBStorage->asyncCommit(
+        params, [](Error::Ptr error) { BOOST_CHECK_EQUAL(error.get(), nullptr); });
+    checkRow(true);
+    openStorage();
+    checkRow(true);
+}
+
+BOOST_AUTO_TEST_CASE(columnFamilies)
+{
+    std::string testPath = "./columnFamilyTest";
+    rocksdb::Options options;
+    options.create_if_missing = true;
+    options.create_missing_column_families = true;
+    std::vector<rocksdb::ColumnFamilyDescriptor> descriptors{
+        {rocksdb::kDefaultColumnFamilyName, rocksdb::ColumnFamilyOptions()},
+        {"txs", rocksdb::ColumnFamilyOptions()}};
+    std::vector<rocksdb::ColumnFamilyHandle*> handles;
+    rocksdb::DB* db;
+    auto s = rocksdb::DB::Open(options, testPath, descriptors, &handles, &db);
+    BOOST_CHECK_EQUAL(s.ok(), true);
+    {
+        auto storage = std::make_shared<RocksDBStorage>(std::unique_ptr<rocksdb::DB>(db),
+            KeyEncoding::TABLE_NAME, handles,
+            std::map<std::string, std::string>{{"s_hash_2_tx", "txs"}});
+        BOOST_CHECK_EQUAL(storage->columnFamilies().size(), 2);
+
+        auto state = std::make_shared<StateStorage>(nullptr);
+        for (auto table : {"s_hash_2_tx", "s_current_state"})
+        {
+            Entry entry;
+            entry.importFields({"value"});
+            state->asyncSetRow(table, "key", std::move(entry),
+                [](Error::UniquePtr error) { BOOST_CHECK(!error); });
+        }
+        storage::RocksDBStorage::TwoPCParams params;
+        storage->asyncPrepare(
+            params, *state, [](Error::Ptr error, uint64_t) { BOOST_CHECK(!error); });
+        storage->asyncCommit(params, [](Error::Ptr error) { BOOST_CHECK(!error); });
+
+        std::string value;
+        auto& rocksDB = storage->db();
+        BOOST_CHECK(
+            rocksDB.Get(rocksdb::ReadOptions(), handles[1], "s_hash_2_tx:key", &value).ok());
+        BOOST_CHECK(rocksDB.Get(rocksdb::ReadOptions(), handles[0], "s_hash_2_tx:key", &value)
+                        .IsNotFound());
+        BOOST_CHECK(
+            rocksDB.Get(rocksdb::ReadOptions(), handles[0], "s_current_state:key", &value).ok());
+        storage->asyncGetRow(
+            "s_hash_2_tx", "key", [](Error::UniquePtr error, std::optional<Entry> entry) {
+                BOOST_CHECK(!error);
+                BOOST_CHECK(entry);
+                BOOST_CHECK_EQUAL(entry->getField(0), "value");
+            });
+    }
+
+    // the mapping persisted at the first open wins over the config of the later opens
+    handles.clear();
+    s = rocksdb::DB::Open(options, testPath, descriptors, &handles, &db);
+    BOOST_CHECK_EQUAL(s.ok(), true);
+    {
+        auto storage = std::make_shared<RocksDBStorage>(
+            std::unique_ptr<rocksdb::DB>(db), KeyEncoding::TABLE_NAME, handles);
+        storage->asyncGetRow(
+            "s_hash_2_tx", "key", [](Error::UniquePtr error, std::optional<Entry> entry) {
+                BOOST_CHECK(!error);
+                BOOST_CHECK(entry);
+            });
+    }
+    boost::filesystem::remove_all(testPath);
+
+    // the db opened without column families keeps all the rows in the default column family
+    handles.clear();
+    s = rocksdb::DB::Open(options, testPath, descriptors, &handles, &db);
+    BOOST_CHECK_EQUAL(s.ok(), true);
+    {
+        RocksDBStorage storage(std::unique_ptr<rocksdb::DB>(db), KeyEncoding::TABLE_NAME, handles);
+    }
+    handles.clear();
+    s = rocksdb::DB::Open(options, testPath, descriptors, &handles, &db);
+    BOOST_CHECK_EQUAL(s.ok(), true);
+    {
+        auto storage = std::make_shared<RocksDBStorage>(std::unique_ptr<rocksdb::DB>(db),
+            KeyEncoding::TABLE_NAME, handles,
+            std::map<std::string, std::string>{{"s_hash_2_tx", "txs"}});
+        auto state = std::make_shared<StateStorage>(nullptr);
+        Entry entry;
+        entry.importFields({"value"});
+        state->asyncSetRow("s_hash_2_tx", "key", std::move(entry),
+            [](Error::UniquePtr error) { BOOST_CHECK(!error); });
+        storage::RocksDBStorage::TwoPCParams params;
+        storage->asyncPrepare(
+            params, *state, [](Error::Ptr error, uint64_t) { BOOST_CHECK(!error); });
+        storage->asyncCommit(params, [](Error::Ptr error) { BOOST_CHECK(!error); });
+        std::string value;
+        BOOST_CHECK(storage->db()
+                        .Get(rocksdb::ReadOptions(), handles[0], "s_hash_2_tx:key", &value)
+                        .ok());
+    }
+    boost::filesystem::remove_all(testPath);
+}
+
 BOOST_AUTO_TEST_CASE(commitAndCheck)
 {
     auto initState = std::make_shared<StateStorage>(rocksDBStorage);
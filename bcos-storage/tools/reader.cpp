@@ -42,7 +42,8 @@ po::variables_map initCommandLine(int argc, const char* argv[])
         "path,p", po::value<string>()->default_value(""), "[RocksDB path]")("name,n",
         po::value<string>()->default_value(""), "[RocksDB name]")("table,t", po::value<string>(),
         "table name ")("key,k", po::value<string>()->default_value(""), "table key")(
-        "iterate,i", po::value<bool>()->default_value(false), "traverse table");
+        "iterate,i", po::value<bool>()->default_value(false), "traverse table")(
+        "stats,s", po::value<bool>()->default_value(false), "print the stats of column families");
     po::variables_map vm;
     try
     {
@@ -74,7 +75,8 @@ int main(int argc, const char* argv[])
         return 0;
     }
     auto iterate = params["iterate"].as<bool>();
-    auto tableName = params["table"].as<string>();
+    auto stats = params["stats"].as<bool>();
+    auto tableName = stats ? std::string() : params["table"].as<string>();
     auto key = params["key"].as<string>();
 
     cout << "rocksdb path : " << storagePath << endl;
@@ -86,9 +88,50 @@ int main(int argc, const char* argv[])
     options.IncreaseParallelism();
     options.OptimizeLevelStyleCompaction();
     options.create_if_missing = false;
-    rocksdb::Status s = rocksdb::DB::Open(options, storagePath, &db);
+    // all the column families must be opened, the table mapping is persisted in the db
+    std::vector<std::string> columnFamilyNames;
+    rocksdb::DB::ListColumnFamilies(options, storagePath, &columnFamilyNames);
+    std::vector<rocksdb::ColumnFamilyDescriptor> columnFamilies;
+    for (auto& name : columnFamilyNames)
+    {
+        columnFamilies.emplace_back(name, rocksdb::ColumnFamilyOptions(options));
+        columnFamilies.back().options.prefix_extractor =
+            RocksDBStorage::newTableIDPrefixExtractor();
+    }
+    std::vector<rocksdb::ColumnFamilyHandle*> handles;
+    // the reader never writes, so it can inspect the db of a running node
+    rocksdb::Status s =
+        rocksdb::DB::OpenForReadOnly(options, storagePath, columnFamilies, &handles, &db);
+    if (!s.ok())
+    {
+        cout << "open rocksdb failed: " << s.ToString() << endl;
+        return 1;
+    }
+
+    auto adapter = std::make_shared<RocksDBStorage>(
+        std::unique_ptr<rocksdb::DB>(db), KeyEncoding::TABLE_NAME, handles,
+        std::map<std::string, std::string>(), true);
 
-    auto adapter = std::make_shared<RocksDBStorage>(std::unique_ptr<rocksdb::DB>(db));
+    if (stats)
+    {
+        for (auto handle : adapter->columnFamilies())
+        {
+            std::string keys;
+            std::string sstSize;
+            std::string memtableSize;
+            std::string cfStats;
+            adapter->db().GetProperty(handle, "rocksdb.estimate-num-keys", &keys);
+            adapter->db().GetProperty(handle, "rocksdb.total-sst-files-size", &sstSize);
+            adapter->db().GetProperty(handle, "rocksdb.cur-size-all-mem-tables", &memtableSize);
+            adapter->db().GetProperty(handle, "rocksdb.cfstats", &cfStats);
+            cout << "column family : " << handle->GetName() << endl;
+            cout << "keys(estimate): " << keys << endl;
+            cout << "sst size      : " << sstSize << endl;
+            cout << "memtable size : " << memtableSize << endl;
+            cout << cfStats << endl;
+        }
+        return 0;
+    }
 
     if (iterate)
     {
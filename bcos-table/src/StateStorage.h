@@ -38,6 +38,7 @@
 #include <boost/multi_index_container.hpp>
 #include <boost/property_map/property_map.hpp>
 #include <boost/throw_exception.hpp>
+#include <algorithm>
 #include <future>
 #include <memory>
 #include <optional>
@@ -120,9 +121,14 @@ public:
     using Ptr = std::shared_ptr<BaseStorage<enableLRU>>;
 
     explicit BaseStorage(std::shared_ptr<StorageInterface> prev)
+      : BaseStorage(std::move(prev), std::thread::hardware_concurrency())
+    {}
+
+    // the storages only accessed by one thread at a time need few buckets
+    BaseStorage(std::shared_ptr<StorageInterface> prev, size_t bucketNum)
       : storage::TraverseStorageInterface(),
         m_prev(std::move(prev)),
-        m_buckets(std::thread::hardware_concurrency())
+        m_buckets(std::max<size_t>(bucketNum, 1))
     {}
 
     BaseStorage(const BaseStorage&) = delete;
@@ -173,13 +179,35 @@ public:
                 }
             }
 
+            applyLimit(resultKeys, _condition);
             _callback(nullptr, std::move(resultKeys));
             return;
         }
 
-        prev->asyncGetPrimaryKeys(table, _condition,
-            [localKeys = std::move(localKeys), callback = std::move(_callback)](
-                auto&& error, auto&& remoteKeys) mutable {
+        // keys deleted locally are dropped from the keys of prev, so prev has to return more
+        // keys than the limit to fill the result
+        std::optional<storage::Condition const> prevCondition;
+        if (_condition && _condition->hasLimit())
+        {
+            auto [offset, count] = _condition->getLimit();
+            if (count > 0)
+            {
+                auto deleted = std::count_if(localKeys.begin(), localKeys.end(),
+                    [](auto& localIt) { return localIt.second != Entry::NORMAL; });
+                count += offset + (size_t)deleted;
+            }
+            storage::Condition condition = *_condition;
+            condition.limit(0, count);
+            prevCondition.emplace(std::move(condition));
+        }
+        else if (_condition)
+        {
+            prevCondition.emplace(*_condition);
+        }
+
+        prev->asyncGetPrimaryKeys(table, prevCondition,
+            [localKeys = std::move(localKeys), condition = _condition,
+                callback = std::move(_callback)](auto&& error, auto&& remoteKeys) mutable {
                 if (error)
                 {
                     callback(BCOS_ERROR_WITH_PREV_UNIQUE_PTR(StorageError::ReadError,
@@ -218,6 +246,7 @@ public:
                     }
                 }
 
+                applyLimit(remoteKeys, condition);
                 callback(nullptr, std::move(remoteKeys));
             });
     }
@@ -396,46 +425,77 @@ public:
             return;
         }
 
-        ssize_t updatedCapacity = entry.size();
-        std::optional<Entry> entryOld;
-
-        auto [bucket, lock] = getBucket(tableView, keyView);
-        boost::ignore_unused(lock);
+        setRowSync(tableView, keyView, std::move(entry));
+        callback(nullptr);
+    }
 
-        auto it = bucket->container.find(std::make_tuple(tableView, keyView));
-        if (it != bucket->container.end())
+    // Synchronous fast path of asyncGetRow without type-erased callback, the value of the row is
+    // passed to visitor as a view which is only valid during the call. Return false if the row
+    // does not exist
+    template <class Visitor>
+    bool getRowValue(std::string_view tableView, std::string_view keyView, Visitor&& visitor)
+    {
         {
-            auto& existsEntry = it->entry;
-            entryOld.emplace(std::move(existsEntry));
-
-            updatedCapacity -= entryOld->size();
-
-            STORAGE_REPORT_SET(tableView, keyView, entry, "UPDATE");
-            bucket->container.modify(it, [&entry](Data& data) { data.entry = std::move(entry); });
+            auto [bucket, lock] = getBucket(tableView, keyView);
+            boost::ignore_unused(lock);
 
-            if constexpr (enableLRU)
+            auto it = bucket->container.find(std::make_tuple(tableView, keyView));
+            if (it != bucket->container.end())
             {
-                updateMRUAndCheck(*bucket, it);
+                if (it->entry.status() != Entry::NORMAL)
+                {
+                    return false;
+                }
+
+                visitor(it->entry.get());
+                if constexpr (enableLRU)
+                {
+                    updateMRUAndCheck(*bucket, it);
+                }
+                return true;
             }
         }
-        else
-        {
-            bucket->container.emplace(
-                Data{std::string(tableView), std::string(keyView), std::move(entry)});
 
-            STORAGE_REPORT_SET(tableView, keyView, std::nullopt, "INSERT");
+        auto prev = getPrev();
+        if (!prev)
+        {
+            return false;
         }
 
-        if (m_recoder.local())
+        Error::UniquePtr prevError;
+        std::optional<Entry> prevEntry;
+        prev->asyncGetRow(
+            tableView, keyView, [&](Error::UniquePtr error, std::optional<Entry> entry) {
+                prevError = std::move(error);
+                prevEntry = std::move(entry);
+            });
+        if (prevError)
         {
-            m_recoder.local()->log(
-                Recoder::Change(std::string(tableView), std::string(keyView), std::move(entryOld)));
+            BOOST_THROW_EXCEPTION(BCOS_ERROR_WITH_PREV(
+                StorageError::ReadError, "Get row from storage failed!", *prevError));
+        }
+        if (!prevEntry)
+        {
+            return false;
         }
 
-        bucket->capacity += updatedCapacity;
+        auto entry = importExistingEntry(tableView, keyView, std::move(*prevEntry));
+        visitor(entry.get());
+        return true;
+    }
 
-        lock.unlock();
-        callback(nullptr);
+    // Synchronous fast path of asyncSetRow, throws if the storage is read-only
+    void setRowValue(std::string_view tableView, std::string_view keyView, std::string_view value)
+    {
+        if (m_readOnly)
+        {
+            BOOST_THROW_EXCEPTION(
+                BCOS_ERROR(StorageError::ReadOnly, "Try to operate a read-only storage"));
+        }
+
+        Entry entry;
+        entry.set(value);
+        setRowSync(tableView, keyView, std::move(entry));
     }
 
     void parallelTraverse(bool onlyDirty, std::function<bool(const std::string_view& table,
@@ -568,6 +628,21 @@ public:
         m_prev = std::move(prev);
     }
 
+    // drop all the entries and the recoders to reuse the storage on top of prev, the buckets keep
+    // their memory, must not be called while the storage is accessed
+    void reset(std::shared_ptr<StorageInterface> prev)
+    {
+        for (auto& bucket : m_buckets)
+        {
+            bucket.container.clear();
+            bucket.capacity = 0;
+        }
+        m_recoder.clear();
+        setPrev(std::move(prev));
+        m_enableTraverse = false;
+        m_readOnly = false;
+    }
+
     typename Recoder::Ptr newRecoder() { return std::make_shared<Recoder>(); }
     void setRecoder(typename Recoder::Ptr recoder) { m_recoder.local().swap(recoder); }
     void rollback(const Recoder& recoder)
@@ -647,6 +722,64 @@ public:
     void setMaxCapacity(ssize_t capacity) { m_maxCapacity = capacity; }
 
 private:
+    static void applyLimit(
+        std::vector<std::string>& keys, const std::optional<storage::Condition const>& condition)
+    {
+        if (!condition || !condition->hasLimit())
+        {
+            return;
+        }
+
+        auto [offset, count] = condition->getLimit();
+        std::sort(keys.begin(), keys.end());
+        keys.erase(keys.begin(), keys.begin() + std::min(offset, keys.size()));
+        if (count > 0 && keys.size() > count)
+        {
+            keys.resize(count);
+        }
+    }
+
+    void setRowSync(std::string_view tableView, std::string_view keyView, Entry entry)
+    {
+        ssize_t updatedCapacity = entry.size();
+        std::optional<Entry> entryOld;
+
+        auto [bucket, lock] = getBucket(tableView, keyView);
+        boost::ignore_unused(lock);
+
+        auto it = bucket->container.find(std::make_tuple(tableView, keyView));
+        if (it != bucket->container.end())
+        {
+            auto& existsEntry = it->entry;
+            entryOld.emplace(std::move(existsEntry));
+
+            updatedCapacity -= entryOld->size();
+
+            STORAGE_REPORT_SET(tableView, keyView, entry, "UPDATE");
+            bucket->container.modify(it, [&entry](Data& data) { data.entry = std::move(entry); });
+
+            if constexpr (enableLRU)
+            {
+                updateMRUAndCheck(*bucket, it);
+            }
+        }
+        else
+        {
+            bucket->container.emplace(
+                Data{std::string(tableView), std::string(keyView), std::move(entry)});
+
+            STORAGE_REPORT_SET(tableView, keyView, std::nullopt, "INSERT");
+        }
+
+        if (m_recoder.local())
+        {
+            m_recoder.local()->log(
+                Recoder::Change(std::string(tableView), std::string(keyView), std::move(entryOld)));
+        }
+
+        bucket->capacity += updatedCapacity;
+    }
+
     Entry importExistingEntry(std::string_view table, std::string_view key, Entry entry)
     {
         if (m_readOnly)
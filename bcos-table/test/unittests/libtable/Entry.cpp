@@ -23,6 +23,8 @@
 #include <bcos-utilities/testutils/TestPromptFixture.h>
 #include <boost/archive/binary_iarchive.hpp>
 #include <boost/archive/binary_oarchive.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/vector.hpp>
 #include <boost/test/unit_test.hpp>
 #include <iostream>
 #include <string>
@@ -162,6 +164,42 @@ BOOST_AUTO_TEST_CASE(largeObject)
     BOOST_CHECK_EQUAL(entry.getField(0), std::string(1024, 'a'));
 }
 
+BOOST_AUTO_TEST_CASE(compactObject)
+{
+    using Fields = std::tuple<std::vector<std::tuple<std::string, std::string>>>;
+    Fields value{{{"name", "alice"}, {"age", std::string(100, '1')}}};
+
+    // boost archive is written until the compatibility version is enabled
+    Entry legacyEntry;
+    legacyEntry.setObject(value, 0);
+    BOOST_CHECK(!codec::isCompact(legacyEntry.get()));
+    BOOST_CHECK(legacyEntry.getObject<Fields>() == value);
+
+    Entry entry;
+    entry.setObject(value, codec::COMPACT_COMPATIBILITY_VERSION);
+    BOOST_CHECK(codec::isCompact(entry.get()));
+    BOOST_CHECK(entry.getObject<Fields>() == value);
+    BOOST_CHECK_LT(entry.size(), legacyEntry.size());
+
+    // the objects own their fields
+    auto moved = std::move(entry);
+    auto out = moved.getObject<Fields>();
+    moved.setField(0, std::string(200, 'x'));
+    BOOST_CHECK_EQUAL(std::get<1>(std::get<0>(out)[0]), "alice");
+
+    // a compact value is never handed to boost archive
+    std::string unknownVersion(codec::COMPACT_MAGIC);
+    unknownVersion.push_back(codec::COMPACT_VERSION + 1);
+    Entry unknownEntry;
+    unknownEntry.setField(0, unknownVersion);
+    BOOST_CHECK_THROW(unknownEntry.getObject<Fields>(), bcos::Error);
+
+    auto truncated = std::string(codec::encodeCompact(value), 0, 20);
+    Entry truncatedEntry;
+    truncatedEntry.setField(0, truncated);
+    BOOST_CHECK_THROW(truncatedEntry.getObject<Fields>(), bcos::Error);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 }  // namespace test
 }  // namespace bcos
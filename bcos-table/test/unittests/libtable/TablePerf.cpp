@@ -2,6 +2,10 @@
 #include "bcos-table/src/StateStorage.h"
 #include <bcos-utilities/Common.h>
 #include <bcos-utilities/testutils/TestPromptFixture.h>
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/vector.hpp>
 #include <boost/lexical_cast.hpp>
 #include <boost/test/unit_test.hpp>
 #include <future>
@@ -128,6 +132,119 @@ BOOST_AUTO_TEST_CASE(asyncToSyncGet)
     std::cout << "asyncToSync cost: " << bcos::utcSteadyTime() - now << std::endl;
 }
 
+BOOST_AUTO_TEST_CASE(slotLoadStore)
+{
+    // 32 bytes keys and values, like the SLOAD/SSTORE of evm contracts
+    std::vector<std::string> keys;
+    keys.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        auto key = std::string(32, '\0');
+        auto number = boost::lexical_cast<std::string>(i);
+        std::copy(number.begin(), number.end(), key.begin());
+        keys.emplace_back(std::move(key));
+    }
+    auto value = std::string(32, 'v');
+    std::string_view table = "c_contract";
+
+    auto now = bcos::utcSteadyTime();
+    for (auto& key : keys)
+    {
+        Entry entry;
+        entry.importFields({bytes(value.begin(), value.end())});
+        tableFactory->asyncSetRow(table, key, std::move(entry), [](auto&& error) {
+            BOOST_CHECK(!error);
+        });
+    }
+    auto asyncSetCost = bcos::utcSteadyTime() - now;
+
+    now = bcos::utcSteadyTime();
+    for (auto& key : keys)
+    {
+        tableFactory->asyncGetRow(table, key, [&value](auto&& error, auto&& entry) {
+            BOOST_CHECK(!error);
+            BOOST_CHECK_EQUAL(entry->getField(0), value);
+        });
+    }
+    auto asyncGetCost = bcos::utcSteadyTime() - now;
+
+    now = bcos::utcSteadyTime();
+    for (auto& key : keys)
+    {
+        tableFactory->setRowValue(table, key, value);
+    }
+    auto syncSetCost = bcos::utcSteadyTime() - now;
+
+    now = bcos::utcSteadyTime();
+    for (auto& key : keys)
+    {
+        auto exists = tableFactory->getRowValue(table, key,
+            [&value](std::string_view valueView) { BOOST_CHECK_EQUAL(valueView, value); });
+        BOOST_CHECK(exists);
+    }
+    auto syncGetCost = bcos::utcSteadyTime() - now;
+
+    BOOST_CHECK(!tableFactory->getRowValue(table, "not exists", [](std::string_view) {}));
+
+    std::cout << "slot asyncSetRow cost: " << asyncSetCost
+              << " asyncGetRow cost: " << asyncGetCost << " setRowValue cost: " << syncSetCost
+              << " getRowValue cost: " << syncGetCost << std::endl;
+}
+
+BOOST_AUTO_TEST_CASE(objectCodec)
+{
+    // the table row of TableFactoryPrecompiled
+    using Fields = std::tuple<std::vector<std::tuple<std::string, std::string>>>;
+    Fields value{{{"name", "alice"}, {"balance", "1000000"}, {"memo", std::string(40, 'm')}}};
+    size_t rounds = count / 10;
+
+    auto now = bcos::utcSteadyTime();
+    std::string archiveValue;
+    for (size_t i = 0; i < rounds; ++i)
+    {
+        archiveValue.clear();
+        boost::iostreams::stream<boost::iostreams::back_insert_device<std::string>>
+            outputStream(archiveValue);
+        boost::archive::binary_oarchive archive(outputStream, Entry::ARCHIVE_FLAG);
+        archive << value;
+        outputStream.flush();
+    }
+    auto archiveEncodeCost = bcos::utcSteadyTime() - now;
+
+    now = bcos::utcSteadyTime();
+    for (size_t i = 0; i < rounds; ++i)
+    {
+        boost::iostreams::stream<boost::iostreams::array_source> inputStream(
+            archiveValue.data(), archiveValue.size());
+        boost::archive::binary_iarchive archive(inputStream, Entry::ARCHIVE_FLAG);
+        Fields out;
+        archive >> out;
+        BOOST_CHECK_EQUAL(std::get<0>(out).size(), 3);
+    }
+    auto archiveDecodeCost = bcos::utcSteadyTime() - now;
+
+    Entry entry;
+    now = bcos::utcSteadyTime();
+    for (size_t i = 0; i < rounds; ++i)
+    {
+        entry.setObject(value, codec::COMPACT_COMPATIBILITY_VERSION);
+    }
+    auto compactEncodeCost = bcos::utcSteadyTime() - now;
+
+    now = bcos::utcSteadyTime();
+    for (size_t i = 0; i < rounds; ++i)
+    {
+        auto out = entry.getObject<Fields>();
+        BOOST_CHECK_EQUAL(std::get<0>(out).size(), 3);
+    }
+    auto compactDecodeCost = bcos::utcSteadyTime() - now;
+
+    std::cout << "object codec, archive size: " << archiveValue.size()
+              << " encode cost: " << archiveEncodeCost << " decode cost: " << archiveDecodeCost
+              << ", compact size: " << entry.size() << " encode cost: " << compactEncodeCost
+              << " decode cost: " << compactDecodeCost << std::endl;
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace bcos::test
@@ -1069,6 +1069,24 @@ BOOST_AUTO_TEST_CASE(hash_map)
 
 BOOST_AUTO_TEST_CASE(importPrev) {}
 
+BOOST_AUTO_TEST_CASE(resetStorage)
+{
+    auto storage = std::make_shared<StateStorage>(memoryStorage, 1);
+    auto table = storage->createTable(testTableName, valueField);
+    BOOST_TEST(table);
+    auto entry = table->newEntry();
+    entry.setField(0, "value");
+    table->setRow("key", entry);
+    BOOST_TEST(table->getRow("key"));
+
+    // the entries written before reset are dropped
+    storage->reset(memoryStorage);
+    BOOST_TEST(!storage->openTable(testTableName));
+    table = storage->createTable(testTableName, valueField);
+    BOOST_TEST(table);
+    BOOST_TEST(!table->getRow("key"));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 }  // namespace test
 }  // namespace bcos
@@ -180,6 +180,46 @@ public:
             std::vector<char>(_block.begin(), _block.end()));
     }
 
+    void asyncResolveShortTxIDs(bcos::crypto::PublicPtr _generatedNodeID,
+        bcos::crypto::HashType const& _proposalHash, uint64_t _salt,
+        bcos::txpool::ShortTxIDsPtr _shortTxIDs, bcos::crypto::HashType const& _txsDigest,
+        std::function<void(bcos::Error::Ptr, bcos::protocol::Block::Ptr)> _onResolved) override
+    {
+        class Callback : public bcostars::TxPoolServicePrxCallback
+        {
+        public:
+            Callback(bcos::protocol::BlockFactory::Ptr _blockFactory,
+                std::function<void(bcos::Error::Ptr, bcos::protocol::Block::Ptr)> callback)
+              : m_blockFactory(_blockFactory), m_callback(callback)
+            {}
+
+            void callback_asyncResolveShortTxIDs(
+                const bcostars::Error& ret, const bcostars::Block& _txsList) override
+            {
+                auto txsList = m_blockFactory->createBlock();
+                std::dynamic_pointer_cast<bcostars::protocol::BlockImpl>(txsList)->setInner(
+                    std::move(*const_cast<bcostars::Block*>(&_txsList)));
+                m_callback(toBcosError(ret), txsList);
+            }
+
+            void callback_asyncResolveShortTxIDs_exception(tars::Int32 ret) override
+            {
+                m_callback(toBcosError(ret), nullptr);
+            }
+
+        private:
+            bcos::protocol::BlockFactory::Ptr m_blockFactory;
+            std::function<void(bcos::Error::Ptr, bcos::protocol::Block::Ptr)> m_callback;
+        };
+
+        auto nodeID = _generatedNodeID->data();
+        m_proxy->async_asyncResolveShortTxIDs(new Callback(m_blockFactory, _onResolved),
+            std::vector<char>(nodeID.begin(), nodeID.end()),
+            std::vector<char>(_proposalHash.begin(), _proposalHash.end()), (tars::Int64)_salt,
+            std::vector<tars::Int64>(_shortTxIDs->begin(), _shortTxIDs->end()),
+            std::vector<char>(_txsDigest.begin(), _txsDigest.end()));
+    }
+
     void asyncFillBlock(bcos::crypto::HashListPtr _txsHash,
         std::function<void(bcos::Error::Ptr, bcos::protocol::TransactionsPtr)> _onBlockFilled)
         override
@@ -300,9 +300,22 @@ void NodeConfig::loadTxPoolConfig(boost::property_tree::ptree const& _pt)
         BOOST_THROW_EXCEPTION(InvalidConfig() << errinfo_comment(
                                   "Please set txpool.verify_worker_num to positive !"));
     }
+    // announce the txs status with short ids to the peers that support it
+    m_compactTxsStatus = _pt.get<bool>("txpool.compact_txs_status", true);
+    // reconcile the txpool with a peer periodically instead of forwarding the txs status
+    m_reconcileTxs = _pt.get<bool>("txpool.reconcile_txs", false);
+    m_reconcileInterval = checkAndGetValue(_pt, "txpool.reconcile_interval", "1000");
+    if (m_reconcileInterval <= 0)
+    {
+        BOOST_THROW_EXCEPTION(InvalidConfig() << errinfo_comment(
+                                  "Please set txpool.reconcile_interval to positive !"));
+    }
     NodeConfig_LOG(INFO) << LOG_DESC("loadTxPoolConfig") << LOG_KV("txpoolLimit", m_txpoolLimit)
                          << LOG_KV("notifierWorkers", m_notifyWorkerNum)
-                         << LOG_KV("verifierWorkers", m_verifierWorkerNum);
+                         << LOG_KV("verifierWorkers", m_verifierWorkerNum)
+                         << LOG_KV("compactTxsStatus", m_compactTxsStatus)
+                         << LOG_KV("reconcileTxs", m_reconcileTxs)
+                         << LOG_KV("reconcileInterval", m_reconcileInterval);
 }
 
 void NodeConfig::loadChainConfig(boost::property_tree::ptree const& _pt)
@@ -350,8 +363,66 @@ void NodeConfig::loadStorageConfig(boost::property_tree::ptree const& _pt)
     m_storagePath = _pt.get<std::string>("storage.data_path", "data/" + m_groupId);
     m_enableLRUCacheStorage = _pt.get<bool>("storage.enable_cache", true);
     m_cacheSize = _pt.get<ssize_t>("storage.cache_size", DEFAULT_CACHE_SIZE);
+    m_storageSSTIngestThreshold = _pt.get<size_t>("storage.sst_ingest_threshold", 0);
+    auto keyEncoding = _pt.get<std::string>("storage.key_encoding", "table_name");
+    if (keyEncoding != "table_name" && keyEncoding != "table_id")
+    {
+        BOOST_THROW_EXCEPTION(InvalidConfig() << errinfo_comment(
+                                  "Please set storage.key_encoding to table_name or table_id!"));
+    }
+    // the db is migrated from table_name to table_id on start, but never back
+    m_storageTableIDKeyEncoding = (keyEncoding == "table_id");
+
+    // contract state takes point lookups, the block history is append-only
+    m_storageColumnFamilies = {{"default", {}, 128 * 1024 * 1024, 10, "no", "level"},
+        {"txs", {SYS_HASH_2_TX, SYS_NUMBER_2_TXS}, 32 * 1024 * 1024, 10, "zstd", "universal"},
+        {"receipts", {SYS_HASH_2_RECEIPT}, 32 * 1024 * 1024, 10, "zstd", "universal"},
+        {"headers",
+            {SYS_NUMBER_2_BLOCK_HEADER, SYS_NUMBER_2_HASH, SYS_HASH_2_NUMBER,
+                SYS_BLOCK_NUMBER_2_NONCES},
+            16 * 1024 * 1024, 10, "zstd", "level"}};
+    if (!_pt.get<bool>("storage.enable_column_families", false))
+    {
+        // all the tables are in the default column family with the default options of rocksdb
+        m_storageColumnFamilies.clear();
+    }
+    for (auto& columnFamily : m_storageColumnFamilies)
+    {
+        loadColumnFamilyConfig(_pt, columnFamily);
+    }
     NodeConfig_LOG(INFO) << LOG_DESC("loadStorageConfig") << LOG_KV("storagePath", m_storagePath)
-                         << LOG_KV("enableLRUCacheStorage", m_enableLRUCacheStorage);
+                         << LOG_KV("enableLRUCacheStorage", m_enableLRUCacheStorage)
+                         << LOG_KV("sstIngestThreshold", m_storageSSTIngestThreshold)
+                         << LOG_KV("keyEncoding", keyEncoding)
+                         << LOG_KV("columnFamilies", m_storageColumnFamilies.size());
+}
+
+void NodeConfig::loadColumnFamilyConfig(
+    boost::property_tree::ptree const& _pt, ColumnFamilyConfig& _config)
+{
+    auto prefix = "storage." + _config.name + "_";
+    _config.blockCacheSize = _pt.get<size_t>(prefix + "cache_size", _config.blockCacheSize);
+    _config.bloomBitsPerKey = _pt.get<int>(prefix + "bloom_bits", _config.bloomBitsPerKey);
+    _config.compression = _pt.get<std::string>(prefix + "compression", _config.compression);
+    _config.compaction = _pt.get<std::string>(prefix + "compaction", _config.compaction);
+    if (_config.compression != "no" && _config.compression != "snappy" &&
+        _config.compression != "lz4" && _config.compression != "zstd")
+    {
+        BOOST_THROW_EXCEPTION(
+            InvalidConfig() << errinfo_comment(
+                "Please set " + prefix + "compression to no, snappy, lz4 or zstd!"));
+    }
+    if (_config.compaction != "level" && _config.compaction != "universal")
+    {
+        BOOST_THROW_EXCEPTION(InvalidConfig() << errinfo_comment(
+                                  "Please set " + prefix + "compaction to level or universal!"));
+    }
+    NodeConfig_LOG(INFO) << LOG_DESC("loadColumnFamilyConfig") << LOG_KV("name", _config.name)
+                         << LOG_KV("tables", _config.tables.size())
+                         << LOG_KV("cacheSize", _config.blockCacheSize)
+                         << LOG_KV("bloomBits", _config.bloomBitsPerKey)
+                         << LOG_KV("compression", _config.compression)
+                         << LOG_KV("compaction", _config.compaction);
 }
 
 void NodeConfig::loadConsensusConfig(boost::property_tree::ptree const& _pt)
@@ -363,8 +434,15 @@ void NodeConfig::loadConsensusConfig(boost::property_tree::ptree const& _pt)
                                   "Please set consensus.checkpoint_timeout to no less than " +
                                   std::to_string(3000) + "ms!"));
     }
+    // the nodes without compact proposal support can't verify the compact pre-prepare, so enable
+    // it only when all the consensus nodes are upgraded
+    m_compactProposal = _pt.get<bool>("consensus.compact_proposal", false);
+    // append the committed proposals to the consensus wal instead of the consensus storage
+    m_enableConsensusWAL = _pt.get<bool>("consensus.enable_wal", false);
     NodeConfig_LOG(INFO) << LOG_DESC("loadConsensusConfig")
-                         << LOG_KV("checkPointTimeoutInterval", m_checkPointTimeoutInterval);
+                         << LOG_KV("checkPointTimeoutInterval", m_checkPointTimeoutInterval)
+                         << LOG_KV("compactProposal", m_compactProposal)
+                         << LOG_KV("enableConsensusWAL", m_enableConsensusWAL);
 }
 
 void NodeConfig::loadLedgerConfig(boost::property_tree::ptree const& _genesisConfig)
@@ -485,10 +563,28 @@ void NodeConfig::loadExecutorConfig(boost::property_tree::ptree const& _pt)
     m_isWasm = _pt.get<bool>("executor.is_wasm", false);
     m_isAuthCheck = _pt.get<bool>("executor.is_auth_check", false);
     m_authAdminAddress = _pt.get<std::string>("executor.auth_admin_account", "");
+    // in KB
+    auto coroutineStackSize = _pt.get<int64_t>("executor.coroutine_stack_size", 0);
+    if (coroutineStackSize < 0)
+    {
+        BOOST_THROW_EXCEPTION(InvalidConfig() << errinfo_comment(
+                                  "Please set executor.coroutine_stack_size to positive !"));
+    }
+    m_coroutineStackSize = coroutineStackSize * 1024;
+    auto codeCacheSize =
+        _pt.get<int64_t>("executor.code_cache_size", (int64_t)DEFAULT_CODE_CACHE_SIZE);
+    if (codeCacheSize < 0)
+    {
+        BOOST_THROW_EXCEPTION(InvalidConfig() << errinfo_comment(
+                                  "Please set executor.code_cache_size to positive !"));
+    }
+    m_codeCacheSize = codeCacheSize;
     NodeConfig_LOG(INFO) << LOG_DESC("loadExecutorConfig") << LOG_KV("isWasm", m_isWasm);
     NodeConfig_LOG(INFO) << LOG_DESC("loadExecutorConfig") << LOG_KV("isAuthCheck", m_isAuthCheck);
     NodeConfig_LOG(INFO) << LOG_DESC("loadExecutorConfig")
-                         << LOG_KV("authAdminAccount", m_authAdminAddress);
+                         << LOG_KV("authAdminAccount", m_authAdminAddress)
+                         << LOG_KV("coroutineStackSize", m_coroutineStackSize)
+                         << LOG_KV("codeCacheSize", m_codeCacheSize);
 }
 
 // Note: make sure the consensus param checker is consistent with the precompiled param checker
@@ -35,6 +35,23 @@ class NodeConfig
 {
 public:
     constexpr static ssize_t DEFAULT_CACHE_SIZE = 32 * 1024 * 1024;
+    constexpr static size_t DEFAULT_CODE_CACHE_SIZE = 64 * 1024 * 1024;
+
+    // the rocksdb tuning of a class of tables
+    struct ColumnFamilyConfig
+    {
+        std::string name;
+        // the tables stored in the column family, empty for the default column family
+        std::vector<std::string> tables;
+        // bytes of the block cache, 0 for the rocksdb default
+        size_t blockCacheSize = 0;
+        // 0 disables the bloom filter
+        int bloomBitsPerKey = 0;
+        // no, snappy, lz4 or zstd
+        std::string compression;
+        // level or universal
+        std::string compaction;
+    };
 
     using Ptr = std::shared_ptr<NodeConfig>;
     NodeConfig() : m_ledgerConfig(std::make_shared<bcos::ledger::LedgerConfig>()) {}
@@ -84,6 +101,9 @@ public:
     size_t txpoolLimit() const { return m_txpoolLimit; }
     size_t notifyWorkerNum() const { return m_notifyWorkerNum; }
     size_t verifierWorkerNum() const { return m_verifierWorkerNum; }
+    bool compactTxsStatus() const { return m_compactTxsStatus; }
+    bool reconcileTxs() const { return m_reconcileTxs; }
+    size_t reconcileInterval() const { return m_reconcileInterval; }
 
     bool smCryptoType() const { return m_smCryptoType; }
     std::string const& chainId() const { return m_chainId; }
@@ -94,6 +114,14 @@ public:
 
     size_t minSealTime() const { return m_minSealTime; }
     size_t checkPointTimeoutInterval() const { return m_checkPointTimeoutInterval; }
+    bool compactProposal() const { return m_compactProposal; }
+    bool enableConsensusWAL() const { return m_enableConsensusWAL; }
+    // the path of the consensus wal, it's set even if the wal is disabled
+    std::string const& consensusWALPath() const { return m_consensusWALPath; }
+    void setConsensusWALPath(std::string const& _consensusWALPath)
+    {
+        m_consensusWALPath = _consensusWALPath;
+    }
 
     std::string const& storagePath() const { return m_storagePath; }
     std::string const& storageDBName() const { return m_storageDBName; }
@@ -110,6 +138,10 @@ public:
     bool isWasm() const { return m_isWasm; }
     bool isAuthCheck() const { return m_isAuthCheck; }
     std::string const& authAdminAddress() const { return m_authAdminAddress; }
+    // 0 means the default coroutine stack size
+    size_t coroutineStackSize() const { return m_coroutineStackSize; }
+    // bytes of the committed contract code cached by the executor
+    size_t codeCacheSize() const { return m_codeCacheSize; }
 
     std::string const& rpcServiceName() const { return m_rpcServiceName; }
     std::string const& gatewayServiceName() const { return m_gatewayServiceName; }
@@ -170,6 +202,13 @@ public:
 
     bool enableLRUCacheStorage() const { return m_enableLRUCacheStorage; }
     ssize_t cacheSize() const { return m_cacheSize; }
+    size_t storageSSTIngestThreshold() const { return m_storageSSTIngestThreshold; }
+    bool storageTableIDKeyEncoding() const { return m_storageTableIDKeyEncoding; }
+    // the first one is the default column family, empty if the column families are disabled
+    std::vector<ColumnFamilyConfig> const& storageColumnFamilies() const
+    {
+        return m_storageColumnFamilies;
+    }
 
 protected:
     virtual void loadChainConfig(boost::property_tree::ptree const& _pt);
@@ -181,6 +220,8 @@ protected:
     virtual void loadSealerConfig(boost::property_tree::ptree const& _pt);
 
     virtual void loadStorageConfig(boost::property_tree::ptree const& _pt);
+    void loadColumnFamilyConfig(
+        boost::property_tree::ptree const& _pt, ColumnFamilyConfig& _config);
     virtual void loadConsensusConfig(boost::property_tree::ptree const& _pt);
 
     virtual void loadLedgerConfig(boost::property_tree::ptree const& _genesisConfig);
@@ -207,6 +248,9 @@ private:
     size_t m_txpoolLimit;
     size_t m_notifyWorkerNum;
     size_t m_verifierWorkerNum;
+    bool m_compactTxsStatus = true;
+    bool m_reconcileTxs = false;
+    size_t m_reconcileInterval = 1000;
     // TODO: the block sync module need some configurations?
 
     // chain configuration
@@ -218,6 +262,9 @@ private:
     // sealer configuration
     size_t m_minSealTime = 0;
     size_t m_checkPointTimeoutInterval;
+    bool m_compactProposal = false;
+    bool m_enableConsensusWAL = false;
+    std::string m_consensusWALPath;
     // for security
     std::string m_privateKeyPath;
 
@@ -236,6 +283,8 @@ private:
     bool m_isWasm = false;
     bool m_isAuthCheck = false;
     std::string m_authAdminAddress;
+    size_t m_coroutineStackSize = 0;
+    size_t m_codeCacheSize = DEFAULT_CODE_CACHE_SIZE;
 
     std::string m_rpcServiceName;
     std::string m_gatewayServiceName;
@@ -277,6 +326,11 @@ private:
 
     bool m_enableLRUCacheStorage = true;
     ssize_t m_cacheSize = DEFAULT_CACHE_SIZE;  // 32MB for default
+    // 0 means commit blocks through the write batch only
+    size_t m_storageSSTIngestThreshold = 0;
+    // encode the rocksdb keys with table id instead of table name
+    bool m_storageTableIDKeyEncoding = false;
+    std::vector<ColumnFamilyConfig> m_storageColumnFamilies;
 };
 }  // namespace tool
 }  // namespace bcos
@@ -24,6 +24,8 @@
 #include <bcos-framework/interfaces/protocol/CommonError.h>
 #include <bcos-tool/LedgerConfigFetcher.h>
 #include <tbb/parallel_for.h>
+#include <algorithm>
+#include <unordered_map>
 using namespace bcos;
 using namespace bcos::txpool;
 using namespace bcos::protocol;
@@ -90,6 +92,39 @@ void TxPool::asyncSubmit(bytesPointer _txData, TxSubmitCallback _txSubmitCallbac
     });
 }
 
+void TxPool::asyncSubmitBatch(
+    std::vector<bytesPointer> _txsData, std::vector<TxSubmitCallback> _txSubmitCallbacks)
+{
+    // the batch is verified and submitted by one task to avoid holding a task per transaction
+    auto self = std::weak_ptr<TxPool>(shared_from_this());
+    m_worker->enqueue([self, txsData = std::move(_txsData),
+                          txSubmitCallbacks = std::move(_txSubmitCallbacks)]() {
+        try
+        {
+            auto txpool = self.lock();
+            if (!txpool)
+            {
+                return;
+            }
+            if (!txpool->m_transactionSync->config()->existsInGroup())
+            {
+                for (auto const& txSubmitCallback : txSubmitCallbacks)
+                {
+                    txpool->checkExistsInGroup(txSubmitCallback);
+                }
+                return;
+            }
+            txpool->m_txpoolStorage->batchSubmitTransactions(txsData, txSubmitCallbacks);
+        }
+        catch (std::exception const& e)
+        {
+            TXPOOL_LOG(WARNING) << LOG_DESC("asyncSubmitBatch exception")
+                                << LOG_KV("txs", txsData.size())
+                                << LOG_KV("errorInfo", boost::diagnostic_information(e));
+        }
+    });
+}
+
 bool TxPool::checkExistsInGroup(TxSubmitCallback _txSubmitCallback)
 {
     auto syncConfig = m_transactionSync->config();
@@ -219,6 +254,165 @@ void TxPool::asyncVerifyBlock(PublicPtr _generatedNodeID, bytesConstRef const& _
     });
 }
 
+void TxPool::asyncResolveShortTxIDs(PublicPtr _generatedNodeID, HashType const& _proposalHash,
+    uint64_t _salt, ShortTxIDsPtr _shortTxIDs, HashType const& _txsDigest,
+    std::function<void(Error::Ptr, Block::Ptr)> _onResolved)
+{
+    auto self = std::weak_ptr<TxPool>(shared_from_this());
+    m_verifier->enqueue([self, _generatedNodeID, _proposalHash, _salt, _shortTxIDs, _txsDigest,
+                            _onResolved]() {
+        try
+        {
+            auto startT = utcTime();
+            auto txpool = self.lock();
+            if (!txpool)
+            {
+                _onResolved(std::make_shared<Error>(
+                                -1, "asyncResolveShortTxIDs failed for lock txpool failed"),
+                    nullptr);
+                return;
+            }
+            auto txs = txpool->m_txpoolStorage->resolveShortTxIDs(_salt, *_shortTxIDs);
+            TXPOOL_LOG(DEBUG) << LOG_DESC("asyncResolveShortTxIDs")
+                              << LOG_KV("hash", _proposalHash.abridged())
+                              << LOG_KV("totalTxs", _shortTxIDs->size())
+                              << LOG_KV("missedTxs", std::count(txs->begin(), txs->end(), nullptr))
+                              << LOG_KV("timecost", (utcTime() - startT));
+            txpool->fetchShortTxIDs(_generatedNodeID, _proposalHash, _salt, _shortTxIDs, txs,
+                [self, _generatedNodeID, _proposalHash, _salt, _shortTxIDs, _txsDigest, txs,
+                    _onResolved](Error::Ptr _error) {
+                    auto txpool = self.lock();
+                    if (!txpool)
+                    {
+                        return;
+                    }
+                    if (_error)
+                    {
+                        _onResolved(_error, nullptr);
+                        return;
+                    }
+                    if (txpool->checkTxsDigest(*txs, _txsDigest))
+                    {
+                        _onResolved(nullptr, txpool->createMetaDataBlock(*txs));
+                        return;
+                    }
+                    // some ids resolved to local transactions colliding with the ones of the
+                    // proposal, fetch all of them from the leader, which resolves them by the
+                    // proposal
+                    TXPOOL_LOG(INFO)
+                        << LOG_DESC("asyncResolveShortTxIDs: inconsistent txs, fetch all of them")
+                        << LOG_KV("hash", _proposalHash.abridged())
+                        << LOG_KV("totalTxs", _shortTxIDs->size());
+                    std::fill(txs->begin(), txs->end(), nullptr);
+                    txpool->fetchShortTxIDs(_generatedNodeID, _proposalHash, _salt, _shortTxIDs,
+                        txs, [self, _txsDigest, txs, _onResolved](Error::Ptr _error) {
+                            auto txpool = self.lock();
+                            if (!txpool)
+                            {
+                                return;
+                            }
+                            if (_error)
+                            {
+                                _onResolved(_error, nullptr);
+                                return;
+                            }
+                            if (!txpool->checkTxsDigest(*txs, _txsDigest))
+                            {
+                                _onResolved(
+                                    std::make_shared<Error>(CommonError::InconsistentTransactions,
+                                        "InconsistentTransactions"),
+                                    nullptr);
+                                return;
+                            }
+                            _onResolved(nullptr, txpool->createMetaDataBlock(*txs));
+                        });
+                });
+        }
+        catch (std::exception const& e)
+        {
+            TXPOOL_LOG(WARNING) << LOG_DESC("asyncResolveShortTxIDs exception")
+                                << LOG_KV("error", boost::diagnostic_information(e));
+            _onResolved(std::make_shared<Error>(-1, "asyncResolveShortTxIDs exception"), nullptr);
+        }
+    });
+}
+
+void TxPool::fetchShortTxIDs(PublicPtr _generatedNodeID, HashType const& _proposalHash,
+    uint64_t _salt, ShortTxIDsPtr _shortTxIDs, TransactionsPtr _txs,
+    std::function<void(Error::Ptr)> _onFetched)
+{
+    auto missedShortTxIDs = std::make_shared<ShortTxIDs>();
+    for (size_t i = 0; i < _txs->size(); i++)
+    {
+        if (!(*_txs)[i])
+        {
+            missedShortTxIDs->emplace_back((*_shortTxIDs)[i]);
+        }
+    }
+    if (missedShortTxIDs->size() == 0)
+    {
+        _onFetched(nullptr);
+        return;
+    }
+    m_transactionSync->requestMissedShortTxIDs(_generatedNodeID, _proposalHash, _salt,
+        missedShortTxIDs, [_salt, _shortTxIDs, _txs, _onFetched](
+                              Error::Ptr _error, TransactionsPtr _fetchedTxs) {
+            if (_error)
+            {
+                _onFetched(_error);
+                return;
+            }
+            std::unordered_map<uint64_t, Transaction::Ptr> fetchedTxs;
+            for (auto const& tx : *_fetchedTxs)
+            {
+                fetchedTxs.emplace(shortTxID(_salt, tx->hash()), tx);
+            }
+            for (size_t i = 0; i < _txs->size(); i++)
+            {
+                if ((*_txs)[i])
+                {
+                    continue;
+                }
+                auto it = fetchedTxs.find((*_shortTxIDs)[i]);
+                if (it == fetchedTxs.end())
+                {
+                    _onFetched(std::make_shared<Error>(
+                        CommonError::TransactionsMissing, "TransactionsMissing"));
+                    return;
+                }
+                (*_txs)[i] = it->second;
+            }
+            _onFetched(nullptr);
+        });
+}
+
+bool TxPool::checkTxsDigest(Transactions const& _txs, HashType const& _txsDigest)
+{
+    HashList txsHash;
+    txsHash.reserve(_txs.size());
+    for (auto const& tx : _txs)
+    {
+        txsHash.emplace_back(tx->hash());
+    }
+    return txsHashDigest(m_config->blockFactory()->cryptoSuite()->hashImpl(), txsHash) ==
+           _txsDigest;
+}
+
+Block::Ptr TxPool::createMetaDataBlock(Transactions const& _txs)
+{
+    auto blockFactory = m_config->blockFactory();
+    auto block = blockFactory->createBlock();
+    for (auto const& tx : _txs)
+    {
+        auto txMetaData = blockFactory->createTransactionMetaData();
+        txMetaData->setHash(tx->hash());
+        txMetaData->setTo(std::string(tx->to()));
+        txMetaData->setAttribute(tx->attribute());
+        block->appendTransactionMetaData(txMetaData);
+    }
+    return block;
+}
+
 void TxPool::asyncNotifyTxsSyncMessage(Error::Ptr _error, std::string const& _uuid,
     NodeIDPtr _nodeID, bytesConstRef _data, std::function<void(Error::Ptr _error)> _onRecv)
 {
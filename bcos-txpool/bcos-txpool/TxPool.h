@@ -54,6 +54,9 @@ public:
     void asyncSubmit(
         bytesPointer _txData, bcos::protocol::TxSubmitCallback _txSubmitCallback) override;
 
+    void asyncSubmitBatch(std::vector<bytesPointer> _txsData,
+        std::vector<bcos::protocol::TxSubmitCallback> _txSubmitCallbacks) override;
+
     void asyncSealTxs(size_t _txsLimit, TxsHashSetPtr _avoidTxs,
         std::function<void(Error::Ptr, bcos::protocol::Block::Ptr, bcos::protocol::Block::Ptr)>
             _sealCallback) override;
@@ -65,6 +68,11 @@ public:
     void asyncVerifyBlock(bcos::crypto::PublicPtr _generatedNodeID, bytesConstRef const& _block,
         std::function<void(Error::Ptr, bool)> _onVerifyFinished) override;
 
+    void asyncResolveShortTxIDs(bcos::crypto::PublicPtr _generatedNodeID,
+        bcos::crypto::HashType const& _proposalHash, uint64_t _salt, ShortTxIDsPtr _shortTxIDs,
+        bcos::crypto::HashType const& _txsDigest,
+        std::function<void(Error::Ptr, bcos::protocol::Block::Ptr)> _onResolved) override;
+
     void asyncNotifyTxsSyncMessage(bcos::Error::Ptr _error, std::string const& _uuid,
         bcos::crypto::NodeIDPtr _nodeID, bytesConstRef _data,
         std::function<void(Error::Ptr _error)> _onRecv) override;
@@ -132,6 +140,15 @@ public:
     }
 
 protected:
+    // fetch the transactions of _txs that are nullptr from the leader by the short ids
+    virtual void fetchShortTxIDs(bcos::crypto::PublicPtr _generatedNodeID,
+        bcos::crypto::HashType const& _proposalHash, uint64_t _salt, ShortTxIDsPtr _shortTxIDs,
+        bcos::protocol::TransactionsPtr _txs, std::function<void(Error::Ptr)> _onFetched);
+    bool checkTxsDigest(
+        bcos::protocol::Transactions const& _txs, bcos::crypto::HashType const& _txsDigest);
+    // the block of the transaction metaData, which is what the sealer proposes
+    virtual bcos::protocol::Block::Ptr createMetaDataBlock(
+        bcos::protocol::Transactions const& _txs);
     virtual bool checkExistsInGroup(bcos::protocol::TxSubmitCallback _txSubmitCallback);
     virtual void getTxsFromLocalLedger(bcos::crypto::HashListPtr _txsHash,
         bcos::crypto::HashListPtr _missedTxs,
@@ -31,6 +31,11 @@ using namespace bcos::protocol;
 using namespace bcos::ledger;
 using namespace bcos::consensus;
 static unsigned const c_maxSendTransactions = 1000;
+// the max number of the short ids announced to a peer that can be resolved
+static size_t const c_maxAnnouncedShortTxIDs = 50000;
+// the sketch size bounds of the txpool reconciliation, 16 bytes per cell
+static size_t const c_minSketchCells = 48;
+static size_t const c_maxSketchCells = 6144;
 
 void TransactionSync::start()
 {
@@ -76,6 +81,12 @@ void TransactionSync::executeWorker()
     {
         maintainTransactions();
     }
+    if (m_config->reconcileTxs() && m_config->existsInGroup() &&
+        utcTime() - m_lastReconcileTime >= m_config->reconcileInterval())
+    {
+        m_lastReconcileTime = utcTime();
+        reconcileTxs();
+    }
     if (!m_config->existsInGroup() || (!m_newTransactions && downloadTxsBufferEmpty()))
     {
         boost::unique_lock<boost::mutex> l(x_signalled);
@@ -96,6 +107,7 @@ void TransactionSync::onRecvSyncMessage(
             return;
         }
         auto txsSyncMsg = m_config->msgFactory()->createTxsSyncMsg(_data);
+        updatePeerShortTxIDSalt(_nodeID, txsSyncMsg->salt());
         // receive transactions
         if (txsSyncMsg->type() == TxsSyncPacketType::TxsPacket)
         {
@@ -126,6 +138,28 @@ void TransactionSync::onRecvSyncMessage(
                 }
             });
         }
+        // receive the sketch of the peer txpool, and response the difference
+        if (txsSyncMsg->type() == TxsSyncPacketType::TxsSketchPacket)
+        {
+            auto self = std::weak_ptr<TransactionSync>(shared_from_this());
+            m_worker->enqueue([self, txsSyncMsg, _sendResponse, _nodeID]() {
+                try
+                {
+                    auto transactionSync = self.lock();
+                    if (!transactionSync)
+                    {
+                        return;
+                    }
+                    transactionSync->onReceiveTxsSketch(txsSyncMsg, _sendResponse, _nodeID);
+                }
+                catch (std::exception const& e)
+                {
+                    SYNC_LOG(WARNING) << LOG_DESC("onRecvSyncMessage: onReceiveTxsSketch exception")
+                                      << LOG_KV("error", boost::diagnostic_information(e))
+                                      << LOG_KV("peer", _nodeID->shortHex());
+                }
+            });
+        }
         if (txsSyncMsg->type() == TxsSyncPacketType::TxsStatusPacket)
         {
             auto self = std::weak_ptr<TransactionSync>(shared_from_this());
@@ -159,6 +193,11 @@ void TransactionSync::onRecvSyncMessage(
 void TransactionSync::onReceiveTxsRequest(TxsSyncMsgInterface::Ptr _txsRequest,
     SendResponseCallback _sendResponse, bcos::crypto::PublicPtr _peer)
 {
+    if (_txsRequest->shortTxIDs().size() > 0)
+    {
+        onReceiveShortTxsRequest(_txsRequest, _sendResponse, _peer);
+        return;
+    }
     auto const& txsHash = _txsRequest->txsHash();
     HashList missedTxs;
     auto txs = m_config->txpoolStorage()->fetchTxs(missedTxs, txsHash);
@@ -177,9 +216,14 @@ void TransactionSync::onReceiveTxsRequest(TxsSyncMsgInterface::Ptr _txsRequest,
         }
 #endif
     }
-    // response the txs
+    responseTxs(txs, _sendResponse, _peer);
+}
+
+void TransactionSync::responseTxs(
+    TransactionsPtr _txs, SendResponseCallback _sendResponse, bcos::crypto::PublicPtr _peer)
+{
     auto block = m_config->blockFactory()->createBlock();
-    for (auto constTx : *txs)
+    for (auto constTx : *_txs)
     {
         auto tx = std::const_pointer_cast<Transaction>(constTx);
         block->appendTransaction(tx);
@@ -192,7 +236,52 @@ void TransactionSync::onReceiveTxsRequest(TxsSyncMsgInterface::Ptr _txsRequest,
     _sendResponse(ref(*packetData));
     SYNC_LOG(INFO) << LOG_DESC("onReceiveTxsRequest: response txs")
                    << LOG_KV("peer", _peer ? _peer->shortHex() : "unknown")
-                   << LOG_KV("txsSize", txs->size());
+                   << LOG_KV("txsSize", _txs->size());
+}
+
+void TransactionSync::onReceiveShortTxsRequest(TxsSyncMsgInterface::Ptr _txsRequest,
+    SendResponseCallback _sendResponse, bcos::crypto::PublicPtr _peer)
+{
+    auto const& shortTxIDs = _txsRequest->shortTxIDs();
+    auto salt = _txsRequest->shortTxIDSalt();
+    auto proposalHash = _txsRequest->proposalHash();
+    auto txs = std::make_shared<Transactions>();
+    if (proposalHash != HashType())
+    {
+        // the transactions of the compact proposal generated by this node
+        txs = m_config->txpoolStorage()->fetchBatchTxsByShortTxIDs(salt, shortTxIDs, proposalHash);
+    }
+    else
+    {
+        // the transactions announced to the peer
+        HashList txsHash;
+        {
+            std::lock_guard<std::mutex> l(x_peerShortTxIDs);
+            auto it = m_peerShortTxIDs.find(_peer);
+            if (it != m_peerShortTxIDs.end() && it->second.salt == salt)
+            {
+                auto const& announced = it->second.announced;
+                for (auto const& id : shortTxIDs)
+                {
+                    auto announcedIt = announced.find(id);
+                    if (announcedIt != announced.end())
+                    {
+                        txsHash.emplace_back(announcedIt->second);
+                    }
+                }
+            }
+        }
+        HashList missedTxs;
+        txs = m_config->txpoolStorage()->fetchTxs(missedTxs, txsHash);
+    }
+    if (txs->size() < shortTxIDs.size())
+    {
+        SYNC_LOG(DEBUG) << LOG_DESC("onReceiveShortTxsRequest: transaction missing")
+                        << LOG_KV("missedTxsSize", shortTxIDs.size() - txs->size())
+                        << LOG_KV("peer", _peer ? _peer->shortHex() : "unknown")
+                        << LOG_KV("proposal", proposalHash.abridged());
+    }
+    responseTxs(txs, _sendResponse, _peer);
 }
 
 void TransactionSync::requestMissedTxs(PublicPtr _generatedNodeID, HashListPtr _missedTxs,
@@ -238,6 +327,72 @@ void TransactionSync::requestMissedTxs(PublicPtr _generatedNodeID, HashListPtr _
         });
 }
 
+void TransactionSync::requestMissedShortTxIDs(PublicPtr _generatedNodeID,
+    HashType const& _proposalHash, uint64_t _salt, ShortTxIDsPtr _missedShortTxIDs,
+    std::function<void(Error::Ptr, TransactionsPtr)> _onFetched)
+{
+    auto txsRequest =
+        m_config->msgFactory()->createTxsSyncMsg(TxsSyncPacketType::TxsRequestPacket, HashList());
+    attachShortTxIDSalt(txsRequest);
+    txsRequest->setShortTxIDs(_salt, *_missedShortTxIDs);
+    txsRequest->setProposalHash(_proposalHash);
+    auto encodedData = txsRequest->encode();
+    auto startT = utcTime();
+    auto self = std::weak_ptr<TransactionSync>(shared_from_this());
+    m_config->frontService()->asyncSendMessageByNodeID(ModuleID::TxsSync, _generatedNodeID,
+        ref(*encodedData), m_config->networkTimeout(),
+        [self, startT, _proposalHash, _missedShortTxIDs, _onFetched](Error::Ptr _error,
+            NodeIDPtr _nodeID, bytesConstRef _data, const std::string&, SendResponseCallback) {
+            try
+            {
+                auto transactionSync = self.lock();
+                if (!transactionSync)
+                {
+                    return;
+                }
+                if (_error != nullptr)
+                {
+                    SYNC_LOG(INFO) << LOG_DESC("requestMissedShortTxIDs: fetch missed txs failed")
+                                   << LOG_KV("errorCode", _error->errorCode())
+                                   << LOG_KV("errorMsg", _error->errorMessage());
+                    _onFetched(_error, nullptr);
+                    return;
+                }
+                auto config = transactionSync->m_config;
+                auto txsResponse = config->msgFactory()->createTxsSyncMsg(_data);
+                if (txsResponse->type() != TxsSyncPacketType::TxsResponsePacket)
+                {
+                    _onFetched(std::make_shared<Error>(CommonError::FetchTransactionsFailed,
+                                   "FetchTransactionsFailed"),
+                        nullptr);
+                    return;
+                }
+                auto block =
+                    config->blockFactory()->createBlock(txsResponse->txsData(), true, false);
+                auto txs = std::make_shared<Transactions>();
+                for (size_t i = 0; i < block->transactionsSize(); i++)
+                {
+                    txs->emplace_back(std::const_pointer_cast<Transaction>(block->transaction(i)));
+                }
+                transactionSync->importDownloadedTxs(_nodeID, txs);
+                SYNC_LOG(DEBUG) << LOG_DESC("requestMissedShortTxIDs: fetch missed txs success")
+                                << LOG_KV("proposal", _proposalHash.abridged())
+                                << LOG_KV("missedTxs", _missedShortTxIDs->size())
+                                << LOG_KV("fetchedTxs", txs->size())
+                                << LOG_KV("timecost", (utcTime() - startT));
+                _onFetched(nullptr, txs);
+            }
+            catch (std::exception const& e)
+            {
+                SYNC_LOG(WARNING) << LOG_DESC("requestMissedShortTxIDs exception")
+                                  << LOG_KV("error", boost::diagnostic_information(e));
+                _onFetched(std::make_shared<Error>(
+                               CommonError::FetchTransactionsFailed, "FetchTransactionsFailed"),
+                    nullptr);
+            }
+        });
+}
+
 size_t TransactionSync::onGetMissedTxsFromLedger(std::set<HashType>& _missedTxs, Error::Ptr _error,
     TransactionsPtr _fetchedTxs, Block::Ptr _verifiedProposal,
     VerifyResponseCallback _onVerifyFinished)
@@ -294,6 +449,7 @@ void TransactionSync::requestMissedTxsFromPeer(PublicPtr _generatedNodeID, HashL
     }
     auto txsRequest =
         m_config->msgFactory()->createTxsSyncMsg(TxsSyncPacketType::TxsRequestPacket, *_missedTxs);
+    attachShortTxIDSalt(txsRequest);
     auto encodedData = txsRequest->encode();
     auto encodeT = utcTime() - startT;
     startT = utcTime();
@@ -583,6 +739,11 @@ void TransactionSync::maintainTransactions()
         return;
     }
     broadcastTxsFromRpc(connectedNodeList, consensusNodeList, txs);
+    // the txs received from the peers are spread by reconcileTxs
+    if (m_config->reconcileTxs())
+    {
+        return;
+    }
     forwardTxsFromP2P(connectedNodeList, consensusNodeList, txs);
 }
 
@@ -624,13 +785,13 @@ void TransactionSync::forwardTxsFromP2P(bcos::crypto::NodeIDSet const& _connecte
         {
             continue;
         }
-        auto txsStatus =
-            m_config->msgFactory()->createTxsSyncMsg(TxsSyncPacketType::TxsStatusPacket, *txsHash);
+        auto txsStatus = createTxsStatus(peer, *txsHash);
         auto packetData = txsStatus->encode();
         m_config->frontService()->asyncSendMessageByNodeID(
             ModuleID::TxsSync, peer, ref(*packetData), 0, nullptr);
         SYNC_LOG(DEBUG) << LOG_DESC("txsStatus: forwardTxsFromP2P")
                         << LOG_KV("to", peer->shortHex()) << LOG_KV("txsSize", txsHash->size())
+                        << LOG_KV("shortTxIDs", txsStatus->shortTxIDs().size())
                         << LOG_KV("packetSize", packetData->size());
     }
 }
@@ -699,6 +860,7 @@ void TransactionSync::broadcastTxsFromRpc(NodeIDSet const& _connectedPeers,
     block->encode(*encodedData);
     auto txsPacket = m_config->msgFactory()->createTxsSyncMsg(
         TxsSyncPacketType::TxsPacket, std::move(*encodedData));
+    attachShortTxIDSalt(txsPacket);
     auto packetData = txsPacket->encode();
     m_config->frontService()->asyncSendBroadcastMessage(
         bcos::protocol::NodeType::CONSENSUS_NODE, ModuleID::TxsSync, ref(*packetData));
@@ -714,11 +876,19 @@ void TransactionSync::onPeerTxsStatus(NodeIDPtr _fromNode, TxsSyncMsgInterface::
     {
         maintainDownloadingTransactions();
     }
-    if (_txsStatus->txsHash().size() == 0)
+    if (_txsStatus->txsHash().size() == 0 && _txsStatus->shortTxIDs().size() == 0)
     {
         responseTxsStatus(_fromNode);
         return;
     }
+    if (_txsStatus->shortTxIDs().size() > 0)
+    {
+        onPeerShortTxsStatus(_fromNode, _txsStatus);
+    }
+    if (_txsStatus->txsHash().size() == 0)
+    {
+        return;
+    }
     auto requestTxs = m_config->txpoolStorage()->filterUnknownTxs(_txsStatus->txsHash(), _fromNode);
     if (requestTxs->size() == 0)
     {
@@ -737,8 +907,7 @@ void TransactionSync::responseTxsStatus(NodeIDPtr _fromNode)
     {
         return;
     }
-    auto txsStatus =
-        m_config->msgFactory()->createTxsSyncMsg(TxsSyncPacketType::TxsStatusPacket, *txsHash);
+    auto txsStatus = createTxsStatus(_fromNode, *txsHash);
     auto packetData = txsStatus->encode();
     m_config->frontService()->asyncSendMessageByNodeID(
         ModuleID::TxsSync, _fromNode, ref(*packetData), 0, nullptr);
@@ -756,7 +925,370 @@ void TransactionSync::onEmptyTxs()
     SYNC_LOG(DEBUG) << LOG_DESC("onEmptyTxs: broadcast txs status to all consensus node list");
     auto txsStatus =
         m_config->msgFactory()->createTxsSyncMsg(TxsSyncPacketType::TxsStatusPacket, HashList());
+    attachShortTxIDSalt(txsStatus);
     auto packetData = txsStatus->encode();
     m_config->frontService()->asyncSendBroadcastMessage(
         bcos::protocol::NodeType::CONSENSUS_NODE, ModuleID::TxsSync, ref(*packetData));
-}
\ No newline at end of file
+}
+
+void TransactionSync::onPeerShortTxsStatus(
+    NodeIDPtr _fromNode, TxsSyncMsgInterface::Ptr _txsStatus)
+{
+    auto txpoolStorage = m_config->txpoolStorage();
+    // the peer announced with the salt before the restart of this node
+    if (_txsStatus->shortTxIDSalt() != txpoolStorage->shortTxIDSalt())
+    {
+        SYNC_LOG(DEBUG) << LOG_DESC("onPeerShortTxsStatus: ignore the status with unknown salt")
+                        << LOG_KV("peer", _fromNode->shortHex())
+                        << LOG_KV("shortTxIDs", _txsStatus->shortTxIDs().size());
+        return;
+    }
+    auto requestShortTxIDs =
+        txpoolStorage->filterUnknownShortTxIDs(_txsStatus->shortTxIDs(), _fromNode);
+    if (requestShortTxIDs->size() == 0)
+    {
+        return;
+    }
+    auto txsRequest =
+        m_config->msgFactory()->createTxsSyncMsg(TxsSyncPacketType::TxsRequestPacket, HashList());
+    attachShortTxIDSalt(txsRequest);
+    txsRequest->setShortTxIDs(txpoolStorage->shortTxIDSalt(), *requestShortTxIDs);
+    auto encodedData = txsRequest->encode();
+    auto self = std::weak_ptr<TransactionSync>(shared_from_this());
+    m_config->frontService()->asyncSendMessageByNodeID(ModuleID::TxsSync, _fromNode,
+        ref(*encodedData), m_config->networkTimeout(),
+        [self](Error::Ptr _error, NodeIDPtr _nodeID, bytesConstRef _data, const std::string&,
+            SendResponseCallback) {
+            try
+            {
+                auto transactionSync = self.lock();
+                if (!transactionSync || _error != nullptr)
+                {
+                    return;
+                }
+                auto config = transactionSync->m_config;
+                auto txsResponse = config->msgFactory()->createTxsSyncMsg(_data);
+                if (txsResponse->type() != TxsSyncPacketType::TxsResponsePacket)
+                {
+                    return;
+                }
+                auto transactions =
+                    config->blockFactory()->createBlock(txsResponse->txsData(), true, false);
+                transactionSync->importDownloadedTxs(_nodeID, transactions);
+            }
+            catch (std::exception const& e)
+            {
+                SYNC_LOG(WARNING) << LOG_DESC("onPeerShortTxsStatus: import txs exception")
+                                  << LOG_KV("error", boost::diagnostic_information(e));
+            }
+        });
+    SYNC_LOG(DEBUG) << LOG_DESC("onPeerShortTxsStatus")
+                    << LOG_KV("reqSize", requestShortTxIDs->size())
+                    << LOG_KV("peerTxsSize", _txsStatus->shortTxIDs().size())
+                    << LOG_KV("peer", _fromNode->shortHex());
+}
+
+TxsSyncMsgInterface::Ptr TransactionSync::createTxsStatus(
+    NodeIDPtr _peer, HashList const& _txsHash)
+{
+    auto txsStatus =
+        m_config->msgFactory()->createTxsSyncMsg(TxsSyncPacketType::TxsStatusPacket, HashList());
+    attachShortTxIDSalt(txsStatus);
+    if (!m_config->compactTxsStatus())
+    {
+        txsStatus->setTxsHash(_txsHash);
+        return txsStatus;
+    }
+    HashList txsHash;
+    ShortTxIDs shortTxIDs;
+    uint64_t salt = 0;
+    {
+        std::lock_guard<std::mutex> l(x_peerShortTxIDs);
+        auto it = m_peerShortTxIDs.find(_peer);
+        // the salt of the peer is unknown
+        if (it == m_peerShortTxIDs.end())
+        {
+            txsStatus->setTxsHash(_txsHash);
+            return txsStatus;
+        }
+        auto& peerShortTxIDs = it->second;
+        salt = peerShortTxIDs.salt;
+        shortTxIDs.reserve(_txsHash.size());
+        for (auto const& hash : _txsHash)
+        {
+            auto id = shortTxID(salt, hash);
+            auto announced = peerShortTxIDs.announced.emplace(id, hash);
+            // collides with another announced transaction, fallback to the full hash
+            if (!announced.second && announced.first->second != hash)
+            {
+                txsHash.emplace_back(hash);
+                continue;
+            }
+            if (announced.second)
+            {
+                peerShortTxIDs.announceOrder.emplace_back(id);
+            }
+            shortTxIDs.emplace_back(id);
+        }
+        while (peerShortTxIDs.announceOrder.size() > c_maxAnnouncedShortTxIDs)
+        {
+            peerShortTxIDs.announced.erase(peerShortTxIDs.announceOrder.front());
+            peerShortTxIDs.announceOrder.pop_front();
+        }
+    }
+    txsStatus->setTxsHash(txsHash);
+    txsStatus->setShortTxIDs(salt, shortTxIDs);
+    return txsStatus;
+}
+
+void TransactionSync::attachShortTxIDSalt(TxsSyncMsgInterface::Ptr const& _txsSyncMsg)
+{
+    // the peers announce the txs status with full hashes to the nodes without salt
+    if (!m_config->compactTxsStatus())
+    {
+        return;
+    }
+    _txsSyncMsg->setSalt(m_config->txpoolStorage()->shortTxIDSalt());
+}
+
+void TransactionSync::updatePeerShortTxIDSalt(NodeIDPtr _peer, uint64_t _salt)
+{
+    std::lock_guard<std::mutex> l(x_peerShortTxIDs);
+    if (_salt == 0)
+    {
+        m_peerShortTxIDs.erase(_peer);
+        return;
+    }
+    auto& peerShortTxIDs = m_peerShortTxIDs[_peer];
+    if (peerShortTxIDs.salt != _salt)
+    {
+        // the peer restarted with a new salt
+        peerShortTxIDs = PeerShortTxIDs();
+        peerShortTxIDs.salt = _salt;
+    }
+}
+
+void TransactionSync::reconcileTxs()
+{
+    auto connectedNodeList = m_config->connectedNodeList();
+    NodeIDs peers;
+    for (auto const& consensusNode : m_config->consensusNodeList())
+    {
+        auto nodeId = consensusNode->nodeID();
+        if (connectedNodeList.count(nodeId) && nodeId->data() != m_config->nodeID()->data())
+        {
+            peers.emplace_back(nodeId);
+        }
+    }
+    if (peers.empty())
+    {
+        return;
+    }
+    auto peer = peers[(m_reconcileIndex++) % peers.size()];
+    size_t sketchCells = c_minSketchCells;
+    {
+        std::lock_guard<std::mutex> l(x_sketchCells);
+        auto it = m_sketchCells.find(peer);
+        if (it != m_sketchCells.end())
+        {
+            sketchCells = it->second;
+        }
+    }
+    // a new salt every round, so the colliding short ids of a round don't collide again
+    auto salt = m_reconcileRandom() | 1;
+    auto shortTxIDs = std::make_shared<std::unordered_map<uint64_t, HashType>>();
+    auto sketch = createTxsSketch(salt, sketchCells, *shortTxIDs);
+    auto txsSketch =
+        m_config->msgFactory()->createTxsSyncMsg(TxsSyncPacketType::TxsSketchPacket, HashList());
+    attachShortTxIDSalt(txsSketch);
+    txsSketch->setShortTxIDs(salt, ShortTxIDs());
+    txsSketch->setSketch(sketch.encode());
+    auto encodedData = txsSketch->encode();
+    auto self = std::weak_ptr<TransactionSync>(shared_from_this());
+    m_config->frontService()->asyncSendMessageByNodeID(ModuleID::TxsSync, peer, ref(*encodedData),
+        m_config->networkTimeout(),
+        [self, peer, sketchCells = sketch.cells(), shortTxIDs](Error::Ptr _error, NodeIDPtr,
+            bytesConstRef _data, const std::string&, SendResponseCallback) {
+            try
+            {
+                auto transactionSync = self.lock();
+                if (!transactionSync)
+                {
+                    return;
+                }
+                transactionSync->onTxsSketchResponse(
+                    peer, sketchCells, shortTxIDs, _error, _data);
+            }
+            catch (std::exception const& e)
+            {
+                SYNC_LOG(WARNING) << LOG_DESC("reconcileTxs: onTxsSketchResponse exception")
+                                  << LOG_KV("error", boost::diagnostic_information(e))
+                                  << LOG_KV("peer", peer->shortHex());
+            }
+        });
+    SYNC_LOG(TRACE) << LOG_DESC("reconcileTxs") << LOG_KV("peer", peer->shortHex())
+                    << LOG_KV("txsSize", shortTxIDs->size())
+                    << LOG_KV("sketchCells", sketch.cells())
+                    << LOG_KV("packetSize", encodedData->size());
+}
+
+void TransactionSync::onReceiveTxsSketch(TxsSyncMsgInterface::Ptr _txsSketch,
+    SendResponseCallback _sendResponse, bcos::crypto::PublicPtr _peer)
+{
+    auto peerSketch = TxsSketch::decode(_txsSketch->sketch(), c_maxSketchCells);
+    if (!peerSketch)
+    {
+        SYNC_LOG(WARNING) << LOG_DESC("onReceiveTxsSketch: invalid sketch")
+                          << LOG_KV("peer", _peer->shortHex())
+                          << LOG_KV("sketchSize", _txsSketch->sketch().size());
+        return;
+    }
+    auto salt = _txsSketch->shortTxIDSalt();
+    std::unordered_map<uint64_t, HashType> shortTxIDs;
+    peerSketch->subtract(createTxsSketch(salt, peerSketch->cells(), shortTxIDs));
+    ShortTxIDs missedShortTxIDs;
+    ShortTxIDs peerMissedShortTxIDs;
+    if (!peerSketch->decode(missedShortTxIDs, peerMissedShortTxIDs))
+    {
+        auto txsSketchFailed = m_config->msgFactory()->createTxsSyncMsg(
+            TxsSyncPacketType::TxsSketchFailedPacket, HashList());
+        auto packetData = txsSketchFailed->encode();
+        _sendResponse(ref(*packetData));
+        SYNC_LOG(DEBUG) << LOG_DESC("onReceiveTxsSketch: the difference is too large to decode")
+                        << LOG_KV("peer", _peer->shortHex())
+                        << LOG_KV("sketchCells", peerSketch->cells());
+        return;
+    }
+    HashList peerMissedTxs;
+    for (auto const& id : peerMissedShortTxIDs)
+    {
+        auto it = shortTxIDs.find(id);
+        if (it != shortTxIDs.end())
+        {
+            peerMissedTxs.emplace_back(it->second);
+        }
+    }
+    HashList missedTxs;
+    auto txs = m_config->txpoolStorage()->fetchTxs(missedTxs, peerMissedTxs);
+    auto block = m_config->blockFactory()->createBlock();
+    for (auto const& tx : *txs)
+    {
+        block->appendTransaction(std::const_pointer_cast<Transaction>(tx));
+    }
+    bytesPointer txsData = std::make_shared<bytes>();
+    block->encode(*txsData);
+    auto txsResponse = m_config->msgFactory()->createTxsSyncMsg(
+        TxsSyncPacketType::TxsResponsePacket, std::move(*txsData));
+    txsResponse->setShortTxIDs(salt, missedShortTxIDs);
+    auto packetData = txsResponse->encode();
+    _sendResponse(ref(*packetData));
+    SYNC_LOG(DEBUG) << LOG_DESC("onReceiveTxsSketch: response the difference")
+                    << LOG_KV("peer", _peer->shortHex()) << LOG_KV("txsSize", txs->size())
+                    << LOG_KV("missedTxs", missedShortTxIDs.size())
+                    << LOG_KV("sketchCells", peerSketch->cells());
+}
+
+void TransactionSync::onTxsSketchResponse(NodeIDPtr _peer, size_t _sketchCells,
+    std::shared_ptr<std::unordered_map<uint64_t, HashType>> _shortTxIDs, Error::Ptr _error,
+    bytesConstRef _data)
+{
+    if (_error != nullptr)
+    {
+        SYNC_LOG(INFO) << LOG_DESC("onTxsSketchResponse: reconcile txs failed")
+                       << LOG_KV("peer", _peer->shortHex())
+                       << LOG_KV("errorCode", _error->errorCode())
+                       << LOG_KV("errorMsg", _error->errorMessage());
+        return;
+    }
+    auto txsResponse = m_config->msgFactory()->createTxsSyncMsg(_data);
+    if (txsResponse->type() == TxsSyncPacketType::TxsSketchFailedPacket)
+    {
+        {
+            std::lock_guard<std::mutex> l(x_sketchCells);
+            m_sketchCells[_peer] = std::min(_sketchCells * 2, c_maxSketchCells);
+        }
+        if (_sketchCells < c_maxSketchCells)
+        {
+            return;
+        }
+        // the difference exceeds the largest sketch, fallback to the txs status
+        HashList txsHash;
+        txsHash.reserve(_shortTxIDs->size());
+        for (auto const& it : *_shortTxIDs)
+        {
+            txsHash.emplace_back(it.second);
+        }
+        auto txsStatus = createTxsStatus(_peer, txsHash);
+        auto packetData = txsStatus->encode();
+        m_config->frontService()->asyncSendMessageByNodeID(
+            ModuleID::TxsSync, _peer, ref(*packetData), 0, nullptr);
+        SYNC_LOG(DEBUG) << LOG_DESC("onTxsSketchResponse: decode failed, send the txs status")
+                        << LOG_KV("peer", _peer->shortHex()) << LOG_KV("txsSize", txsHash.size())
+                        << LOG_KV("packetSize", packetData->size());
+        return;
+    }
+    if (txsResponse->type() != TxsSyncPacketType::TxsResponsePacket)
+    {
+        return;
+    }
+    auto transactions = m_config->blockFactory()->createBlock(txsResponse->txsData(), true, false);
+    importDownloadedTxs(_peer, transactions);
+    auto const& missedShortTxIDs = txsResponse->shortTxIDs();
+    auto difference = transactions->transactionsSize() + missedShortTxIDs.size();
+    {
+        std::lock_guard<std::mutex> l(x_sketchCells);
+        m_sketchCells[_peer] =
+            std::max(c_minSketchCells, std::min(difference * 2 + 32, c_maxSketchCells));
+    }
+    if (missedShortTxIDs.size() == 0)
+    {
+        return;
+    }
+    // send the txs missed by the peer
+    HashList peerMissedTxs;
+    for (auto const& id : missedShortTxIDs)
+    {
+        auto it = _shortTxIDs->find(id);
+        if (it != _shortTxIDs->end())
+        {
+            peerMissedTxs.emplace_back(it->second);
+        }
+    }
+    HashList missedTxs;
+    auto txs = m_config->txpoolStorage()->fetchTxs(missedTxs, peerMissedTxs);
+    auto block = m_config->blockFactory()->createBlock();
+    for (auto const& tx : *txs)
+    {
+        block->appendTransaction(std::const_pointer_cast<Transaction>(tx));
+    }
+    auto encodedData = std::make_shared<bytes>();
+    block->encode(*encodedData);
+    auto txsPacket = m_config->msgFactory()->createTxsSyncMsg(
+        TxsSyncPacketType::TxsPacket, std::move(*encodedData));
+    attachShortTxIDSalt(txsPacket);
+    auto packetData = txsPacket->encode();
+    m_config->frontService()->asyncSendMessageByNodeID(
+        ModuleID::TxsSync, _peer, ref(*packetData), 0, nullptr);
+    SYNC_LOG(DEBUG) << LOG_DESC("onTxsSketchResponse: reconciled")
+                    << LOG_KV("peer", _peer->shortHex())
+                    << LOG_KV("fetchedTxs", transactions->transactionsSize())
+                    << LOG_KV("sentTxs", txs->size()) << LOG_KV("packetSize", packetData->size());
+}
+
+TxsSketch TransactionSync::createTxsSketch(
+    uint64_t _salt, size_t _cells, std::unordered_map<uint64_t, HashType>& _shortTxIDs)
+{
+    TxsSketch sketch(_cells);
+    auto txsHash = m_config->txpoolStorage()->getAllTxsHash();
+    _shortTxIDs.reserve(txsHash->size());
+    for (auto const& hash : *txsHash)
+    {
+        auto id = shortTxID(_salt, hash);
+        // the txs with the same short id are reconciled as one
+        if (_shortTxIDs.emplace(id, hash).second)
+        {
+            sketch.insert(id);
+        }
+    }
+    return sketch;
+}
@@ -22,9 +22,14 @@
 
 #include "bcos-txpool/sync/TransactionSyncConfig.h"
 #include "bcos-txpool/sync/interfaces/TransactionSyncInterface.h"
+#include "bcos-txpool/sync/utilities/TxsSketch.h"
 #include <bcos-framework/interfaces/protocol/Protocol.h>
 #include <bcos-utilities/ThreadPool.h>
 #include <bcos-utilities/Worker.h>
+#include <deque>
+#include <mutex>
+#include <random>
+#include <unordered_map>
 
 namespace bcos
 {
@@ -42,7 +47,8 @@ public:
         m_downloadTxsBuffer(std::make_shared<TxsSyncMsgList>()),
         m_worker(std::make_shared<ThreadPool>("txsSyncWorker", 1)),
         m_txsRequester(std::make_shared<ThreadPool>("txsRequester", 1)),
-        m_forwardWorker(std::make_shared<ThreadPool>("txsForward", 1))
+        m_forwardWorker(std::make_shared<ThreadPool>("txsForward", 1)),
+        m_reconcileRandom(std::random_device()())
     {
         m_txsSubmitted = m_config->txpoolStorage()->onReady([&]() { this->noteNewTransactions(); });
     }
@@ -61,8 +67,17 @@ public:
         bcos::crypto::HashListPtr _missedTxs, bcos::protocol::Block::Ptr _verifiedProposal,
         VerifyResponseCallback _onVerifyFinished) override;
 
+    void requestMissedShortTxIDs(bcos::crypto::PublicPtr _generatedNodeID,
+        bcos::crypto::HashType const& _proposalHash, uint64_t _salt,
+        bcos::txpool::ShortTxIDsPtr _missedShortTxIDs,
+        std::function<void(Error::Ptr, bcos::protocol::TransactionsPtr)> _onFetched) override;
+
     virtual void maintainTransactions();
     virtual void maintainDownloadingTransactions();
+    // reconcile gossip: the sketch of the txpool is sent to one peer per reconcileInterval, the
+    // peer decodes the difference against its own txpool, responses the txs this node misses and
+    // requests the txs it misses with short ids
+    virtual void reconcileTxs();
     void onEmptyTxs() override;
 
 protected:
@@ -83,6 +98,28 @@ protected:
 
     virtual void onReceiveTxsRequest(TxsSyncMsgInterface::Ptr _txsRequest,
         SendResponseCallback _sendResponse, bcos::crypto::PublicPtr _peer);
+    virtual void responseTxs(bcos::protocol::TransactionsPtr _txs,
+        SendResponseCallback _sendResponse, bcos::crypto::PublicPtr _peer);
+
+    // compact relay: the txs status are announced with the short ids salted by the receiver, and
+    // the announced ids are kept to resolve the following txs request of the receiver
+    virtual TxsSyncMsgInterface::Ptr createTxsStatus(
+        bcos::crypto::NodeIDPtr _peer, bcos::crypto::HashList const& _txsHash);
+    virtual void onPeerShortTxsStatus(
+        bcos::crypto::NodeIDPtr _fromNode, TxsSyncMsgInterface::Ptr _txsStatus);
+    virtual void onReceiveShortTxsRequest(TxsSyncMsgInterface::Ptr _txsRequest,
+        SendResponseCallback _sendResponse, bcos::crypto::PublicPtr _peer);
+    void attachShortTxIDSalt(TxsSyncMsgInterface::Ptr const& _txsSyncMsg);
+    void updatePeerShortTxIDSalt(bcos::crypto::NodeIDPtr _peer, uint64_t _salt);
+
+    virtual void onReceiveTxsSketch(TxsSyncMsgInterface::Ptr _txsSketch,
+        SendResponseCallback _sendResponse, bcos::crypto::PublicPtr _peer);
+    virtual void onTxsSketchResponse(bcos::crypto::NodeIDPtr _peer, size_t _sketchCells,
+        std::shared_ptr<std::unordered_map<uint64_t, bcos::crypto::HashType>> _shortTxIDs,
+        Error::Ptr _error, bytesConstRef _data);
+    // _shortTxIDs maps the short ids salted by _salt to the txs of the txpool
+    TxsSketch createTxsSketch(uint64_t _salt, size_t _cells,
+        std::unordered_map<uint64_t, bcos::crypto::HashType>& _shortTxIDs);
 
     // functions called by requestMissedTxs
     virtual void verifyFetchedTxs(Error::Ptr _error, bcos::crypto::NodeIDPtr _nodeID,
@@ -140,6 +177,25 @@ private:
 
     bcos::Handler<> m_txsSubmitted;
 
+    struct PeerShortTxIDs
+    {
+        uint64_t salt = 0;
+        std::unordered_map<uint64_t, bcos::crypto::HashType> announced;
+        // announce order of the ids, to drop the oldest ones
+        std::deque<uint64_t> announceOrder;
+    };
+    std::map<bcos::crypto::NodeIDPtr, PeerShortTxIDs, bcos::crypto::KeyCompare> m_peerShortTxIDs;
+    std::mutex x_peerShortTxIDs;
+
+    // the sketch cells expected to decode the difference with the peer, grows when the decoding
+    // fails and follows the last difference otherwise
+    std::map<bcos::crypto::NodeIDPtr, size_t, bcos::crypto::KeyCompare> m_sketchCells;
+    std::mutex x_sketchCells;
+    // only accessed by the worker thread
+    std::mt19937_64 m_reconcileRandom;
+    size_t m_reconcileIndex = 0;
+    uint64_t m_lastReconcileTime = 0;
+
     std::atomic_bool m_running = {false};
 
     std::atomic_bool m_newTransactions = {false};
@@ -59,6 +59,17 @@ public:
     void setNetworkTimeout(unsigned _networkTimeout) { m_networkTimeout = _networkTimeout; }
     unsigned forwardPercent() const { return m_forwardPercent; }
     void setForwardPercent(unsigned _forwardPercent) { m_forwardPercent = _forwardPercent; }
+    // announce the txs status to the peers with short ids
+    bool compactTxsStatus() const { return m_compactTxsStatus; }
+    void setCompactTxsStatus(bool _compactTxsStatus) { m_compactTxsStatus = _compactTxsStatus; }
+    // reconcile the txpool with a peer every reconcileInterval ms instead of forwarding the status
+    bool reconcileTxs() const { return m_reconcileTxs; }
+    void setReconcileTxs(bool _reconcileTxs) { m_reconcileTxs = _reconcileTxs; }
+    unsigned reconcileInterval() const { return m_reconcileInterval; }
+    void setReconcileInterval(unsigned _reconcileInterval)
+    {
+        m_reconcileInterval = _reconcileInterval;
+    }
     std::shared_ptr<bcos::ledger::LedgerInterface> ledger() { return m_ledger; }
 
     // for ut
@@ -78,6 +89,11 @@ private:
     unsigned m_networkTimeout = 500;
 
     unsigned m_forwardPercent = 25;
+
+    bool m_compactTxsStatus = true;
+
+    bool m_reconcileTxs = false;
+    unsigned m_reconcileInterval = 1000;
 };
 }  // namespace sync
 }  // namespace bcos
\ No newline at end of file
@@ -22,6 +22,7 @@
 #include "bcos-txpool/sync/TransactionSyncConfig.h"
 #include <bcos-crypto/interfaces/crypto/CommonType.h>
 #include <bcos-framework/interfaces/protocol/Block.h>
+#include <bcos-framework/interfaces/txpool/TxPoolTypeDef.h>
 
 namespace bcos
 {
@@ -42,6 +43,13 @@ public:
         bcos::crypto::HashListPtr _missedTxs, bcos::protocol::Block::Ptr _verifiedProposal,
         std::function<void(Error::Ptr, bool)> _onVerifyFinished) = 0;
 
+    // fetch the transactions of a compact proposal from its leader, the fetched transactions are
+    // imported into the txpool
+    virtual void requestMissedShortTxIDs(bcos::crypto::PublicPtr _generatedNodeID,
+        bcos::crypto::HashType const& _proposalHash, uint64_t _salt,
+        bcos::txpool::ShortTxIDsPtr _missedShortTxIDs,
+        std::function<void(Error::Ptr, bcos::protocol::TransactionsPtr)> _onFetched) = 0;
+
     virtual void onRecvSyncMessage(bcos::Error::Ptr _error, bcos::crypto::NodeIDPtr _nodeID,
         bytesConstRef _data, std::function<void(bytesConstRef _response)> _sendResponse) = 0;
 
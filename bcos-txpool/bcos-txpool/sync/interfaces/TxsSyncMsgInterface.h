@@ -21,6 +21,7 @@
 #pragma once
 #include <bcos-crypto/interfaces/crypto/CommonType.h>
 #include <bcos-crypto/interfaces/crypto/KeyInterface.h>
+#include <bcos-framework/interfaces/txpool/TxPoolTypeDef.h>
 namespace bcos
 {
 namespace sync
@@ -39,12 +40,21 @@ public:
     virtual int32_t type() const = 0;
     virtual bytesConstRef txsData() const = 0;
     virtual bcos::crypto::HashList const& txsHash() const = 0;
+    virtual uint64_t salt() const = 0;
+    virtual uint64_t shortTxIDSalt() const = 0;
+    virtual bcos::txpool::ShortTxIDs const& shortTxIDs() const = 0;
+    virtual bcos::crypto::HashType proposalHash() const = 0;
+    virtual bytesConstRef sketch() const = 0;
 
     virtual void setVersion(int32_t _version) = 0;
     virtual void setType(int32_t _type) = 0;
     virtual void setTxsData(bytes const& _txsData) = 0;
     virtual void setTxsData(bytes&& _txsData) = 0;
     virtual void setTxsHash(bcos::crypto::HashList const& _txsHash) = 0;
+    virtual void setSalt(uint64_t _salt) = 0;
+    virtual void setShortTxIDs(uint64_t _salt, bcos::txpool::ShortTxIDs const& _shortTxIDs) = 0;
+    virtual void setProposalHash(bcos::crypto::HashType const& _proposalHash) = 0;
+    virtual void setSketch(bytes const& _sketch) = 0;
 
     virtual void setFrom(bcos::crypto::NodeIDPtr _from) { m_from = _from; }
     virtual bcos::crypto::NodeIDPtr from() const { return m_from; }
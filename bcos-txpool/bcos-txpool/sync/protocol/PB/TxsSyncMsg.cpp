@@ -58,6 +58,37 @@ HashList const& TxsSyncMsg::txsHash() const
     return *m_txsHash;
 }
 
+uint64_t TxsSyncMsg::salt() const
+{
+    return m_rawSyncMessage->salt();
+}
+
+uint64_t TxsSyncMsg::shortTxIDSalt() const
+{
+    return m_rawSyncMessage->shorttxidsalt();
+}
+
+bcos::txpool::ShortTxIDs const& TxsSyncMsg::shortTxIDs() const
+{
+    return *m_shortTxIDs;
+}
+
+HashType TxsSyncMsg::proposalHash() const
+{
+    auto const& hashData = m_rawSyncMessage->proposalhash();
+    if (hashData.size() < HashType::size)
+    {
+        return HashType();
+    }
+    return HashType((byte const*)hashData.data(), HashType::size);
+}
+
+bytesConstRef TxsSyncMsg::sketch() const
+{
+    auto const& sketch = m_rawSyncMessage->sketch();
+    return bytesConstRef((byte const*)sketch.data(), sketch.size());
+}
+
 void TxsSyncMsg::setVersion(int32_t _version)
 {
     m_rawSyncMessage->set_version(_version);
@@ -88,6 +119,28 @@ void TxsSyncMsg::setTxsHash(HashList const& _txsHash)
     }
 }
 
+void TxsSyncMsg::setSalt(uint64_t _salt)
+{
+    m_rawSyncMessage->set_salt(_salt);
+}
+
+void TxsSyncMsg::setShortTxIDs(uint64_t _salt, bcos::txpool::ShortTxIDs const& _shortTxIDs)
+{
+    *m_shortTxIDs = _shortTxIDs;
+    m_rawSyncMessage->set_shorttxidsalt(_salt);
+    m_rawSyncMessage->mutable_shorttxids()->Assign(_shortTxIDs.begin(), _shortTxIDs.end());
+}
+
+void TxsSyncMsg::setProposalHash(HashType const& _proposalHash)
+{
+    m_rawSyncMessage->set_proposalhash(_proposalHash.data(), HashType::size);
+}
+
+void TxsSyncMsg::setSketch(bytes const& _sketch)
+{
+    m_rawSyncMessage->set_sketch(_sketch.data(), _sketch.size());
+}
+
 void TxsSyncMsg::deserializeObject()
 {
     m_txsHash->clear();
@@ -97,4 +150,6 @@ void TxsSyncMsg::deserializeObject()
         m_txsHash->emplace_back(
             HashType((byte const*)hashData.c_str(), bcos::crypto::HashType::size));
     }
+    auto const& shortTxIDs = m_rawSyncMessage->shorttxids();
+    m_shortTxIDs->assign(shortTxIDs.begin(), shortTxIDs.end());
 }
\ No newline at end of file
@@ -31,7 +31,8 @@ class TxsSyncMsg : public TxsSyncMsgInterface
 public:
     TxsSyncMsg()
       : m_rawSyncMessage(std::make_shared<TxsSyncMessage>()),
-        m_txsHash(std::make_shared<bcos::crypto::HashList>())
+        m_txsHash(std::make_shared<bcos::crypto::HashList>()),
+        m_shortTxIDs(std::make_shared<bcos::txpool::ShortTxIDs>())
     {}
 
     explicit TxsSyncMsg(bytesConstRef _data) : TxsSyncMsg() { decode(_data); }
@@ -44,12 +45,21 @@ public:
     int32_t type() const override;
     bytesConstRef txsData() const override;
     bcos::crypto::HashList const& txsHash() const override;
+    uint64_t salt() const override;
+    uint64_t shortTxIDSalt() const override;
+    bcos::txpool::ShortTxIDs const& shortTxIDs() const override;
+    bcos::crypto::HashType proposalHash() const override;
+    bytesConstRef sketch() const override;
 
     void setVersion(int32_t _version) override;
     void setType(int32_t _type) override;
     void setTxsData(bytes const& _txsData) override;
     void setTxsData(bytes&& _txsData) override;
     void setTxsHash(bcos::crypto::HashList const& _txsHash) override;
+    void setSalt(uint64_t _salt) override;
+    void setShortTxIDs(uint64_t _salt, bcos::txpool::ShortTxIDs const& _shortTxIDs) override;
+    void setProposalHash(bcos::crypto::HashType const& _proposalHash) override;
+    void setSketch(bytes const& _sketch) override;
 
 protected:
     virtual void deserializeObject();
@@ -57,6 +67,7 @@ protected:
 private:
     std::shared_ptr<TxsSyncMessage> m_rawSyncMessage;
     bcos::crypto::HashListPtr m_txsHash;
+    bcos::txpool::ShortTxIDsPtr m_shortTxIDs;
 };
 }  // namespace sync
 }  // namespace bcos
\ No newline at end of file
@@ -33,6 +33,11 @@ enum TxsSyncPacketType : int32_t
     TxsStatusPacket = 0x01,
     TxsRequestPacket = 0x02,
     TxsResponsePacket = 0x03,
+    // the TxsSketch of the txpool, answered with the txs the sender misses and the short ids of
+    // the txs the sender has and the receiver misses
+    TxsSketchPacket = 0x04,
+    // answer of a TxsSketchPacket whose difference is larger than the sketch can decode
+    TxsSketchFailedPacket = 0x05,
     PacketCount
 };
 }
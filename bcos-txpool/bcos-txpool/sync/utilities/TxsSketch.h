@@ -0,0 +1,212 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief invertible bloom lookup table of short tx ids, used to reconcile the txpools
+ * @file TxsSketch.h
+ */
+#pragma once
+#include <bcos-utilities/Common.h>
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace bcos
+{
+namespace sync
+{
+/// Every id is xor-ed into one cell of each of the c_hashNum sub-tables. Subtracting the sketch of
+/// another set cancels the common ids, and the difference is peeled from the cells holding a
+/// single id, so the size of the sketch only depends on the size of the difference: about 1.5
+/// cells per differing id
+class TxsSketch
+{
+public:
+    constexpr static size_t c_hashNum = 3;
+    // encoded size of a cell: count, idSum and checkSum
+    constexpr static size_t c_cellSize = 16;
+
+    explicit TxsSketch(size_t _cells)
+      : m_cells((std::max<size_t>(_cells, c_hashNum) + c_hashNum - 1) / c_hashNum * c_hashNum)
+    {}
+
+    size_t cells() const { return m_cells.size(); }
+
+    void insert(uint64_t _id) { update(_id, 1); }
+    void erase(uint64_t _id) { update(_id, -1); }
+
+    // the cell count of _sketch must be the same as this sketch
+    void subtract(TxsSketch const& _sketch)
+    {
+        for (size_t i = 0; i < m_cells.size(); i++)
+        {
+            m_cells[i].count -= _sketch.m_cells[i].count;
+            m_cells[i].idSum ^= _sketch.m_cells[i].idSum;
+            m_cells[i].checkSum ^= _sketch.m_cells[i].checkSum;
+        }
+    }
+
+    // peel the ids inserted only into this sketch into _inserted, and the ids only subtracted
+    // into _subtracted, return false if the difference is too large to be decoded
+    bool decode(std::vector<uint64_t>& _inserted, std::vector<uint64_t>& _subtracted) const
+    {
+        auto cells = m_cells;
+        std::vector<size_t> pureCells;
+        for (size_t i = 0; i < cells.size(); i++)
+        {
+            if (isPure(cells[i]))
+            {
+                pureCells.emplace_back(i);
+            }
+        }
+        while (!pureCells.empty())
+        {
+            auto const cell = cells[pureCells.back()];
+            pureCells.pop_back();
+            // peeled by another id
+            if (!isPure(cell))
+            {
+                continue;
+            }
+            if (cell.count > 0)
+            {
+                _inserted.emplace_back(cell.idSum);
+            }
+            else
+            {
+                _subtracted.emplace_back(cell.idSum);
+            }
+            for (size_t i = 0; i < c_hashNum; i++)
+            {
+                auto index = cellIndex(cell.idSum, i);
+                cells[index].count -= cell.count;
+                cells[index].idSum ^= cell.idSum;
+                cells[index].checkSum ^= cell.checkSum;
+                if (isPure(cells[index]))
+                {
+                    pureCells.emplace_back(index);
+                }
+            }
+        }
+        for (auto const& cell : cells)
+        {
+            if (cell.count != 0 || cell.idSum != 0 || cell.checkSum != 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bytes encode() const
+    {
+        bytes data(m_cells.size() * c_cellSize);
+        auto pointer = data.data();
+        for (auto const& cell : m_cells)
+        {
+            pointer = writeLE((uint32_t)cell.count, pointer);
+            pointer = writeLE(cell.idSum, pointer);
+            pointer = writeLE(cell.checkSum, pointer);
+        }
+        return data;
+    }
+
+    // return std::nullopt if _data is not an encoded sketch of at most _maxCells cells
+    static std::optional<TxsSketch> decode(bytesConstRef _data, size_t _maxCells)
+    {
+        if (_data.size() == 0 || _data.size() % (c_cellSize * c_hashNum) != 0 ||
+            _data.size() / c_cellSize > _maxCells)
+        {
+            return std::nullopt;
+        }
+        TxsSketch sketch(_data.size() / c_cellSize);
+        auto pointer = _data.data();
+        for (auto& cell : sketch.m_cells)
+        {
+            uint32_t count = 0;
+            pointer = readLE(count, pointer);
+            cell.count = (int32_t)count;
+            pointer = readLE(cell.idSum, pointer);
+            pointer = readLE(cell.checkSum, pointer);
+        }
+        return sketch;
+    }
+
+private:
+    struct Cell
+    {
+        int32_t count = 0;
+        uint64_t idSum = 0;
+        uint32_t checkSum = 0;
+    };
+
+    static uint64_t mix(uint64_t _value)
+    {
+        _value = (_value ^ (_value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        _value = (_value ^ (_value >> 27)) * 0x94d049bb133111ebULL;
+        return _value ^ (_value >> 31);
+    }
+
+    static uint32_t checkSum(uint64_t _id) { return (uint32_t)mix(_id ^ 0x9e3779b97f4a7c15ULL); }
+
+    // the i-th hash of the id selects a cell of the i-th sub-table, so the cells are distinct
+    size_t cellIndex(uint64_t _id, size_t _i) const
+    {
+        auto subTableSize = m_cells.size() / c_hashNum;
+        return _i * subTableSize + mix(_id + _i) % subTableSize;
+    }
+
+    bool isPure(Cell const& _cell) const
+    {
+        return (_cell.count == 1 || _cell.count == -1) && checkSum(_cell.idSum) == _cell.checkSum;
+    }
+
+    void update(uint64_t _id, int32_t _count)
+    {
+        auto idCheckSum = checkSum(_id);
+        for (size_t i = 0; i < c_hashNum; i++)
+        {
+            auto& cell = m_cells[cellIndex(_id, i)];
+            cell.count += _count;
+            cell.idSum ^= _id;
+            cell.checkSum ^= idCheckSum;
+        }
+    }
+
+    template <class T>
+    static byte* writeLE(T _value, byte* _pointer)
+    {
+        for (size_t i = 0; i < sizeof(T); i++)
+        {
+            *_pointer++ = (byte)(_value >> (8 * i));
+        }
+        return _pointer;
+    }
+
+    template <class T>
+    static byte const* readLE(T& _value, byte const* _pointer)
+    {
+        _value = 0;
+        for (size_t i = 0; i < sizeof(T); i++)
+        {
+            _value |= (T)(*_pointer++) << (8 * i);
+        }
+        return _pointer;
+    }
+
+    std::vector<Cell> m_cells;
+};
+}  // namespace sync
+}  // namespace bcos
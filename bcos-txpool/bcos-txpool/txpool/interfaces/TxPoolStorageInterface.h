@@ -42,6 +42,9 @@ public:
         bcos::protocol::Transaction::Ptr _tx,
         bcos::protocol::TxSubmitCallback _txSubmitCallback = nullptr, bool _enforceImport = false,
         bool _checkPoolLimit = false) = 0;
+    // decode and verify the signatures of the transactions in parallel, then submit them in order
+    virtual void batchSubmitTransactions(std::vector<bytesPointer> const& _txsData,
+        std::vector<bcos::protocol::TxSubmitCallback> const& _txSubmitCallbacks) = 0;
 
     virtual bcos::protocol::TransactionStatus insert(bcos::protocol::Transaction::ConstPtr _tx) = 0;
     virtual void batchInsert(bcos::protocol::Transactions const& _txs) = 0;
@@ -72,6 +75,19 @@ public:
     virtual bcos::crypto::HashListPtr filterUnknownTxs(
         bcos::crypto::HashList const& _txsHashList, bcos::crypto::NodeIDPtr _peer) = 0;
 
+    // the salt of the short ids which the peers announce the txs status to this node with
+    virtual uint64_t shortTxIDSalt() const = 0;
+    // Note: _shortTxIDs must be salted with shortTxIDSalt()
+    virtual ShortTxIDsPtr filterUnknownShortTxIDs(
+        ShortTxIDs const& _shortTxIDs, bcos::crypto::NodeIDPtr _peer) = 0;
+    // resolve the short ids salted with _salt through the index of the salt, the result is in
+    // the order of _shortTxIDs, with nullptr for the missed ids and the ambiguous ids
+    virtual bcos::protocol::TransactionsPtr resolveShortTxIDs(
+        uint64_t _salt, ShortTxIDs const& _shortTxIDs) = 0;
+    // the transactions of the batch _batchHash sealed by this node that match the short ids
+    virtual bcos::protocol::TransactionsPtr fetchBatchTxsByShortTxIDs(uint64_t _salt,
+        ShortTxIDs const& _shortTxIDs, bcos::crypto::HashType const& _batchHash) = 0;
+
     virtual size_t size() const = 0;
     virtual void clear() = 0;
 
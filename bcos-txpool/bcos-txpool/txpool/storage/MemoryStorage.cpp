@@ -19,9 +19,13 @@
  * @date 2021-05-07
  */
 #include "bcos-txpool/txpool/storage/MemoryStorage.h"
+#include <tbb/parallel_for.h>
 #include <tbb/parallel_invoke.h>
+#include <algorithm>
 #include <memory>
+#include <random>
 #include <tuple>
+#include <unordered_map>
 
 using namespace bcos;
 using namespace bcos::txpool;
@@ -33,6 +37,10 @@ MemoryStorage::MemoryStorage(TxPoolConfig::Ptr _config, size_t _notifyWorkerNum)
     m_notifier = std::make_shared<ThreadPool>("txNotifier", _notifyWorkerNum);
     m_worker = std::make_shared<ThreadPool>("txpoolWorker", 1);
     m_blockNumberUpdatedTime = utcTime();
+    std::random_device randomDevice;
+    std::uniform_int_distribution<uint64_t> distribution(1);
+    m_shortTxIDSalt = distribution(randomDevice);
+    m_shortTxIDIndexes[m_shortTxIDSalt] = std::make_shared<ShortTxIDIndex>();
     TXPOOL_LOG(INFO) << LOG_DESC("init MemoryStorage of txpool")
                      << LOG_KV("txNotifierWorkerNum", _notifyWorkerNum);
 }
@@ -71,6 +79,57 @@ TransactionStatus MemoryStorage::submitTransaction(
     }
 }
 
+void MemoryStorage::batchSubmitTransactions(std::vector<bytesPointer> const& _txsData,
+    std::vector<TxSubmitCallback> const& _txSubmitCallbacks)
+{
+    // decode the transactions and recover the senders in parallel, the recovered sender is cached
+    // in the transaction so the signature is not verified again when submit
+    std::vector<Transaction::Ptr> txs(_txsData.size());
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, _txsData.size()),
+        [&](const tbb::blocked_range<size_t>& _range) {
+            for (size_t i = _range.begin(); i < _range.end(); i++)
+            {
+                try
+                {
+                    txs[i] = m_config->txFactory()->createTransaction(ref(*_txsData[i]), false);
+                }
+                catch (std::exception const& e)
+                {
+                    TXPOOL_LOG(WARNING) << LOG_DESC("Invalid transaction for decode exception")
+                                        << LOG_KV("error", boost::diagnostic_information(e));
+                    continue;
+                }
+                if (exist(txs[i]->hash()))
+                {
+                    continue;
+                }
+                try
+                {
+                    txs[i]->verify();
+                }
+                catch (std::exception const& e)
+                {
+                    txs[i]->setInvalid(true);
+                }
+            }
+        });
+    // the nonce checks depend on the order of the transactions
+    for (size_t i = 0; i < txs.size(); i++)
+    {
+        auto const& tx = txs[i];
+        if (!tx)
+        {
+            notifyInvalidReceipt(HashType(), TransactionStatus::Malform, _txSubmitCallbacks[i]);
+            continue;
+        }
+        auto result = submitTransaction(tx, _txSubmitCallbacks[i]);
+        if (result != TransactionStatus::None)
+        {
+            notifyInvalidReceipt(tx->hash(), result, _txSubmitCallbacks[i]);
+        }
+    }
+}
+
 TransactionStatus MemoryStorage::txpoolStorageCheck(Transaction::ConstPtr _tx)
 {
     auto txHash = _tx->hash();
@@ -209,6 +268,7 @@ TransactionStatus MemoryStorage::insert(Transaction::ConstPtr _tx)
         return TransactionStatus::AlreadyInTxPool;
     }
     m_txsTable[_tx->hash()] = _tx;
+    insertShortTxID(_tx->hash());
     m_onReady();
     preCommitTransaction(_tx);
     notifyUnsealedTxsSize();
@@ -284,6 +344,7 @@ Transaction::ConstPtr MemoryStorage::removeWithoutLock(HashType const& _txHash)
         m_sealedTxsSize--;
     }
     m_txsTable.unsafe_erase(_txHash);
+    eraseShortTxID(_txHash);
 #if FISCO_DEBUG
     // TODO: remove this, now just for bug tracing
     TXPOOL_LOG(DEBUG) << LOG_DESC("remove tx: ") << tx->hash().abridged()
@@ -293,6 +354,94 @@ Transaction::ConstPtr MemoryStorage::removeWithoutLock(HashType const& _txHash)
     return tx;
 }
 
+void MemoryStorage::insertShortTxID(HashType const& _txHash)
+{
+    for (auto const& [salt, index] : m_shortTxIDIndexes)
+    {
+        index->txsHash.emplace(shortTxID(salt, _txHash), _txHash);
+    }
+}
+
+void MemoryStorage::eraseShortTxID(HashType const& _txHash)
+{
+    for (auto const& [salt, index] : m_shortTxIDIndexes)
+    {
+        auto range = index->txsHash.equal_range(shortTxID(salt, _txHash));
+        for (auto it = range.first; it != range.second;)
+        {
+            if (it->second == _txHash)
+            {
+                it = index->txsHash.unsafe_erase(it);
+                continue;
+            }
+            ++it;
+        }
+    }
+}
+
+MemoryStorage::ShortTxIDIndex::Ptr MemoryStorage::shortTxIDIndex(uint64_t _salt)
+{
+    auto clock = ++m_shortTxIDIndexClock;
+    {
+        ReadGuard l(x_txpoolMutex);
+        auto it = m_shortTxIDIndexes.find(_salt);
+        if (it != m_shortTxIDIndexes.end())
+        {
+            it->second->lastUsed = clock;
+            return it->second;
+        }
+    }
+    auto index = registerShortTxIDIndex(_salt, clock);
+    // scan the txpool once for the new salt without blocking the inserts, the other resolvers of
+    // the salt wait for the scan
+    std::call_once(index->filled, [this, &index, _salt]() {
+        auto startT = utcTime();
+        ReadGuard l(x_txpoolMutex);
+        for (auto const& it : m_txsTable)
+        {
+            index->txsHash.emplace(shortTxID(_salt, it.first), it.first);
+        }
+        TXPOOL_LOG(INFO) << LOG_DESC("fill short id index") << LOG_KV("txs", m_txsTable.size())
+                         << LOG_KV("timecost", (utcTime() - startT));
+    });
+    return index;
+}
+
+MemoryStorage::ShortTxIDIndex::Ptr MemoryStorage::registerShortTxIDIndex(
+    uint64_t _salt, uint64_t _clock)
+{
+    WriteGuard l(x_txpoolMutex);
+    auto it = m_shortTxIDIndexes.find(_salt);
+    if (it != m_shortTxIDIndexes.end())
+    {
+        it->second->lastUsed = _clock;
+        return it->second;
+    }
+    // evict the least recently used index, the one of m_shortTxIDSalt is always kept
+    if (m_shortTxIDIndexes.size() >= c_maxShortTxIDIndexes)
+    {
+        auto evicted = m_shortTxIDIndexes.end();
+        for (auto indexIt = m_shortTxIDIndexes.begin(); indexIt != m_shortTxIDIndexes.end();
+             ++indexIt)
+        {
+            if (indexIt->first != m_shortTxIDSalt &&
+                (evicted == m_shortTxIDIndexes.end() ||
+                    indexIt->second->lastUsed < evicted->second->lastUsed))
+            {
+                evicted = indexIt;
+            }
+        }
+        m_shortTxIDIndexes.erase(evicted);
+    }
+    // the index is maintained with m_txsTable from now on
+    auto index = std::make_shared<ShortTxIDIndex>();
+    index->lastUsed = _clock;
+    m_shortTxIDIndexes[_salt] = index;
+    TXPOOL_LOG(INFO) << LOG_DESC("register short id index") << LOG_KV("salt", _salt)
+                     << LOG_KV("indexes", m_shortTxIDIndexes.size());
+    return index;
+}
+
 Transaction::ConstPtr MemoryStorage::remove(HashType const& _txHash)
 {
     WriteGuard l(x_txpoolMutex);
@@ -608,6 +757,10 @@ void MemoryStorage::clear()
 {
     WriteGuard l(x_txpoolMutex);
     m_txsTable.clear();
+    for (auto const& it : m_shortTxIDIndexes)
+    {
+        it.second->txsHash.clear();
+    }
 }
 
 HashListPtr MemoryStorage::filterUnknownTxs(HashList const& _txsHashList, NodeIDPtr _peer)
@@ -649,9 +802,128 @@ HashListPtr MemoryStorage::filterUnknownTxs(HashList const& _txsHashList, NodeID
     return unknownTxsList;
 }
 
+ShortTxIDsPtr MemoryStorage::filterUnknownShortTxIDs(
+    ShortTxIDs const& _shortTxIDs, NodeIDPtr _peer)
+{
+    auto unknownShortTxIDs = std::make_shared<ShortTxIDs>();
+    ReadGuard l(x_txpoolMutex);
+    UpgradableGuard missedTxsLock(x_missedTxs);
+    auto const& shortTxIDs = m_shortTxIDIndexes.at(m_shortTxIDSalt)->txsHash;
+    for (auto const& id : _shortTxIDs)
+    {
+        auto range = shortTxIDs.equal_range(id);
+        if (range.first != range.second)
+        {
+            // the colliding transactions are all marked as known by the peer, the peer would
+            // re-forward the missed one to the other nodes
+            for (auto it = range.first; it != range.second; ++it)
+            {
+                auto txIt = m_txsTable.find(it->second);
+                if (txIt != m_txsTable.end() && txIt->second)
+                {
+                    txIt->second->appendKnownNode(_peer);
+                }
+            }
+            continue;
+        }
+        if (m_missedShortTxIDs.count(id))
+        {
+            continue;
+        }
+        unknownShortTxIDs->push_back(id);
+        m_missedShortTxIDs.insert(id);
+    }
+    if (m_missedShortTxIDs.size() >= m_config->poolLimit())
+    {
+        UpgradeGuard ul(missedTxsLock);
+        m_missedShortTxIDs.clear();
+    }
+    return unknownShortTxIDs;
+}
+
+TransactionsPtr MemoryStorage::resolveShortTxIDs(uint64_t _salt, ShortTxIDs const& _shortTxIDs)
+{
+    auto resolvedTxs = std::make_shared<Transactions>(_shortTxIDs.size());
+    auto index = shortTxIDIndex(_salt);
+    ReadGuard l(x_txpoolMutex);
+    for (size_t i = 0; i < _shortTxIDs.size(); i++)
+    {
+        auto range = index->txsHash.equal_range(_shortTxIDs[i]);
+        if (range.first == range.second)
+        {
+            continue;
+        }
+        // the colliding transactions are fetched from the leader
+        auto txHash = range.first->second;
+        if (std::any_of(std::next(range.first), range.second,
+                [&txHash](auto const& _entry) { return _entry.second != txHash; }))
+        {
+            TXPOOL_LOG(DEBUG) << LOG_DESC("resolveShortTxIDs: ambiguous short id")
+                              << LOG_KV("id", _shortTxIDs[i]);
+            continue;
+        }
+        auto txIt = m_txsTable.find(txHash);
+        if (txIt != m_txsTable.end() && txIt->second)
+        {
+            (*resolvedTxs)[i] = std::const_pointer_cast<Transaction>(txIt->second);
+        }
+    }
+    return resolvedTxs;
+}
+
+TransactionsPtr MemoryStorage::fetchBatchTxsByShortTxIDs(
+    uint64_t _salt, ShortTxIDs const& _shortTxIDs, HashType const& _batchHash)
+{
+    std::unordered_map<uint64_t, HashType> batchTxs;
+    {
+        std::lock_guard<std::mutex> l(x_batches);
+        auto it = m_batches.find(_batchHash);
+        if (it == m_batches.end())
+        {
+            return std::make_shared<Transactions>();
+        }
+        batchTxs.reserve(it->second.size());
+        for (auto const& txHash : it->second)
+        {
+            batchTxs.emplace(shortTxID(_salt, txHash), txHash);
+        }
+    }
+    HashList txsHash;
+    txsHash.reserve(_shortTxIDs.size());
+    for (auto const& id : _shortTxIDs)
+    {
+        auto it = batchTxs.find(id);
+        if (it != batchTxs.end())
+        {
+            txsHash.emplace_back(it->second);
+        }
+    }
+    HashList missedTxs;
+    return fetchTxs(missedTxs, txsHash);
+}
+
+void MemoryStorage::recordBatch(HashType const& _batchHash, HashList const& _txsHashList)
+{
+    std::lock_guard<std::mutex> l(x_batches);
+    if (!m_batches.emplace(_batchHash, _txsHashList).second)
+    {
+        return;
+    }
+    m_batchesOrder.emplace_back(_batchHash);
+    while (m_batchesOrder.size() > c_maxRecentBatches)
+    {
+        m_batches.erase(m_batchesOrder.front());
+        m_batchesOrder.pop_front();
+    }
+}
+
 void MemoryStorage::batchMarkTxs(
     HashList const& _txsHashList, BlockNumber _batchId, HashType const& _batchHash, bool _sealFlag)
 {
+    if (_sealFlag && _batchHash != HashType())
+    {
+        recordBatch(_batchHash, _txsHashList);
+    }
     ReadGuard l(x_txpoolMutex);
     ssize_t successCount = 0;
     for (auto txHash : _txsHashList)
@@ -22,6 +22,9 @@
 #include "bcos-txpool/TxPoolConfig.h"
 #include <bcos-utilities/ThreadPool.h>
 #include <tbb/concurrent_unordered_map.h>
+#include <deque>
+#include <map>
+#include <mutex>
 #define TBB_PREVIEW_CONCURRENT_ORDERED_CONTAINERS 1
 #include <tbb/concurrent_set.h>
 namespace bcos
@@ -54,6 +57,8 @@ public:
     bcos::protocol::TransactionStatus submitTransaction(bcos::protocol::Transaction::Ptr _tx,
         bcos::protocol::TxSubmitCallback _txSubmitCallback = nullptr, bool _enforceImport = false,
         bool _checkPoolLimit = true) override;
+    void batchSubmitTransactions(std::vector<bytesPointer> const& _txsData,
+        std::vector<bcos::protocol::TxSubmitCallback> const& _txSubmitCallbacks) override;
 
     bcos::protocol::TransactionStatus insert(bcos::protocol::Transaction::ConstPtr _tx) override;
     void batchInsert(bcos::protocol::Transactions const& _txs) override;
@@ -82,6 +87,14 @@ public:
     bcos::crypto::HashListPtr filterUnknownTxs(
         bcos::crypto::HashList const& _txsHashList, bcos::crypto::NodeIDPtr _peer) override;
 
+    uint64_t shortTxIDSalt() const override { return m_shortTxIDSalt; }
+    ShortTxIDsPtr filterUnknownShortTxIDs(
+        ShortTxIDs const& _shortTxIDs, bcos::crypto::NodeIDPtr _peer) override;
+    bcos::protocol::TransactionsPtr resolveShortTxIDs(
+        uint64_t _salt, ShortTxIDs const& _shortTxIDs) override;
+    bcos::protocol::TransactionsPtr fetchBatchTxsByShortTxIDs(uint64_t _salt,
+        ShortTxIDs const& _shortTxIDs, bcos::crypto::HashType const& _batchHash) override;
+
     bcos::crypto::HashListPtr getAllTxsHash() override;
     void batchMarkTxs(bcos::crypto::HashList const& _txsHashList,
         bcos::protocol::BlockNumber _batchId, bcos::crypto::HashType const& _batchHash,
@@ -139,6 +152,26 @@ protected:
 
     virtual void notifyUnsealedTxsSize(size_t _retryTime = 0);
 
+    // the short ids of m_txsTable salted by one salt, maintained with m_txsTable since it is
+    // registered, and filled with the txs already in m_txsTable once by the first resolver. A tx
+    // inserted while the index is filled may be indexed twice, the duplicates resolve alike
+    struct ShortTxIDIndex
+    {
+        using Ptr = std::shared_ptr<ShortTxIDIndex>;
+        tbb::concurrent_unordered_multimap<uint64_t, bcos::crypto::HashType> txsHash;
+        std::atomic<uint64_t> lastUsed = {0};
+        std::once_flag filled;
+    };
+    void insertShortTxID(bcos::crypto::HashType const& _txHash);
+    void eraseShortTxID(bcos::crypto::HashType const& _txHash);
+    // the index of _salt, created from m_txsTable if missing, the caller must not hold
+    // x_txpoolMutex
+    ShortTxIDIndex::Ptr shortTxIDIndex(uint64_t _salt);
+    // find or register the index of _salt under the write lock, without filling it
+    ShortTxIDIndex::Ptr registerShortTxIDIndex(uint64_t _salt, uint64_t _clock);
+    void recordBatch(bcos::crypto::HashType const& _batchHash,
+        bcos::crypto::HashList const& _txsHashList);
+
 private:
     TxPoolConfig::Ptr m_config;
     ThreadPool::Ptr m_notifier;
@@ -150,6 +183,24 @@ private:
 
     mutable SharedMutex x_txpoolMutex;
 
+    // indexes of m_txsTable by the short ids: the one of m_shortTxIDSalt resolves the compact txs
+    // status announced by the peers, and the ones of the epoch salts, see proposalShortTxIDSalt,
+    // resolve the compact proposals of all the leaders. The indexes are updated with m_txsTable,
+    // and added or evicted under the write lock of x_txpoolMutex
+    uint64_t m_shortTxIDSalt;
+    std::map<uint64_t, ShortTxIDIndex::Ptr> m_shortTxIDIndexes;
+    std::atomic<uint64_t> m_shortTxIDIndexClock = {0};
+    tbb::concurrent_set<uint64_t> m_missedShortTxIDs;
+    // the salt of the status, the current and the previous epochs, and one spare
+    static constexpr size_t c_maxShortTxIDIndexes = 4;
+
+    // the transactions of the recent batches sealed by this node, to serve the transactions of
+    // its compact proposals
+    std::map<bcos::crypto::HashType, bcos::crypto::HashList> m_batches;
+    std::deque<bcos::crypto::HashType> m_batchesOrder;
+    mutable std::mutex x_batches;
+    size_t c_maxRecentBatches = 32;
+
     tbb::concurrent_set<bcos::crypto::HashType> m_invalidTxs;
     tbb::concurrent_set<bcos::protocol::NonceType> m_invalidNonces;
 
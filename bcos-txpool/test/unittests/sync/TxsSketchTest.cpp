@@ -0,0 +1,94 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief unit test for TxsSketch
+ * @file TxsSketchTest.cpp
+ */
+#include "bcos-txpool/sync/utilities/TxsSketch.h"
+#include <bcos-utilities/testutils/TestPromptFixture.h>
+#include <boost/test/unit_test.hpp>
+#include <random>
+#include <set>
+using namespace bcos;
+using namespace bcos::sync;
+namespace bcos
+{
+namespace test
+{
+BOOST_FIXTURE_TEST_SUITE(TxsSketchTest, TestPromptFixture)
+BOOST_AUTO_TEST_CASE(testTxsSketch)
+{
+    std::mt19937_64 random(1024);
+    size_t cells = 96;
+    TxsSketch localSketch(cells);
+    TxsSketch peerSketch(cells);
+    BOOST_CHECK(localSketch.cells() == cells);
+    // the common ids
+    for (size_t i = 0; i < 10000; i++)
+    {
+        auto id = random();
+        localSketch.insert(id);
+        peerSketch.insert(id);
+    }
+    std::set<uint64_t> localIDs;
+    std::set<uint64_t> peerIDs;
+    for (size_t i = 0; i < 30; i++)
+    {
+        auto id = random();
+        if (i % 3 == 0)
+        {
+            peerSketch.insert(id);
+            peerIDs.insert(id);
+            continue;
+        }
+        localSketch.insert(id);
+        localIDs.insert(id);
+    }
+
+    // the sketch sent to the peer
+    auto encodedSketch = localSketch.encode();
+    BOOST_CHECK(encodedSketch.size() == cells * TxsSketch::c_cellSize);
+    auto decodedSketch = TxsSketch::decode(ref(encodedSketch), cells);
+    BOOST_CHECK(decodedSketch.has_value());
+    BOOST_CHECK(decodedSketch->encode() == encodedSketch);
+    BOOST_CHECK(!TxsSketch::decode(ref(encodedSketch), cells - TxsSketch::c_hashNum));
+    BOOST_CHECK(!TxsSketch::decode(bytesConstRef(encodedSketch.data(), 20), cells));
+
+    decodedSketch->subtract(peerSketch);
+    std::vector<uint64_t> inserted;
+    std::vector<uint64_t> subtracted;
+    BOOST_CHECK(decodedSketch->decode(inserted, subtracted));
+    BOOST_CHECK(std::set<uint64_t>(inserted.begin(), inserted.end()) == localIDs);
+    BOOST_CHECK(std::set<uint64_t>(subtracted.begin(), subtracted.end()) == peerIDs);
+
+    // the same sets
+    TxsSketch sameSketch(cells);
+    sameSketch.subtract(TxsSketch(cells));
+    inserted.clear();
+    subtracted.clear();
+    BOOST_CHECK(sameSketch.decode(inserted, subtracted));
+    BOOST_CHECK(inserted.empty() && subtracted.empty());
+
+    // the difference is too large for the sketch
+    TxsSketch smallSketch(12);
+    for (size_t i = 0; i < 100; i++)
+    {
+        smallSketch.insert(random());
+    }
+    BOOST_CHECK(!smallSketch.decode(inserted, subtracted));
+}
+BOOST_AUTO_TEST_SUITE_END()
+}  // namespace test
+}  // namespace bcos
@@ -17,6 +17,7 @@
  * @file TxsSyncMsgTest.h
  */
 #include "FakeTxsSyncMsg.h"
+#include "bcos-txpool/sync/utilities/Common.h"
 #include <bcos-crypto/hash/Keccak256.h>
 #include <bcos-crypto/hash/SM3.h>
 #include <bcos-utilities/testutils/TestPromptFixture.h>
@@ -44,6 +45,45 @@ BOOST_AUTO_TEST_CASE(testTxsSyncMsg)
     bytes txsData = bytes(data.begin(), data.end());
     faker->fakeTxsMsg(type, version, hashList, txsData);
 }
+
+BOOST_AUTO_TEST_CASE(testCompactTxsSyncMsg)
+{
+    auto msgFactory = std::make_shared<TxsSyncMsgFactoryImpl>();
+    auto hashImpl = std::make_shared<Keccak256>();
+    uint64_t salt = 0x1234567890abcdef;
+    txpool::ShortTxIDs shortTxIDs;
+    for (int i = 0; i < 10; i++)
+    {
+        auto hash = hashImpl->hash(std::to_string(i));
+        shortTxIDs.emplace_back(txpool::shortTxID(salt, hash));
+        // the ids depend on the salt
+        BOOST_CHECK(txpool::shortTxID(salt, hash) == shortTxIDs.back());
+        BOOST_CHECK(txpool::shortTxID(salt + 1, hash) != shortTxIDs.back());
+    }
+    auto proposalHash = hashImpl->hash(std::string("proposal"));
+    auto msg = msgFactory->createTxsSyncMsg(TxsSyncPacketType::TxsRequestPacket, HashList());
+    msg->setSalt(salt + 1);
+    msg->setShortTxIDs(salt, shortTxIDs);
+    msg->setProposalHash(proposalHash);
+
+    auto encodedData = msg->encode();
+    auto decodedMsg = msgFactory->createTxsSyncMsg(ref(*encodedData));
+    BOOST_CHECK_EQUAL(decodedMsg->type(), TxsSyncPacketType::TxsRequestPacket);
+    BOOST_CHECK_EQUAL(decodedMsg->salt(), salt + 1);
+    BOOST_CHECK_EQUAL(decodedMsg->shortTxIDSalt(), salt);
+    BOOST_CHECK(decodedMsg->shortTxIDs() == shortTxIDs);
+    BOOST_CHECK(decodedMsg->proposalHash() == proposalHash);
+    BOOST_CHECK(decodedMsg->txsHash().empty());
+    // 8 bytes per transaction instead of 32
+    BOOST_CHECK(encodedData->size() < shortTxIDs.size() * HashType::size / 2);
+
+    // the messages without short ids
+    auto fullMsg = msgFactory->createTxsSyncMsg(TxsSyncPacketType::TxsStatusPacket, HashList());
+    auto decodedFullMsg = msgFactory->createTxsSyncMsg(ref(*fullMsg->encode()));
+    BOOST_CHECK_EQUAL(decodedFullMsg->salt(), 0);
+    BOOST_CHECK(decodedFullMsg->shortTxIDs().empty());
+    BOOST_CHECK(decodedFullMsg->proposalHash() == HashType());
+}
 BOOST_AUTO_TEST_SUITE_END()
 }  // namespace test
 }  // namespace bcos
\ No newline at end of file
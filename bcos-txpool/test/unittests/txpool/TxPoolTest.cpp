@@ -472,6 +472,65 @@ BOOST_AUTO_TEST_CASE(testSMTxPoolInitAndSubmitTransaction)
     txPoolInitAndSubmitTransactionTest(true, cryptoSuite);
 }
 
+BOOST_AUTO_TEST_CASE(testAsyncSubmitBatch)
+{
+    auto hashImpl = std::make_shared<Keccak256>();
+    auto signatureImpl = std::make_shared<Secp256k1Crypto>();
+    auto cryptoSuite = std::make_shared<CryptoSuite>(hashImpl, signatureImpl, nullptr);
+    auto keyPair = signatureImpl->generateKeyPair();
+    int64_t blockLimit = 10;
+    auto faker = std::make_shared<TxPoolFixture>(keyPair->publicKey(), cryptoSuite,
+        "group_test_for_txpool", "chain_test_for_txpool", blockLimit,
+        std::make_shared<FakeGateWay>());
+    faker->init();
+    faker->appendSealer(faker->nodeID());
+    auto txpool = faker->txpool();
+    auto txpoolStorage = txpool->txpoolStorage();
+    auto ledger = faker->ledger();
+
+    std::vector<bytesPointer> txsData;
+    for (size_t i = 0; i < 3; i++)
+    {
+        auto tx = fakeTransaction(cryptoSuite, utcTime() + 1000 * (i + 1),
+            ledger->blockNumber() + blockLimit - 4, faker->chainId(), faker->groupId());
+        auto encodedData = tx->encode();
+        txsData.emplace_back(std::make_shared<bytes>(encodedData.begin(), encodedData.end()));
+    }
+    // the duplicated transaction and the malformed transaction are rejected
+    txsData.emplace_back(std::make_shared<bytes>(*txsData[0]));
+    auto malformedData = std::make_shared<bytes>(*txsData[1]);
+    for (auto& byte : *malformedData)
+    {
+        byte += 100;
+    }
+    txsData.emplace_back(malformedData);
+
+    std::atomic_size_t rejectedTxs = {0};
+    std::vector<TxSubmitCallback> callbacks;
+    for (size_t i = 0; i < txsData.size(); i++)
+    {
+        callbacks.emplace_back([&, i](Error::Ptr _error, TransactionSubmitResult::Ptr _result) {
+            BOOST_CHECK(_error->errorCode() == _result->status());
+            if (i == 3)
+            {
+                BOOST_CHECK(_result->status() == (uint32_t)TransactionStatus::AlreadyInTxPool);
+            }
+            else
+            {
+                BOOST_CHECK_EQUAL(i, 4);
+                BOOST_CHECK(_result->status() == (uint32_t)TransactionStatus::Malform);
+            }
+            rejectedTxs++;
+        });
+    }
+    txpool->asyncSubmitBatch(txsData, callbacks);
+    while (rejectedTxs < 2)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    BOOST_CHECK_EQUAL(txpoolStorage->size(), 3);
+}
+
 BOOST_AUTO_TEST_CASE(fillWithSubmit)
 {
     // auto hashImpl = std::make_shared<SM3>();
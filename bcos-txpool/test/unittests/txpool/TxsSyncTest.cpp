@@ -121,6 +121,26 @@ void testTransactionSync(bool _onlyTxsStatus = false)
         auto originSendSize = faker->frontService()->totalSendMsgSize();
         faker->sync()->maintainTransactions();
         BOOST_CHECK(faker->frontService()->totalSendMsgSize() == originSendSize);
+
+        // the peers attached their salts to the txs requests, so the status of the new
+        // transactions are announced with short ids, and fetched with the short ids
+        importTransactions(txsNum, cryptoSuite, faker);
+        auto startT = utcTime();
+        while (txpool->txpoolStorage()->size() < 2 * txsNum && (utcTime() - startT <= 10000))
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+        faker->sync()->maintainTransactions();
+        for (auto txpoolPeer : txpoolPeerList)
+        {
+            startT = utcTime();
+            while (txpoolPeer->txpool()->txpoolStorage()->size() < 2 * txsNum &&
+                   (utcTime() - startT <= 10000))
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            }
+            BOOST_CHECK(txpoolPeer->txpool()->txpoolStorage()->size() == 2 * txsNum);
+        }
         return;
     }
     // check the transactions has been broadcasted to all the node
@@ -191,6 +211,66 @@ void testTransactionSync(bool _onlyTxsStatus = false)
     {
         std::this_thread::sleep_for(std::chrono::milliseconds(2));
     }
+    // the faker resolves the compact proposal of the syncPeer, and fetches the missed txs from
+    // the batch marked by the syncPeer with the short ids
+    uint64_t salt = 0x5a17;
+    auto proposalHash = hashImpl->hash(std::string("proposal"));
+    syncPeer->txpool()->asyncMarkTxs(txsHash, true, 1, proposalHash, nullptr);
+    auto shortTxIDs = std::make_shared<ShortTxIDs>();
+    for (auto const& txHash : *txsHash)
+    {
+        shortTxIDs->emplace_back(shortTxID(salt, txHash));
+    }
+    auto txsDigest = txsHashDigest(hashImpl, *txsHash);
+    finish = false;
+    faker->txpool()->asyncResolveShortTxIDs(syncPeer->nodeID(), proposalHash, salt, shortTxIDs,
+        txsDigest, [&](Error::Ptr _error, Block::Ptr _txsMetaData) {
+            BOOST_CHECK(_error == nullptr);
+            BOOST_CHECK(_txsMetaData->transactionsMetaDataSize() == txsHash->size());
+            for (size_t i = 0; i < txsHash->size() && _error == nullptr; i++)
+            {
+                BOOST_CHECK(_txsMetaData->transactionHash(i) == (*txsHash)[i]);
+            }
+            finish = true;
+        });
+    while (!finish)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+
+    // the txs mismatching the digest are rejected
+    finish = false;
+    faker->txpool()->asyncResolveShortTxIDs(syncPeer->nodeID(), proposalHash, salt, shortTxIDs,
+        hashImpl->hash(std::string("tampered")), [&](Error::Ptr _error, Block::Ptr) {
+            BOOST_CHECK(_error && _error->errorCode() == CommonError::InconsistentTransactions);
+            finish = true;
+        });
+    while (!finish)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+
+    // the leaders of an epoch share the salt, and the salts of more epochs than the indexes
+    // kept by the txpool still resolve
+    BOOST_CHECK_EQUAL(proposalShortTxIDSalt(1), proposalShortTxIDSalt(c_shortTxIDSaltEpoch - 1));
+    BOOST_CHECK_NE(proposalShortTxIDSalt(1), proposalShortTxIDSalt(c_shortTxIDSaltEpoch));
+    auto syncPeerStorage = syncPeer->txpool()->txpoolStorage();
+    for (int64_t epoch = 0; epoch < 10; epoch++)
+    {
+        auto epochSalt = proposalShortTxIDSalt(epoch * c_shortTxIDSaltEpoch);
+        ShortTxIDs epochShortTxIDs;
+        for (auto const& txHash : *txsHash)
+        {
+            epochShortTxIDs.emplace_back(shortTxID(epochSalt, txHash));
+        }
+        auto resolvedTxs = syncPeerStorage->resolveShortTxIDs(epochSalt, epochShortTxIDs);
+        BOOST_CHECK_EQUAL(resolvedTxs->size(), txsHash->size());
+        for (size_t i = 0; i < resolvedTxs->size(); i++)
+        {
+            BOOST_CHECK((*resolvedTxs)[i] && (*resolvedTxs)[i]->hash() == (*txsHash)[i]);
+        }
+    }
+
     // assume the faker verify the syncPeer generated proposal
     auto blockFactory = faker->txpool()->txpoolConfig()->blockFactory();
     auto block = blockFactory->createBlock();
@@ -227,6 +307,60 @@ BOOST_AUTO_TEST_CASE(testOnPeerTxsStatus)
 {
     testTransactionSync(true);
 }
+
+BOOST_AUTO_TEST_CASE(testReconcileTxs)
+{
+    auto hashImpl = std::make_shared<Keccak256>();
+    auto signatureImpl = std::make_shared<Secp256k1Crypto>();
+    auto cryptoSuite = std::make_shared<CryptoSuite>(hashImpl, signatureImpl, nullptr);
+    std::string groupId = "test-group";
+    std::string chainId = "test-chain";
+    int64_t blockLimit = 15;
+    auto fakeGateWay = std::make_shared<FakeGateWay>();
+    auto faker = std::make_shared<TxPoolFixture>(signatureImpl->generateKeyPair()->publicKey(),
+        cryptoSuite, groupId, chainId, blockLimit, fakeGateWay);
+    auto peer = std::make_shared<TxPoolFixture>(signatureImpl->generateKeyPair()->publicKey(),
+        cryptoSuite, groupId, chainId, blockLimit, fakeGateWay);
+    for (auto const& node : {faker, peer})
+    {
+        node->appendSealer(faker->nodeID());
+        node->appendSealer(peer->nodeID());
+        node->init();
+        node->sync()->config()->setReconcileTxs(true);
+    }
+    // the txs are only known by the node that received them
+    size_t txsNum = 20;
+    importTransactions(txsNum, cryptoSuite, faker);
+    // the nonces of the fake txs are based on the current time
+    std::this_thread::sleep_for(std::chrono::milliseconds(2 * txsNum));
+    size_t peerTxsNum = 7;
+    importTransactions(peerTxsNum, cryptoSuite, peer);
+    BOOST_CHECK(faker->txpool()->txpoolStorage()->size() == txsNum);
+    BOOST_CHECK(peer->txpool()->txpoolStorage()->size() == peerTxsNum);
+
+    // one decoded round reconciles the txs in both directions, the round failed to decode
+    // enlarges the sketch of the next round
+    auto reconciled = [&]() {
+        return faker->txpool()->txpoolStorage()->size() == txsNum + peerTxsNum &&
+               peer->txpool()->txpoolStorage()->size() == txsNum + peerTxsNum;
+    };
+    for (size_t round = 0; round < 5 && !reconciled(); round++)
+    {
+        faker->sync()->reconcileTxs();
+        auto startT = utcTime();
+        while (!reconciled() && (utcTime() - startT <= 2000))
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+    }
+    BOOST_CHECK(reconciled());
+    // nothing to reconcile
+    auto originSendSize = peer->frontService()->totalSendMsgSize();
+    peer->sync()->reconcileTxs();
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    BOOST_CHECK(faker->txpool()->txpoolStorage()->size() == txsNum + peerTxsNum);
+    BOOST_CHECK(peer->frontService()->totalSendMsgSize() == originSendSize + 1);
+}
 BOOST_AUTO_TEST_SUITE_END()
 }  // namespace test
 }  // namespace bcos
@@ -160,6 +160,38 @@ bcostars::Error TxPoolServiceServer::asyncVerifyBlock(const vector<tars::Char>&
     return bcostars::Error();
 }
 
+bcostars::Error TxPoolServiceServer::asyncResolveShortTxIDs(
+    const vector<tars::Char>& generatedNodeID, const vector<tars::Char>& proposalHash,
+    tars::Int64 salt, const vector<tars::Int64>& shortTxIDs, const vector<tars::Char>& txsDigest,
+    bcostars::Block& txsList, tars::TarsCurrentPtr current)
+{
+    current->setResponse(false);
+
+    bcos::crypto::PublicPtr pk = m_txpoolInitializer->cryptoSuite()->keyFactory()->createKey(
+        bcos::bytesConstRef((const bcos::byte*)generatedNodeID.data(), generatedNodeID.size()));
+    auto bcosShortTxIDs =
+        std::make_shared<bcos::txpool::ShortTxIDs>(shortTxIDs.begin(), shortTxIDs.end());
+    m_txpoolInitializer->txpool()->asyncResolveShortTxIDs(pk,
+        bcos::crypto::HashType(bcos::bytes(proposalHash.begin(), proposalHash.end())),
+        (uint64_t)salt, bcosShortTxIDs,
+        bcos::crypto::HashType(bcos::bytes(txsDigest.begin(), txsDigest.end())),
+        [current](bcos::Error::Ptr error, bcos::protocol::Block::Ptr _txsList) {
+            if (error)
+            {
+                TXPOOLSERVICE_LOG(WARNING)
+                    << LOG_DESC("asyncResolveShortTxIDs failed")
+                    << LOG_KV("code", error->errorCode()) << LOG_KV("msg", error->errorMessage());
+                async_response_asyncResolveShortTxIDs(
+                    current, toTarsError(error), bcostars::Block());
+                return;
+            }
+            async_response_asyncResolveShortTxIDs(current, toTarsError(error),
+                std::dynamic_pointer_cast<bcostars::protocol::BlockImpl>(_txsList)->inner());
+        });
+
+    return bcostars::Error();
+}
+
 bcostars::Error TxPoolServiceServer::notifyConnectedNodes(
     const vector<vector<tars::Char>>& connectedNodes, tars::TarsCurrentPtr current)
 {
@@ -56,6 +56,11 @@ public:
     bcostars::Error asyncVerifyBlock(const vector<tars::Char>& generatedNodeID,
         const vector<tars::Char>& block, tars::Bool& result, tars::TarsCurrentPtr current) override;
 
+    bcostars::Error asyncResolveShortTxIDs(const vector<tars::Char>& generatedNodeID,
+        const vector<tars::Char>& proposalHash, tars::Int64 salt,
+        const vector<tars::Int64>& shortTxIDs, const vector<tars::Char>& txsDigest,
+        bcostars::Block& txsList, tars::TarsCurrentPtr current) override;
+
     bcostars::Error notifyConnectedNodes(
         const vector<vector<tars::Char>>& connectedNodes, tars::TarsCurrentPtr current) override;
 
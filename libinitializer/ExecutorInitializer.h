@@ -2,20 +2,29 @@
 
 #include "bcos-framework/interfaces/storage/StorageInterface.h"
 #include <bcos-executor/src/executor/TransactionExecutorFactory.h>
+#include <bcos-tool/NodeConfig.h>
 
 namespace bcos::initializer
 {
 class ExecutorInitializer
 {
 public:
+    // build the executor with the [executor] config of the node, every deployment builds its
+    // executors here
     static bcos::executor::TransactionExecutor::Ptr build(txpool::TxPoolInterface::Ptr txpool,
         storage::MergeableStorageInterface::Ptr cache,
         storage::TransactionalStorageInterface::Ptr storage,
         protocol::ExecutionMessageFactory::Ptr executionMessageFactory,
-        bcos::crypto::Hash::Ptr hashImpl, bool isWasm, bool isAuthCheck)
+        bcos::crypto::Hash::Ptr hashImpl, bcos::tool::NodeConfig::Ptr nodeConfig)
     {
-        return bcos::executor::TransactionExecutorFactory::build(
-            txpool, cache, storage, executionMessageFactory, hashImpl,isWasm, isAuthCheck);
+        auto executor = bcos::executor::TransactionExecutorFactory::build(txpool, cache, storage,
+            executionMessageFactory, hashImpl, nodeConfig->isWasm(), nodeConfig->isAuthCheck());
+        if (nodeConfig->coroutineStackSize() > 0)
+        {
+            executor->setCoroutineStackSize(nodeConfig->coroutineStackSize());
+        }
+        executor->setCodeCacheCapacity(nodeConfig->codeCacheSize());
+        return executor;
     }
 };
 }  // namespace bcos::initializer
\ No newline at end of file
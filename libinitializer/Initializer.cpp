@@ -114,7 +114,7 @@ void Initializer::init(bcos::initializer::NodeArchitectureType _nodeArchType,
                           m_nodeConfig->groupId() + c_fileSeparator + m_nodeConfig->storagePath();
         }
         BCOS_LOG(INFO) << LOG_DESC("initNode") << LOG_KV("storagePath", storagePath);
-        auto storage = StorageInitializer::build(storagePath);
+        auto storage = StorageInitializer::build(storagePath, m_nodeConfig);
 
         // build ledger
         auto ledger =
@@ -151,7 +151,7 @@ void Initializer::init(bcos::initializer::NodeArchitectureType _nodeArchType,
         // Note: ensure that there has at least one executor before pbft/sync execute block
         auto executor = ExecutorInitializer::build(m_txpoolInitializer->txpool(), cache, storage,
             executionMessageFactory, m_protocolInitializer->cryptoSuite()->hashImpl(),
-            m_nodeConfig->isWasm(), m_nodeConfig->isAuthCheck());
+            m_nodeConfig);
         auto parallelExecutor = std::make_shared<bcos::initializer::ParallelExecutor>(executor);
         executorManager->addExecutor("default", parallelExecutor);
 
@@ -166,6 +166,18 @@ void Initializer::init(bcos::initializer::NodeArchitectureType _nodeArchType,
         BCOS_LOG(INFO) << LOG_DESC("initNode: init storage for consensus")
                        << LOG_KV("consensusStoragePath", consensusStoragePath);
         auto consensusStorage = StorageInitializer::build(consensusStoragePath);
+        // the wal file is beside the consensus storage, it's kept even if the wal is disabled to
+        // move the proposals of it back to the consensus storage
+        auto consensusWALPath = m_nodeConfig->storagePath() + c_fileSeparator + c_consensusWALName;
+        if (!_airVersion)
+        {
+            consensusWALPath = ServerConfig::BasePath + ".." + c_fileSeparator +
+                               m_nodeConfig->groupId() + c_fileSeparator + consensusWALPath;
+        }
+        BCOS_LOG(INFO) << LOG_DESC("initNode: init wal for consensus")
+                       << LOG_KV("consensusWALPath", consensusWALPath)
+                       << LOG_KV("enableWAL", m_nodeConfig->enableConsensusWAL());
+        m_nodeConfig->setConsensusWALPath(consensusWALPath);
         // build and init the pbft related modules
         if (_nodeArchType == NodeArchitectureType::AIR)
         {
@@ -83,6 +83,7 @@ private:
     bcos::ledger::LedgerInterface::Ptr m_ledger;
     std::shared_ptr<bcos::scheduler::SchedulerInterface> m_scheduler;
     std::string const c_consensusStorageDBName = "consensus_log";
+    std::string const c_consensusWALName = "consensus_wal";
     std::string const c_fileSeparator = "/";
 };
 }  // namespace initializer
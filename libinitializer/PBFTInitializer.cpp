@@ -321,10 +321,12 @@ void PBFTInitializer::createPBFT()
     auto pbftFactory = std::make_shared<PBFTFactory>(m_protocolInitializer->cryptoSuite(),
         m_protocolInitializer->keyPair(), m_frontService, kvStorage, m_ledger, m_scheduler,
         m_txpool, m_protocolInitializer->blockFactory(), m_protocolInitializer->txResultFactory());
+    pbftFactory->setWALPath(m_nodeConfig->consensusWALPath(), m_nodeConfig->enableConsensusWAL());
 
     m_pbft = pbftFactory->createPBFT();
     auto pbftConfig = m_pbft->pbftEngine()->pbftConfig();
     pbftConfig->setCheckPointTimeoutInterval(m_nodeConfig->checkPointTimeoutInterval());
+    pbftConfig->setCompactProposal(m_nodeConfig->compactProposal());
 }
 
 void PBFTInitializer::createSync()
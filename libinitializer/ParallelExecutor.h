@@ -35,6 +35,21 @@ public:
         });
     }
 
+    void executeTransactions(std::string contractAddress,
+        gsl::span<bcos::protocol::ExecutionMessage::UniquePtr> inputs,
+        std::function<void(
+            bcos::Error::UniquePtr, std::vector<bcos::protocol::ExecutionMessage::UniquePtr>)>
+            callback) override
+    {
+        // the span may not outlive this call, take the messages before going to the pool
+        auto messages = std::make_shared<std::vector<bcos::protocol::ExecutionMessage::UniquePtr>>(
+            std::make_move_iterator(inputs.begin()), std::make_move_iterator(inputs.end()));
+        m_pool.enqueue([this, contractAddress = std::move(contractAddress), messages,
+                           callback = std::move(callback)] {
+            m_executor->executeTransactions(contractAddress, *messages, std::move(callback));
+        });
+    }
+
     void dagExecuteTransactions(gsl::span<bcos::protocol::ExecutionMessage::UniquePtr> inputs,
         std::function<void(
             bcos::Error::UniquePtr, std::vector<bcos::protocol::ExecutionMessage::UniquePtr>)>
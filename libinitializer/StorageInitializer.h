@@ -26,14 +26,21 @@
 #include "boost/filesystem.hpp"
 #include <bcos-framework/interfaces/storage/StorageInterface.h>
 #include <bcos-storage/src/RocksDBStorage.h>
+#include <bcos-tool/NodeConfig.h>
+#include <rocksdb/cache.h>
+#include <rocksdb/filter_policy.h>
+#include <rocksdb/table.h>
 #include <rocksdb/write_batch.h>
+#include <set>
 
 namespace bcos::initializer
 {
 class StorageInitializer
 {
 public:
-    static bcos::storage::TransactionalStorageInterface::Ptr build(std::string const& _storagePath)
+    // the storage is tuned by _nodeConfig, rocksdb default options are used without it
+    static bcos::storage::TransactionalStorageInterface::Ptr build(
+        std::string const& _storagePath, bcos::tool::NodeConfig::Ptr _nodeConfig = nullptr)
     {
         boost::filesystem::create_directories(_storagePath);
         rocksdb::DB* db;
@@ -44,11 +51,129 @@ public:
         // options.OptimizeLevelStyleCompaction();
         // create the DB if it's not already present
         options.create_if_missing = true;
+        options.create_missing_column_families = true;
+
+        // the encoding of the rows in the db can't be changed back, the prefix extractor of an
+        // existing db follows it, and the table name encoded rows are migrated to table id when
+        // the storage is created
+        auto persistedKeyEncoding =
+            bcos::storage::RocksDBStorage::persistedKeyEncoding(_storagePath);
+        auto keyEncoding = persistedKeyEncoding.value_or(bcos::storage::KeyEncoding::TABLE_NAME);
+        std::vector<bcos::tool::NodeConfig::ColumnFamilyConfig> columnFamilyConfigs;
+        if (_nodeConfig)
+        {
+            keyEncoding = _nodeConfig->storageTableIDKeyEncoding() ?
+                              bcos::storage::KeyEncoding::TABLE_ID :
+                              bcos::storage::KeyEncoding::TABLE_NAME;
+            columnFamilyConfigs = _nodeConfig->storageColumnFamilies();
+        }
+        if (persistedKeyEncoding == bcos::storage::KeyEncoding::TABLE_ID &&
+            keyEncoding != bcos::storage::KeyEncoding::TABLE_ID)
+        {
+            BOOST_THROW_EXCEPTION(BCOS_ERROR(-1, "The rows of " + _storagePath +
+                                                     " are encoded with table id, please set "
+                                                     "storage.key_encoding to table_id!"));
+        }
+
+        // all the column families of the db must be opened
+        std::vector<std::string> existsColumnFamilies;
+        rocksdb::DB::ListColumnFamilies(options, _storagePath, &existsColumnFamilies);
+        std::vector<rocksdb::ColumnFamilyDescriptor> columnFamilies;
+        std::map<std::string, std::string> tableColumnFamilies;
+        columnFamilies.emplace_back(rocksdb::kDefaultColumnFamilyName,
+            columnFamilyConfigs.empty() ?
+                rocksdb::ColumnFamilyOptions(options) :
+                toColumnFamilyOptions(columnFamilyConfigs[0]));
+        for (size_t i = 1; i < columnFamilyConfigs.size(); ++i)
+        {
+            auto& config = columnFamilyConfigs[i];
+            columnFamilies.emplace_back(config.name, toColumnFamilyOptions(config));
+            for (auto& table : config.tables)
+            {
+                tableColumnFamilies.emplace(table, config.name);
+            }
+        }
+        for (auto& name : existsColumnFamilies)
+        {
+            if (std::find_if(columnFamilies.begin(), columnFamilies.end(), [&name](auto& it) {
+                    return it.name == name;
+                }) == columnFamilies.end())
+            {
+                columnFamilies.emplace_back(name, rocksdb::ColumnFamilyOptions(options));
+            }
+        }
+        if (keyEncoding == bcos::storage::KeyEncoding::TABLE_ID)
+        {
+            // iterate the rows of a table with the prefix bloom filter
+            for (auto& columnFamily : columnFamilies)
+            {
+                columnFamily.options.prefix_extractor =
+                    bcos::storage::RocksDBStorage::newTableIDPrefixExtractor();
+            }
+        }
 
         // open DB
-        rocksdb::Status s = rocksdb::DB::Open(options, _storagePath, &db);
+        std::vector<rocksdb::ColumnFamilyHandle*> handles;
+        rocksdb::Status s = rocksdb::DB::Open(options, _storagePath, columnFamilies, &handles, &db);
+        if (!s.ok())
+        {
+            BOOST_THROW_EXCEPTION(
+                BCOS_ERROR(-1, "Open rocksdb " + _storagePath + " failed! " + s.ToString()));
+        }
+
+        auto storage = std::make_shared<bcos::storage::RocksDBStorage>(
+            std::unique_ptr<rocksdb::DB>(db), keyEncoding, handles, tableColumnFamilies);
+        if (_nodeConfig && _nodeConfig->storageSSTIngestThreshold() > 0)
+        {
+            // the sst files are prepared outside of the rocksdb directory
+            storage->setSSTIngestThreshold(
+                _nodeConfig->storageSSTIngestThreshold(), _storagePath + "_ingest");
+        }
+        return storage;
+    }
+
+private:
+    static rocksdb::ColumnFamilyOptions toColumnFamilyOptions(
+        bcos::tool::NodeConfig::ColumnFamilyConfig const& _config)
+    {
+        rocksdb::ColumnFamilyOptions options;
+        rocksdb::BlockBasedTableOptions tableOptions;
+        if (_config.blockCacheSize > 0)
+        {
+            tableOptions.block_cache = rocksdb::NewLRUCache(_config.blockCacheSize);
+        }
+        if (_config.bloomBitsPerKey > 0)
+        {
+            tableOptions.filter_policy.reset(
+                rocksdb::NewBloomFilterPolicy(_config.bloomBitsPerKey, false));
+        }
+        options.table_factory.reset(rocksdb::NewBlockBasedTableFactory(tableOptions));
+
+        static const std::map<std::string, rocksdb::CompressionType> compressions = {
+            {"no", rocksdb::kNoCompression}, {"snappy", rocksdb::kSnappyCompression},
+            {"lz4", rocksdb::kLZ4Compression}, {"zstd", rocksdb::kZSTD}};
+        // rocksdb fails to write the sst files with the compression not linked into it, only zstd
+        // is enabled by the rocksdb build of cmake/config.cmake
+        static const std::set<rocksdb::CompressionType> supportedCompressions = {
+            rocksdb::kNoCompression, rocksdb::kZSTD};
+        options.compression = compressions.at(_config.compression);
+        if (!supportedCompressions.count(options.compression))
+        {
+            BOOST_THROW_EXCEPTION(BCOS_ERROR(-1, "The compression " + _config.compression +
+                                                     " of column family " + _config.name +
+                                                     " is not supported by rocksdb!"));
+        }
 
-        return std::make_shared<bcos::storage::RocksDBStorage>(std::unique_ptr<rocksdb::DB>(db));
+        if (_config.compaction == "universal")
+        {
+            options.compaction_style = rocksdb::kCompactionStyleUniversal;
+        }
+        else
+        {
+            options.compaction_style = rocksdb::kCompactionStyleLevel;
+            options.level_compaction_dynamic_level_bytes = true;
+        }
+        return options;
     }
 };
-}  // namespace bcos::initializer
\ No newline at end of file
+}  // namespace bcos::initializer
@@ -47,6 +47,10 @@ TxPoolInitializer::TxPoolInitializer(bcos::tool::NodeConfig::Ptr _nodeConfig,
         m_nodeConfig->notifyWorkerNum(), m_nodeConfig->verifierWorkerNum());
     auto txpoolConfig = m_txpool->txpoolConfig();
     txpoolConfig->setPoolLimit(m_nodeConfig->txpoolLimit());
+    auto syncConfig = m_txpool->transactionSync()->config();
+    syncConfig->setCompactTxsStatus(m_nodeConfig->compactTxsStatus());
+    syncConfig->setReconcileTxs(m_nodeConfig->reconcileTxs());
+    syncConfig->setReconcileInterval(m_nodeConfig->reconcileInterval());
 }
 
 void TxPoolInitializer::init(bcos::sealer::SealerInterface::Ptr _sealer)
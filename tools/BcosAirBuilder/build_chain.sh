@@ -731,12 +731,18 @@ generate_common_ini() {
 [consensus]
     ; min block generation time(ms)
     min_seal_time=500
+    ; broadcast the proposals with short transaction ids, requires all consensus nodes to support it
+    compact_proposal=false
+    ; append the committed proposals to a write-ahead log with batched fsync
+    enable_wal=false
 
 [executor]
     ; use the wasm virtual machine or not
     is_wasm=${wasm_mode}
     is_auth_check=${auth_mode}
     auth_admin_account=${auth_admin_account}
+    ; the stack size of the coroutines executing the transactions(KB), 0 means the default
+    coroutine_stack_size=0
 
 [storage]
     data_path=data
@@ -746,6 +752,11 @@ generate_common_ini() {
     limit=15000
     notify_worker_num=2
     verify_worker_num=2
+    ; announce the transactions to the peers with short ids
+    compact_txs_status=true
+    ; reconcile the txpool with a peer every reconcile_interval ms instead of forwarding txs status
+    reconcile_txs=false
+    reconcile_interval=1000
 [log]
     enable=true
     log_path=./log